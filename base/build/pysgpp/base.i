@@ -85,11 +85,14 @@ namespace std {
 %include "base/src/sgpp/base/grid/storage/hashmap/SerializationVersion.hpp"
 %ignore sgpp::base::HashGridPoint::operator=;
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridPoint.hpp"
+%include "base/src/sgpp/base/grid/storage/hashmap/FlatGridIndex.hpp"
 %ignore sgpp::base::HashGridStorage::operator=;
 %ignore sgpp::base::HashGridStorage::operator[];
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridStorage.hpp"
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridIterator.hpp"
 %include "base/src/sgpp/base/grid/GridStorage.hpp"
+%newobject sgpp::base::BinaryGridFile::createGrid;
+%include "base/src/sgpp/base/grid/storage/hashmap/BinaryGridFile.hpp"
 
 %include "base/src/sgpp/base/grid/generation/functors/RefinementFunctor.hpp"
 %include "base/src/sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp"
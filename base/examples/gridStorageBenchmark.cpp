@@ -0,0 +1,113 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/**
+ * \page example_gridStorageBenchmark_cpp Grid storage backends
+ *
+ * This example compares the two index structures of sgpp::base::HashGridStorage,
+ * the default std::unordered_map and the open-addressing sgpp::base::FlatGridIndex.
+ * For both backends, we measure the time needed to generate a regular grid, to look up
+ * the sequence numbers of all grid points and of their (mostly missing) children,
+ * and to refine the grid.
+ */
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridPoint;
+using sgpp::base::GridStorage;
+using sgpp::base::HashGridStorageBackend;
+using sgpp::base::RegularGridConfiguration;
+using sgpp::base::SGppStopwatch;
+using sgpp::base::SurplusRefinementFunctor;
+
+/**
+ * We run the same workload for a given backend and print the timings.
+ */
+void runBenchmark(HashGridStorageBackend backend, const std::string& name, size_t dim,
+                  int level) {
+  RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = dim;
+  gridConfig.level_ = level;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+  gridConfig.storageBackend_ = backend;
+
+  SGppStopwatch stopwatch;
+
+  /**
+   * The regular grid is generated point by point through the storage's insert method.
+   */
+  stopwatch.start();
+  std::unique_ptr<Grid> grid(Grid::createGrid(gridConfig));
+  grid->getGenerator().regular(level);
+  GridStorage& storage = grid->getStorage();
+  double timeGenerate = stopwatch.stop();
+
+  /**
+   * Lookups of the grid points themselves and of their left children in each dimension.
+   */
+  stopwatch.start();
+  size_t checksum = 0;
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    GridPoint point(storage[i]);
+    checksum += storage.getSequenceNumber(point);
+
+    for (size_t d = 0; d < dim; d++) {
+      GridPoint::level_type l;
+      GridPoint::index_type idx;
+      point.get(d, l, idx);
+      point.getLeftChild(d);
+      checksum += storage.isContaining(point) ? 1 : 0;
+      point.set(d, l, idx);
+    }
+  }
+
+  double timeLookup = stopwatch.stop();
+
+  /**
+   * One refinement step, refining the points with the largest coefficients.
+   * The coefficients are pairwise distinct, so both backends refine the same points.
+   */
+  DataVector alpha(storage.getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i);
+  }
+
+  stopwatch.start();
+  SurplusRefinementFunctor functor(alpha, storage.getSize() / 100 + 1);
+  grid->getGenerator().refine(functor);
+  double timeRefine = stopwatch.stop();
+
+  std::cout << std::setw(14) << name << std::setw(10) << storage.getSize() << std::setw(14)
+            << timeGenerate << std::setw(14) << timeLookup << std::setw(14) << timeRefine
+            << "   (checksum " << checksum << ")" << std::endl;
+}
+
+int main() {
+  /**
+   * A 10-dimensional regular grid of level 7 has about 10^6 points.
+   */
+  const size_t dim = 10;
+  const int level = 7;
+
+  std::cout << std::setw(14) << "backend" << std::setw(10) << "points" << std::setw(14)
+            << "generate [s]" << std::setw(14) << "lookup [s]" << std::setw(14) << "refine [s]"
+            << std::endl;
+  runBenchmark(HashGridStorageBackend::UnorderedMap, "unordered_map", dim, level);
+  runBenchmark(HashGridStorageBackend::OpenAddressing, "open-address", dim, level);
+
+  return 0;
+}
@@ -0,0 +1,103 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/**
+ * \page example_multipleEvalScaling_cpp Scaling of the transposed multiple evaluation
+ *
+ * This example measures the strong scaling of the transposed multiple evaluation
+ * (OperationMultipleEval::multTranspose, which uses
+ * sgpp::base::AlgorithmMultipleEvaluation::mult_transpose for linear grids)
+ * from one thread up to the maximum number of OpenMP threads.
+ */
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::OperationMultipleEval;
+using sgpp::base::SGppStopwatch;
+
+int main() {
+  /**
+   * We create a regular grid and a random data set.
+   */
+  const size_t dim = 6;
+  const int level = 7;
+  const size_t numberDataPoints = 5000;
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+
+  DataMatrix dataset(numberDataPoints, dim);
+  DataVector source(numberDataPoints);
+  DataVector result(grid->getSize());
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset.set(j, t, distribution(generator));
+    }
+
+    source[j] = distribution(generator);
+  }
+
+  std::cout << "grid points: " << grid->getSize() << ", data points: " << numberDataPoints
+            << std::endl;
+
+  /**
+   * We run multTranspose with an increasing number of threads.
+   * The speedup is relative to the run with one thread.
+   */
+  int maxThreads = 1;
+#ifdef _OPENMP
+  maxThreads = omp_get_max_threads();
+#endif
+
+  std::unique_ptr<OperationMultipleEval> opEval(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+  SGppStopwatch stopwatch;
+  double timeOneThread = 0.0;
+
+  std::cout << std::setw(8) << "threads" << std::setw(14) << "time [s]" << std::setw(10)
+            << "speedup" << std::setw(18) << "checksum" << std::endl;
+
+  for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+#ifdef _OPENMP
+    omp_set_num_threads(numThreads);
+#endif
+    stopwatch.start();
+    opEval->multTranspose(source, result);
+    const double time = stopwatch.stop();
+
+    if (numThreads == 1) {
+      timeOneThread = time;
+    }
+
+    std::cout << std::setw(8) << numThreads << std::setw(14) << time << std::setw(10)
+              << timeOneThread / time << std::setw(18) << result.sum() << std::endl;
+
+    // also measure the maximum number of threads if it is not a power of two
+    if ((numThreads < maxThreads) && (2 * numThreads > maxThreads)) {
+      numThreads = maxThreads / 2;
+    }
+  }
+
+  return 0;
+}
@@ -157,6 +157,60 @@ class AlgorithmDGEMV {
       }
     }
   }
+
+  /**
+   * Performs the DGEMV Operation on the grid having a transposed matrix for several
+   * coefficient vectors at once
+   *
+   * The affected basis functions are determined only once per data point, their values are
+   * then applied to all coefficient vectors with SIMD loops over the columns.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points, one coefficient vector per column
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the results, one column per coefficient vector (#data points x #vectors)
+   */
+  void mult(GridStorage& storage, BASIS& basis, const DataMatrix& source,
+            DataMatrix& x, DataMatrix& result) {
+    typedef std::vector<std::pair<size_t, double> > IndexValVector;
+
+    const size_t numberOfVectors = source.getNcols();
+    const size_t result_size = x.getNrows();
+
+    result.resizeRowsCols(result_size, numberOfVectors);
+    result.setAll(0.0);
+
+    #pragma omp parallel
+    {
+      DataVector line(x.getNcols());
+      IndexValVector vec;
+
+      GetAffectedBasisFunctions<BASIS> ga(storage);
+
+      #pragma omp for schedule (static)
+
+      for (size_t i = 0; i < result_size; i++) {
+        vec.clear();
+
+        x.getRow(i, line);
+
+        ga(basis, line, vec);
+
+        double* resultRow = result.getPointer() + i * numberOfVectors;
+
+        for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
+          const double* sourceRow = source.getPointer() + iter->first * numberOfVectors;
+          const double value = iter->second;
+
+          #pragma omp simd
+          for (size_t j = 0; j < numberOfVectors; j++) {
+            resultRow[j] += value * sourceRow[j];
+          }
+        }
+      }
+    }
+  }
 };
 
 }  // namespace base
@@ -46,6 +46,23 @@ class AlgorithmEvaluationTransposed {
    * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
    */
   void operator()(BASIS& basis, const DataVector& point, double alpha, DataVector& result) {
+    AddToVector accumulator(result);
+    traverse(basis, point, alpha, accumulator);
+  }
+
+  /**
+   * Passes the weighted evaluations of all basis functions that are non-zero at a given
+   * evaluation point to an accumulator instead of adding them to a vector.
+   * For a given evaluation point \f$x\f$, accumulator(i, alpha * \f$\phi_i(x)\f$) is called
+   * for all basis functions that are non-zero.
+   *
+   * @param basis a sparse grid basis
+   * @param point evaluation point within the domain
+   * @param alpha the coefficient of the regarded ansatzfunction
+   * @param accumulator callable object with signature void(size_t seq, double value)
+   */
+  template <class ACCUMULATOR>
+  void traverse(BASIS& basis, const DataVector& point, double alpha, ACCUMULATOR& accumulator) {
     GridStorage::grid_iterator working(storage);
 
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
@@ -76,13 +93,26 @@ class AlgorithmEvaluationTransposed {
       }
     }
 
-    rec(basis, newPoint, 0, 1.0, working, source, alpha, result);
+    rec(basis, newPoint, 0, 1.0, working, source, alpha, accumulator);
     delete[] source;
   }
 
  protected:
   GridStorage& storage;
 
+  /**
+   * Accumulator that adds the contributions to a vector.
+   */
+  class AddToVector {
+   public:
+    explicit AddToVector(DataVector& result) : result(result) {}
+
+    inline void operator()(size_t seq, double value) { result[seq] += value; }
+
+   protected:
+    DataVector& result;
+  };
+
   /**
    * Recursive traversal of the "tree" of basis functions for evaluation, used in operator().
    * For a given evaluation point \f$x\f$, it stores tuples (std::pair) of
@@ -95,12 +125,13 @@ class AlgorithmEvaluationTransposed {
    * @param working iterator working on the GridStorage of the basis
    * @param source array of indices for each dimension (identifying the indices of the current grid point)
    * @param alpha the coefficient of current ansatzfunction
-   * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
+   * @param accumulator callable object that receives the local support of the given ansatzfuction for all evaluations points
    */
+  template <class ACCUMULATOR>
   void rec(BASIS& basis, DataVector& point, size_t current_dim,
            double value, GridStorage::grid_iterator& working,
            index_t* source, double alpha,
-           DataVector& result) {
+           ACCUMULATOR& accumulator) {
     const unsigned int BITS_IN_BYTE = 8;
     // maximum possible level for the index type
     const level_t max_level = static_cast<level_t>(sizeof(index_t) * BITS_IN_BYTE - 1);
@@ -125,9 +156,9 @@ class AlgorithmEvaluationTransposed {
         const double new_value = basis.eval(work_level, work_index, point[current_dim]) * value;
 
         if (current_dim == storage.getDimension() - 1) {
-          result[seq] += alpha * new_value;
+          accumulator(seq, alpha * new_value);
         } else {
-          rec(basis, point, current_dim + 1, new_value, working, source, alpha, result);
+          rec(basis, point, current_dim + 1, new_value, working, source, alpha, accumulator);
           if (!hint) working.resetToLevelOne(current_dim+1);
         }
       }
@@ -15,8 +15,14 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -35,9 +41,21 @@ namespace base {
 template <class BASIS>
 class AlgorithmMultipleEvaluation {
  public:
+  /// number of data points a thread processes per round of mult_transpose
+  static const size_t CHUNK_SIZE = 32;
+
   /**
    * Performs a transposed mass evaluation
    *
+   * The data points are processed in rounds. In each round, every thread traverses
+   * the grid for the next CHUNK_SIZE data points and sorts the contributions into one
+   * buffer per thread, depending on which thread owns the receiving grid point
+   * (the grid points are split into contiguous ranges of sequence numbers).
+   * After a barrier, every thread adds the contributions destined for its own range
+   * to the result. This way, no thread needs a private copy of the result vector and
+   * no critical section is required. For a fixed number of threads, the order of
+   * the summation (and thus the result) is deterministic.
+   *
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
    * @param source the coefficients of the grid points
@@ -47,54 +65,69 @@ class AlgorithmMultipleEvaluation {
   void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source, DataMatrix& x,
                       DataVector& result) {
     result.setAll(0.0);
-    size_t source_size = source.getSize();
+    const size_t source_size = source.getSize();
+    const size_t result_size = result.getSize();
+
+    // contributions[producer][owner]
+    std::vector<std::vector<ContributionList>> contributions;
 
 #pragma omp parallel
     {
-      DataVector privateResult(result.getSize());
-      privateResult.setAll(0.0);
-
-      DataVector line(x.getNcols());
-      AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
-
-      privateResult.setAll(0.0);
-
-#pragma omp for schedule(static)
-
-      for (size_t i = 0; i < source_size; i++) {
-        x.getRow(i, line);
-
-        AlgoEvalTrans(basis, line, source[i], privateResult);
+      size_t numThreads = 1;
+      size_t threadId = 0;
+#ifdef _OPENMP
+      numThreads = static_cast<size_t>(omp_get_num_threads());
+      threadId = static_cast<size_t>(omp_get_thread_num());
+#endif
+
+#pragma omp single
+      { contributions.assign(numThreads, std::vector<ContributionList>(numThreads)); }
+
+      if (numThreads == 1) {
+        // nothing to distribute, add the contributions directly
+        DataVector line(x.getNcols());
+        AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
+
+        for (size_t i = 0; i < source_size; i++) {
+          x.getRow(i, line);
+          AlgoEvalTrans(basis, line, source[i], result);
+        }
+      } else {
+        const size_t rangeSize = std::max<size_t>((result_size + numThreads - 1) / numThreads, 1);
+        std::vector<ContributionList>& ownContributions = contributions[threadId];
+        DataVector line(x.getNcols());
+        AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
+        SortIntoRanges sortIntoRanges(ownContributions, rangeSize);
+
+        for (size_t roundStart = 0; roundStart < source_size;
+             roundStart += numThreads * CHUNK_SIZE) {
+          const size_t chunkStart = std::min(roundStart + threadId * CHUNK_SIZE, source_size);
+          const size_t chunkEnd = std::min(chunkStart + CHUNK_SIZE, source_size);
+
+          for (size_t i = chunkStart; i < chunkEnd; i++) {
+            x.getRow(i, line);
+            AlgoEvalTrans.traverse(basis, line, source[i], sortIntoRanges);
+          }
+
+#pragma omp barrier
+
+          for (size_t producer = 0; producer < numThreads; producer++) {
+            const ContributionList& list = contributions[producer][threadId];
+
+            for (size_t k = 0; k < list.size(); k++) {
+              result[list[k].first] += list[k].second;
+            }
+          }
+
+#pragma omp barrier
+
+          for (size_t owner = 0; owner < numThreads; owner++) {
+            ownContributions[owner].clear();
+          }
+        }
       }
-
-#pragma omp critical
-      { result.add(privateResult); }
     }
   }
-  // implementation requires OpenMP 4.0 support
-  //        void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source,
-  //                            DataMatrix& x, DataVector& result) {
-  //          result.setAll(0.0);
-  //          size_t source_size = source.getSize();
-  //
-  //          #pragma omp declare reduction(accumulate :
-  // ...      sgpp::base::DataVector : omp_out.add(omp_in))
-  // ...      initializer ( omp_priv = DataVector(omp_orig.getSize(), 0))
-  //
-  //          #pragma omp parallel
-  //          {
-  //            DataVector line(x.getNcols());
-  //            AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
-  //
-  //            #pragma omp for reduction(accumulate:result) schedule(static)
-  //
-  //            for (size_t i = 0; i < source_size; i++) {
-  //              x.getRow(i, line);
-  //
-  //              AlgoEvalTrans(basis, line, source[i], result);
-  //            }
-  //          }
-  //        }
 
   /**
    * Performs a mass evaluation
@@ -124,8 +157,97 @@ class AlgorithmMultipleEvaluation {
       }
     }
   }
+
+  /**
+   * Performs a mass evaluation for several coefficient vectors at once
+   *
+   * The grid is traversed only once per data point, the values of the affected basis functions
+   * are then applied to all coefficient vectors with SIMD loops over the columns.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points, one coefficient vector per column
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the results, one column per coefficient vector (#data points x #vectors)
+   */
+  void mult(GridStorage& storage, BASIS& basis, DataMatrix& source, DataMatrix& x,
+            DataMatrix& result) {
+    const size_t numberOfVectors = source.getNcols();
+    const size_t result_size = x.getNrows();
+
+    result.resizeRowsCols(result_size, numberOfVectors);
+    result.setAll(0.0);
+
+#pragma omp parallel
+    {
+      DataVector line(x.getNcols());
+      AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
+      ContributionList basisValues;
+      AppendToList appendToList(basisValues);
+
+#pragma omp for schedule(static)
+
+      for (size_t i = 0; i < result_size; i++) {
+        x.getRow(i, line);
+        basisValues.clear();
+        AlgoEvalTrans.traverse(basis, line, 1.0, appendToList);
+
+        double* resultRow = result.getPointer() + i * numberOfVectors;
+
+        for (size_t k = 0; k < basisValues.size(); k++) {
+          const double* sourceRow = source.getPointer() + basisValues[k].first * numberOfVectors;
+          const double value = basisValues[k].second;
+
+#pragma omp simd
+          for (size_t j = 0; j < numberOfVectors; j++) {
+            resultRow[j] += value * sourceRow[j];
+          }
+        }
+      }
+    }
+  }
+
+ protected:
+  /// list of (sequence number, value) contributions to the result of mult_transpose
+  typedef std::vector<std::pair<size_t, double>> ContributionList;
+
+  /**
+   * Accumulator for AlgorithmEvaluationTransposed that collects the contributions in a list.
+   */
+  class AppendToList {
+   public:
+    explicit AppendToList(ContributionList& list) : list(list) {}
+
+    inline void operator()(size_t seq, double value) {
+      list.push_back(std::make_pair(seq, value));
+    }
+
+   protected:
+    ContributionList& list;
+  };
+
+  /**
+   * Accumulator for AlgorithmEvaluationTransposed that sorts the contributions
+   * by the thread owning the receiving grid point.
+   */
+  class SortIntoRanges {
+   public:
+    SortIntoRanges(std::vector<ContributionList>& lists, size_t rangeSize)
+        : lists(lists), rangeSize(rangeSize) {}
+
+    inline void operator()(size_t seq, double value) {
+      lists[seq / rangeSize].push_back(std::make_pair(seq, value));
+    }
+
+   protected:
+    std::vector<ContributionList>& lists;
+    size_t rangeSize;
+  };
 };
 
+template <class BASIS>
+const size_t AlgorithmMultipleEvaluation<BASIS>::CHUNK_SIZE;
+
 }  // namespace base
 }  // namespace sgpp
 
@@ -10,6 +10,7 @@
 
 #include <exception>
 #include <cstddef>
+#include <string>
 
 
 namespace sgpp {
@@ -29,6 +30,15 @@ class data_exception : public std::exception {
   explicit data_exception(const char* msg) noexcept : msg(msg) {
   }
 
+  /**
+   * Create a new exception (constructor) with a message that is composed at runtime, e.g., that
+   * contains a file name. The exception keeps its own copy of the message.
+   *
+   * @param msg The exception message
+   */
+  explicit data_exception(const std::string& msg) : stringMsg(msg), msg(nullptr) {
+  }
+
   /**
    * Create default exception (constructor).
    */
@@ -47,12 +57,16 @@ class data_exception : public std::exception {
   const char* what() const noexcept override {
     if (msg) {
       return msg;
+    } else if (!stringMsg.empty()) {
+      return stringMsg.c_str();
     } else {
       return "data_exception: general failure";
     }
   }
 
  protected:
+  /// the exception message composed at runtime
+  std::string stringMsg;
   /// the exception message
   const char* msg;
 };
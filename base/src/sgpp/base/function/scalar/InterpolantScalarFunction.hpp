@@ -7,15 +7,20 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/base/function/scalar/ScalarFunction.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 
+#include <atomic>
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -47,7 +52,8 @@ class InterpolantScalarFunction : public ScalarFunction {
       : ScalarFunction(grid.getDimension()),
         grid(grid),
         opEval(op_factory::createOperationEvalNaive(grid)),
-        alpha(alpha) {}
+        alpha(alpha),
+        multipleEvalSupported(true) {}
 
   /**
    * Destructor.
@@ -70,6 +76,56 @@ class InterpolantScalarFunction : public ScalarFunction {
     return opEval->eval(alpha, x);
   }
 
+  /**
+   * Batched evaluation of the function.
+   * The points are evaluated at once with OperationMultipleEval
+   * (vectorized and parallelized over the points) if the grid type supports it,
+   * otherwise the points are evaluated in parallel one by one.
+   *
+   * @param      x      matrix \f$\vec{x} \in [0, 1]^{N \times d}\f$
+   *                    of evaluation points (row-wise)
+   * @param[out] value  \f$(f(\vec{x}_k))_k\f$
+   *                    where \f$\vec{x}_k\f$ is the \f$k\f$-th row of \f$x\f$
+   */
+  void eval(const DataMatrix& x, DataVector& value) override {
+    const size_t N = x.getNrows();
+
+    if ((N <= 1) || !multipleEvalSupported.load(std::memory_order_relaxed)) {
+      ScalarFunction::eval(x, value);
+      return;
+    }
+
+    // OperationMultipleEval must not be called with points outside of the domain,
+    // their value is set to infinity as in eval(const DataVector&)
+    for (size_t k = 0; k < N; k++) {
+      if (!isInDomain(x, k)) {
+        evalInDomain(x, value);
+        return;
+      }
+    }
+
+    // the operation may modify the dataset (e.g., padding)
+    DataMatrix dataset(x);
+    std::unique_ptr<OperationMultipleEval> opMultipleEval;
+
+    try {
+      opMultipleEval.reset(op_factory::createOperationMultipleEval(grid, dataset));
+    } catch (const factory_exception&) {
+      // remember that the grid type is not supported
+      multipleEvalSupported.store(false, std::memory_order_relaxed);
+      ScalarFunction::eval(x, value);
+      return;
+    }
+
+    value.resize(N);
+    opMultipleEval->mult(alpha, value);
+  }
+
+  /**
+   * @return true, the clones do not share state
+   */
+  bool supportsParallelEval() const override { return true; }
+
   /**
    * @param[out] clone pointer to cloned object
    */
@@ -94,6 +150,9 @@ class InterpolantScalarFunction : public ScalarFunction {
   std::unique_ptr<OperationEval> opEval;
   /// coefficient vector
   DataVector alpha;
+  /// whether OperationMultipleEval is implemented for the grid type
+  /// (atomic, as eval might be called concurrently)
+  std::atomic<bool> multipleEvalSupported;
 };
 }  // namespace base
 }  // namespace sgpp
@@ -9,8 +9,14 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
 #include <cstddef>
+#include <limits>
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -43,7 +49,12 @@ class ScalarFunction {
   virtual double eval(const DataVector& x) = 0;
 
   /**
-   * Convenience method for calculating \f$f(\vec{x})\f$ for multiple \f$\vec{x}\f$.
+   * Calculate \f$f(\vec{x})\f$ for multiple \f$\vec{x}\f$ (batched evaluation).
+   * The standard implementation evaluates the points one by one. If the function supports
+   * parallel evaluation (see supportsParallelEval()), the points are evaluated in parallel,
+   * where every thread except the master thread uses its own clone of the function.
+   * Derived classes may override this method with a more efficient implementation
+   * (e.g., InterpolantScalarFunction).
    *
    * @param      x      matrix \f$\vec{x} \in [0, 1]^{N \times d}\f$
    *                    of evaluation points (row-wise)
@@ -52,15 +63,89 @@ class ScalarFunction {
    */
   virtual void eval(const DataMatrix& x, DataVector& value) {
     const size_t N = x.getNrows();
-    DataVector xk(d);
+    value.resize(N);
+
+#pragma omp parallel if ((N > 1) && supportsParallelEval())
+    {
+      DataVector xk(d);
+      ScalarFunction* curFPtr = this;
+#ifdef _OPENMP
+      std::unique_ptr<ScalarFunction> curF;
+
+      if (omp_get_thread_num() > 0) {
+        clone(curF);
+        curFPtr = curF.get();
+      }
+
+#endif /* _OPENMP */
+
+#pragma omp for schedule(dynamic)
+      for (size_t k = 0; k < N; k++) {
+        x.getRow(k, xk);
+        value[k] = curFPtr->eval(xk);
+      }
+    }
+  }
+
+  /**
+   * Batched evaluation (see eval(const DataMatrix&, DataVector&)) of the points
+   * in \f$[0, 1]^d\f$. The points outside of the domain are not evaluated,
+   * their value is set to infinity (e.g., for optimizers that generate such points).
+   *
+   * @param      x      matrix \f$\vec{x} \in \mathbb{R}^{N \times d}\f$
+   *                    of evaluation points (row-wise)
+   * @param[out] value  \f$(f(\vec{x}_k))_k\f$
+   *                    where \f$\vec{x}_k\f$ is the \f$k\f$-th row of \f$x\f$
+   *                    (infinity if \f$\vec{x}_k \notin [0, 1]^d\f$)
+   */
+  void evalInDomain(const DataMatrix& x, DataVector& value) {
+    const size_t N = x.getNrows();
+    std::vector<size_t> pointsInDomain;
+    pointsInDomain.reserve(N);
     value.resize(N);
 
     for (size_t k = 0; k < N; k++) {
-      x.getRow(k, xk);
-      value[k] = eval(xk);
+      if (isInDomain(x, k)) {
+        pointsInDomain.push_back(k);
+      } else {
+        value[k] = std::numeric_limits<double>::infinity();
+      }
+    }
+
+    if (pointsInDomain.size() == N) {
+      eval(x, value);
+      return;
+    } else if (pointsInDomain.empty()) {
+      return;
+    }
+
+    DataMatrix xInDomain(pointsInDomain.size(), d);
+    DataVector valueInDomain(pointsInDomain.size());
+
+    for (size_t k = 0; k < pointsInDomain.size(); k++) {
+      for (size_t t = 0; t < d; t++) {
+        xInDomain(k, t) = x(pointsInDomain[k], t);
+      }
+    }
+
+    eval(xInDomain, valueInDomain);
+
+    for (size_t k = 0; k < pointsInDomain.size(); k++) {
+      value[pointsInDomain[k]] = valueInDomain[k];
     }
   }
 
+  /**
+   * Whether clones of the function (see clone()) may be evaluated concurrently by different
+   * threads, which is used by the batched evaluation. The default is false, as the evaluation
+   * might access shared state (e.g., functions implemented in Python via SWIG must not be
+   * evaluated concurrently). Derived classes override this method if their clones are
+   * independent.
+   *
+   * @return whether clones of the function may be evaluated in parallel
+   */
+  virtual bool supportsParallelEval() const { return false; }
+
   /**
    * @return dimension \f$d\f$ of the domain
    */
@@ -79,6 +164,21 @@ class ScalarFunction {
  protected:
   /// dimension of the domain
   size_t d;
+
+  /**
+   * @param x matrix of points (row-wise)
+   * @param k row index
+   * @return whether the \f$k\f$-th row of \f$x\f$ is in \f$[0, 1]^d\f$
+   */
+  static bool isInDomain(const DataMatrix& x, size_t k) {
+    for (size_t t = 0; t < x.getNcols(); t++) {
+      if ((x(k, t) < 0.0) || (x(k, t) > 1.0)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
 };
 }  // namespace base
 }  // namespace sgpp
@@ -49,6 +49,12 @@ class ScaledScalarFunction : public ScalarFunction {
         new ScaledScalarFunction(*fOrig, lowerBounds, upperBounds, valueFactor));
   }
 
+  /**
+   * @return whether the underlying function supports parallel evaluation
+   *         (the clones clone the underlying function)
+   */
+  bool supportsParallelEval() const override { return fOrig->supportsParallelEval(); }
+
   const DataVector& getLowerBounds() const { return lowerBounds; }
   void setLowerBounds(const DataVector& lowerBounds) { this->lowerBounds = lowerBounds; }
 
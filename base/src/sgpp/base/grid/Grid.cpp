@@ -199,7 +199,7 @@ Grid* Grid::createFundamentalNakSplineBoundaryGrid(
   return new FundamentalNakSplineBoundaryGrid(dim, degree, boundaryLevel);
 }
 
-Grid* Grid::createGrid(RegularGridConfiguration gridConfig) {
+static Grid* createGridOfConfiguredType(const RegularGridConfiguration& gridConfig) {
   if (gridConfig.filename_.length() > 0) {
     std::ifstream ifs(gridConfig.filename_);
     std::string content((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
@@ -211,7 +211,7 @@ Grid* Grid::createGrid(RegularGridConfiguration gridConfig) {
       case GridType::LinearStretched:
         return Grid::createLinearStretchedGrid(gridConfig.dim_);
       case GridType::LinearL0Boundary:
-        return Grid::createLinearBoundaryGrid(gridConfig.dim_);
+        return Grid::createLinearBoundaryGrid(gridConfig.dim_, 0);
       case GridType::LinearBoundary:
         return Grid::createLinearBoundaryGrid(gridConfig.dim_, gridConfig.boundaryLevel_);
       case GridType::LinearStretchedBoundary:
@@ -270,7 +270,7 @@ Grid* Grid::createGrid(RegularGridConfiguration gridConfig) {
       case GridType::ModBsplineClenshawCurtis:
         return Grid::createModBsplineClenshawCurtisGrid(gridConfig.dim_, gridConfig.maxDegree_);
       case GridType::LinearStencil:
-        return Grid::createLinearStretchedGrid(gridConfig.dim_);
+        return Grid::createLinearGridStencil(gridConfig.dim_);
       case GridType::ModLinearStencil:
         return Grid::createModLinearGridStencil(gridConfig.dim_);
       case GridType::NakBsplineBoundaryCombigrid:
@@ -304,6 +304,12 @@ Grid* Grid::createGrid(RegularGridConfiguration gridConfig) {
   throw generation_exception("Grid::createGrid - grid type not known");
 }
 
+Grid* Grid::createGrid(RegularGridConfiguration gridConfig) {
+  Grid* grid = createGridOfConfiguredType(gridConfig);
+  grid->getStorage().setBackend(gridConfig.storageBackend_);
+  return grid;
+}
+
 Grid* Grid::createGridOfEquivalentType(size_t numDims) {
   Grid* newGrid = nullptr;
 
@@ -317,7 +323,7 @@ Grid* Grid::createGridOfEquivalentType(size_t numDims) {
       newGrid = Grid::createLinearStretchedGrid(numDims);
       break;
     case GridType::LinearL0Boundary:
-      newGrid = Grid::createLinearBoundaryGrid(numDims);
+      newGrid = Grid::createLinearBoundaryGrid(numDims, 0);
       break;
     case GridType::LinearBoundary:
       boundaryLevel =
@@ -411,7 +417,7 @@ Grid* Grid::createGridOfEquivalentType(size_t numDims) {
       newGrid = Grid::createModBsplineClenshawCurtisGrid(numDims, degree);
       break;
     case GridType::LinearStencil:
-      newGrid = Grid::createLinearStretchedGrid(numDims);
+      newGrid = Grid::createLinearGridStencil(numDims);
       break;
     case GridType::ModLinearStencil:
       newGrid = Grid::createModLinearGridStencil(numDims);
@@ -99,6 +99,8 @@ struct GeneralGridConfiguration {
   std::string filename_;
   /// subgrid selection value t
   double t_ = 0.0;
+  /// index structure of the grid storage
+  HashGridStorageBackend storageBackend_ = HashGridStorageBackend::UnorderedMap;
   /// virtual destructor, since GeneralGridConfiguration is used as base class
   virtual ~GeneralGridConfiguration() {}
 };
@@ -71,6 +71,16 @@ class RefinementFunctor {
    */
   virtual double getRefinementThreshold() const = 0;
 
+  /**
+   * Returns whether the functor can be evaluated by several threads concurrently, e.g., when the
+   * refinement computes the indicators of the grid points in parallel.
+   *
+   * @return whether operator() is thread-safe. Default value: false.
+   */
+  virtual bool isThreadSafe() const {
+    return false;
+  }
+
   /**
    * Returns the total sum of local (error) indicators used for refinement
    *
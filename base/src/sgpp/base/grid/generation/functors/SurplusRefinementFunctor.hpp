@@ -43,6 +43,8 @@ class SurplusRefinementFunctor : public RefinementFunctor {
 
   double getRefinementThreshold() const override;
 
+  bool isThreadSafe() const override;
+
  protected:
   /// pointer to the vector that stores the alpha values
   DataVector& alpha;
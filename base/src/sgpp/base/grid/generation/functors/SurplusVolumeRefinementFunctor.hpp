@@ -45,6 +45,8 @@ class SurplusVolumeRefinementFunctor : public RefinementFunctor {
 
   double getRefinementThreshold() const override;
 
+  bool isThreadSafe() const override;
+
  protected:
   /// pointer to the vector that stores the alpha values
   DataVector& alpha;
@@ -25,5 +25,9 @@ void ANOVAHashRefinement::refineGridpoint(GridStorage& storage, size_t refine_in
     }
   }
 }
+
+bool ANOVAHashRefinement::isThreadSafe() const {
+  return true;
+}
 }  // namespace base
 }  // namespace sgpp
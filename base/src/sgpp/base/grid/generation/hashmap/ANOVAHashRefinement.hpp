@@ -28,6 +28,13 @@ class ANOVAHashRefinement : public HashRefinement {
      * @param refine_index The index in the hashmap of the point that should be refined
      */
   virtual void refineGridpoint(GridStorage& storage, size_t refine_index);
+
+  /**
+   * The refinement indicators are computed as by HashRefinement.
+   *
+   * @return true
+   */
+  bool isThreadSafe() const override;
 };
 }  // namespace base
 }  // namespace sgpp
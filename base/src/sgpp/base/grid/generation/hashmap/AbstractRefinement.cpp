@@ -64,8 +64,6 @@ void AbstractRefinement::refineGridpoint1D(GridStorage& storage, size_t seq,
 }*/
 
 bool AbstractRefinement::isRefinable(GridStorage& storage, GridPoint& point) {
-  GridStorage::grid_map_iterator child_iter;
-
   if (point.isLeaf()) return true;
 
   for (size_t d = 0; d < storage.getDimension(); d++) {
@@ -75,18 +73,14 @@ bool AbstractRefinement::isRefinable(GridStorage& storage, GridPoint& point) {
 
     // test existence of left child
     point.set(d, source_level + 1, 2 * source_index - 1);
-    child_iter = storage.find(&point);
-
     // if there no more grid points --> test if we should refine the grid
-    if (child_iter == storage.end()) {
+    if (!storage.isContaining(point)) {
       return true;
     }
 
     // test existance of right child
     point.set(d, source_level + 1, 2 * source_index + 1);
-    child_iter = storage.find(&point);
-
-    if (child_iter == storage.end()) {
+    if (!storage.isContaining(point)) {
       return true;
     }
 
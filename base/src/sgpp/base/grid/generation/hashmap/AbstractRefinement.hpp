@@ -115,11 +115,18 @@ class AbstractRefinement {
 
   /**
    * Comparison of the refinement_pair_type. This way the priority queue
-   * has the elements with the smallest refinement_value_type on top
+   * has the elements with the smallest refinement_value_type on top.
+   * Equal values are ordered by the sequence number (the larger sequence number
+   * is on top), so the selected elements do not depend on the order they are
+   * added in.
    */
   static bool compare_pairs(const refinement_pair_type& lhs,
                             const refinement_pair_type& rhs)  {
-    return (lhs.second > rhs.second);
+    if (lhs.second != rhs.second) {
+      return (lhs.second > rhs.second);
+    }
+
+    return (lhs.first->getSeq() < rhs.first->getSeq());
   }
 
 
@@ -239,7 +246,7 @@ class AbstractRefinement {
       point.setLeaf(saveLeaf);
     } else {
       // set stored index to false
-      storage.getPoint((storage.find(&point))->second).setLeaf(false);
+      storage.getPoint(storage.getSequenceNumber(point)).setLeaf(false);
     }
   }
 
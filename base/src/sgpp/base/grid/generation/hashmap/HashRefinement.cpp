@@ -10,7 +10,13 @@
 
 #include <vector>
 #include <algorithm>
+#include <exception>
 #include <memory>
+#include <typeinfo>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
 
 
 namespace sgpp {
@@ -18,10 +24,10 @@ namespace base {
 
 void HashRefinement::addElementToCollection(
   const GridStorage::grid_map_iterator& iter,
-  AbstractRefinement::refinement_list_type current_value_list,
+  const AbstractRefinement::refinement_list_type& current_value_list,
   size_t refinements_num,
   AbstractRefinement::refinement_container_type& collection) {
-  for (AbstractRefinement::refinement_list_type::iterator it =
+  for (AbstractRefinement::refinement_list_type::const_iterator it =
          current_value_list.begin();
        it != current_value_list.end(); it++) {
     collection.push_back(*it);
@@ -39,59 +45,106 @@ void HashRefinement::addElementToCollection(
 }
 
 
+bool HashRefinement::isThreadSafe() const {
+  // a SWIG director (or any other subclass) may override the virtual methods called in parallel
+  return typeid(*this) == typeid(HashRefinement);
+}
+
+
 void HashRefinement::collectRefinablePoints(GridStorage& storage,
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
   size_t refinements_num = functor.getRefinementsNum();
 
-  // max value equals min value
-
-  GridPoint point;
+  // the grid_map cannot be split among the threads, so its iterators are gathered first
+  std::vector<GridStorage::grid_map_iterator> iterators;
+  iterators.reserve(storage.getSize());
   GridStorage::grid_map_iterator end_iter = storage.end();
 
-  // start iterating over whole grid
   for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
        iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    // check for each grid point whether it can be refined
-    // (i.e., whether not all kids exist yet)
-    // if yes, check whether it belongs to the refinements_num largest ones
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      // test existence of left child
-      point.set(d, source_level + 1, 2 * source_index - 1);
-      child_iter = storage.find(&point);
+    iterators.push_back(iter);
+  }
 
-      // if there no more grid points --> test if we should refine the grid
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
+  // every thread selects the refinements_num largest indicators of its grid points,
+  // the points are processed by a single thread if the indicators are not thread-safe
+  std::vector<AbstractRefinement::refinement_container_type> threadCollections;
+  std::exception_ptr exception = nullptr;
+  const bool parallel = isThreadSafe() && functor.isThreadSafe();
+
+#pragma omp parallel if (parallel)
+  {
+    size_t numThreads = 1;
+    size_t threadId = 0;
+#ifdef _OPENMP
+    numThreads = static_cast<size_t>(omp_get_num_threads());
+    threadId = static_cast<size_t>(omp_get_thread_num());
+#endif /* _OPENMP */
+
+#pragma omp single
+    { threadCollections.resize(numThreads); }
+
+    AbstractRefinement::refinement_container_type& threadCollection =
+      threadCollections[threadId];
+    GridPoint point;
+
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < iterators.size(); i++) {
+      try {
+        const GridStorage::grid_map_iterator& iter = iterators[i];
+        point = *(iter->first);
+
+        // check for each grid point whether it can be refined
+        // (i.e., whether not all kids exist yet)
+        // if yes, check whether it belongs to the refinements_num largest ones
+        for (size_t d = 0; d < storage.getDimension(); d++) {
+          index_t source_index;
+          level_t source_level;
+          point.get(d, source_level, source_index);
+
+          // test existence of left and right child
+          point.set(d, source_level + 1, 2 * source_index - 1);
+          bool isMissingChild = !storage.isContaining(point);
+
+          if (!isMissingChild) {
+            point.set(d, source_level + 1, 2 * source_index + 1);
+            isMissingChild = !storage.isContaining(point);
+          }
+
+          // if there no more grid points --> test if we should refine the grid
+          if (isMissingChild) {
+            addElementToCollection(iter, getIndicator(storage, iter, functor),
+                                   refinements_num, threadCollection);
+            break;
+          }
+
+          // reset current grid point in dimension d
+          point.set(d, source_level, source_index);
+        }
+      } catch (...) {
+#pragma omp critical
+        exception = std::current_exception();
       }
+    }
+  }
 
-      // test existence of right child
-      point.set(d, source_level + 1, 2 * source_index + 1);
-      child_iter = storage.find(&point);
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
 
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
-      }
+  // merge the candidates of the threads; as compare_pairs breaks ties by the sequence
+  // number, the selected points do not depend on the number of threads
+  for (AbstractRefinement::refinement_container_type& threadCollection :
+       threadCollections) {
+    collection.insert(collection.end(), threadCollection.begin(),
+                      threadCollection.end());
+  }
 
-      // reset current grid point in dimension d
-      point.set(d, source_level, source_index);
-    }
+  std::stable_sort(collection.begin(), collection.end(),
+                   AbstractRefinement::compare_pairs);
+
+  if (collection.size() > refinements_num) {
+    collection.erase(collection.begin() + refinements_num, collection.end());
   }
 }
 
@@ -161,8 +214,6 @@ size_t HashRefinement::getNumberOfRefinablePoints(GridStorage& storage) {
        iter++) {
     point = *(iter->first);
 
-    GridStorage::grid_map_iterator child_iter;
-
     // check for each grid point whether it can be refined
     // (i.e., whether not all children exist yet)
     for (size_t d = 0; d < storage.getDimension(); d++) {
@@ -172,19 +223,15 @@ size_t HashRefinement::getNumberOfRefinablePoints(GridStorage& storage) {
 
       // test existence of the left child
       point.set(d, source_level + 1, 2 * source_index - 1);
-      child_iter = storage.find(&point);
-
       // if there no more grid points --> test if we should refine the grid
-      if (child_iter == end_iter) {
+      if (!storage.isContaining(point)) {
         counter++;
         break;
       }
 
       // test existence of the right child
       point.set(d, source_level + 1, 2 * source_index + 1);
-      child_iter = storage.find(&point);
-
-      if (child_iter == end_iter) {
+      if (!storage.isContaining(point)) {
         counter++;
         break;
       }
@@ -58,6 +58,16 @@ class HashRefinement: public AbstractRefinement {
   void refineGridpoint1D(GridStorage& storage, GridPoint& point, size_t d) override;
   void refineGridpoint1D(GridStorage& storage, size_t seq, size_t d) override;
 
+  /**
+   * Returns whether the refinement indicators of the grid points can be computed by several
+   * threads concurrently, i.e., whether getIndicator() and addElementToCollection() are
+   * thread-safe. Subclasses that override these methods, in particular subclasses implemented in
+   * Python via SWIG directors, are only parallelized if they override this method as well.
+   *
+   * @return true for HashRefinement itself, false for subclasses by default
+   */
+  virtual bool isThreadSafe() const;
+
   ~HashRefinement() override {}
 
 
@@ -119,7 +129,7 @@ class HashRefinement: public AbstractRefinement {
   */
   virtual void addElementToCollection(
     const GridStorage::grid_map_iterator& iter,
-    AbstractRefinement::refinement_list_type current_value_list,
+    const AbstractRefinement::refinement_list_type& current_value_list,
     size_t refinements_num,
     AbstractRefinement::refinement_container_type& collection);
 
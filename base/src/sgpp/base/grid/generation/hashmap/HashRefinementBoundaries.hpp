@@ -135,7 +135,7 @@ class HashRefinementBoundaries: public AbstractRefinement {
   */
   virtual void addElementToCollection(
     const GridStorage::grid_map_iterator& iter,
-    AbstractRefinement::refinement_list_type current_value_list,
+    const AbstractRefinement::refinement_list_type& current_value_list,
     size_t refinements_num,
     AbstractRefinement::refinement_container_type& collection);
 
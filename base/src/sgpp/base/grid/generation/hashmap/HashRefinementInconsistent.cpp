@@ -19,5 +19,9 @@ void HashRefinementInconsistent::createGridpoint(GridStorage& storage, GridPoint
   storage.insert(point);
 }
 
+bool HashRefinementInconsistent::isThreadSafe() const {
+  return true;
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -20,6 +20,14 @@ namespace base {
  * Free refinement class for sparse grids
  */
 class HashRefinementInconsistent: public HashRefinement {
+ public:
+  /**
+   * The refinement indicators are computed as by HashRefinement.
+   *
+   * @return true
+   */
+  bool isThreadSafe() const override;
+
  protected:
   /**
    * This method creates a new point on the grid. It checks if some parents or
@@ -104,10 +104,10 @@ ForwardSelectorRefinement::getIndicator(
 
 void ForwardSelectorRefinement::addElementToCollection(
     const GridStorage::grid_map_iterator& iter,
-    AbstractRefinement::refinement_list_type current_value_list,
+    const AbstractRefinement::refinement_list_type& current_value_list,
     size_t refinementsNum,
     AbstractRefinement::refinement_container_type& collection) {
-  for (AbstractRefinement::refinement_list_type::iterator it =
+  for (AbstractRefinement::refinement_list_type::const_iterator it =
            current_value_list.begin();
        it != current_value_list.end(); it++) {
     collection.push_back(*it);
@@ -121,7 +121,7 @@ class ImpurityRefinement : public virtual RefinementDecorator {
   */
   virtual void addElementToCollection(
       const GridStorage::grid_map_iterator& iter,
-      AbstractRefinement::refinement_list_type current_value_list,
+      const AbstractRefinement::refinement_list_type& current_value_list,
       size_t refinementsNum,
       AbstractRefinement::refinement_container_type& collection);
 };
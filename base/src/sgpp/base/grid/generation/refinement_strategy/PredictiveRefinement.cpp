@@ -26,10 +26,10 @@ bool doubleReverseCompare(const double firstEl, const double secondEl) {
 
 void PredictiveRefinement::addElementToCollection(
   const GridStorage::grid_map_iterator& iter,
-  AbstractRefinement::refinement_list_type current_value_list,
+  const AbstractRefinement::refinement_list_type& current_value_list,
   size_t refinements_num,
   AbstractRefinement::refinement_container_type& collection) {
-  for (AbstractRefinement::refinement_list_type::iterator it =
+  for (AbstractRefinement::refinement_list_type::const_iterator it =
          current_value_list.begin();
        it != current_value_list.end(); it++) {
     collection.push_back(*it);
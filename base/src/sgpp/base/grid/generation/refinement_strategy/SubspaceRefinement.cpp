@@ -18,7 +18,7 @@ namespace base {
 
 void SubspaceRefinement::addElementToCollection(
   const GridStorage::grid_map_iterator& iter,
-  AbstractRefinement::refinement_list_type current_value_list,
+  const AbstractRefinement::refinement_list_type& current_value_list,
   size_t refinements_num,
   AbstractRefinement::refinement_container_type& collection) {
   for (AbstractRefinement::refinement_pair_type key_value :
@@ -96,7 +96,7 @@ class SubspaceRefinement: public RefinementDecorator {
   */
   virtual void addElementToCollection(
     const GridStorage::grid_map_iterator& iter,
-    AbstractRefinement::refinement_list_type current_value_list,
+    const AbstractRefinement::refinement_list_type& current_value_list,
     size_t refinement_num,
     AbstractRefinement::refinement_container_type& collection);
 };
@@ -0,0 +1,372 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/grid/common/Stretching.hpp>
+#include <sgpp/base/grid/storage/hashmap/BinaryGridFile.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+/// identifies binary grid files
+const char BINARY_GRID_MAGIC[8] = {'S', 'G', 'P', 'P', 'G', 'R', 'I', 'D'};
+/// written in native byte order, used to detect files with a different byte order
+const uint32_t BINARY_GRID_BYTE_ORDER_MARK = 0x01020304;
+/// alignment of the sections of the file
+const uint64_t BINARY_GRID_ALIGNMENT = 64;
+
+/**
+ * Header at the beginning of a binary grid file.
+ */
+struct BinaryGridFileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint64_t dimension;
+  uint64_t numberOfPoints;
+  uint64_t hasCoefficients;
+  uint64_t descriptionOffset;
+  uint64_t descriptionLength;
+  uint64_t levelsOffset;
+  uint64_t indicesOffset;
+  uint64_t leafFlagsOffset;
+  uint64_t coefficientsOffset;
+  uint64_t fileSize;
+};
+
+uint64_t alignOffset(uint64_t offset) {
+  return (offset + BINARY_GRID_ALIGNMENT - 1) / BINARY_GRID_ALIGNMENT * BINARY_GRID_ALIGNMENT;
+}
+
+void writePadding(std::ofstream& stream, uint64_t& offset) {
+  const uint64_t alignedOffset = alignOffset(offset);
+  const std::vector<char> padding(alignedOffset - offset, 0);
+  stream.write(padding.data(), padding.size());
+  offset = alignedOffset;
+}
+
+}  // namespace
+
+void BinaryGridFile::write(const std::string& filename, Grid& grid) {
+  write(filename, grid, nullptr);
+}
+
+void BinaryGridFile::write(const std::string& filename, Grid& grid, const DataVector& alpha) {
+  if (alpha.getSize() != grid.getSize()) {
+    throw file_exception("BinaryGridFile::write: size of alpha does not match grid size");
+  }
+
+  write(filename, grid, &alpha);
+}
+
+void BinaryGridFile::write(const std::string& filename, Grid& grid, const DataVector* alpha) {
+  GridStorage& storage = grid.getStorage();
+  const size_t dim = storage.getDimension();
+  const size_t numPoints = storage.getSize();
+
+  // the description is the text serialization of an empty grid of the same type
+  std::string description;
+  {
+    std::unique_ptr<Grid> emptyGrid(grid.createGridOfEquivalentType(dim));
+    Stretching* stretching = dynamic_cast<Stretching*>(storage.getBoundingBox());
+
+    if (stretching != nullptr) {
+      emptyGrid->setStretching(*stretching);
+    } else {
+      emptyGrid->setBoundingBox(*storage.getBoundingBox());
+    }
+
+    emptyGrid->serialize(description);
+  }
+
+  BinaryGridFileHeader header;
+  std::memcpy(header.magic, BINARY_GRID_MAGIC, sizeof(header.magic));
+  header.version = BINARY_SERIALIZATION_VERSION;
+  header.byteOrderMark = BINARY_GRID_BYTE_ORDER_MARK;
+  header.dimension = dim;
+  header.numberOfPoints = numPoints;
+  header.hasCoefficients = (alpha != nullptr) ? 1 : 0;
+  header.descriptionOffset = alignOffset(sizeof(header));
+  header.descriptionLength = description.size();
+  header.levelsOffset = alignOffset(header.descriptionOffset + header.descriptionLength);
+  header.indicesOffset =
+      alignOffset(header.levelsOffset + numPoints * dim * sizeof(HashGridPoint::level_type));
+  header.leafFlagsOffset =
+      alignOffset(header.indicesOffset + numPoints * dim * sizeof(HashGridPoint::index_type));
+  header.coefficientsOffset = alignOffset(header.leafFlagsOffset + numPoints);
+  header.fileSize =
+      header.coefficientsOffset + ((alpha != nullptr) ? numPoints * sizeof(double) : 0);
+
+  std::ofstream stream(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if (!stream.is_open()) {
+    throw file_exception("BinaryGridFile::write: cannot open file for writing");
+  }
+
+  uint64_t offset = 0;
+  stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  offset += sizeof(header);
+  writePadding(stream, offset);
+
+  stream.write(description.data(), description.size());
+  offset += description.size();
+  writePadding(stream, offset);
+
+  // levels and indices are written in chunks of grid points to limit the temporary memory
+  const size_t chunkSize = 4096;
+  std::vector<HashGridPoint::level_type> levelChunk;
+  std::vector<HashGridPoint::index_type> indexChunk;
+
+  for (size_t start = 0; start < numPoints; start += chunkSize) {
+    const size_t end = std::min(start + chunkSize, numPoints);
+    levelChunk.clear();
+
+    for (size_t i = start; i < end; i++) {
+      const HashGridPoint& point = storage.getPoint(i);
+
+      for (size_t d = 0; d < dim; d++) {
+        levelChunk.push_back(point.getLevel(d));
+      }
+    }
+
+    stream.write(reinterpret_cast<const char*>(levelChunk.data()),
+                 levelChunk.size() * sizeof(HashGridPoint::level_type));
+  }
+
+  offset += numPoints * dim * sizeof(HashGridPoint::level_type);
+  writePadding(stream, offset);
+
+  for (size_t start = 0; start < numPoints; start += chunkSize) {
+    const size_t end = std::min(start + chunkSize, numPoints);
+    indexChunk.clear();
+
+    for (size_t i = start; i < end; i++) {
+      const HashGridPoint& point = storage.getPoint(i);
+
+      for (size_t d = 0; d < dim; d++) {
+        indexChunk.push_back(point.getIndex(d));
+      }
+    }
+
+    stream.write(reinterpret_cast<const char*>(indexChunk.data()),
+                 indexChunk.size() * sizeof(HashGridPoint::index_type));
+  }
+
+  offset += numPoints * dim * sizeof(HashGridPoint::index_type);
+  writePadding(stream, offset);
+
+  std::vector<uint8_t> leafFlags(numPoints);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    leafFlags[i] = storage.getPoint(i).isLeaf() ? 1 : 0;
+  }
+
+  stream.write(reinterpret_cast<const char*>(leafFlags.data()), leafFlags.size());
+  offset += numPoints;
+  writePadding(stream, offset);
+
+  if (alpha != nullptr) {
+    stream.write(reinterpret_cast<const char*>(alpha->getPointer()), numPoints * sizeof(double));
+  }
+
+  if (!stream.good()) {
+    throw file_exception("BinaryGridFile::write: error while writing the file");
+  }
+}
+
+BinaryGridFile::BinaryGridFile(const std::string& filename)
+    : data(nullptr),
+      fileSize(0),
+      isMapped(false),
+      buffer(),
+      dimension(0),
+      numberOfPoints(0),
+      description(nullptr),
+      descriptionLength(0),
+      levels(nullptr),
+      indices(nullptr),
+      leafFlags(nullptr),
+      coefficients(nullptr) {
+#ifndef _WIN32
+  const int fd = open(filename.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    throw file_exception("BinaryGridFile: cannot open file");
+  }
+
+  struct stat fileStatus;
+
+  if (fstat(fd, &fileStatus) != 0) {
+    close(fd);
+    throw file_exception("BinaryGridFile: cannot determine file size");
+  }
+
+  fileSize = static_cast<size_t>(fileStatus.st_size);
+
+  if (fileSize > 0) {
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (mapping != MAP_FAILED) {
+      data = static_cast<const char*>(mapping);
+      isMapped = true;
+    }
+  }
+
+  close(fd);
+#endif
+
+  if (!isMapped) {
+    // fallback if memory mapping is not available
+    std::ifstream stream(filename, std::ios::in | std::ios::binary);
+
+    if (!stream.is_open()) {
+      throw file_exception("BinaryGridFile: cannot open file");
+    }
+
+    buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    data = buffer.data();
+    fileSize = buffer.size();
+  }
+
+  try {
+    parseHeader();
+  } catch (...) {
+#ifndef _WIN32
+    if (isMapped) {
+      munmap(const_cast<char*>(data), fileSize);
+    }
+#endif
+    throw;
+  }
+}
+
+BinaryGridFile::~BinaryGridFile() {
+#ifndef _WIN32
+  if (isMapped) {
+    munmap(const_cast<char*>(data), fileSize);
+  }
+#endif
+}
+
+void BinaryGridFile::parseHeader() {
+  if (fileSize < sizeof(BinaryGridFileHeader)) {
+    throw file_exception("BinaryGridFile: file is too small");
+  }
+
+  BinaryGridFileHeader header;
+  std::memcpy(&header, data, sizeof(header));
+
+  if (std::memcmp(header.magic, BINARY_GRID_MAGIC, sizeof(header.magic)) != 0) {
+    throw file_exception("BinaryGridFile: not a binary grid file");
+  }
+
+  if (header.byteOrderMark != BINARY_GRID_BYTE_ORDER_MARK) {
+    throw file_exception("BinaryGridFile: file was written with a different byte order");
+  }
+
+  if (header.version > BINARY_SERIALIZATION_VERSION) {
+    throw file_exception("BinaryGridFile: version of the file is too new");
+  }
+
+  const uint64_t numEntries = header.numberOfPoints * header.dimension;
+
+  if ((header.fileSize != fileSize) ||
+      (header.descriptionOffset + header.descriptionLength > fileSize) ||
+      (header.levelsOffset + numEntries * sizeof(HashGridPoint::level_type) > fileSize) ||
+      (header.indicesOffset + numEntries * sizeof(HashGridPoint::index_type) > fileSize) ||
+      (header.leafFlagsOffset + header.numberOfPoints > fileSize) ||
+      ((header.hasCoefficients != 0) &&
+       (header.coefficientsOffset + header.numberOfPoints * sizeof(double) > fileSize))) {
+    throw file_exception("BinaryGridFile: file is truncated or corrupt");
+  }
+
+  dimension = static_cast<size_t>(header.dimension);
+  numberOfPoints = static_cast<size_t>(header.numberOfPoints);
+  description = data + header.descriptionOffset;
+  descriptionLength = static_cast<size_t>(header.descriptionLength);
+  levels = reinterpret_cast<const HashGridPoint::level_type*>(data + header.levelsOffset);
+  indices = reinterpret_cast<const HashGridPoint::index_type*>(data + header.indicesOffset);
+  leafFlags = reinterpret_cast<const uint8_t*>(data + header.leafFlagsOffset);
+  coefficients = (header.hasCoefficients != 0)
+                     ? reinterpret_cast<const double*>(data + header.coefficientsOffset)
+                     : nullptr;
+}
+
+size_t BinaryGridFile::getDimension() const { return dimension; }
+
+size_t BinaryGridFile::getSize() const { return numberOfPoints; }
+
+bool BinaryGridFile::hasCoefficients() const { return coefficients != nullptr; }
+
+std::string BinaryGridFile::getDescription() const {
+  return std::string(description, descriptionLength);
+}
+
+void BinaryGridFile::getCoefficients(DataVector& alpha) const {
+  if (coefficients == nullptr) {
+    throw file_exception("BinaryGridFile::getCoefficients: file contains no coefficients");
+  }
+
+  alpha.resize(numberOfPoints);
+  std::memcpy(alpha.getPointer(), coefficients, numberOfPoints * sizeof(double));
+}
+
+Grid* BinaryGridFile::createGrid() const {
+  Grid* grid = Grid::unserialize(getDescription());
+  insertPoints(grid->getStorage());
+  return grid;
+}
+
+void BinaryGridFile::loadStorage(HashGridStorage& storage) const {
+  if (storage.getDimension() != dimension) {
+    throw file_exception("BinaryGridFile::loadStorage: dimension mismatch");
+  }
+
+  std::unique_ptr<Grid> emptyGrid(Grid::unserialize(getDescription()));
+  Stretching* stretching = dynamic_cast<Stretching*>(emptyGrid->getStorage().getBoundingBox());
+
+  if (stretching != nullptr) {
+    storage.setStretching(*stretching);
+  } else {
+    storage.setBoundingBox(*emptyGrid->getStorage().getBoundingBox());
+  }
+
+  insertPoints(storage);
+}
+
+void BinaryGridFile::insertPoints(HashGridStorage& storage) const {
+  storage.clear();
+  HashGridPoint point(dimension);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    for (size_t d = 0; d < dimension; d++) {
+      point.push(d, getLevel(i, d), getIndex(i, d));
+    }
+
+    point.setLeaf(leafFlags[i] != 0);
+    point.rehash();
+    storage.insert(point);
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,184 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BINARYGRIDFILE_HPP
+#define BINARYGRIDFILE_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+#include <sgpp/base/grid/storage/hashmap/SerializationVersion.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Binary file format for grids and their coefficient vectors.
+ *
+ * In contrast to the text format of Grid::serialize, the grid points are stored as
+ * contiguous arrays of levels and indices (one row of length dimension per grid point,
+ * ordered by sequence number), followed by the leaf flags and, optionally,
+ * the coefficients. Grid type, parameters and bounding box/stretching are stored as
+ * a short text description in the format of Grid::serialize (without grid points).
+ * All sections are aligned to 64 bytes. The file is written in the native byte order,
+ * reading a file with a different byte order fails.
+ *
+ * Opening a file maps it read-only into memory (on POSIX systems), the arrays can then be
+ * accessed without parsing or copying; createGrid and loadStorage construct the grid
+ * points directly from the arrays.
+ */
+class BinaryGridFile {
+ public:
+  /**
+   * Writes a grid without coefficients.
+   *
+   * @param filename name of the file
+   * @param grid     grid to write
+   */
+  static void write(const std::string& filename, Grid& grid);
+
+  /**
+   * Writes a grid together with its coefficients.
+   *
+   * @param filename name of the file
+   * @param grid     grid to write
+   * @param alpha    coefficient vector (size must equal the number of grid points)
+   */
+  static void write(const std::string& filename, Grid& grid, const DataVector& alpha);
+
+  /**
+   * Opens a binary grid file and maps it read-only into memory.
+   *
+   * @param filename name of the file
+   */
+  explicit BinaryGridFile(const std::string& filename);
+
+  /**
+   * Destructor, unmaps the file.
+   */
+  ~BinaryGridFile();
+
+  BinaryGridFile(const BinaryGridFile&) = delete;
+  BinaryGridFile& operator=(const BinaryGridFile&) = delete;
+
+  /**
+   * @return dimension of the grid
+   */
+  size_t getDimension() const;
+
+  /**
+   * @return number of grid points
+   */
+  size_t getSize() const;
+
+  /**
+   * @return whether the file contains coefficients
+   */
+  bool hasCoefficients() const;
+
+  /**
+   * @return text description of the grid (format of Grid::serialize without grid points)
+   */
+  std::string getDescription() const;
+
+  /**
+   * @param seq sequence number of a grid point
+   * @param d   dimension
+   * @return level of the grid point in dimension d
+   */
+  inline HashGridPoint::level_type getLevel(size_t seq, size_t d) const {
+    return levels[seq * dimension + d];
+  }
+
+  /**
+   * @param seq sequence number of a grid point
+   * @param d   dimension
+   * @return index of the grid point in dimension d
+   */
+  inline HashGridPoint::index_type getIndex(size_t seq, size_t d) const {
+    return indices[seq * dimension + d];
+  }
+
+  /**
+   * @return read-only pointer to the levels (getSize() x getDimension(), row-major)
+   */
+  inline const HashGridPoint::level_type* getLevels() const { return levels; }
+
+  /**
+   * @return read-only pointer to the indices (getSize() x getDimension(), row-major)
+   */
+  inline const HashGridPoint::index_type* getIndices() const { return indices; }
+
+  /**
+   * @return read-only pointer to the coefficients, nullptr if the file has none
+   */
+  inline const double* getCoefficientsData() const { return coefficients; }
+
+  /**
+   * Copies the coefficients into a vector.
+   *
+   * @param[out] alpha coefficient vector (resized to getSize())
+   */
+  void getCoefficients(DataVector& alpha) const;
+
+  /**
+   * Creates the grid stored in the file.
+   * Note: object has to be freed after use.
+   *
+   * @return pointer to the new grid
+   */
+  Grid* createGrid() const;
+
+  /**
+   * Replaces the points and the bounding box/stretching of a grid storage
+   * by the ones stored in the file.
+   *
+   * @param storage grid storage (must have the same dimension as the stored grid)
+   */
+  void loadStorage(HashGridStorage& storage) const;
+
+ private:
+  /// pointer to the beginning of the file contents
+  const char* data;
+  /// size of the file in bytes
+  size_t fileSize;
+  /// whether data points to a memory mapping (otherwise to buffer)
+  bool isMapped;
+  /// file contents if the file could not be mapped
+  std::vector<char> buffer;
+  /// dimension of the grid
+  size_t dimension;
+  /// number of grid points
+  size_t numberOfPoints;
+  /// text description of the grid
+  const char* description;
+  /// length of the text description
+  size_t descriptionLength;
+  /// levels of the grid points
+  const HashGridPoint::level_type* levels;
+  /// indices of the grid points
+  const HashGridPoint::index_type* indices;
+  /// leaf flags of the grid points
+  const uint8_t* leafFlags;
+  /// coefficients, nullptr if the file has none
+  const double* coefficients;
+
+  static void write(const std::string& filename, Grid& grid, const DataVector* alpha);
+  void parseHeader();
+  void insertPoints(HashGridStorage& storage) const;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* BINARYGRIDFILE_HPP */
@@ -0,0 +1,213 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/hashmap/FlatGridIndex.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+FlatGridIndex::FlatGridIndex(size_t dimension)
+    : dimension(dimension),
+      numPoints(0),
+      levels(),
+      indices(),
+      hashes(),
+      slots(),
+      slotMask(0),
+      slotShift(64) {}
+
+void FlatGridIndex::reset(size_t dimension) {
+  this->dimension = dimension;
+  clear();
+}
+
+void FlatGridIndex::clear() {
+  numPoints = 0;
+  levels.clear();
+  indices.clear();
+  hashes.clear();
+  slots.clear();
+  slotMask = 0;
+  slotShift = 64;
+}
+
+void FlatGridIndex::reserve(size_t numPoints) {
+  levels.reserve(numPoints * dimension);
+  indices.reserve(numPoints * dimension);
+  hashes.reserve(numPoints);
+  growTable(numPoints);
+}
+
+size_t FlatGridIndex::insert(const HashGridPoint& point) {
+  growTable(numPoints + 1);
+
+  const size_t seq = numPoints;
+  appendRow(point);
+  placeOrRedirectSlot(point, seq);
+
+  return seq;
+}
+
+void FlatGridIndex::update(const HashGridPoint& point, size_t seq) {
+  if (seq >= numPoints) {
+    return;
+  }
+
+  const size_t oldSlot = findSlotOfSequenceNumber(seq);
+
+  if (oldSlot != npos) {
+    eraseSlot(oldSlot);
+  }
+
+  setRow(seq, point);
+  placeOrRedirectSlot(point, seq);
+}
+
+void FlatGridIndex::deleteLast() {
+  if (numPoints == 0) {
+    return;
+  }
+
+  const size_t slot = findSlotOfSequenceNumber(numPoints - 1);
+
+  if (slot != npos) {
+    eraseSlot(slot);
+  }
+
+  numPoints--;
+  levels.resize(numPoints * dimension);
+  indices.resize(numPoints * dimension);
+  hashes.pop_back();
+}
+
+void FlatGridIndex::rebuild(const std::vector<HashGridPoint*>& points) {
+  clear();
+  reserve(points.size());
+
+  for (size_t i = 0; i < points.size(); i++) {
+    insert(*points[i]);
+  }
+}
+
+void FlatGridIndex::appendRow(const HashGridPoint& point) {
+  for (size_t d = 0; d < dimension; d++) {
+    levels.push_back(point.getLevel(d));
+    indices.push_back(point.getIndex(d));
+  }
+
+  hashes.push_back(point.getHash());
+  numPoints++;
+}
+
+void FlatGridIndex::setRow(size_t seq, const HashGridPoint& point) {
+  for (size_t d = 0; d < dimension; d++) {
+    levels[seq * dimension + d] = point.getLevel(d);
+    indices[seq * dimension + d] = point.getIndex(d);
+  }
+
+  hashes[seq] = point.getHash();
+}
+
+void FlatGridIndex::placeSlot(size_t hash, size_t seq) {
+  size_t slot = getHomeSlot(hash);
+
+  while (slots[slot].seq != npos) {
+    slot = (slot + 1) & slotMask;
+  }
+
+  slots[slot].hash = hash;
+  slots[slot].seq = seq;
+}
+
+void FlatGridIndex::placeOrRedirectSlot(const HashGridPoint& point, size_t seq) {
+  const size_t hash = point.getHash();
+  size_t slot = getHomeSlot(hash);
+
+  while (slots[slot].seq != npos) {
+    if ((slots[slot].hash == hash) && (slots[slot].seq != seq) &&
+        rowEquals(slots[slot].seq, point)) {
+      // an equal point is already stored, redirect the lookup to the new point
+      slots[slot].seq = seq;
+      return;
+    }
+
+    slot = (slot + 1) & slotMask;
+  }
+
+  slots[slot].hash = hash;
+  slots[slot].seq = seq;
+}
+
+size_t FlatGridIndex::findSlotOfSequenceNumber(size_t seq) const {
+  if (slots.empty()) {
+    return npos;
+  }
+
+  size_t slot = getHomeSlot(hashes[seq]);
+
+  while (slots[slot].seq != npos) {
+    if (slots[slot].seq == seq) {
+      return slot;
+    }
+
+    slot = (slot + 1) & slotMask;
+  }
+
+  return npos;
+}
+
+void FlatGridIndex::eraseSlot(size_t slot) {
+  // backward shift deletion, keeps the table free of tombstones
+  size_t hole = slot;
+  size_t next = (hole + 1) & slotMask;
+
+  while (slots[next].seq != npos) {
+    const size_t home = getHomeSlot(slots[next].hash);
+
+    // the entry may be moved to the hole iff the hole lies in [home, next)
+    if (((next - home) & slotMask) >= ((next - hole) & slotMask)) {
+      slots[hole] = slots[next];
+      hole = next;
+    }
+
+    next = (next + 1) & slotMask;
+  }
+
+  slots[hole].seq = npos;
+}
+
+void FlatGridIndex::growTable(size_t minPoints) {
+  // keep the load factor at most 1/2 to get short probe sequences
+  if (2 * minPoints <= slots.size()) {
+    return;
+  }
+
+  size_t numSlots = 16;
+  unsigned int log2NumSlots = 4;
+
+  while (numSlots < 2 * minPoints) {
+    numSlots *= 2;
+    log2NumSlots++;
+  }
+
+  Slot emptySlot;
+  emptySlot.hash = 0;
+  emptySlot.seq = npos;
+  std::vector<Slot> oldSlots(numSlots, emptySlot);
+  slots.swap(oldSlots);
+  slotMask = numSlots - 1;
+  slotShift = 64 - log2NumSlots;
+
+  for (size_t slot = 0; slot < oldSlots.size(); slot++) {
+    if (oldSlots[slot].seq != npos) {
+      placeSlot(oldSlots[slot].hash, oldSlots[slot].seq);
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
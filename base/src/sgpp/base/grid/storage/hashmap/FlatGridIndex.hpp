@@ -0,0 +1,213 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef FLATGRIDINDEX_HPP
+#define FLATGRIDINDEX_HPP
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Open-addressing index of grid points.
+ *
+ * Levels and indices of all points are kept in two contiguous arrays (one row of
+ * length dimension per point, ordered by sequence number), and the sequence numbers
+ * are looked up in a linear probing hash table keyed on the (level, index) tuple.
+ * In contrast to the std::unordered_map used by HashGridStorage, a lookup does not
+ * dereference any heap-allocated HashGridPoint, which keeps the probe sequence in
+ * a few cache lines.
+ */
+class FlatGridIndex {
+ public:
+  /// level type
+  typedef HashGridPoint::level_type level_type;
+  /// index type
+  typedef HashGridPoint::index_type index_type;
+
+  /// sequence number returned by find if the point is not contained
+  static const size_t npos = static_cast<size_t>(-1);
+
+  /**
+   * Constructor
+   *
+   * @param dimension the dimension of the grid points
+   */
+  explicit FlatGridIndex(size_t dimension = 0);
+
+  /**
+   * Removes all points and sets a new dimension.
+   *
+   * @param dimension the dimension of the grid points
+   */
+  void reset(size_t dimension);
+
+  /**
+   * Removes all points, the dimension is kept.
+   */
+  void clear();
+
+  /**
+   * Reserves memory for a given number of points.
+   *
+   * @param numPoints number of points
+   */
+  void reserve(size_t numPoints);
+
+  /**
+   * @return number of stored points
+   */
+  inline size_t getSize() const { return numPoints; }
+
+  /**
+   * @return dimension of the grid points
+   */
+  inline size_t getDimension() const { return dimension; }
+
+  /**
+   * Looks up the sequence number of a grid point.
+   *
+   * @param point grid point
+   * @return sequence number of the point, npos if the point is not contained
+   */
+  inline size_t find(const HashGridPoint& point) const {
+    if (numPoints == 0) {
+      return npos;
+    }
+
+    const size_t hash = point.getHash();
+    size_t slot = getHomeSlot(hash);
+
+    while (slots[slot].seq != npos) {
+      if ((slots[slot].hash == hash) && rowEquals(slots[slot].seq, point)) {
+        return slots[slot].seq;
+      }
+
+      slot = (slot + 1) & slotMask;
+    }
+
+    return npos;
+  }
+
+  /**
+   * Appends a grid point, its sequence number is the number of points stored before.
+   * If an equal point is already stored, the lookup refers to the new point afterwards
+   * (same semantics as the assignment to the grid_map of HashGridStorage).
+   *
+   * @param point grid point
+   * @return sequence number of the point
+   */
+  size_t insert(const HashGridPoint& point);
+
+  /**
+   * Replaces the point with sequence number seq.
+   *
+   * @param point new grid point
+   * @param seq   sequence number of the point to replace
+   */
+  void update(const HashGridPoint& point, size_t seq);
+
+  /**
+   * Removes the point with the largest sequence number.
+   */
+  void deleteLast();
+
+  /**
+   * Rebuilds the index from a list of points, the sequence number of
+   * a point is its position in the list.
+   *
+   * @param points list of grid points
+   */
+  void rebuild(const std::vector<HashGridPoint*>& points);
+
+  /**
+   * @param seq sequence number
+   * @param d   dimension
+   * @return level of the point with sequence number seq in dimension d
+   */
+  inline level_type getLevel(size_t seq, size_t d) const { return levels[seq * dimension + d]; }
+
+  /**
+   * @param seq sequence number
+   * @param d   dimension
+   * @return index of the point with sequence number seq in dimension d
+   */
+  inline index_type getIndex(size_t seq, size_t d) const { return indices[seq * dimension + d]; }
+
+  /**
+   * @return pointer to the contiguous level array (numPoints x dimension, row-major)
+   */
+  inline const level_type* getLevels() const { return levels.data(); }
+
+  /**
+   * @return pointer to the contiguous index array (numPoints x dimension, row-major)
+   */
+  inline const index_type* getIndices() const { return indices.data(); }
+
+ private:
+  /// slot of the open-addressing table
+  struct Slot {
+    /// cached hash value of the stored point
+    size_t hash;
+    /// sequence number of the stored point, npos if the slot is empty
+    size_t seq;
+  };
+
+  /// dimension of the grid points
+  size_t dimension;
+  /// number of stored points
+  size_t numPoints;
+  /// levels of all points
+  std::vector<level_type> levels;
+  /// indices of all points
+  std::vector<index_type> indices;
+  /// hash values of all points, needed to find the slot of a point by its sequence number
+  std::vector<size_t> hashes;
+  /// open-addressing table (size is a power of two)
+  std::vector<Slot> slots;
+  /// number of slots minus one
+  size_t slotMask;
+  /// 64 minus the binary logarithm of the number of slots
+  unsigned int slotShift;
+
+  inline size_t getHomeSlot(size_t hash) const {
+    // Fibonacci hashing, the high bits of the product are well mixed
+    return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >>
+                               slotShift);
+  }
+
+  inline bool rowEquals(size_t seq, const HashGridPoint& point) const {
+    const level_type* rowLevels = &levels[seq * dimension];
+    const index_type* rowIndices = &indices[seq * dimension];
+
+    for (size_t d = 0; d < dimension; d++) {
+      if ((rowLevels[d] != point.getLevel(d)) || (rowIndices[d] != point.getIndex(d))) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  void appendRow(const HashGridPoint& point);
+  void setRow(size_t seq, const HashGridPoint& point);
+  void placeSlot(size_t hash, size_t seq);
+  void placeOrRedirectSlot(const HashGridPoint& point, size_t seq);
+  size_t findSlotOfSequenceNumber(size_t seq) const;
+  void eraseSlot(size_t slot);
+  void growTable(size_t minPoints);
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* FLATGRIDINDEX_HPP */
@@ -23,6 +23,9 @@ HashGridStorage::HashGridStorage(size_t dimension)
       dimension(dimension),
       list(),
       map(),
+      backend(HashGridStorageBackend::UnorderedMap),
+      flatIndex(dimension),
+      isMapSynchronized(true),
       algoDims(),
       boundingBox(new BoundingBox(dimension)),
       stretching(nullptr),
@@ -37,6 +40,9 @@ HashGridStorage::HashGridStorage(BoundingBox& creationBoundingBox)
       dimension(creationBoundingBox.getDimension()),
       list(),
       map(),
+      backend(HashGridStorageBackend::UnorderedMap),
+      flatIndex(dimension),
+      isMapSynchronized(true),
       algoDims(),
       boundingBox(new BoundingBox(creationBoundingBox)),
       stretching(nullptr),
@@ -52,6 +58,9 @@ HashGridStorage::HashGridStorage(Stretching& creationStretching)
       dimension(creationStretching.getDimension()),
       list(),
       map(),
+      backend(HashGridStorageBackend::UnorderedMap),
+      flatIndex(dimension),
+      isMapSynchronized(true),
       algoDims(),
       boundingBox(nullptr),
       stretching(new Stretching(creationStretching)),
@@ -67,6 +76,9 @@ HashGridStorage::HashGridStorage(std::string& istr)
       dimension(0lu),
       list(),
       map(),
+      backend(HashGridStorageBackend::UnorderedMap),
+      flatIndex(),
+      isMapSynchronized(true),
       algoDims() {
   std::istringstream istream;
   istream.str(istr);
@@ -83,6 +95,9 @@ HashGridStorage::HashGridStorage(std::istream& istream)
       dimension(0lu),
       list(),
       map(),
+      backend(HashGridStorageBackend::UnorderedMap),
+      flatIndex(),
+      isMapSynchronized(true),
       algoDims() {
   parseGridDescription(istream);
 
@@ -96,11 +111,16 @@ HashGridStorage::HashGridStorage(HashGridStorage& copyFrom)
       dimension(copyFrom.dimension),
       list(),
       map(),
+      backend(copyFrom.backend),
+      flatIndex(copyFrom.dimension),
+      isMapSynchronized(copyFrom.backend == HashGridStorageBackend::UnorderedMap),
       algoDims(copyFrom.algoDims),
       boundingBox(copyFrom.bUseStretching ? nullptr : new BoundingBox(*copyFrom.boundingBox)),
       stretching(copyFrom.bUseStretching ? new Stretching(*copyFrom.stretching) : nullptr),
       bUseStretching(copyFrom.bUseStretching) {
   // copy gridpoints
+  flatIndex.reserve(copyFrom.getSize());
+
   for (size_t i = 0; i < copyFrom.getSize(); i++) {
     this->insert(copyFrom[i]);
   }
@@ -118,6 +138,9 @@ void HashGridStorage::operator=(const HashGridStorage& other) {
   dimension = other.dimension;
   algoDims = other.algoDims;
   bUseStretching = other.bUseStretching;
+  backend = other.backend;
+  flatIndex.reset(dimension);
+  isMapSynchronized = (backend == HashGridStorageBackend::UnorderedMap);
 
   if (other.bUseStretching) {
     stretching = new Stretching(*other.stretching);
@@ -151,10 +174,50 @@ void HashGridStorage::clear() {
 
   // remove all elements from hashmap
   map.clear();
+  flatIndex.clear();
+  isMapSynchronized = (backend == HashGridStorageBackend::UnorderedMap);
   // remove all list entries
   list.clear();
 }
 
+void HashGridStorage::setBackend(HashGridStorageBackend backend) {
+  if (backend == this->backend) {
+    return;
+  }
+
+  this->backend = backend;
+
+  if (backend == HashGridStorageBackend::OpenAddressing) {
+    flatIndex.reset(dimension);
+    flatIndex.rebuild(list);
+    map.clear();
+    isMapSynchronized = false;
+  } else {
+    synchronizeMap();
+    flatIndex.clear();
+  }
+}
+
+HashGridStorageBackend HashGridStorage::getBackend() const { return backend; }
+
+const FlatGridIndex& HashGridStorage::getFlatIndex() const { return flatIndex; }
+
+void HashGridStorage::synchronizeMap() {
+  if (isMapSynchronized) {
+    return;
+  }
+
+  // from now on, the map is kept up to date by all modifying methods
+  map.clear();
+  map.reserve(list.size());
+
+  for (size_t i = 0; i < list.size(); i++) {
+    map[list[i]] = i;
+  }
+
+  isMapSynchronized = true;
+}
+
 std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoints) {
   point_pointer curPoint;
   std::vector<size_t> remainingPoints;
@@ -163,6 +226,35 @@ std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoint
   // sort list
   removePoints.sort();
 
+  if (backend == HashGridStorageBackend::OpenAddressing) {
+    std::list<size_t>::iterator removeIter = removePoints.begin();
+
+    // compact the list and rebuild the index once instead of erasing point by point
+    for (size_t i = 0; i < list.size(); i++) {
+      if ((removeIter != removePoints.end()) && (*removeIter == i)) {
+        while ((removeIter != removePoints.end()) && (*removeIter == i)) {
+          removeIter++;
+        }
+
+        delCounter++;
+      } else {
+        list[i - delCounter] = list[i];
+        remainingPoints.push_back(i);
+      }
+    }
+
+    list.resize(list.size() - delCounter);
+    flatIndex.rebuild(list);
+
+    if (isMapSynchronized) {
+      isMapSynchronized = false;
+      synchronizeMap();
+    }
+
+    recalcLeafProperty();
+    return remainingPoints;
+  }
+
   // DEBUG : print list points to delete, sorted
   // std::cout << std::endl << "List of points to delete, sorted" << std::endl;
   // for(std::list<size_t>::iterator iter = removePoints.begin();
@@ -258,6 +350,21 @@ void HashGridStorage::toString(std::ostream& stream) const {
   stream << "[";
   int i = 0;
 
+  if (backend == HashGridStorageBackend::OpenAddressing) {
+    for (size_t seq = 0; seq < list.size(); seq++) {
+      if (seq != 0) {
+        stream << ",";
+      }
+
+      stream << " ";
+      list[seq]->toString(stream);
+      stream << " -> " << seq;
+    }
+
+    stream << " ]";
+    return;
+  }
+
   for (grid_map_const_iterator iter = map.begin(); iter != map.end(); iter++, i++) {
     if (i != 0) {
       stream << ",";
@@ -271,12 +378,25 @@ void HashGridStorage::toString(std::ostream& stream) const {
   stream << " ]";
 }
 
-size_t HashGridStorage::getSize() const { return map.size(); }
+size_t HashGridStorage::getSize() const {
+  return (backend == HashGridStorageBackend::OpenAddressing) ? list.size() : map.size();
+}
+
+size_t HashGridStorage::computeHash() const {
+  size_t hash = getSize();
+
+  for (size_t k = 0; k < getSize(); k++) {
+    // combine like boost::hash_combine, such that the hash depends on the order of the points
+    hash ^= list[k]->getHash() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  }
+
+  return hash;
+}
 
 size_t HashGridStorage::getNumberOfInnerPoints() const {
   size_t innerPoints = 0;
 
-  for (size_t p = 0; p < map.size(); p++) {
+  for (size_t p = 0; p < getSize(); p++) {
     if (list[p]->isInnerPoint()) innerPoints++;
   }
 
@@ -288,6 +408,15 @@ size_t HashGridStorage::getDimension() const { return dimension; }
 size_t HashGridStorage::insert(const point_type& index) {
   point_pointer insert = new HashGridPoint(index);
   list.push_back(insert);
+
+  if (backend == HashGridStorageBackend::OpenAddressing) {
+    flatIndex.insert(*insert);
+
+    if (!isMapSynchronized) {
+      return list.size() - 1;
+    }
+  }
+
   return (map[insert] = list.size() - 1);
 }
 
@@ -326,18 +455,37 @@ void HashGridStorage::update(point_type& index, size_t pos) {
   if (pos < list.size()) {
     // Remove old element at pos
     point_pointer del = list[pos];
-    map.erase(del);
+
+    if (isMapSynchronized) {
+      map.erase(del);
+    }
+
     delete del;
     // Insert update
     point_pointer insert = new HashGridPoint(index);
     list[pos] = insert;
-    map[insert] = pos;
+
+    if (backend == HashGridStorageBackend::OpenAddressing) {
+      flatIndex.update(*insert, pos);
+    }
+
+    if (isMapSynchronized) {
+      map[insert] = pos;
+    }
   }
 }
 
 void HashGridStorage::deleteLast() {
   point_pointer del = list.back();
-  map.erase(del);
+
+  if (backend == HashGridStorageBackend::OpenAddressing) {
+    flatIndex.deleteLast();
+  }
+
+  if (isMapSynchronized) {
+    map.erase(del);
+  }
+
   list.pop_back();
   delete del;
 }
@@ -357,15 +505,14 @@ void HashGridStorage::setAlgorithmicDimensions(std::vector<size_t> newAlgoDims)
 
 void HashGridStorage::recalcLeafProperty() {
   point_pointer point;
-  grid_map_iterator iter;
   size_t current_dim;
   point_type::level_type l;
   point_type::level_type i;
   bool isLeaf = true;
 
   // iterate through the grid
-  for (iter = map.begin(); iter != map.end(); iter++) {
-    point = iter->first;
+  for (size_t seq = 0; seq < list.size(); seq++) {
+    point = list[seq];
     isLeaf = true;
 
     // iterate through the dimensions
@@ -670,10 +817,15 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
     }
   }
 
+  if (backend == HashGridStorageBackend::OpenAddressing) {
+    flatIndex.reset(dimension);
+    flatIndex.rebuild(list);
+    flatIndex.reserve(list.size() + num);
+  }
+
   for (size_t i = 0; i < num; i++) {
     point_pointer index = new HashGridPoint(istream, version);
-    list.push_back(index);
-    map[index] = i;
+    store(index);
   }
 
   // set's the grid point's leaf information which is not saved in version 1
@@ -8,6 +8,7 @@
 
 #include <sgpp/base/exception/generation_exception.hpp>
 
+#include <sgpp/base/grid/storage/hashmap/FlatGridIndex.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
 #include <sgpp/base/grid/storage/hashmap/SerializationVersion.hpp>
 
@@ -36,6 +37,16 @@ namespace base {
 
 class HashGridIterator;
 
+/**
+ * Index structure used by HashGridStorage to map grid points to sequence numbers
+ */
+enum class HashGridStorageBackend {
+  /// std::unordered_map of pointers to the grid points (default)
+  UnorderedMap,
+  /// FlatGridIndex, i.e., contiguous level/index arrays with an open-addressing hash table
+  OpenAddressing
+};
+
 /**
  * Generic hash table based storage of grid points.
  */
@@ -127,6 +138,31 @@ class HashGridStorage {
    */
   void clear();
 
+  /**
+   * Sets the index structure that is used to look up grid points. The stored
+   * points are kept and reindexed.
+   *
+   * With HashGridStorageBackend::OpenAddressing, getSequenceNumber and isContaining work on
+   * the FlatGridIndex. The grid_map is only built when it is accessed via begin(), end() or
+   * find() for the first time and kept up to date afterwards.
+   *
+   * @param backend the new index structure
+   */
+  void setBackend(HashGridStorageBackend backend);
+
+  /**
+   * @return the index structure that is used to look up grid points
+   */
+  HashGridStorageBackend getBackend() const;
+
+  /**
+   * Returns the flat level/index arrays of the grid points. Only up to date if the
+   * storage uses HashGridStorageBackend::OpenAddressing.
+   *
+   * @return the FlatGridIndex of the storage
+   */
+  const FlatGridIndex& getFlatIndex() const;
+
   /**
    * Remove several point from HashGridStorage. The points to removed
    * are stored in a list. This function returns a vector of remaining points
@@ -182,6 +218,15 @@ class HashGridStorage {
    */
   size_t getSize() const;
 
+  /**
+   * computes a hash of the levels and indices of all grid points (in the order of their
+   * sequence numbers), which changes if grid points are inserted, deleted, or reordered;
+   * can be used to detect whether data derived from the grid has to be recomputed
+   *
+   * @return hash of the grid points
+   */
+  size_t computeHash() const;
+
   /**
    * gets the number of inner grid points
    *
@@ -523,6 +568,12 @@ class HashGridStorage {
   grid_list list;
   /// the indices of the grid points
   grid_map map;
+  /// index structure used to look up grid points
+  HashGridStorageBackend backend;
+  /// open-addressing index of the grid points (only used with the OpenAddressing backend)
+  FlatGridIndex flatIndex;
+  /// true if the grid_map is kept up to date (always true for the UnorderedMap backend)
+  bool isMapSynchronized;
   /// algorithmic dimension, these are used in Up/Downs
   std::vector<size_t> algoDims;
 
@@ -540,6 +591,11 @@ class HashGridStorage {
    * @param istream the string stream that contains the information
    */
   void parseGridDescription(std::istream& istream);
+
+  /**
+   * Rebuilds the grid_map from the list if it is out of date
+   */
+  void synchronizeMap();
 };
 
 HashGridStorage::point_pointer inline HashGridStorage::create(point_type& index) {
@@ -551,22 +607,47 @@ void inline HashGridStorage::destroy(point_pointer index) { delete index; }
 
 unsigned int inline HashGridStorage::store(point_pointer index) {
   list.push_back(index);
+
+  if (backend == HashGridStorageBackend::OpenAddressing) {
+    flatIndex.insert(*index);
+
+    if (!isMapSynchronized) {
+      return static_cast<unsigned int>(list.size() - 1);
+    }
+  }
+
   return static_cast<unsigned int>(map[index] = static_cast<unsigned int>(list.size() - 1));
 }
 
 HashGridStorage::grid_map_iterator inline HashGridStorage::find(point_pointer index) {
+  synchronizeMap();
   return map.find(index);
 }
 
-HashGridStorage::grid_map_iterator inline HashGridStorage::begin() { return map.begin(); }
+HashGridStorage::grid_map_iterator inline HashGridStorage::begin() {
+  synchronizeMap();
+  return map.begin();
+}
 
-HashGridStorage::grid_map_iterator inline HashGridStorage::end() { return map.end(); }
+HashGridStorage::grid_map_iterator inline HashGridStorage::end() {
+  synchronizeMap();
+  return map.end();
+}
 
 bool inline HashGridStorage::isContaining(HashGridPoint& index) const {
+  if (backend == HashGridStorageBackend::OpenAddressing) {
+    return flatIndex.find(index) != FlatGridIndex::npos;
+  }
+
   return map.find(&index) != map.end();
 }
 
 size_t inline HashGridStorage::getSequenceNumber(HashGridPoint& index) const {
+  if (backend == HashGridStorageBackend::OpenAddressing) {
+    size_t seq = flatIndex.find(index);
+    return (seq != FlatGridIndex::npos) ? seq : list.size() + 1;
+  }
+
   grid_map_const_iterator iter = map.find(&index);
 
   if (iter != map.end()) {
@@ -576,7 +657,7 @@ size_t inline HashGridStorage::getSequenceNumber(HashGridPoint& index) const {
   }
 }
 
-bool inline HashGridStorage::isInvalidSequenceNumber(size_t s) { return s > map.size(); }
+bool inline HashGridStorage::isInvalidSequenceNumber(size_t s) { return s > getSize(); }
 
 std::vector<size_t> inline HashGridStorage::getAlgorithmicDimensions() { return algoDims; }
 
@@ -23,4 +23,12 @@
  */
 #define SERIALIZATION_VERSION 9
 
+/**
+ * This specifies the available versions of the binary grid format (see BinaryGridFile)
+ *
+ * Version 1: header, grid description in the text format above (without grid points),
+ *            levels, indices and leaf flags of the grid points, optional coefficients
+ */
+#define BINARY_SERIALIZATION_VERSION 1
+
 #endif /* SERIALIZATIONVERSION_HPP */
@@ -134,6 +134,7 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalInterModLinear.hpp>
 
+#include <sgpp/base/operation/hash/OperationMultipleEvalBsplineBlocked.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalBsplineBoundaryNaive.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalBsplineClenshawCurtisNaive.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalBsplineNaive.hpp>
@@ -531,6 +532,21 @@ base::OperationMultipleEval* createOperationMultipleEval(base::Grid& grid,
     return new base::OperationMultipleEvalLinearStretchedBoundary(grid, dataset);
   } else if (grid.getType() == base::GridType::Periodic) {
     return new base::OperationMultipleEvalPeriodic(grid, dataset);
+  } else if (grid.getType() == base::GridType::Bspline) {
+    return new base::OperationMultipleEvalBsplineBlocked<base::SBsplineBase>(
+        grid, dynamic_cast<base::BsplineGrid*>(&grid)->getDegree(), dataset);
+  } else if (grid.getType() == base::GridType::BsplineBoundary) {
+    return new base::OperationMultipleEvalBsplineBlocked<base::SBsplineBoundaryBase>(
+        grid, dynamic_cast<base::BsplineBoundaryGrid*>(&grid)->getDegree(), dataset);
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    return new base::OperationMultipleEvalBsplineBlocked<base::SBsplineModifiedBase>(
+        grid, dynamic_cast<base::ModBsplineGrid*>(&grid)->getDegree(), dataset);
+  } else if (grid.getType() == base::GridType::BsplineClenshawCurtis) {
+    return new base::OperationMultipleEvalBsplineBlocked<base::SBsplineClenshawCurtisBase>(
+        grid, dynamic_cast<base::BsplineClenshawCurtisGrid*>(&grid)->getDegree(), dataset);
+  } else if (grid.getType() == base::GridType::ModBsplineClenshawCurtis) {
+    return new base::OperationMultipleEvalBsplineBlocked<base::SBsplineModifiedClenshawCurtisBase>(
+        grid, dynamic_cast<base::ModBsplineClenshawCurtisGrid*>(&grid)->getDegree(), dataset);
   } else {
     throw base::factory_exception(
         "createOperationMultipleEval is not implemented for this grid type.");
@@ -6,6 +6,7 @@
 #ifndef OPERATIONMATRIX_HPP
 #define OPERATIONMATRIX_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -38,6 +39,26 @@ class OperationMatrix {
    * @param result DataVector into which the result of the Laplace operation is stored
    */
   virtual void mult(DataVector& alpha, DataVector& result) = 0;
+
+  /**
+   * Multiplies the matrix with several vectors at once, e.g. for block solvers with multiple
+   * right-hand sides. The default implementation calls mult for every column, derived classes
+   * may override it to share work (e.g. grid traversals) between the vectors.
+   *
+   * @param alpha DataMatrix whose columns are the vectors that are multiplied with the matrix
+   * @param result DataMatrix into whose columns the results are stored, must have the same
+   *        number of columns as alpha
+   */
+  virtual void multBatch(DataMatrix& alpha, DataMatrix& result) {
+    DataVector alphaColumn(alpha.getNrows());
+    DataVector resultColumn(result.getNrows());
+
+    for (size_t j = 0; j < alpha.getNcols(); j++) {
+      alpha.getColumn(j, alphaColumn);
+      mult(alphaColumn, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
 };
 
 }  // namespace base
@@ -73,6 +73,31 @@ class OperationMultipleEval {
     throw sgpp::base::not_implemented_exception();
   }
 
+  /**
+   * Multiplication of @f$B^T@f$ with several coefficient vectors at once, e.g., to evaluate
+   * many functions that live on the same grid.
+   *
+   * The default implementation calls mult() once per column. Kernels that override this
+   * method evaluate each basis function only once and apply it to all columns.
+   *
+   * @param alpha matrix with one coefficient vector per column (#grid points x #vectors)
+   * @param result the results, one column per coefficient vector, is resized to
+   * (#data points x #vectors)
+   */
+  virtual void mult(DataMatrix& alpha, DataMatrix& result) {
+    const size_t numberOfVectors = alpha.getNcols();
+    DataVector alphaColumn(alpha.getNrows());
+    DataVector resultColumn(dataset.getNrows());
+
+    result.resizeRowsCols(dataset.getNrows(), numberOfVectors);
+
+    for (size_t j = 0; j < numberOfVectors; j++) {
+      alpha.getColumn(j, alphaColumn);
+      this->mult(alphaColumn, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
+
   /**
    * Multiplication of @f$B@f$ with vector @f$\alpha@f$
    *
@@ -0,0 +1,427 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONMULTIPLEEVALBSPLINEBLOCKED_HPP
+#define OPERATIONMULTIPLEEVALBSPLINEBLOCKED_HPP
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBoundaryBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineClenshawCurtisBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineModifiedBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineModifiedClenshawCurtisBasis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Parallel, cache-blocked OperationMultipleEval for the B-spline grids
+ * (BASIS is one of SBsplineBase, SBsplineBoundaryBase, SBsplineModifiedBase,
+ * SBsplineClenshawCurtisBase and SBsplineModifiedClenshawCurtisBase).
+ *
+ * The data points are processed in blocks of BLOCK_SIZE points, the blocks are
+ * distributed among the OpenMP threads. For each block, every distinct 1D basis
+ * function (level and index in one dimension) that occurs in the grid is evaluated
+ * once at all points of the block, which replaces the (#grid points x #data points x d)
+ * calls of the 1D basis by roughly (#distinct 1D functions x #data points) calls.
+ * Grid points with a 1D factor that vanishes on the whole block are skipped,
+ * the remaining tensor products are formed with SIMD loops over the points of the block.
+ *
+ * multTranspose evaluates the 1D functions on groups of TRANSPOSE_GROUP_SIZE blocks in parallel
+ * and distributes the grid points among the threads, so every entry of the result is
+ * accumulated by a single thread.
+ *
+ * The distinct 1D functions and the transformed data points are determined by prepare(),
+ * which is called by the constructor. If the grid is changed afterwards, prepare() has to be
+ * called again (the grid data is rebuilt automatically if the number of grid points changed).
+ */
+template <class BASIS>
+class OperationMultipleEvalBsplineBlocked : public OperationMultipleEval {
+ public:
+  /// number of data points that are processed together
+  static const size_t BLOCK_SIZE = 64;
+  /// number of blocks whose 1D function values are computed together in multTranspose
+  static const size_t TRANSPOSE_GROUP_SIZE = 16;
+
+  /**
+   * Constructor
+   *
+   * @param grid    grid
+   * @param degree  B-spline degree
+   * @param dataset the dataset that should be evaluated
+   */
+  OperationMultipleEvalBsplineBlocked(Grid& grid, size_t degree, DataMatrix& dataset)
+      : OperationMultipleEval(grid, dataset),
+        storage(grid.getStorage()),
+        degree(degree),
+        preparedGridSize(0),
+        preparedGridHash(0) {
+    this->prepare();
+  }
+
+  ~OperationMultipleEvalBsplineBlocked() override {}
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    const size_t n = storage.getSize();
+    const size_t m = dataset.getNrows();
+
+    result.setAll(0.0);
+    updateGrid();
+
+    const size_t numberOfBlocks = (m + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+#pragma omp parallel
+    {
+      // the Clenshaw-Curtis bases hold temporary knot vectors, so every thread needs its own
+      BASIS basis(degree);
+      std::vector<double> values(functionLevels.size() * BLOCK_SIZE);
+      std::vector<char> isNonZero(functionLevels.size());
+      double blockResult[BLOCK_SIZE];
+      double product[BLOCK_SIZE];
+
+#pragma omp for schedule(dynamic)
+
+      for (size_t block = 0; block < numberOfBlocks; block++) {
+        const size_t blockStart = block * BLOCK_SIZE;
+        const size_t blockSize = std::min(BLOCK_SIZE, m - blockStart);
+
+        evaluateBlock(basis, blockStart, blockSize, values, isNonZero);
+        std::fill(blockResult, blockResult + BLOCK_SIZE, 0.0);
+
+        for (size_t i = 0; i < n; i++) {
+          if ((alpha[i] != 0.0) &&
+              computeProduct(i, blockSize, values.data(), isNonZero.data(), product)) {
+            const double alphaI = alpha[i];
+
+#pragma omp simd
+            for (size_t k = 0; k < blockSize; k++) {
+              blockResult[k] += alphaI * product[k];
+            }
+          }
+        }
+
+        for (size_t k = 0; k < blockSize; k++) {
+          result[blockStart + k] = blockResult[k];
+        }
+      }
+    }
+  }
+
+  void mult(DataMatrix& alpha, DataMatrix& result) override {
+    const size_t n = storage.getSize();
+    const size_t m = dataset.getNrows();
+    const size_t numberOfVectors = alpha.getNcols();
+
+    result.resizeRowsCols(m, numberOfVectors);
+    updateGrid();
+
+    const size_t numberOfBlocks = (m + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+#pragma omp parallel
+    {
+      BASIS basis(degree);
+      std::vector<double> values(functionLevels.size() * BLOCK_SIZE);
+      std::vector<char> isNonZero(functionLevels.size());
+      // results of the block, BLOCK_SIZE entries per coefficient vector
+      std::vector<double> blockResult(numberOfVectors * BLOCK_SIZE);
+      double product[BLOCK_SIZE];
+
+#pragma omp for schedule(dynamic)
+
+      for (size_t block = 0; block < numberOfBlocks; block++) {
+        const size_t blockStart = block * BLOCK_SIZE;
+        const size_t blockSize = std::min(BLOCK_SIZE, m - blockStart);
+
+        evaluateBlock(basis, blockStart, blockSize, values, isNonZero);
+        std::fill(blockResult.begin(), blockResult.end(), 0.0);
+
+        for (size_t i = 0; i < n; i++) {
+          if (!computeProduct(i, blockSize, values.data(), isNonZero.data(), product)) {
+            continue;
+          }
+
+          // the basis function is evaluated once for all coefficient vectors
+          const double* alphaRow = alpha.getPointer() + i * numberOfVectors;
+
+          for (size_t j = 0; j < numberOfVectors; j++) {
+            const double alphaIJ = alphaRow[j];
+            double* vectorResult = &blockResult[j * BLOCK_SIZE];
+
+            if (alphaIJ != 0.0) {
+#pragma omp simd
+              for (size_t k = 0; k < blockSize; k++) {
+                vectorResult[k] += alphaIJ * product[k];
+              }
+            }
+          }
+        }
+
+        for (size_t k = 0; k < blockSize; k++) {
+          for (size_t j = 0; j < numberOfVectors; j++) {
+            result.set(blockStart + k, j, blockResult[j * BLOCK_SIZE + k]);
+          }
+        }
+      }
+    }
+  }
+
+  void multTranspose(DataVector& source, DataVector& result) override {
+    const size_t n = storage.getSize();
+    const size_t m = dataset.getNrows();
+
+    result.setAll(0.0);
+    updateGrid();
+
+    const size_t numberOfFunctions = functionLevels.size();
+    const size_t numberOfBlocks = (m + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    const size_t groupSize = std::min(TRANSPOSE_GROUP_SIZE, numberOfBlocks);
+    // values and non-zero flags of the 1D functions on the blocks of a group, shared by all threads
+    std::vector<double> values(groupSize * numberOfFunctions * BLOCK_SIZE);
+    std::vector<char> isNonZero(groupSize * numberOfFunctions);
+
+#pragma omp parallel
+    {
+      BASIS basis(degree);
+      double product[BLOCK_SIZE];
+
+      for (size_t groupStart = 0; groupStart < numberOfBlocks;
+           groupStart += TRANSPOSE_GROUP_SIZE) {
+        const size_t groupEnd = std::min(groupStart + TRANSPOSE_GROUP_SIZE, numberOfBlocks);
+        const size_t numberOfEvaluations = (groupEnd - groupStart) * numberOfFunctions;
+
+#pragma omp for schedule(static)
+
+        for (size_t q = 0; q < numberOfEvaluations; q++) {
+          const size_t blockStart = (groupStart + q / numberOfFunctions) * BLOCK_SIZE;
+          isNonZero[q] = evaluateFunction(basis, q % numberOfFunctions, blockStart,
+                                          std::min(BLOCK_SIZE, m - blockStart),
+                                          &values[q * BLOCK_SIZE]);
+        }
+
+        // the grid points are distributed among the threads, hence no reduction is needed
+#pragma omp for schedule(dynamic, 16)
+
+        for (size_t i = 0; i < n; i++) {
+          double sum = 0.0;
+
+          for (size_t block = groupStart; block < groupEnd; block++) {
+            const size_t blockStart = block * BLOCK_SIZE;
+            const size_t blockSize = std::min(BLOCK_SIZE, m - blockStart);
+            const size_t offset = (block - groupStart) * numberOfFunctions;
+            const double* blockSource = source.getPointer() + blockStart;
+
+            if (computeProduct(i, blockSize, &values[offset * BLOCK_SIZE], &isNonZero[offset],
+                               product)) {
+#pragma omp simd reduction(+ : sum)
+              for (size_t k = 0; k < blockSize; k++) {
+                sum += blockSource[k] * product[k];
+              }
+            }
+          }
+
+          result[i] += sum;
+        }
+      }
+    }
+  }
+
+  /**
+   * Determines the distinct 1D basis functions of the grid and transforms the data points
+   * to the unit cube.
+   */
+  void prepare() override {
+    prepareGrid();
+    prepareData();
+    this->isPrepared = true;
+  }
+
+  double getDuration() override { return 0.0; }
+
+  std::string getImplementationName() override { return "BSPLINE_BLOCKED"; }
+
+ protected:
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// B-spline degree
+  size_t degree;
+  /// levels of the distinct 1D basis functions
+  std::vector<GridPoint::level_type> functionLevels;
+  /// indices of the distinct 1D basis functions
+  std::vector<GridPoint::index_type> functionIndices;
+  /// dimension of the distinct 1D basis functions
+  std::vector<size_t> functionDimensions;
+  /// for each grid point and dimension, the number of the corresponding 1D basis function
+  std::vector<size_t> gridPointFunctions;
+  /// data points transformed to the unit cube, stored dimension by dimension
+  std::vector<double> pointsInUnitCube;
+  /// number of grid points when the 1D basis functions were determined
+  size_t preparedGridSize;
+  /// hash of the grid points when the 1D basis functions were determined
+  size_t preparedGridHash;
+
+  /**
+   * Determines the distinct 1D basis functions again if the grid points have changed
+   * (the size alone does not suffice, e.g., after coarsening and refinement).
+   */
+  void updateGrid() {
+    if ((storage.getSize() != preparedGridSize) || (storage.computeHash() != preparedGridHash)) {
+      prepareGrid();
+    }
+  }
+
+  /**
+   * Determines the distinct 1D basis functions of the grid.
+   */
+  void prepareGrid() {
+    const size_t n = storage.getSize();
+    const size_t d = storage.getDimension();
+
+    functionLevels.clear();
+    functionIndices.clear();
+    functionDimensions.clear();
+    gridPointFunctions.resize(n * d);
+
+    for (size_t t = 0; t < d; t++) {
+      std::unordered_map<uint64_t, size_t> functionNumbers;
+
+      for (size_t i = 0; i < n; i++) {
+        const GridPoint& gp = storage.getPoint(i);
+        const GridPoint::level_type l = gp.getLevel(t);
+        const GridPoint::index_type idx = gp.getIndex(t);
+        const uint64_t key = (static_cast<uint64_t>(l) << 32) | static_cast<uint64_t>(idx);
+        auto it = functionNumbers.find(key);
+
+        if (it == functionNumbers.end()) {
+          it = functionNumbers.emplace(key, functionLevels.size()).first;
+          functionLevels.push_back(l);
+          functionIndices.push_back(idx);
+          functionDimensions.push_back(t);
+        }
+
+        gridPointFunctions[i * d + t] = it->second;
+      }
+    }
+
+    preparedGridSize = n;
+    preparedGridHash = storage.computeHash();
+  }
+
+  /**
+   * Transforms the data points to the unit cube and transposes them.
+   */
+  void prepareData() {
+    const size_t m = dataset.getNrows();
+    const size_t d = dataset.getNcols();
+    const BoundingBox& boundingBox = *storage.getBoundingBox();
+
+    pointsInUnitCube.resize(m * d);
+
+    for (size_t j = 0; j < m; j++) {
+      for (size_t t = 0; t < d; t++) {
+        pointsInUnitCube[t * m + j] = boundingBox.transformPointToUnitCube(t, dataset.get(j, t));
+      }
+    }
+  }
+
+  /**
+   * Evaluates a distinct 1D basis function at the points of a block.
+   *
+   * @param basis       1D basis
+   * @param f           number of the 1D function
+   * @param blockStart  number of the first data point of the block
+   * @param blockSize   number of data points of the block
+   * @param fValues     values of the 1D function (blockSize entries)
+   * @return            whether the 1D function is non-zero somewhere in the block
+   */
+  bool evaluateFunction(BASIS& basis, size_t f, size_t blockStart, size_t blockSize,
+                        double* fValues) const {
+    const double* x = &pointsInUnitCube[functionDimensions[f] * dataset.getNrows() + blockStart];
+    bool nonZero = false;
+
+    for (size_t k = 0; k < blockSize; k++) {
+      fValues[k] = basis.eval(functionLevels[f], functionIndices[f], x[k]);
+      nonZero = nonZero || (fValues[k] != 0.0);
+    }
+
+    return nonZero;
+  }
+
+  /**
+   * Evaluates all distinct 1D basis functions at the points of a block.
+   *
+   * @param basis       1D basis
+   * @param blockStart  number of the first data point of the block
+   * @param blockSize   number of data points of the block
+   * @param values      values of the 1D functions (BLOCK_SIZE entries per function)
+   * @param isNonZero   whether the 1D functions are non-zero somewhere in the block
+   */
+  void evaluateBlock(BASIS& basis, size_t blockStart, size_t blockSize,
+                     std::vector<double>& values, std::vector<char>& isNonZero) const {
+    for (size_t f = 0; f < functionLevels.size(); f++) {
+      isNonZero[f] = evaluateFunction(basis, f, blockStart, blockSize, &values[f * BLOCK_SIZE]);
+    }
+  }
+
+  /**
+   * Computes the values of a basis function at the points of a block.
+   *
+   * @param i           sequence number of the grid point
+   * @param blockSize   number of data points of the block
+   * @param values      values of the 1D functions as computed by evaluateBlock
+   * @param isNonZero   non-zero flags of the 1D functions as computed by evaluateBlock
+   * @param product     values of the basis function
+   * @return            false if the basis function vanishes on the whole block
+   *                    (product is not computed in this case)
+   */
+  inline bool computeProduct(size_t i, size_t blockSize, const double* values,
+                             const char* isNonZero, double* product) const {
+    const size_t d = storage.getDimension();
+    const size_t* functions = &gridPointFunctions[i * d];
+
+    for (size_t t = 0; t < d; t++) {
+      if (!isNonZero[functions[t]]) {
+        return false;
+      }
+    }
+
+    const double* firstValues = &values[functions[0] * BLOCK_SIZE];
+
+#pragma omp simd
+    for (size_t k = 0; k < blockSize; k++) {
+      product[k] = firstValues[k];
+    }
+
+    for (size_t t = 1; t < d; t++) {
+      const double* tValues = &values[functions[t] * BLOCK_SIZE];
+
+#pragma omp simd
+      for (size_t k = 0; k < blockSize; k++) {
+        product[k] *= tValues[k];
+      }
+    }
+
+    return true;
+  }
+};
+
+template <class BASIS>
+const size_t OperationMultipleEvalBsplineBlocked<BASIS>::BLOCK_SIZE;
+
+template <class BASIS>
+const size_t OperationMultipleEvalBsplineBlocked<BASIS>::TRANSPOSE_GROUP_SIZE;
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONMULTIPLEEVALBSPLINEBLOCKED_HPP */
@@ -19,6 +19,13 @@ void OperationMultipleEvalLinear::mult(DataVector& alpha, DataVector& result) {
   op.mult(storage, base, alpha, this->dataset, result);
 }
 
+void OperationMultipleEvalLinear::mult(DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmMultipleEvaluation<SLinearBase> op;
+  LinearBasis<unsigned int, unsigned int> base;
+
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
 void OperationMultipleEvalLinear::multTranspose(DataVector& alpha, DataVector& result) {
   AlgorithmMultipleEvaluation<SLinearBase> op;
   LinearBasis<unsigned int, unsigned int> base;
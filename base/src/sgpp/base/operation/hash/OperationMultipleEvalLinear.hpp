@@ -34,6 +34,7 @@ class OperationMultipleEvalLinear : public OperationMultipleEval {
   ~OperationMultipleEvalLinear() override {}
 
   void mult(DataVector& alpha, DataVector& result) override;
+  void mult(DataMatrix& alpha, DataMatrix& result) override;
   void multTranspose(DataVector& source, DataVector& result) override;
 
   double getDuration() override;
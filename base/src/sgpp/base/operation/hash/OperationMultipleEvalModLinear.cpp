@@ -20,6 +20,13 @@ void OperationMultipleEvalModLinear::mult(DataVector& alpha, DataVector& result)
   op.mult(storage, base, alpha, this->dataset, result);
 }
 
+void OperationMultipleEvalModLinear::mult(DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearModifiedBase> op;
+  LinearModifiedBasis<unsigned int, unsigned int> base;
+
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
 void OperationMultipleEvalModLinear::multTranspose(DataVector& source, DataVector& result) {
   AlgorithmDGEMV<SLinearModifiedBase> op;
   LinearModifiedBasis<unsigned int, unsigned int> base;
@@ -35,6 +35,7 @@ class OperationMultipleEvalModLinear : public OperationMultipleEval {
   ~OperationMultipleEvalModLinear() override {}
 
   void mult(DataVector& alpha, DataVector& result) override;
+  void mult(DataMatrix& alpha, DataMatrix& result) override;
   void multTranspose(DataVector& source, DataVector& result) override;
 
   double getDuration() override;
@@ -101,7 +101,8 @@ bool Auto::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
   if (supports[&solverUMFPACK] || supports[&solverGmmpp]) {
     // if at least one of the sparse solvers is supported
     // ==> estimate sparsity ratio of matrix by considering
-    // every inc-th row
+    // every inc-th row (systems like HierarchisationSLE count the
+    // non-zero entries of a row without checking every column)
     size_t nrows = 0;
     size_t nnz = 0;
     size_t inc = static_cast<size_t>(ESTIMATE_NNZ_ROWS_SAMPLE_SIZE * static_cast<double>(n)) + 1;
@@ -110,12 +111,7 @@ bool Auto::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
 
     for (size_t i = 0; i < n; i += inc) {
       nrows++;
-
-      for (size_t j = 0; j < n; j++) {
-        if (system.isMatrixEntryNonZero(i, j)) {
-          nnz++;
-        }
-      }
+      nnz += system.countNNZInRow(i);
     }
 
     // calculate estimate ratio nonzero entries
@@ -5,7 +5,6 @@
 
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/sle/solver/Gmmpp.hpp>
-#include <sgpp/base/tools/sle/system/CloneableSLE.hpp>
 #include <sgpp/globaldef.hpp>
 
 #ifdef USE_GMMPP
@@ -113,54 +112,26 @@ bool Gmmpp::solve(SLE& system, DataVector& b, DataVector& x) const {
   Printer::getInstance().printStatusBegin("Solving linear system (Gmm++)...");
 
   const size_t n = system.getDimension();
-  size_t nnz = 0;
-  size_t rowsDone = 0;
   gmm::csr_matrix<double> A2;
 
-  {
-    gmm::row_matrix<gmm::rsvector<double>> A(n, n);
-
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) shared(system, A, nnz, rowsDone) default(none)
-    {
-      SLE* system2 = &system;
-#ifdef _OPENMP
-      std::unique_ptr<CloneableSLE> clonedSLE;
+  // assemble the matrix in CSR format (in parallel if supported by the system)
+  Printer::getInstance().printStatusUpdate("constructing sparse matrix");
 
-      if (system.isCloneable() && (omp_get_max_threads() > 1)) {
-        dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
-        system2 = clonedSLE.get();
-      }
+  std::vector<size_t> rowPtr;
+  std::vector<size_t> colIdx;
+  std::vector<double> values;
+  system.getSparseMatrix(rowPtr, colIdx, values);
+  const size_t nnz = values.size();
 
-#endif /* _OPENMP */
+  {
+    gmm::row_matrix<gmm::rsvector<double>> A(n, n);
 
 // copy system matrix to Gmm++ matrix object
-#pragma omp for ordered schedule(static)
-
-      for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < n; j++) {
-          double entry = system2->getMatrixEntry(i, j);
-
-          if (entry != 0) {
-#pragma omp critical
-            {
-              A(i, j) = entry;
-              nnz++;
-            }
-          }
-        }
-
-#pragma omp atomic
-        rowsDone++;
-
-        // status message
-        if (rowsDone % 100 == 0) {
-          char str[10];
-          snprintf(str, sizeof(str), "%.1f%%",
-                 static_cast<double>(rowsDone) / static_cast<double>(n) * 100.0);
-          Printer::getInstance().printStatusUpdate("constructing sparse matrix (" +
-                                                   std::string(str) + ")");
-        }
+// (the rows are independent, the columns of each row are sorted)
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < n; i++) {
+      for (size_t k = rowPtr[i]; k < rowPtr[i + 1]; k++) {
+        A(i, colIdx[k]) = values[k];
       }
     }
 
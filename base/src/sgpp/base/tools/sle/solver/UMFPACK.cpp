@@ -5,7 +5,6 @@
 
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/sle/solver/UMFPACK.hpp>
-#include <sgpp/base/tools/sle/system/CloneableSLE.hpp>
 #include <sgpp/globaldef.hpp>
 
 #ifdef USE_UMFPACK
@@ -30,9 +29,11 @@ typedef UF_long sslong;
 #endif
 
 /**
+ * Solve the transposed system, i.e., the system matrix is given in CSR format.
+ *
  * @param       numeric result of umfpack_dl_numeric()
- * @param       Ap      CCS column pointers
- * @param       Ai      CCS row indices
+ * @param       Ap      CCS column pointers (CSR row pointers of the system matrix)
+ * @param       Ai      CCS row indices (CSR column indices of the system matrix)
  * @param       Ax      CCS matrix entries
  * @param       b       right-hand side
  * @param[out]  x       solution to the system
@@ -45,7 +46,7 @@ bool solveInternal(void* numeric, const std::vector<sslong>& Ap, const std::vect
   x.resize(n);
   x.setAll(0.0);
 
-  sslong result = umfpack_dl_solve(UMFPACK_A, &Ap[0], &Ai[0], &Ax[0], x.getPointer(),
+  sslong result = umfpack_dl_solve(UMFPACK_At, &Ap[0], &Ai[0], &Ax[0], x.getPointer(),
                                    b.getPointer(), numeric, nullptr, nullptr);
   return (result == UMFPACK_OK);
 }
@@ -73,66 +74,14 @@ bool UMFPACK::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
 
   const size_t n = system.getDimension();
 
-  size_t nnz = 0;
-  std::vector<uint32_t> Ti;
-  std::vector<uint32_t> Tj;
-  std::vector<double> Tx;
-  size_t rowsDone = 0;
+  // assemble the matrix in CSR format (in parallel if supported by the system)
+  Printer::getInstance().printStatusUpdate("constructing sparse matrix");
 
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) \
-shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
-  {
-    SLE* system2 = &system;
-#ifdef _OPENMP
-    std::unique_ptr<CloneableSLE> clonedSLE;
-
-    if (system.isCloneable() && (omp_get_max_threads() > 1)) {
-      dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
-      system2 = clonedSLE.get();
-    }
-
-#endif /* _OPENMP */
-
-    std::vector<uint32_t> curTi;
-    std::vector<uint32_t> curTj;
-    std::vector<double> curTx;
-
-// get indices and values of nonzero entries
-#pragma omp for ordered schedule(static)
-
-    for (uint32_t i = 0; i < n; i++) {
-      for (uint32_t j = 0; j < n; j++) {
-        double entry = system2->getMatrixEntry(i, j);
-
-        if (entry != 0) {
-          curTi.push_back(i);
-          curTj.push_back(j);
-          curTx.push_back(entry);
-        }
-      }
-
-#pragma omp atomic
-      rowsDone++;
-
-      // status message
-      if (rowsDone % 100 == 0) {
-        char str[10];
-        snprintf(str, sizeof(str), "%.1f%%",
-                 static_cast<double>(rowsDone) / static_cast<double>(n) * 100.0);
-        Printer::getInstance().printStatusUpdate("constructing sparse matrix (" +
-                                                 std::string(str) + ")");
-      }
-    }
-
-#pragma omp critical
-    {
-      Ti.insert(Ti.end(), curTi.begin(), curTi.end());
-      Tj.insert(Tj.end(), curTj.begin(), curTj.end());
-      Tx.insert(Tx.end(), curTx.begin(), curTx.end());
-      nnz += curTx.size();
-    }
-  }
+  std::vector<size_t> rowPtr;
+  std::vector<size_t> colIdx;
+  std::vector<double> values;
+  system.getSparseMatrix(rowPtr, colIdx, values);
+  const size_t nnz = values.size();
 
   Printer::getInstance().printStatusUpdate("constructing sparse matrix (100.0%)");
   Printer::getInstance().printStatusNewLine();
@@ -146,41 +95,18 @@ shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
     Printer::getInstance().printStatusNewLine();
   }
 
-  std::vector<sslong> Ap(n + 1, 0);
-  std::vector<sslong> Ai(nnz, 0);
-  std::vector<double> Ax(nnz, 0.0);
+  // the CSR arrays of the matrix are the CCS arrays of its transpose
+  // ==> factorize the transpose and solve with UMFPACK_At
+  // (no conversion via umfpack_dl_triplet_to_col necessary)
+  std::vector<sslong> Ap(rowPtr.begin(), rowPtr.end());
+  std::vector<sslong> Ai(colIdx.begin(), colIdx.end());
+  std::vector<double>& Ax = values;
 
   sslong result;
 
-  // convert matrix to CCS
-  {
-    std::vector<sslong> TiArray(nnz, 0);
-    std::vector<sslong> TjArray(nnz, 0);
-
-    for (size_t k = 0; k < nnz; k++) {
-      TiArray[k] = static_cast<sslong>(Ti[k]);
-      TjArray[k] = static_cast<sslong>(Tj[k]);
-    }
-
-    Printer::getInstance().printStatusUpdate("step 1: umfpack_dl_triplet_to_col");
-
-    result = umfpack_dl_triplet_to_col(static_cast<sslong>(n), static_cast<sslong>(n),
-                                       static_cast<sslong>(nnz), &TiArray[0], &TjArray[0], &Tx[0],
-                                       &Ap[0], &Ai[0], &Ax[0], nullptr);
-
-    if (result != UMFPACK_OK) {
-      Printer::getInstance().printStatusEnd(
-          "error: Could not convert to CCS via "
-          "umfpack_dl_triplet_to_col, error code " +
-          std::to_string(result));
-      return false;
-    }
-  }
-
   void *symbolic, *numeric;
 
-  Printer::getInstance().printStatusNewLine();
-  Printer::getInstance().printStatusUpdate("step 2: umfpack_dl_symbolic");
+  Printer::getInstance().printStatusUpdate("step 1: umfpack_dl_symbolic");
 
   // call umfpack_dl_symbolic
   result = umfpack_dl_symbolic(static_cast<sslong>(n), static_cast<sslong>(n), &Ap[0], &Ai[0],
@@ -195,7 +121,7 @@ shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
   }
 
   Printer::getInstance().printStatusNewLine();
-  Printer::getInstance().printStatusUpdate("step 3: umfpack_dl_numeric");
+  Printer::getInstance().printStatusUpdate("step 2: umfpack_dl_numeric");
 
   // call umfpack_dl_numeric
   result = umfpack_dl_numeric(&Ap[0], &Ai[0], &Ax[0], symbolic, &numeric, nullptr, nullptr);
@@ -221,9 +147,9 @@ shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
     Printer::getInstance().printStatusNewLine();
 
     if (B.getNcols() == 1) {
-      Printer::getInstance().printStatusUpdate("step 4: umfpack_dl_solve");
+      Printer::getInstance().printStatusUpdate("step 3: umfpack_dl_solve");
     } else {
-      Printer::getInstance().printStatusUpdate("step 4: umfpack_dl_solve (RHS " +
+      Printer::getInstance().printStatusUpdate("step 3: umfpack_dl_solve (RHS " +
                                                std::to_string(i + 1) + " of " +
                                                std::to_string(B.getNcols()) + ")");
     }
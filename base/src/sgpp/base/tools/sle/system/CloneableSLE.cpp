@@ -0,0 +1,60 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/sle/system/CloneableSLE.hpp>
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+void CloneableSLE::getSparsityPattern(std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx) {
+  probeSparseMatrixInParallel(rowPtr, colIdx, nullptr);
+}
+
+void CloneableSLE::getSparseMatrix(std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx,
+                                   std::vector<double>& values) {
+  probeSparseMatrixInParallel(rowPtr, colIdx, &values);
+}
+
+void CloneableSLE::probeSparseMatrixInParallel(std::vector<size_t>& rowPtr,
+                                               std::vector<size_t>& colIdx,
+                                               std::vector<double>* values) {
+#ifdef _OPENMP
+  const size_t numberOfThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t numberOfThreads = 1;
+#endif /* _OPENMP */
+
+  // matrix entry lookups might not be thread-safe
+  // ==> every thread except the master thread gets its own clone
+  std::vector<std::unique_ptr<CloneableSLE>> clones(numberOfThreads);
+
+  for (size_t thread = 1; thread < numberOfThreads; thread++) {
+    clone(clones[thread]);
+  }
+
+  assembleSparseMatrix(
+      [this, &clones](size_t i, std::vector<size_t>& columns, std::vector<double>* rowValues) {
+#ifdef _OPENMP
+        const size_t thread = static_cast<size_t>(omp_get_thread_num());
+#else
+        const size_t thread = 0;
+#endif /* _OPENMP */
+        CloneableSLE& system = ((thread == 0) ? *this : *clones[thread]);
+        system.probeMatrixRow(i, columns, rowValues);
+      },
+      (numberOfThreads > 1), rowPtr, colIdx, values);
+}
+
+}  // namespace base
+}  // namespace sgpp
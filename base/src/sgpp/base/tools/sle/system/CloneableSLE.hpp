@@ -8,7 +8,9 @@
 #include <sgpp/base/tools/sle/system/SLE.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -45,6 +47,37 @@ class CloneableSLE : public SLE {
    * @return whether this system derives from CloneableSLE or not (true)
    */
   bool isCloneable() const override { return true; }
+
+  /**
+   * Compute the sparsity pattern of the matrix in CSR format.
+   * The rows are checked in parallel, every thread uses its own clone of the system.
+   *
+   * @param[out] rowPtr   row pointers (size n + 1)
+   * @param[out] colIdx   column indices of the non-zero entries (size nnz)
+   */
+  void getSparsityPattern(std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx) override;
+
+  /**
+   * Assemble the matrix in CSR format.
+   * The rows are assembled in parallel, every thread uses its own clone of the system.
+   *
+   * @param[out] rowPtr   row pointers (size n + 1)
+   * @param[out] colIdx   column indices of the non-zero entries (size nnz)
+   * @param[out] values   values of the non-zero entries (size nnz)
+   */
+  void getSparseMatrix(std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx,
+                       std::vector<double>& values) override;
+
+ protected:
+  /**
+   * Check all columns of the rows in parallel with one clone of the system per thread.
+   *
+   * @param[out]  rowPtr    row pointers (size n + 1)
+   * @param[out]  colIdx    column indices of the non-zero entries
+   * @param[out]  values    values of the non-zero entries (nullptr for the pattern only)
+   */
+  void probeSparseMatrixInParallel(std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx,
+                                   std::vector<double>* values);
 };
 }  // namespace base
 }  // namespace sgpp
@@ -0,0 +1,233 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/sle/system/HierarchisationSLE.hpp>
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+size_t HierarchisationSLE::countNNZInRow(size_t i) {
+  prepareSparsityStructure();
+  std::vector<size_t> columns;
+  getNonZeroEntriesInRow(i, columns, nullptr);
+  return columns.size();
+}
+
+size_t HierarchisationSLE::countNNZ() {
+  std::vector<size_t> rowPtr;
+  std::vector<size_t> colIdx;
+  getSparsityPattern(rowPtr, colIdx);
+  return colIdx.size();
+}
+
+void HierarchisationSLE::getSparsityPattern(std::vector<size_t>& rowPtr,
+                                            std::vector<size_t>& colIdx) {
+  prepareSparsityStructure();
+  assembleSparseMatrix(
+      [this](size_t i, std::vector<size_t>& columns, std::vector<double>* values) {
+        getNonZeroEntriesInRow(i, columns, values);
+      },
+      true, rowPtr, colIdx, nullptr);
+}
+
+void HierarchisationSLE::getSparseMatrix(std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx,
+                                         std::vector<double>& values) {
+  prepareSparsityStructure();
+  assembleSparseMatrix(
+      [this](size_t i, std::vector<size_t>& columns, std::vector<double>* rowValues) {
+        getNonZeroEntriesInRow(i, columns, rowValues);
+      },
+      true, rowPtr, colIdx, &values);
+}
+
+void HierarchisationSLE::prepareSparsityStructure() {
+  const size_t n = gridStorage.getSize();
+  const size_t d = gridStorage.getDimension();
+  const size_t gridHash = gridStorage.computeHash();
+
+  // the size alone does not suffice, as the grid might have changed without changing its size
+  // (e.g., points deleted by coarsening and inserted by refinement)
+  if ((sparsityStructureGridSize == n) && (sparsityStructureGridHash == gridHash)) {
+    return;
+  }
+
+  levelIndexIDs1d.assign(n * d, 0);
+  nonZeroBasisPtr1d.assign(d, std::vector<size_t>());
+  nonZeroBasisIDs1d.assign(d, std::vector<size_t>());
+  nonZeroBasisValues1d.assign(d, std::vector<double>());
+
+  for (size_t t = 0; t < d; t++) {
+    // number the distinct 1D level-index pairs (ascending by level and index),
+    // the values of the map are first the index of a grid point with this pair
+    std::map<std::pair<level_t, index_t>, size_t> levelIndexIDs;
+
+    for (size_t k = 0; k < n; k++) {
+      const GridPoint& gp = gridStorage[k];
+      levelIndexIDs.emplace(std::make_pair(gp.getLevel(t), gp.getIndex(t)), k);
+    }
+
+    const size_t m = levelIndexIDs.size();
+    std::vector<std::pair<level_t, index_t>> levelIndexPairs;
+    std::vector<double> coordinates;
+    levelIndexPairs.reserve(m);
+    coordinates.reserve(m);
+
+    for (auto& entry : levelIndexIDs) {
+      levelIndexPairs.push_back(entry.first);
+      coordinates.push_back(gridStorage.getUnitCoordinate(gridStorage[entry.second], t));
+      entry.second = levelIndexPairs.size() - 1;
+    }
+
+    for (size_t k = 0; k < n; k++) {
+      const GridPoint& gp = gridStorage[k];
+      levelIndexIDs1d[k * d + t] =
+          levelIndexIDs[std::make_pair(gp.getLevel(t), gp.getIndex(t))];
+    }
+
+    // evaluate all 1D basis functions at all 1D grid points
+    std::vector<std::vector<size_t>> nonZeroBasisIDs(m);
+    std::vector<std::vector<double>> nonZeroBasisValues(m);
+
+#pragma omp parallel
+    {
+      // basis evaluations might not be thread-safe
+      // ==> every thread except the master thread uses its own clone
+      HierarchisationSLE* system = this;
+#ifdef _OPENMP
+      std::unique_ptr<CloneableSLE> clonedSLE;
+
+      if (omp_get_thread_num() > 0) {
+        clone(clonedSLE);
+        system = static_cast<HierarchisationSLE*>(clonedSLE.get());
+      }
+
+#endif /* _OPENMP */
+
+#pragma omp for schedule(dynamic, 16)
+      for (size_t pointID = 0; pointID < m; pointID++) {
+        for (size_t basisID = 0; basisID < m; basisID++) {
+          const double value = system->evalBasisFunction1dAtGridPoint(
+              levelIndexPairs[basisID].first, levelIndexPairs[basisID].second,
+              levelIndexPairs[pointID].first, levelIndexPairs[pointID].second,
+              coordinates[pointID]);
+
+          if (value != 0.0) {
+            nonZeroBasisIDs[pointID].push_back(basisID);
+            nonZeroBasisValues[pointID].push_back(value);
+          }
+        }
+      }
+    }
+
+    nonZeroBasisPtr1d[t].assign(m + 1, 0);
+
+    for (size_t pointID = 0; pointID < m; pointID++) {
+      nonZeroBasisPtr1d[t][pointID + 1] =
+          nonZeroBasisPtr1d[t][pointID] + nonZeroBasisIDs[pointID].size();
+      nonZeroBasisIDs1d[t].insert(nonZeroBasisIDs1d[t].end(), nonZeroBasisIDs[pointID].begin(),
+                                  nonZeroBasisIDs[pointID].end());
+      nonZeroBasisValues1d[t].insert(nonZeroBasisValues1d[t].end(),
+                                     nonZeroBasisValues[pointID].begin(),
+                                     nonZeroBasisValues[pointID].end());
+    }
+  }
+
+  // sort grid points lexicographically by their 1D IDs
+  sortedGridPoints.resize(n);
+
+  for (size_t k = 0; k < n; k++) {
+    sortedGridPoints[k] = k;
+  }
+
+  std::sort(sortedGridPoints.begin(), sortedGridPoints.end(), [this, d](size_t k1, size_t k2) {
+    return std::lexicographical_compare(
+        levelIndexIDs1d.begin() + k1 * d, levelIndexIDs1d.begin() + (k1 + 1) * d,
+        levelIndexIDs1d.begin() + k2 * d, levelIndexIDs1d.begin() + (k2 + 1) * d);
+  });
+
+  sparsityStructureGridSize = n;
+  sparsityStructureGridHash = gridHash;
+}
+
+void HierarchisationSLE::getNonZeroEntriesInRow(size_t i, std::vector<size_t>& columns,
+                                                std::vector<double>* values) const {
+  std::vector<std::pair<size_t, double>> entries;
+  searchNonZeroEntries(i, 0, 0, sortedGridPoints.size(), 1.0, entries);
+  std::sort(entries.begin(), entries.end());
+
+  columns.resize(entries.size());
+
+  for (size_t k = 0; k < entries.size(); k++) {
+    columns[k] = entries[k].first;
+  }
+
+  if (values != nullptr) {
+    values->resize(entries.size());
+
+    for (size_t k = 0; k < entries.size(); k++) {
+      (*values)[k] = entries[k].second;
+    }
+  }
+}
+
+void HierarchisationSLE::searchNonZeroEntries(
+    size_t i, size_t t, size_t begin, size_t end, double value,
+    std::vector<std::pair<size_t, double>>& entries) const {
+  const size_t d = gridStorage.getDimension();
+
+  if (t == d) {
+    // the range consists of exactly one grid point whose basis function
+    // doesn't vanish at the i-th grid point
+    entries.emplace_back(sortedGridPoints[begin], value);
+    return;
+  }
+
+  const size_t pointID = levelIndexIDs1d[i * d + t];
+  const std::vector<size_t>& basisIDs = nonZeroBasisIDs1d[t];
+  const std::vector<double>& basisValues = nonZeroBasisValues1d[t];
+  const auto lessID = [this, d, t](size_t k, size_t basisID) {
+    return (levelIndexIDs1d[k * d + t] < basisID);
+  };
+  const auto greaterID = [this, d, t](size_t basisID, size_t k) {
+    return (basisID < levelIndexIDs1d[k * d + t]);
+  };
+
+  // the grid points in the range are sorted by their 1D IDs in the t-th dimension,
+  // as are the 1D basis functions which don't vanish at the i-th grid point
+  // ==> descend into the sub-ranges of the matching 1D IDs
+  std::vector<size_t>::const_iterator position = sortedGridPoints.begin() + begin;
+  const std::vector<size_t>::const_iterator rangeEnd = sortedGridPoints.begin() + end;
+
+  for (size_t k = nonZeroBasisPtr1d[t][pointID];
+       (k < nonZeroBasisPtr1d[t][pointID + 1]) && (position != rangeEnd); k++) {
+    position = std::lower_bound(position, rangeEnd, basisIDs[k], lessID);
+
+    if ((position == rangeEnd) || (levelIndexIDs1d[*position * d + t] != basisIDs[k])) {
+      continue;
+    }
+
+    const std::vector<size_t>::const_iterator subRangeEnd =
+        std::upper_bound(position, rangeEnd, basisIDs[k], greaterID);
+    searchNonZeroEntries(i, t + 1, position - sortedGridPoints.begin(),
+                         subRangeEnd - sortedGridPoints.begin(), value * basisValues[k],
+                         entries);
+    position = subRangeEnd;
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
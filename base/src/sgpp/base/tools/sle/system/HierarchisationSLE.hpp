@@ -57,6 +57,8 @@
 #include <cstring>
 #include <memory>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -84,7 +86,12 @@ class HierarchisationSLE : public CloneableSLE {
    *                          grid points according to gridStorage)
    */
   HierarchisationSLE(Grid& grid, GridStorage& gridStorage)
-      : CloneableSLE(), grid(grid), gridStorage(gridStorage), basisType(INVALID) {
+      : CloneableSLE(),
+        grid(grid),
+        gridStorage(gridStorage),
+        basisType(INVALID),
+        sparsityStructureGridSize(0),
+        sparsityStructureGridHash(0) {
     // initialize the correct basis (according to the grid)
     if (grid.getType() == GridType::Bspline) {
       bsplineBasis = std::unique_ptr<SBsplineBase>(
@@ -222,6 +229,42 @@ class HierarchisationSLE : public CloneableSLE {
     return evalBasisFunctionAtGridPoint(j, i);
   }
 
+  /**
+   * Count the non-zero entries of a row by searching the grid
+   * for the basis functions whose support contains the grid point.
+   *
+   * @param i     row index
+   * @return      number of non-zero entries in the i-th row
+   */
+  size_t countNNZInRow(size_t i) override;
+
+  /**
+   * @return      number of non-zero entries
+   */
+  size_t countNNZ() override;
+
+  /**
+   * Compute the sparsity pattern in CSR format without probing all matrix entries.
+   * For every grid point, the basis functions which do not vanish at the point are found
+   * by intersecting the 1D supports dimension by dimension (see prepareSparsityStructure).
+   * The rows are computed in parallel.
+   *
+   * @param[out] rowPtr   row pointers (size n + 1)
+   * @param[out] colIdx   column indices of the non-zero entries (size nnz)
+   */
+  void getSparsityPattern(std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx) override;
+
+  /**
+   * Assemble the matrix in CSR format without probing all matrix entries
+   * (see getSparsityPattern). The rows are assembled in parallel.
+   *
+   * @param[out] rowPtr   row pointers (size n + 1)
+   * @param[out] colIdx   column indices of the non-zero entries (size nnz)
+   * @param[out] values   values of the non-zero entries (size nnz)
+   */
+  void getSparseMatrix(std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx,
+                       std::vector<double>& values) override;
+
   /**
    * @return          sparse grid
    */
@@ -322,59 +365,130 @@ class HierarchisationSLE : public CloneableSLE {
     WAVELET_MODIFIED,
   } basisType;
 
+  /// number of grid points the sparsity structure has been prepared for (0 if not prepared)
+  size_t sparsityStructureGridSize;
+  /// hash of the grid points the sparsity structure has been prepared for
+  size_t sparsityStructureGridHash;
+  /// IDs of the 1D level-index pairs of the grid points (row-major, size n * dim)
+  std::vector<size_t> levelIndexIDs1d;
+  /// for every dimension, start of the non-zero 1D basis values of every 1D level-index pair
+  std::vector<std::vector<size_t>> nonZeroBasisPtr1d;
+  /// for every dimension, 1D level-index IDs of the non-zero 1D basis functions
+  std::vector<std::vector<size_t>> nonZeroBasisIDs1d;
+  /// for every dimension, values of the non-zero 1D basis functions
+  std::vector<std::vector<double>> nonZeroBasisValues1d;
+  /// grid point indices sorted lexicographically by their 1D level-index IDs
+  std::vector<size_t> sortedGridPoints;
+
   /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th basis function at the
-   *                  pointJ-th grid point
+   * Prepare the data needed for the sparse assembly (if not already done for the current
+   * grid points, see GridStorage::computeHash).
+   * In every dimension, the distinct 1D level-index pairs of the grid are numbered and the
+   * 1D basis functions are evaluated at all 1D grid points (the matrix entries are products
+   * of these 1D values). In addition, the grid points are sorted lexicographically by their
+   * 1D IDs, such that the grid points whose basis functions do not vanish at a given point
+   * can be found by a hierarchical search (first dimension first) in the sorted grid.
    */
-  inline double evalBasisFunctionAtGridPoint(size_t basisI, size_t pointJ) {
+  void prepareSparsityStructure();
+
+  /**
+   * Find the non-zero entries of a row. prepareSparsityStructure has to be called before.
+   * This method is thread-safe.
+   *
+   * @param       i         row index
+   * @param[out]  columns   column indices of the non-zero entries (sorted ascendingly)
+   * @param[out]  values    values of the non-zero entries (may be nullptr)
+   */
+  void getNonZeroEntriesInRow(size_t i, std::vector<size_t>& columns,
+                              std::vector<double>* values) const;
+
+  /**
+   * Recursive part of getNonZeroEntriesInRow.
+   *
+   * @param           i         row index
+   * @param           t         current dimension
+   * @param           begin     begin of the range in sortedGridPoints whose 1D IDs in the
+   *                            dimensions 0, ..., t-1 match
+   * @param           end       end of the range
+   * @param           value     product of the 1D basis values in the dimensions 0, ..., t-1
+   * @param[in,out]   entries   found column indices and values
+   */
+  void searchNonZeroEntries(size_t i, size_t t, size_t begin, size_t end, double value,
+                            std::vector<std::pair<size_t, double>>& entries) const;
+
+  /**
+   * @param basisLevel    level of the 1D basis function
+   * @param basisIndex    index of the 1D basis function
+   * @param pointLevel    level of the 1D grid point
+   * @param pointIndex    index of the 1D grid point
+   * @param x             coordinate of the 1D grid point
+   * @return              factor of the 1D basis function in the matrix entries
+   *                      (see evalBasisFunctionAtGridPoint)
+   */
+  inline double evalBasisFunction1dAtGridPoint(level_t basisLevel, index_t basisIndex,
+                                               level_t pointLevel, index_t pointIndex,
+                                               double x) {
+    if ((basisType == FUNDAMENTAL_NAK_SPLINE) || (basisType == FUNDAMENTAL_SPLINE) ||
+        (basisType == FUNDAMENTAL_SPLINE_MODIFIED)) {
+      if (pointLevel < basisLevel) {
+        return 0.0;
+      } else if (pointLevel == basisLevel) {
+        return ((pointIndex == basisIndex) ? 1.0 : 0.0);
+      }
+    } else if ((basisType == WEAKLY_FUNDAMENTAL_NAK_SPLINE) ||
+               (basisType == WEAKLY_FUNDAMENTAL_NAK_SPLINE_MODIFIED) ||
+               (basisType == WEAKLY_FUNDAMENTAL_SPLINE)) {
+      if (pointLevel < basisLevel) {
+        return 0.0;
+      }
+    }
+
     if (basisType == BSPLINE) {
-      return evalBsplineFunctionAtGridPoint(basisI, pointJ);
+      return bsplineBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == BSPLINE_BOUNDARY) {
-      return evalBsplineBoundaryFunctionAtGridPoint(basisI, pointJ);
+      return bsplineBoundaryBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == BSPLINE_CLENSHAW_CURTIS) {
-      return evalBsplineClenshawCurtisFunctionAtGridPoint(basisI, pointJ);
+      return bsplineClenshawCurtisBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == BSPLINE_MODIFIED) {
-      return evalBsplineModifiedFunctionAtGridPoint(basisI, pointJ);
+      return modBsplineBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == BSPLINE_MODIFIED_CLENSHAW_CURTIS) {
-      return evalBsplineModifiedClenshawCurtisFunctionAtGridPoint(basisI, pointJ);
+      return modBsplineClenshawCurtisBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == FUNDAMENTAL_NAK_SPLINE) {
-      return evalFundamentalNakSplineFunctionAtGridPoint(basisI, pointJ);
+      return fundamentalNakSplineBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == FUNDAMENTAL_SPLINE) {
-      return evalFundamentalSplineFunctionAtGridPoint(basisI, pointJ);
+      return fundamentalSplineBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == FUNDAMENTAL_SPLINE_MODIFIED) {
-      return evalFundamentalSplineModifiedFunctionAtGridPoint(basisI, pointJ);
+      return modFundamentalSplineBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == WEAKLY_FUNDAMENTAL_NAK_SPLINE) {
-      return evalWeaklyFundamentalNakSplineFunctionAtGridPoint(basisI, pointJ);
+      return weaklyFundamentalNakSplineBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == WEAKLY_FUNDAMENTAL_NAK_SPLINE_MODIFIED) {
-      return evalWeaklyFundamentalNakSplineModifiedFunctionAtGridPoint(basisI, pointJ);
+      return modWeaklyFundamentalNakSplineBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == WEAKLY_FUNDAMENTAL_SPLINE) {
-      return evalWeaklyFundamentalSplineFunctionAtGridPoint(basisI, pointJ);
+      return weaklyFundamentalSplineBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == LINEAR) {
-      return evalLinearFunctionAtGridPoint(basisI, pointJ);
+      return linearBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == LINEAR_BOUNDARY) {
-      return evalLinearBoundaryFunctionAtGridPoint(basisI, pointJ);
+      return linearL0BoundaryBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == LINEAR_CLENSHAW_CURTIS) {
-      return evalLinearClenshawCurtisFunctionAtGridPoint(basisI, pointJ);
+      return linearClenshawCurtisBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == LINEAR_CLENSHAW_CURTIS_BOUNDARY) {
-      return evalLinearClenshawCurtisBoundaryFunctionAtGridPoint(basisI, pointJ);
+      return linearClenshawCurtisBoundaryBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == LINEAR_MODIFIED) {
-      return evalLinearModifiedFunctionAtGridPoint(basisI, pointJ);
+      return modLinearBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == NATURAL_BSPLINE) {
-      return evalNaturalBsplineFunctionAtGridPoint(basisI, pointJ);
+      return naturalBsplineBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == NAK_BSPLINE) {
-      return evalNakBsplineFunctionAtGridPoint(basisI, pointJ);
+      return nakBsplineBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == NAK_BSPLINE_MODIFIED) {
-      return evalNakBsplineModifiedFunctionAtGridPoint(basisI, pointJ);
+      return modNakBsplineBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == WAVELET) {
-      return evalWaveletFunctionAtGridPoint(basisI, pointJ);
+      return waveletBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == WAVELET_BOUNDARY) {
-      return evalWaveletBoundaryFunctionAtGridPoint(basisI, pointJ);
+      return waveletBoundaryBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == WAVELET_MODIFIED) {
-      return evalWaveletModifiedFunctionAtGridPoint(basisI, pointJ);
+      return modWaveletBasis->eval(basisLevel, basisIndex, x);
     } else if (basisType == NAK_BSPLINEBOUNDARY_COMBIGRID) {
-      return evalNakBsplineBoundaryCombigridFunctionAtGridPoint(basisI, pointJ);
+      return nakBsplineBoundaryCombigridBasis->eval(basisLevel, basisIndex, x);
     } else {
       return 0.0;
     }
@@ -383,604 +497,19 @@ class HierarchisationSLE : public CloneableSLE {
   /**
    * @param basisI    basis function index
    * @param pointJ    grid point index
-   * @return          value of the basisI-th B-spline basis function
-   *                  at the pointJ-th grid point
-   */
-  inline double evalBsplineFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = bsplineBasis->eval(gpBasis.getLevel(t), gpBasis.getIndex(t),
-                                                 gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th B-spline boundary
-   *                  basis function at the pointJ-th grid point
-   */
-  inline double evalBsplineBoundaryFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = bsplineBoundaryBasis->eval(gpBasis.getLevel(t), gpBasis.getIndex(t),
-                                                         gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th B-spline Clenshaw-Curtis
-   *                  basis function at the pointJ-th grid point
-   */
-  inline double evalBsplineClenshawCurtisFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = bsplineClenshawCurtisBasis->eval(
-          gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th modified B-spline
-   *                  basis function at the pointJ-th grid point
-   */
-  inline double evalBsplineModifiedFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = modBsplineBasis->eval(gpBasis.getLevel(t), gpBasis.getIndex(t),
-                                                    gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th modified Clenshaw-Curtis
-   *                  B-spline basis function at the pointJ-th grid point
-   */
-  inline double evalBsplineModifiedClenshawCurtisFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = modBsplineClenshawCurtisBasis->eval(
-          gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th fundamental not-a-knot spline basis
-   *                  function at the pointJ-th grid point
-   */
-  inline double evalFundamentalNakSplineFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      if (gpPoint.getLevel(t) < gpBasis.getLevel(t)) {
-        return 0.0;
-      } else if (gpPoint.getLevel(t) == gpBasis.getLevel(t)) {
-        if (gpPoint.getIndex(t) != gpBasis.getIndex(t)) {
-          return 0.0;
-        }
-      } else {
-        const double result1d = fundamentalNakSplineBasis->eval(
-            gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-        if (result1d == 0.0) {
-          return 0.0;
-        }
-
-        result *= result1d;
-      }
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th fundamental spline basis
-   *                  function at the pointJ-th grid point
-   */
-  inline double evalFundamentalSplineFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      if (gpPoint.getLevel(t) < gpBasis.getLevel(t)) {
-        return 0.0;
-      } else if (gpPoint.getLevel(t) == gpBasis.getLevel(t)) {
-        if (gpPoint.getIndex(t) != gpBasis.getIndex(t)) {
-          return 0.0;
-        }
-      } else {
-        const double result1d = fundamentalSplineBasis->eval(
-            gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-        if (result1d == 0.0) {
-          return 0.0;
-        }
-
-        result *= result1d;
-      }
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th modified fundamental spline
-   *                  basis function at the pointJ-th grid point
-   */
-  inline double evalFundamentalSplineModifiedFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      if (gpPoint.getLevel(t) < gpBasis.getLevel(t)) {
-        return 0.0;
-      } else if (gpPoint.getLevel(t) == gpBasis.getLevel(t)) {
-        if (gpPoint.getIndex(t) != gpBasis.getIndex(t)) {
-          return 0.0;
-        }
-      } else {
-        const double result1d = modFundamentalSplineBasis->eval(
-            gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-        if (result1d == 0.0) {
-          return 0.0;
-        }
-
-        result *= result1d;
-      }
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th weakly fundamental not-a-knot spline basis
-   *                  function at the pointJ-th grid point
-   */
-  inline double evalWeaklyFundamentalNakSplineFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const base::GridPoint& gpBasis = gridStorage[basisI];
-    const base::GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      if (gpPoint.getLevel(t) < gpBasis.getLevel(t)) {
-        return 0.0;
-      } else {
-        const double result1d = weaklyFundamentalNakSplineBasis->eval(
-            gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-        if (result1d == 0.0) {
-          return 0.0;
-        }
-
-        result *= result1d;
-      }
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th modified weakly fundamental not-a-knot spline basis
-   *                  function at the pointJ-th grid point
-   */
-  inline double evalWeaklyFundamentalNakSplineModifiedFunctionAtGridPoint(
-      size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      if (gpPoint.getLevel(t) < gpBasis.getLevel(t)) {
-        return 0.0;
-      } else {
-        const double result1d = modWeaklyFundamentalNakSplineBasis->eval(
-            gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-        if (result1d == 0.0) {
-          return 0.0;
-        }
-
-        result *= result1d;
-      }
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th weakly fundamental spline basis
-   *                  function at the pointJ-th grid point
-   */
-  inline double evalWeaklyFundamentalSplineFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      if (gpPoint.getLevel(t) < gpBasis.getLevel(t)) {
-        return 0.0;
-      } else {
-        const double result1d = weaklyFundamentalSplineBasis->eval(
-            gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-        if (result1d == 0.0) {
-          return 0.0;
-        }
-
-        result *= result1d;
-      }
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th linear
-   *                  basis function at the pointJ-th grid point
-   */
-  inline double evalLinearFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = linearBasis->eval(gpBasis.getLevel(t), gpBasis.getIndex(t),
-                                                gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th linear boundary
-   *                  basis function at the pointJ-th grid point
-   */
-  inline double evalLinearBoundaryFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = linearL0BoundaryBasis->eval(
-          gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th linear Clenshaw-Curtis
-   *                  basis function at the pointJ-th grid point
-   */
-  inline double evalLinearClenshawCurtisFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = linearClenshawCurtisBasis->eval(
-          gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
- * @param basisI    basis function index
- * @param pointJ    grid point index
- * @return          value of the basisI-th linear Clenshaw-Curtis
- *                  boundary basis function at the pointJ-th grid point
- */
-  inline double evalLinearClenshawCurtisBoundaryFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = linearClenshawCurtisBoundaryBasis->eval(
-          gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th modified linear
-   *                  basis function at the pointJ-th grid point
-   */
-  inline double evalLinearModifiedFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = modLinearBasis->eval(gpBasis.getLevel(t), gpBasis.getIndex(t),
-                                                   gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th natural B-spline basis function
-   *                  at the pointJ-th grid point
-   */
-  inline double evalNaturalBsplineFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = naturalBsplineBasis->eval(
-          gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th not-a-knot B-spline basis function
-   *                  at the pointJ-th grid point
-   */
-  inline double evalNakBsplineFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = nakBsplineBasis->eval(
-          gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th modified not-a-knot B-spline basis function
-   *                  at the pointJ-th grid point
-   */
-  inline double evalNakBsplineModifiedFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = modNakBsplineBasis->eval(
-          gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th wavelet
-   *                  basis function at the pointJ-th grid point
-   */
-  inline double evalWaveletFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = waveletBasis->eval(gpBasis.getLevel(t), gpBasis.getIndex(t),
-                                                 gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th wavelet boundary
-   *                  basis function at the pointJ-th grid point
-   */
-  inline double evalWaveletBoundaryFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = waveletBoundaryBasis->eval(gpBasis.getLevel(t), gpBasis.getIndex(t),
-                                                         gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-   * @param basisI    basis function index
-   * @param pointJ    grid point index
-   * @return          value of the basisI-th modified wavelet
-   *                  basis function at the pointJ-th grid point
+   * @return          value of the basisI-th basis function at the
+   *                  pointJ-th grid point (product of the factors of
+   *                  evalBasisFunction1dAtGridPoint)
    */
-  inline double evalWaveletModifiedFunctionAtGridPoint(size_t basisI, size_t pointJ) {
-    const GridPoint& gpBasis = gridStorage[basisI];
-    const GridPoint& gpPoint = gridStorage[pointJ];
-    double result = 1.0;
-
-    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = modWaveletBasis->eval(gpBasis.getLevel(t), gpBasis.getIndex(t),
-                                                    gridStorage.getUnitCoordinate(gpPoint, t));
-
-      if (result1d == 0.0) {
-        return 0.0;
-      }
-
-      result *= result1d;
-    }
-
-    return result;
-  }
-
-  /**
-       * @param basisI    basis function index
-       * @param pointJ    grid point index
-       * @return          value of the basisI-th not-a-knot B-spline basis function
-       *                  at the pointJ-th grid point
-       */
-  inline double evalNakBsplineBoundaryCombigridFunctionAtGridPoint(size_t basisI, size_t pointJ) {
+  inline double evalBasisFunctionAtGridPoint(size_t basisI, size_t pointJ) {
     const GridPoint& gpBasis = gridStorage[basisI];
     const GridPoint& gpPoint = gridStorage[pointJ];
     double result = 1.0;
 
     for (size_t t = 0; t < gridStorage.getDimension(); t++) {
-      const double result1d = nakBsplineBoundaryCombigridBasis->eval(
-          gpBasis.getLevel(t), gpBasis.getIndex(t), gridStorage.getUnitCoordinate(gpPoint, t));
+      const double result1d = evalBasisFunction1dAtGridPoint(
+          gpBasis.getLevel(t), gpBasis.getIndex(t), gpPoint.getLevel(t), gpPoint.getIndex(t),
+          gridStorage.getUnitCoordinate(gpPoint, t));
 
       if (result1d == 0.0) {
         return 0.0;
@@ -0,0 +1,132 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/sle/system/SLE.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+size_t SLE::countNNZInRow(size_t i) {
+  const size_t n = getDimension();
+  size_t nnz = 0;
+
+  for (size_t j = 0; j < n; j++) {
+    if (isMatrixEntryNonZero(i, j)) {
+      nnz++;
+    }
+  }
+
+  return nnz;
+}
+
+void SLE::getSparsityPattern(std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx) {
+  assembleSparseMatrix(
+      [this](size_t i, std::vector<size_t>& columns, std::vector<double>* values) {
+        probeMatrixRow(i, columns, values);
+      },
+      false, rowPtr, colIdx, nullptr);
+}
+
+void SLE::getSparseMatrix(std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx,
+                          std::vector<double>& values) {
+  assembleSparseMatrix(
+      [this](size_t i, std::vector<size_t>& columns, std::vector<double>* values) {
+        probeMatrixRow(i, columns, values);
+      },
+      false, rowPtr, colIdx, &values);
+}
+
+void SLE::probeMatrixRow(size_t i, std::vector<size_t>& columns, std::vector<double>* values) {
+  const size_t n = getDimension();
+  columns.clear();
+
+  if (values == nullptr) {
+    for (size_t j = 0; j < n; j++) {
+      if (isMatrixEntryNonZero(i, j)) {
+        columns.push_back(j);
+      }
+    }
+  } else {
+    values->clear();
+
+    for (size_t j = 0; j < n; j++) {
+      const double entry = getMatrixEntry(i, j);
+
+      if (entry != 0.0) {
+        columns.push_back(j);
+        values->push_back(entry);
+      }
+    }
+  }
+}
+
+void SLE::assembleSparseMatrix(const RowFunction& rowFunction, bool parallel,
+                               std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx,
+                               std::vector<double>* values) {
+  // number of rows per block (blocks are the unit of work of the threads)
+  const size_t blockSize = 256;
+  const size_t n = getDimension();
+  const size_t numberOfBlocks = (n + blockSize - 1) / blockSize;
+  const bool withValues = (values != nullptr);
+
+  std::vector<std::vector<size_t>> blockColIdx(numberOfBlocks);
+  std::vector<std::vector<double>> blockValues(numberOfBlocks);
+  rowPtr.assign(n + 1, 0);
+
+  // compute the entries of the blocks, the number of entries of the i-th row
+  // is temporarily stored in rowPtr[i+1]
+#pragma omp parallel if (parallel)
+  {
+    std::vector<size_t> columns;
+    std::vector<double> rowValues;
+
+#pragma omp for schedule(dynamic)
+    for (size_t block = 0; block < numberOfBlocks; block++) {
+      const size_t rowEnd = std::min((block + 1) * blockSize, n);
+
+      for (size_t i = block * blockSize; i < rowEnd; i++) {
+        rowFunction(i, columns, (withValues ? &rowValues : nullptr));
+        rowPtr[i + 1] = columns.size();
+        blockColIdx[block].insert(blockColIdx[block].end(), columns.begin(), columns.end());
+
+        if (withValues) {
+          blockValues[block].insert(blockValues[block].end(), rowValues.begin(),
+                                    rowValues.end());
+        }
+      }
+    }
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    rowPtr[i + 1] += rowPtr[i];
+  }
+
+  const size_t nnz = rowPtr[n];
+  colIdx.resize(nnz);
+
+  if (withValues) {
+    values->resize(nnz);
+  }
+
+  // copy the blocks to the CSR arrays
+#pragma omp parallel for schedule(static) if (parallel)
+  for (size_t block = 0; block < numberOfBlocks; block++) {
+    const size_t offset = rowPtr[block * blockSize];
+    std::copy(blockColIdx[block].begin(), blockColIdx[block].end(), colIdx.begin() + offset);
+
+    if (withValues) {
+      std::copy(blockValues[block].begin(), blockValues[block].end(),
+                values->begin() + offset);
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
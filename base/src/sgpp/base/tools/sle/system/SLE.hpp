@@ -9,6 +9,8 @@
 #include <sgpp/globaldef.hpp>
 
 #include <cstddef>
+#include <functional>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -88,6 +90,37 @@ class SLE {
     return nnz;
   }
 
+  /**
+   * Count the non-zero entries of a row.
+   * Standard implementation with \f$\mathcal{O}(n)\f$ checks.
+   *
+   * @param i     row index
+   * @return      number of non-zero entries in the i-th row
+   */
+  virtual size_t countNNZInRow(size_t i);
+
+  /**
+   * Compute the sparsity pattern of the matrix in CSR format
+   * (compressed sparse row, the column indices of each row are sorted ascendingly).
+   * Standard implementation with \f$\mathcal{O}(n^2)\f$ checks.
+   *
+   * @param[out] rowPtr   row pointers (size n + 1), the column indices
+   *                      of the i-th row are colIdx[rowPtr[i]], ..., colIdx[rowPtr[i+1]-1]
+   * @param[out] colIdx   column indices of the non-zero entries (size nnz)
+   */
+  virtual void getSparsityPattern(std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx);
+
+  /**
+   * Assemble the matrix in CSR format (see getSparsityPattern).
+   * Standard implementation with \f$\mathcal{O}(n^2)\f$ calls of getMatrixEntry.
+   *
+   * @param[out] rowPtr   row pointers (size n + 1)
+   * @param[out] colIdx   column indices of the non-zero entries (size nnz)
+   * @param[out] values   values of the non-zero entries (size nnz)
+   */
+  virtual void getSparseMatrix(std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx,
+                               std::vector<double>& values);
+
   /**
    * Pure virtual method returning the dimension (number of rows/columns)
    * of the system.
@@ -101,6 +134,38 @@ class SLE {
    *         (standard: false)
    */
   virtual bool isCloneable() const { return false; }
+
+ protected:
+  /**
+   * Function computing the non-zero entries of a row, the arguments are the row index,
+   * the column indices (sorted ascendingly) and the values of the entries
+   * (nullptr if only the sparsity pattern is needed).
+   */
+  typedef std::function<void(size_t, std::vector<size_t>&, std::vector<double>*)> RowFunction;
+
+  /**
+   * Determine the non-zero entries of a row by checking all columns.
+   *
+   * @param       i         row index
+   * @param[out]  columns   column indices of the non-zero entries
+   * @param[out]  values    values of the non-zero entries
+   *                        (if nullptr, only isMatrixEntryNonZero is called)
+   */
+  void probeMatrixRow(size_t i, std::vector<size_t>& columns, std::vector<double>* values);
+
+  /**
+   * Assemble a CSR matrix row by row. The rows are split into contiguous blocks,
+   * which are processed in parallel if requested (then rowFunction has to be thread-safe).
+   *
+   * @param       rowFunction   computes the non-zero entries of a row
+   * @param       parallel      whether to process the rows in parallel
+   * @param[out]  rowPtr        row pointers (size n + 1)
+   * @param[out]  colIdx        column indices of the non-zero entries
+   * @param[out]  values        values of the non-zero entries (nullptr for the pattern only)
+   */
+  void assembleSparseMatrix(const RowFunction& rowFunction, bool parallel,
+                            std::vector<size_t>& rowPtr, std::vector<size_t>& colIdx,
+                            std::vector<double>* values);
 };
 }  // namespace base
 }  // namespace sgpp
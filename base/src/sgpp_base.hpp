@@ -114,6 +114,7 @@
 #include <sgpp/base/grid/generation/functors/ClassificationRefinementFunctor.hpp>
 #include <sgpp/base/grid/generation/functors/PersistentErrorRefinementFunctor.hpp>
 #include <sgpp/base/grid/generation/functors/PredictiveRefinementDimensionIndicator.hpp>*/
+#include <sgpp/base/grid/storage/hashmap/BinaryGridFile.hpp>
 #include <sgpp/base/grid/type/BsplineBoundaryGrid.hpp>
 #include <sgpp/base/grid/type/BsplineClenshawCurtisGrid.hpp>
 #include <sgpp/base/grid/type/BsplineGrid.hpp>
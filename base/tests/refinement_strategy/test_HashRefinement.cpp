@@ -0,0 +1,181 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
+#include <atomic>
+#include <memory>
+#include <random>
+
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridPoint;
+using sgpp::base::GridStorage;
+using sgpp::base::HashRefinement;
+using sgpp::base::RefinementFunctor;
+using sgpp::base::SurplusRefinementFunctor;
+
+namespace {
+
+/**
+ * Refines a regular grid with surpluses that contain many ties, using the given number of
+ * OpenMP threads.
+ */
+std::unique_ptr<Grid> refineWithThreads(int numThreads) {
+  const size_t dim = 3;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> distribution(0, 4);
+  DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(distribution(generator));
+  }
+
+#ifdef _OPENMP
+  const int oldNumThreads = omp_get_max_threads();
+  omp_set_num_threads(numThreads);
+#endif /* _OPENMP */
+
+  HashRefinement refinement;
+  SurplusRefinementFunctor functor(alpha, 15);
+  refinement.free_refine(grid->getStorage(), functor);
+
+#ifdef _OPENMP
+  omp_set_num_threads(oldNumThreads);
+#endif /* _OPENMP */
+
+  return grid;
+}
+
+/**
+ * Number of threads of the innermost parallel region the caller is executed in.
+ */
+int currentNumThreads() {
+#ifdef _OPENMP
+  return omp_get_num_threads();
+#else
+  return 1;
+#endif /* _OPENMP */
+}
+
+/**
+ * Surplus functor that does not declare itself thread-safe and records the largest number of
+ * threads it was called from concurrently.
+ */
+class RecordingFunctor : public RefinementFunctor {
+ public:
+  explicit RecordingFunctor(DataVector& alpha) : alpha(alpha), maxThreads(0) {}
+
+  double operator()(GridStorage& storage, size_t seq) const override {
+    int threads = currentNumThreads();
+    int oldThreads = maxThreads.load();
+
+    while ((threads > oldThreads) && !maxThreads.compare_exchange_weak(oldThreads, threads)) {
+    }
+
+    return alpha[seq];
+  }
+
+  double start() const override { return 0.0; }
+
+  size_t getRefinementsNum() const override { return 5; }
+
+  double getRefinementThreshold() const override { return 0.0; }
+
+  DataVector& alpha;
+  mutable std::atomic<int> maxThreads;
+};
+
+/**
+ * Subclass of HashRefinement, e.g., as generated for a SWIG director.
+ */
+class DerivedRefinement : public HashRefinement {};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestHashRefinement)
+
+BOOST_AUTO_TEST_CASE(testTieBreak) {
+  // of the refinable points with equal indicators, the one with the smallest
+  // sequence number is refined
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(1));
+  GridStorage& storage = grid->getStorage();
+  grid->getGenerator().regular(2);
+
+  DataVector alpha(storage.getSize(), 1.0);
+  HashRefinement refinement;
+  SurplusRefinementFunctor functor(alpha, 1);
+  refinement.free_refine(storage, functor);
+
+  BOOST_REQUIRE_EQUAL(storage.getSize(), 5);
+  const GridPoint::index_type refinedIndex = storage.getPoint(1).getIndex(0);
+
+  for (size_t i = 3; i < 5; i++) {
+    const GridPoint::index_type index = storage.getPoint(i).getIndex(0);
+    BOOST_CHECK_EQUAL(storage.getPoint(i).getLevel(0), 3);
+    BOOST_CHECK((index == 2 * refinedIndex - 1) || (index == 2 * refinedIndex + 1));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testThreadIndependence) {
+  // the refined grid, including the order of the new points, does not depend on the
+  // number of threads collecting the refinement candidates
+  std::unique_ptr<Grid> serialGrid = refineWithThreads(1);
+  std::unique_ptr<Grid> parallelGrid = refineWithThreads(4);
+  GridStorage& serialStorage = serialGrid->getStorage();
+  GridStorage& parallelStorage = parallelGrid->getStorage();
+
+  BOOST_REQUIRE_EQUAL(serialStorage.getSize(), parallelStorage.getSize());
+
+  for (size_t i = 0; i < serialStorage.getSize(); i++) {
+    BOOST_CHECK(serialStorage.getPoint(i).equals(parallelStorage.getPoint(i)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSerialFallback) {
+  // functors and subclasses that are not known to be thread-safe are evaluated by a single thread
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(3));
+  grid->getGenerator().regular(4);
+  DataVector alpha(grid->getSize(), 1.0);
+
+  HashRefinement refinement;
+  DerivedRefinement derivedRefinement;
+  SurplusRefinementFunctor surplusFunctor(alpha);
+  BOOST_CHECK(refinement.isThreadSafe());
+  BOOST_CHECK(!derivedRefinement.isThreadSafe());
+  BOOST_CHECK(surplusFunctor.isThreadSafe());
+
+  RecordingFunctor functor(alpha);
+  BOOST_CHECK(!functor.isThreadSafe());
+
+#ifdef _OPENMP
+  const int oldNumThreads = omp_get_max_threads();
+  omp_set_num_threads(4);
+#endif /* _OPENMP */
+
+  refinement.free_refine(grid->getStorage(), functor);
+
+#ifdef _OPENMP
+  omp_set_num_threads(oldNumThreads);
+#endif /* _OPENMP */
+
+  BOOST_CHECK_EQUAL(functor.maxThreads.load(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,14 +6,19 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/grid/storage/hashmap/BinaryGridFile.hpp>
 
 #include <algorithm>
+#include <cstdio>
+#include <memory>
 #include <vector>
 #include <string>
 
+using sgpp::base::BinaryGridFile;
 using sgpp::base::BoundingBox;
 using sgpp::base::DataVector;
 using sgpp::base::DataMatrix;
@@ -22,6 +27,7 @@ using sgpp::base::generation_exception;
 using sgpp::base::Grid;
 using sgpp::base::GridGenerator;
 using sgpp::base::GridStorage;
+using sgpp::base::GridType;
 using sgpp::base::OperationEval;
 using sgpp::base::OperationMultipleEval;
 using sgpp::base::Stretching;
@@ -37,6 +43,25 @@ BOOST_AUTO_TEST_CASE(testCreation) {
   BOOST_CHECK(factory != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(testCreationFromConfiguration) {
+  // the grid created from a configuration and its equivalent type must have the configured type
+  for (GridType type : {GridType::Linear, GridType::LinearBoundary, GridType::LinearL0Boundary,
+                        GridType::LinearStencil, GridType::ModLinearStencil}) {
+    sgpp::base::RegularGridConfiguration gridConfig;
+    gridConfig.type_ = type;
+    gridConfig.dim_ = 2;
+    gridConfig.level_ = 2;
+    // with the default boundary level 0, LinearBoundary would create a LinearL0Boundary grid
+    gridConfig.boundaryLevel_ = 1;
+
+    std::unique_ptr<Grid> grid(Grid::createGrid(gridConfig));
+    BOOST_CHECK(grid->getType() == type);
+
+    std::unique_ptr<Grid> equivalentGrid(grid->createGridOfEquivalentType(3));
+    BOOST_CHECK(equivalentGrid->getType() == type);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testSerializationLinear) {
   // Uses Linear grid for tests
 
@@ -371,6 +396,113 @@ BOOST_AUTO_TEST_CASE(testSerializationLinearBoundaryWithLeaf) {
   }
 }
 
+/**
+ * Writes the grid with and without coefficients in the binary format and checks that
+ * both are restored.
+ */
+void checkBinarySerialization(Grid& grid, const std::string& fileName) {
+  DataVector alpha(grid.getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i);
+  }
+
+  BinaryGridFile::write(fileName, grid, alpha);
+
+  {
+    BinaryGridFile file(fileName);
+    BOOST_CHECK_EQUAL(file.getDimension(), grid.getDimension());
+    BOOST_CHECK_EQUAL(file.getSize(), grid.getSize());
+    BOOST_CHECK(file.hasCoefficients());
+
+    std::unique_ptr<Grid> newGrid(file.createGrid());
+    BOOST_CHECK(newGrid->getType() == grid.getType());
+    BOOST_CHECK_EQUAL(newGrid->serialize(), grid.serialize());
+
+    // the points are at the same coordinates (i.e., bounding box or stretching were restored)
+    DataVector coordinates(grid.getDimension());
+    DataVector newCoordinates(grid.getDimension());
+
+    for (size_t i = 0; i < grid.getSize(); i++) {
+      grid.getStorage().getCoordinates(grid.getStorage().getPoint(i), coordinates);
+      newGrid->getStorage().getCoordinates(newGrid->getStorage().getPoint(i), newCoordinates);
+
+      for (size_t d = 0; d < grid.getDimension(); d++) {
+        BOOST_CHECK_EQUAL(newCoordinates[d], coordinates[d]);
+      }
+    }
+
+    DataVector newAlpha;
+    file.getCoefficients(newAlpha);
+    BOOST_CHECK_EQUAL(newAlpha.getSize(), alpha.getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      BOOST_CHECK_EQUAL(newAlpha[i], alpha[i]);
+      BOOST_CHECK_EQUAL(file.getCoefficientsData()[i], alpha[i]);
+    }
+
+    GridStorage storage(grid.getDimension());
+    file.loadStorage(storage);
+    BOOST_CHECK_EQUAL(storage.serialize(), grid.getStorage().serialize());
+  }
+
+  BinaryGridFile::write(fileName, grid);
+
+  {
+    BinaryGridFile file(fileName);
+    BOOST_CHECK(!file.hasCoefficients());
+    BOOST_CHECK(file.getCoefficientsData() == nullptr);
+  }
+
+  std::remove(fileName.c_str());
+  BOOST_CHECK_THROW(BinaryGridFile file(fileName), sgpp::base::file_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testBinarySerialization) {
+  std::unique_ptr<Grid> grid(Grid::createModBsplineGrid(3, 3));
+  grid->getGenerator().regular(3);
+  grid->getBoundingBox().setBoundary(1, BoundingBox1D(-2.0, 2.0));
+
+  // adaptive grids contain non-leaf points whose children are missing
+  DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i);
+  }
+
+  SurplusRefinementFunctor functor(alpha, 3);
+  grid->getGenerator().refine(functor);
+
+  checkBinarySerialization(*grid, "test_GridFactory_binary_modbspline.tmp");
+}
+
+BOOST_AUTO_TEST_CASE(testBinarySerializationBoundary) {
+  // boundary grids with and without the level 0 points in the interior subspaces
+  std::unique_ptr<Grid> grid(Grid::createLinearBoundaryGrid(3));
+  grid->getGenerator().regular(3);
+  grid->getBoundingBox().setBoundary(0, BoundingBox1D(0.5, 7.0));
+  checkBinarySerialization(*grid, "test_GridFactory_binary_boundary.tmp");
+
+  std::unique_ptr<Grid> gridL0(Grid::createLinearBoundaryGrid(3, 0));
+  gridL0->getGenerator().regular(3);
+  checkBinarySerialization(*gridL0, "test_GridFactory_binary_boundary_l0.tmp");
+}
+
+BOOST_AUTO_TEST_CASE(testBinarySerializationStretched) {
+  Stretching1D str1d;
+  str1d.type = "log";
+  str1d.x_0 = 1;
+  str1d.xsi = 10;
+  BoundingBox1D dimBound(0.5, 7.0);
+  Stretching stretch({dimBound, BoundingBox1D(1.0, 3.0)}, {str1d, str1d});
+
+  std::unique_ptr<Grid> grid(Grid::createLinearStretchedBoundaryGrid(2));
+  grid->getStorage().setStretching(stretch);
+  grid->getGenerator().regular(3);
+
+  checkBinarySerialization(*grid, "test_GridFactory_binary_stretched.tmp");
+}
+
 // end test suite TestGridFactory
 BOOST_AUTO_TEST_SUITE_END()
 
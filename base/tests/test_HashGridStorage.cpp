@@ -14,6 +14,7 @@
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
 
+#include <list>
 #include <string>
 #include <vector>
 
@@ -21,6 +22,7 @@ using sgpp::base::DataVector;
 using sgpp::base::HashGenerator;
 using sgpp::base::HashGridPoint;
 using sgpp::base::HashGridStorage;
+using sgpp::base::HashGridStorageBackend;
 using sgpp::base::HashRefinement;
 using sgpp::base::HashRefinementBoundaries;
 using sgpp::base::SurplusRefinementFunctor;
@@ -194,6 +196,81 @@ BOOST_AUTO_TEST_CASE(testSeq) {
   BOOST_CHECK(s.isInvalidSequenceNumber(seq));
 }
 
+BOOST_AUTO_TEST_CASE(testOpenAddressingBackend) {
+  HashGridStorage s(3);
+  HashGridStorage sFlat(3);
+  HashGenerator g;
+
+  sFlat.setBackend(HashGridStorageBackend::OpenAddressing);
+  g.regular(s, 4);
+  g.regular(sFlat, 4);
+
+  BOOST_CHECK_EQUAL(s.getSize(), sFlat.getSize());
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK_EQUAL(sFlat.getSequenceNumber(s[i]), s.getSequenceNumber(s[i]));
+    BOOST_CHECK_EQUAL(sFlat.getFlatIndex().getLevel(i, 2), s[i].getLevel(2));
+  }
+
+  // points that are not contained
+  HashGridPoint p(3);
+  p.set(0, 5, 1);
+  p.set(1, 1, 1);
+  p.set(2, 1, 1);
+  BOOST_CHECK(!sFlat.isContaining(p));
+  BOOST_CHECK(sFlat.isInvalidSequenceNumber(sFlat.getSequenceNumber(p)));
+
+  // insert and deleteLast
+  size_t seq = sFlat.insert(p);
+  BOOST_CHECK_EQUAL(seq, s.getSize());
+  BOOST_CHECK_EQUAL(sFlat.getSequenceNumber(p), seq);
+  sFlat.deleteLast();
+  BOOST_CHECK(!sFlat.isContaining(p));
+  BOOST_CHECK_EQUAL(sFlat.getSize(), s.getSize());
+
+  // update
+  HashGridPoint oldPoint(sFlat[3]);
+  sFlat.update(p, 3);
+  BOOST_CHECK_EQUAL(sFlat.getSequenceNumber(p), 3U);
+  BOOST_CHECK(!sFlat.isContaining(oldPoint));
+  sFlat.update(oldPoint, 3);
+  BOOST_CHECK_EQUAL(sFlat.getSequenceNumber(oldPoint), 3U);
+
+  // the grid_map is built on demand
+  size_t numMapEntries = 0;
+
+  for (HashGridStorage::grid_map_iterator iter = sFlat.begin(); iter != sFlat.end(); iter++) {
+    BOOST_CHECK_EQUAL(iter->second, s.getSequenceNumber(*iter->first));
+    numMapEntries++;
+  }
+
+  BOOST_CHECK_EQUAL(numMapEntries, s.getSize());
+
+  // deletePoints
+  std::list<size_t> removePoints;
+  removePoints.push_back(s.getSize() - 1);
+  removePoints.push_back(5);
+  std::list<size_t> removePointsFlat(removePoints);
+  std::vector<size_t> remaining = s.deletePoints(removePoints);
+  std::vector<size_t> remainingFlat = sFlat.deletePoints(removePointsFlat);
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(remaining.begin(), remaining.end(), remainingFlat.begin(),
+                                remainingFlat.end());
+  BOOST_CHECK_EQUAL(s.getSize(), sFlat.getSize());
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK_EQUAL(sFlat.getSequenceNumber(s[i]), i);
+    BOOST_CHECK_EQUAL(sFlat[i].isLeaf(), s[i].isLeaf());
+  }
+
+  // switching back to the unordered_map keeps the points
+  sFlat.setBackend(HashGridStorageBackend::UnorderedMap);
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK_EQUAL(sFlat.getSequenceNumber(s[i]), i);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(TestHashGridStorageWithT)
@@ -9,14 +9,22 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalBsplineBlocked.hpp>
+
+#include <list>
+#include <memory>
+#include <random>
+#include <vector>
 
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::base::GridStorage;
+using sgpp::base::GridType;
 using sgpp::base::OperationMultipleEval;
 
 BOOST_AUTO_TEST_SUITE(TestOperationMultipleEval)
@@ -78,4 +86,265 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalTranspose) {
+  // compare the parallel transposed evaluation with the naive implementation
+  const size_t dim = 3;
+  const size_t numberDataPoints = 500;
+  std::vector<GridType> gridTypes = {GridType::Linear, GridType::LinearBoundary};
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (GridType gridType : gridTypes) {
+    sgpp::base::RegularGridConfiguration gridConfig;
+    gridConfig.type_ = gridType;
+    gridConfig.dim_ = dim;
+    gridConfig.level_ = 5;
+    std::unique_ptr<Grid> grid(Grid::createGrid(gridConfig));
+    grid->getGenerator().regular(5);
+
+    const size_t N = grid->getSize();
+    DataMatrix dataset(numberDataPoints, dim);
+    DataVector source(numberDataPoints);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      for (size_t t = 0; t < dim; t++) {
+        dataset.set(j, t, distribution(generator));
+      }
+
+      source[j] = distribution(generator) - 0.5;
+    }
+
+    DataVector result(N);
+    DataVector resultNaive(N);
+    std::unique_ptr<OperationMultipleEval>(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset))
+        ->multTranspose(source, result);
+    std::unique_ptr<OperationMultipleEval>(
+        sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset))
+        ->multTranspose(source, resultNaive);
+
+    for (size_t i = 0; i < N; i++) {
+      BOOST_CHECK_SMALL(result[i] - resultNaive[i], 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalBspline) {
+  // compare the blocked B-spline kernels with the naive implementations
+  const size_t dim = 3;
+  const size_t degree = 3;
+  const size_t numberDataPoints = 150;
+  std::vector<GridType> gridTypes = {GridType::Bspline, GridType::BsplineBoundary,
+                                     GridType::ModBspline, GridType::BsplineClenshawCurtis,
+                                     GridType::ModBsplineClenshawCurtis};
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (GridType gridType : gridTypes) {
+    sgpp::base::RegularGridConfiguration gridConfig;
+    gridConfig.type_ = gridType;
+    gridConfig.dim_ = dim;
+    gridConfig.level_ = 4;
+    gridConfig.maxDegree_ = degree;
+    std::unique_ptr<Grid> grid(Grid::createGrid(gridConfig));
+    grid->getGenerator().regular(4);
+    grid->getBoundingBox().setBoundary(1, BoundingBox1D(-2.0, 2.0));
+
+    const size_t N = grid->getSize();
+    DataMatrix dataset(numberDataPoints, dim);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      for (size_t t = 0; t < dim; t++) {
+        dataset.set(j, t, distribution(generator));
+      }
+
+      dataset.set(j, 1, 4.0 * dataset.get(j, 1) - 2.0);
+    }
+
+    DataVector alpha(N);
+    DataVector source(numberDataPoints);
+
+    for (size_t i = 0; i < N; i++) {
+      alpha[i] = distribution(generator) - 0.5;
+    }
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      source[j] = distribution(generator) - 0.5;
+    }
+
+    std::unique_ptr<OperationMultipleEval> opEval(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+    std::unique_ptr<OperationMultipleEval> opEvalNaive(
+        sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+
+    DataVector result(numberDataPoints);
+    DataVector resultNaive(numberDataPoints);
+    opEval->mult(alpha, result);
+    opEvalNaive->mult(alpha, resultNaive);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      BOOST_CHECK_SMALL(result[j] - resultNaive[j], 1e-10);
+    }
+
+    DataVector resultTranspose(N);
+    DataVector resultTransposeNaive(N);
+    opEval->multTranspose(source, resultTranspose);
+    opEvalNaive->multTranspose(source, resultTransposeNaive);
+
+    for (size_t i = 0; i < N; i++) {
+      BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeNaive[i], 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalBsplineRefined) {
+  // the blocked B-spline kernel prepares the grid once, it has to follow a refinement of the grid
+  // (more data points than a group of blocks of multTranspose)
+  const size_t dim = 2;
+  const size_t numberDataPoints = 1100;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  std::unique_ptr<Grid> grid(Grid::createModBsplineGrid(dim, 3));
+  grid->getGenerator().regular(3);
+
+  DataMatrix dataset(numberDataPoints, dim);
+  DataVector source(numberDataPoints);
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset.set(j, t, distribution(generator));
+    }
+
+    source[j] = distribution(generator) - 0.5;
+  }
+
+  std::unique_ptr<OperationMultipleEval> opEval(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+  for (size_t refinement = 0; refinement < 2; refinement++) {
+    const size_t N = grid->getSize();
+    DataVector alpha(N);
+
+    for (size_t i = 0; i < N; i++) {
+      alpha[i] = distribution(generator) - 0.5;
+    }
+
+    std::unique_ptr<OperationMultipleEval> opEvalNaive(
+        sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+
+    DataVector result(numberDataPoints);
+    DataVector resultNaive(numberDataPoints);
+    opEval->mult(alpha, result);
+    opEvalNaive->mult(alpha, resultNaive);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      BOOST_CHECK_SMALL(result[j] - resultNaive[j], 1e-10);
+    }
+
+    DataVector resultTranspose(N);
+    DataVector resultTransposeNaive(N);
+    opEval->multTranspose(source, resultTranspose);
+    opEvalNaive->multTranspose(source, resultTransposeNaive);
+
+    for (size_t i = 0; i < N; i++) {
+      BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeNaive[i], 1e-10);
+    }
+
+    sgpp::base::SurplusRefinementFunctor functor(alpha, 3);
+    grid->getGenerator().refine(functor);
+    BOOST_CHECK_GT(grid->getSize(), N);
+  }
+
+  // replace the last grid point by another one, such that the number of grid points is unchanged
+  GridStorage& storage = grid->getStorage();
+  const size_t N = storage.getSize();
+  std::list<size_t> removePoints = {N - 1};
+  storage.deletePoints(removePoints);
+  sgpp::base::GridPoint gp(dim);
+  gp.set(0, 6, 1);
+  gp.set(1, 1, 1);
+  BOOST_CHECK(!storage.isContaining(gp));
+  storage.insert(gp);
+  BOOST_CHECK_EQUAL(storage.getSize(), N);
+
+  DataVector alpha(N);
+
+  for (size_t i = 0; i < N; i++) {
+    alpha[i] = distribution(generator) - 0.5;
+  }
+
+  std::unique_ptr<OperationMultipleEval> opEvalNaive(
+      sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+  DataVector result(numberDataPoints);
+  DataVector resultNaive(numberDataPoints);
+  opEval->mult(alpha, result);
+  opEvalNaive->mult(alpha, resultNaive);
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    BOOST_CHECK_SMALL(result[j] - resultNaive[j], 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalMultipleVectors) {
+  // evaluating several coefficient vectors at once must match the evaluation column by column
+  const size_t dim = 3;
+  const size_t numberDataPoints = 150;
+  const size_t numberOfVectors = 5;
+  std::vector<GridType> gridTypes = {GridType::Linear, GridType::ModLinear, GridType::Bspline,
+                                     GridType::ModBspline, GridType::LinearBoundary};
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (GridType gridType : gridTypes) {
+    sgpp::base::RegularGridConfiguration gridConfig;
+    gridConfig.type_ = gridType;
+    gridConfig.dim_ = dim;
+    gridConfig.level_ = 4;
+    gridConfig.maxDegree_ = 3;
+    std::unique_ptr<Grid> grid(Grid::createGrid(gridConfig));
+    grid->getGenerator().regular(4);
+
+    const size_t N = grid->getSize();
+    DataMatrix dataset(numberDataPoints, dim);
+    DataMatrix alpha(N, numberOfVectors);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      for (size_t t = 0; t < dim; t++) {
+        dataset.set(j, t, distribution(generator));
+      }
+    }
+
+    for (size_t i = 0; i < N; i++) {
+      for (size_t k = 0; k < numberOfVectors; k++) {
+        alpha.set(i, k, distribution(generator) - 0.5);
+      }
+    }
+
+    std::unique_ptr<OperationMultipleEval> opEval(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+    DataMatrix result;
+    opEval->mult(alpha, result);
+
+    BOOST_REQUIRE_EQUAL(result.getNrows(), numberDataPoints);
+    BOOST_REQUIRE_EQUAL(result.getNcols(), numberOfVectors);
+
+    DataVector alphaColumn(N);
+    DataVector resultColumn(numberDataPoints);
+
+    for (size_t k = 0; k < numberOfVectors; k++) {
+      alpha.getColumn(k, alphaColumn);
+      opEval->mult(alphaColumn, resultColumn);
+
+      for (size_t j = 0; j < numberDataPoints; j++) {
+        BOOST_CHECK_SMALL(result.get(j, k) - resultColumn[j], 1e-10);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -8,6 +8,7 @@
 
 #include <sgpp/base/function/scalar/InterpolantScalarFunction.hpp>
 #include <sgpp/base/function/scalar/ScalarFunction.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/RandomNumberGenerator.hpp>
 #include <sgpp/base/tools/sle/solver/Armadillo.hpp>
@@ -22,6 +23,7 @@
 
 #include <cmath>
 #include <limits>
+#include <list>
 #include <vector>
 
 using sgpp::base::CloneableSLE;
@@ -333,3 +335,120 @@ BOOST_AUTO_TEST_CASE(TestHierarchisationSLE) {
     }
   }
 }
+
+void testSparseSLE(SLE& system) {
+  // Test sgpp::base::SLE::getSparsityPattern, getSparseMatrix and countNNZInRow
+  // against the matrix entries.
+  const size_t n = system.getDimension();
+  std::vector<size_t> rowPtr;
+  std::vector<size_t> colIdx;
+  std::vector<size_t> rowPtr2;
+  std::vector<size_t> colIdx2;
+  std::vector<double> values;
+
+  system.getSparsityPattern(rowPtr, colIdx);
+  system.getSparseMatrix(rowPtr2, colIdx2, values);
+  BOOST_REQUIRE_EQUAL(rowPtr.size(), n + 1);
+  BOOST_CHECK_EQUAL(rowPtr[0], 0U);
+  BOOST_REQUIRE_EQUAL(rowPtr[n], colIdx.size());
+  BOOST_CHECK(rowPtr == rowPtr2);
+  BOOST_CHECK(colIdx == colIdx2);
+  BOOST_REQUIRE_EQUAL(values.size(), colIdx.size());
+  BOOST_CHECK_EQUAL(system.countNNZ(), colIdx.size());
+
+  for (size_t i = 0; i < n; i++) {
+    size_t k = rowPtr[i];
+    BOOST_CHECK_EQUAL(system.countNNZInRow(i), rowPtr[i + 1] - rowPtr[i]);
+
+    for (size_t j = 0; j < n; j++) {
+      const double Aij = system.getMatrixEntry(i, j);
+
+      if (Aij != 0.0) {
+        BOOST_REQUIRE_LT(k, rowPtr[i + 1]);
+        BOOST_CHECK_EQUAL(colIdx[k], j);
+        BOOST_CHECK_EQUAL(values[k], Aij);
+        k++;
+      }
+    }
+
+    BOOST_CHECK_EQUAL(k, rowPtr[i + 1]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestSparseSLE) {
+  // Test sparse assembly of sgpp::base::FullSLE and sgpp::base::HierarchisationSLE.
+  Printer::getInstance().setVerbosity(-1);
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  {
+    const size_t n = 50;
+    sgpp::base::DataMatrix A(n, n, 0.0);
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        if (RandomNumberGenerator::getInstance().getUniformRN() < 0.2) {
+          A(i, j) = RandomNumberGenerator::getInstance().getUniformRN(-1.0, 1.0);
+        }
+      }
+    }
+
+    FullSLE system(A);
+    testSparseSLE(system);
+  }
+
+  const size_t d = 3;
+  const size_t p = 3;
+  const size_t l = 4;
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  createSupportedGridsSLE(d, p, grids);
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+      sgpp::base::Grid::createFundamentalNakSplineBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+      sgpp::base::Grid::createWeaklyFundamentalSplineBoundaryGrid(d, p)));
+  grids.push_back(
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createNakBsplineBoundaryGrid(d, p)));
+  grids.push_back(
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModNakBsplineGrid(d, p)));
+
+  for (auto& grid : grids) {
+    sgpp::base::GridStorage& gridStorage = grid->getStorage();
+    gridStorage.clear();
+    grid->getGenerator().regular(l);
+
+    // refine some grid points to get an irregular grid
+    sgpp::base::DataVector refinementIndicator(gridStorage.getSize(), 0.0);
+
+    for (size_t i = 0; i < gridStorage.getSize(); i += 7) {
+      refinementIndicator[i] = 1.0;
+    }
+
+    sgpp::base::SurplusRefinementFunctor functor(refinementIndicator, 5);
+    grid->getGenerator().refine(functor);
+
+    HierarchisationSLE system(*grid);
+    testSparseSLE(system);
+
+    // the sparse structure has to be updated if the grid changes
+    refinementIndicator.resizeZero(gridStorage.getSize());
+    refinementIndicator[gridStorage.getSize() - 1] = 1.0;
+    grid->getGenerator().refine(functor);
+    BOOST_CHECK_EQUAL(system.getDimension(), gridStorage.getSize());
+    testSparseSLE(system);
+
+    // ... even if the number of grid points stays the same:
+    // replace the last grid point by a new point (a descendant in the first dimension)
+    const size_t n = gridStorage.getSize();
+    sgpp::base::GridPoint gp(gridStorage[n - 1]);
+
+    do {
+      gp.set(0, gp.getLevel(0) + 1, (gp.getLevel(0) == 0) ? 1 : 2 * gp.getIndex(0) - 1);
+    } while (gridStorage.isContaining(gp));
+
+    std::list<size_t> pointsToDelete = {n - 1};
+    gridStorage.deletePoints(pointsToDelete);
+    gridStorage.insert(gp);
+    BOOST_CHECK_EQUAL(gridStorage.getSize(), n);
+    testSparseSLE(system);
+  }
+}
@@ -0,0 +1,70 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/**
+ * This example measures the throughput of the combigrid ThreadPool for many short tasks, as they
+ * are created by the parallel level computation. The tasks are added from outside the pool, so
+ * they are distributed among the task deques of the threads, and the threads terminate as soon as
+ * no task is left.
+ *
+ * Usage: threadPoolThroughput [number of tasks] (default 20000)
+ *
+ * This example can be found in the file threadPoolThroughput.cpp
+ */
+
+#include <sgpp/combigrid/threading/ThreadPool.hpp>
+#include <sgpp/combigrid/utils/Stopwatch.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using sgpp::combigrid::Stopwatch;
+using sgpp::combigrid::ThreadPool;
+
+int main(int argc, char* argv[]) {
+  const size_t numTasks = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 20000;
+  std::vector<size_t> numThreadsList = {1, 2, 4, 8, 16, 32, 64};
+
+  for (size_t numThreads : numThreadsList) {
+    std::atomic<size_t> numExecuted(0);
+    std::vector<ThreadPool::Task> tasks;
+
+    for (size_t i = 0; i < numTasks; ++i) {
+      tasks.push_back(ThreadPool::Task([&numExecuted, i]() {
+        double x = static_cast<double>(i);
+
+        for (size_t j = 0; j < 10; ++j) {
+          x = std::sqrt(x + 1.0);
+        }
+
+        if (x > 0.0) {
+          ++numExecuted;
+        }
+      }));
+    }
+
+    Stopwatch stopwatch;
+    auto tp = std::make_shared<ThreadPool>(numThreads, ThreadPool::terminateWhenIdle);
+    tp->addTasks(tasks);
+    tp->start();
+    tp->join();
+    double elapsedSeconds = stopwatch.elapsedSeconds();
+
+    if (numExecuted.load() != numTasks) {
+      std::cerr << "ThreadPool with " << numThreads << " threads executed " << numExecuted.load()
+                << " of " << numTasks << " tasks\n";
+      return 1;
+    }
+
+    std::cout << "ThreadPool with " << numThreads << " threads: "
+              << static_cast<double>(numTasks) / elapsedSeconds << " tasks/s\n";
+  }
+
+  return 0;
+}
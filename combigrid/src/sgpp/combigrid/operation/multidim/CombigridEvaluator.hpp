@@ -13,6 +13,7 @@
 #include <sgpp/combigrid/operation/multidim/fullgrid/AbstractFullGridEvaluationStrategy.hpp>
 #include <sgpp/combigrid/serialization/TreeStorageSerializationStrategy.hpp>
 #include <sgpp/combigrid/storage/AbstractMultiStorage.hpp>
+#include <sgpp/combigrid/storage/flat/FlatStorage.hpp>
 #include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
 #include <sgpp/combigrid/utils/DataVectorHashing.hpp>
 #include <sgpp/combigrid/algebraic/NormStrategy.hpp>
@@ -67,7 +68,7 @@ class CombigridEvaluator : public AbstractLevelEvaluator {
   void initPartialDifferences() {
     partialDifferences.clear();
     for (size_t d = 0; d <= numDimensions; ++d) {
-      partialDifferences.push_back(std::make_shared<TreeStorage<V>>(numDimensions));
+      partialDifferences.push_back(std::make_shared<FlatStorage<V>>(numDimensions));
     }
   }
 
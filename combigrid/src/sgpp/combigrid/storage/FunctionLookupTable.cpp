@@ -9,37 +9,147 @@
 #include <sgpp/combigrid/utils/DataVectorHashing.hpp>
 #include <sgpp/combigrid/utils/Utils.hpp>
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+
+/// magic bytes at the beginning of a binary lookup table file
+const char LOOKUP_TABLE_FILE_MAGIC[8] = {'S', 'G', 'P', 'P', 'F', 'L', 'T', 'B'};
+/// written in native byte order, used to detect files written on a different architecture
+const uint32_t LOOKUP_TABLE_FILE_BYTE_ORDER_MARK = 0x01020304;
+/// version of the binary format
+const uint32_t LOOKUP_TABLE_FILE_VERSION = 1;
+
+/**
+ * Writes the header of a binary lookup table file.
+ */
+void writeLookupTableHeader(std::ostream& stream) {
+  stream.write(LOOKUP_TABLE_FILE_MAGIC, sizeof(LOOKUP_TABLE_FILE_MAGIC));
+  stream.write(reinterpret_cast<const char*>(&LOOKUP_TABLE_FILE_BYTE_ORDER_MARK),
+               sizeof(uint32_t));
+  stream.write(reinterpret_cast<const char*>(&LOOKUP_TABLE_FILE_VERSION), sizeof(uint32_t));
+}
+
+/**
+ * Writes a single entry (dimension, parameter, function value) of a binary lookup table file.
+ */
+void writeLookupTableEntry(std::ostream& stream, base::DataVector const& x, double y) {
+  uint64_t dim = x.getSize();
+  stream.write(reinterpret_cast<const char*>(&dim), sizeof(uint64_t));
+  stream.write(reinterpret_cast<const char*>(x.getPointer()), dim * sizeof(double));
+  stream.write(reinterpret_cast<const char*>(&y), sizeof(double));
+}
+
+}  // namespace
+
+/**
+ * Part of the hashtable with its own mutex
+ */
+struct FunctionLookupTableShard {
+  std::unordered_map<base::DataVector, double, DataVectorHash, DataVectorEqualTo> hashmap;
+  std::mutex shardMutex;
+};
+
 /**
  * Helper to realize the PIMPL pattern
  */
 struct FunctionLookupTableImpl {
-  std::shared_ptr<std::unordered_map<base::DataVector, double, DataVectorHash, DataVectorEqualTo>>
-      hashmap;
+  static const size_t numShards = 64;
+
+  std::vector<std::unique_ptr<FunctionLookupTableShard>> shards;
   MultiFunction func;
-  std::recursive_mutex tableMutex;
+  DataVectorHash hash;
+
+  /// file that newly computed values are appended to (if persistent cache is enabled)
+  std::unique_ptr<std::ofstream> cacheStream;
+  std::mutex cacheMutex;
+
+  explicit FunctionLookupTableImpl(MultiFunction func)
+      : shards(), func(func), hash(), cacheStream(), cacheMutex() {
+    for (size_t i = 0; i < numShards; ++i) {
+      shards.emplace_back(new FunctionLookupTableShard());
+    }
+  }
+
+  FunctionLookupTableShard& getShard(base::DataVector const& x) {
+    // mix the bits of the hash, since the lower bits are also used by the hashmaps of the shards
+    size_t h = hash(x);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return *shards[h % numShards];
+  }
+
+  /**
+   * Evaluates the function at x, stores the value and appends it to the persistent cache.
+   * The function is evaluated without holding a lock.
+   */
+  double computeEntry(base::DataVector const& x) {
+    double y = func(x);
+    FunctionLookupTableShard& shard = getShard(x);
+
+    {
+      std::lock_guard<std::mutex> guard(shard.shardMutex);
+      // if another thread has computed the value in the meantime, the first value is kept and
+      // has already been appended to the persistent cache by that thread
+      auto result = shard.hashmap.emplace(x, y);
+
+      if (!result.second) {
+        return result.first->second;
+      }
+    }
+
+    std::lock_guard<std::mutex> guard(cacheMutex);
+
+    if (cacheStream) {
+      writeLookupTableEntry(*cacheStream, x, y);
+      cacheStream->flush();
+    }
+
+    return y;
+  }
+
+  /**
+   * Determines the dimension of the stored parameters.
+   *
+   * @param dim the dimension of the first stored parameter that is found
+   * @return false if the table is empty
+   */
+  bool getNumDimensions(size_t& dim) {
+    for (auto& shard : shards) {
+      std::lock_guard<std::mutex> guard(shard->shardMutex);
+
+      if (!shard->hashmap.empty()) {
+        dim = shard->hashmap.begin()->first.getSize();
+        return true;
+      }
+    }
 
-  explicit FunctionLookupTableImpl(MultiFunction func) : func(func), tableMutex() {
-    hashmap = std::make_shared<
-        std::unordered_map<base::DataVector, double, DataVectorHash, DataVectorEqualTo>>();
+    return false;
   }
 };
 
+const size_t FunctionLookupTableImpl::numShards;
+
 FunctionLookupTable::FunctionLookupTable(MultiFunction const& func)
     : impl(std::make_shared<FunctionLookupTableImpl>(func)) {}
 
 double FunctionLookupTable::operator()(const base::DataVector& x) {
-  auto it = impl->hashmap->find(x);
-  if (it == impl->hashmap->end()) {
-    auto y = impl->func(x);
-    addEntry(x, y);
-    return y;
+  FunctionLookupTableShard& shard = impl->getShard(x);
+  auto it = shard.hashmap.find(x);
+
+  if (it == shard.hashmap.end()) {
+    return impl->computeEntry(x);
   }
 
   return it->second;
@@ -48,40 +158,45 @@ double FunctionLookupTable::operator()(const base::DataVector& x) {
 double FunctionLookupTable::eval(const base::DataVector& x) { return (*this)(x); }
 
 double FunctionLookupTable::evalThreadsafe(const base::DataVector& x) {
-  impl->tableMutex.lock();
-  auto it = impl->hashmap->find(x);
-  if (it == impl->hashmap->end()) {
-    impl->tableMutex.unlock();
-    auto y = impl->func(x);
-    impl->tableMutex.lock();
-    addEntry(x, y);
-    impl->tableMutex.unlock();
-    return y;
+  FunctionLookupTableShard& shard = impl->getShard(x);
+
+  {
+    std::lock_guard<std::mutex> guard(shard.shardMutex);
+    auto it = shard.hashmap.find(x);
+
+    if (it != shard.hashmap.end()) {
+      return it->second;
+    }
   }
 
-  std::lock_guard<std::recursive_mutex> guard(impl->tableMutex);
-  auto y = it->second;
-  impl->tableMutex.unlock();
-  return y;
+  return impl->computeEntry(x);
 }
 
-void FunctionLookupTable::addEntry(const base::DataVector& x, double y) { (*impl->hashmap)[x] = y; }
+void FunctionLookupTable::addEntry(const base::DataVector& x, double y) {
+  FunctionLookupTableShard& shard = impl->getShard(x);
+  std::lock_guard<std::mutex> guard(shard.shardMutex);
+  shard.hashmap[x] = y;
+}
 
 std::string FunctionLookupTable::serialize() {
   FloatSerializationStrategy<double> strategy;
 
   std::vector<std::string> entries;
 
-  for (auto it = impl->hashmap->begin(); it != impl->hashmap->end(); ++it) {
-    std::vector<std::string> vectorEntries;
+  for (auto& shard : impl->shards) {
+    std::lock_guard<std::mutex> guard(shard->shardMutex);
 
-    auto& vec = it->first;
+    for (auto it = shard->hashmap.begin(); it != shard->hashmap.end(); ++it) {
+      std::vector<std::string> vectorEntries;
 
-    for (size_t i = 0; i < vec.getSize(); ++i) {
-      vectorEntries.push_back(strategy.serialize(vec[i]));
-    }
+      auto& vec = it->first;
+
+      for (size_t i = 0; i < vec.getSize(); ++i) {
+        vectorEntries.push_back(strategy.serialize(vec[i]));
+      }
 
-    entries.push_back(join(vectorEntries, ", ") + " -> " + strategy.serialize(it->second));
+      entries.push_back(join(vectorEntries, ", ") + " -> " + strategy.serialize(it->second));
+    }
   }
 
   return join(entries, "\n");
@@ -121,12 +236,150 @@ void FunctionLookupTable::deserialize(const std::string& value) {
   }
 }
 
+void FunctionLookupTable::saveToFile(std::string const& filename) const {
+  // write to a temporary file first, so that an existing file is not lost if writing fails
+  std::string temporaryFilename = filename + ".tmp";
+
+  {
+    std::ofstream stream(temporaryFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!stream.is_open()) {
+      throw std::runtime_error("FunctionLookupTable::saveToFile(): cannot open file " +
+                               temporaryFilename);
+    }
+
+    writeLookupTableHeader(stream);
+
+    for (auto& shard : impl->shards) {
+      std::lock_guard<std::mutex> guard(shard->shardMutex);
+
+      for (auto it = shard->hashmap.begin(); it != shard->hashmap.end(); ++it) {
+        writeLookupTableEntry(stream, it->first, it->second);
+      }
+    }
+
+    if (!stream) {
+      throw std::runtime_error("FunctionLookupTable::saveToFile(): error while writing file " +
+                               temporaryFilename);
+    }
+  }
+
+  if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0) {
+    std::remove(temporaryFilename.c_str());
+    throw std::runtime_error("FunctionLookupTable::saveToFile(): cannot rename file to " +
+                             filename);
+  }
+}
+
+void FunctionLookupTable::loadFromFile(std::string const& filename) {
+  std::ifstream stream(filename, std::ios::in | std::ios::binary | std::ios::ate);
+
+  if (!stream.is_open()) {
+    throw std::runtime_error("FunctionLookupTable::loadFromFile(): cannot open file " + filename);
+  }
+
+  const std::streamoff fileSize = stream.tellg();
+  stream.seekg(0);
+
+  char magic[sizeof(LOOKUP_TABLE_FILE_MAGIC)];
+  uint32_t byteOrderMark = 0;
+  uint32_t version = 0;
+  stream.read(magic, sizeof(magic));
+  stream.read(reinterpret_cast<char*>(&byteOrderMark), sizeof(uint32_t));
+  stream.read(reinterpret_cast<char*>(&version), sizeof(uint32_t));
+
+  if (!stream || std::memcmp(magic, LOOKUP_TABLE_FILE_MAGIC, sizeof(magic)) != 0) {
+    throw std::runtime_error("FunctionLookupTable::loadFromFile(): not a lookup table file: " +
+                             filename);
+  } else if (byteOrderMark != LOOKUP_TABLE_FILE_BYTE_ORDER_MARK) {
+    throw std::runtime_error(
+        "FunctionLookupTable::loadFromFile(): file was written with a different byte order: " +
+        filename);
+  } else if (version != LOOKUP_TABLE_FILE_VERSION) {
+    throw std::runtime_error("FunctionLookupTable::loadFromFile(): unsupported version of file " +
+                             filename);
+  }
+
+  // all parameters have the dimension of the entries that are already stored or, if the table is
+  // empty, of the first entry of the file
+  size_t tableDim = 0;
+  bool hasTableDim = impl->getNumDimensions(tableDim);
+  uint64_t dim;
+
+  // an incomplete last entry (e.g., if a run was interrupted while appending to the persistent
+  // cache) is ignored
+  while (stream.read(reinterpret_cast<char*>(&dim), sizeof(uint64_t))) {
+    if (!hasTableDim) {
+      tableDim = static_cast<size_t>(dim);
+      hasTableDim = true;
+    } else if (dim != tableDim) {
+      throw std::runtime_error(
+          "FunctionLookupTable::loadFromFile(): entry of dimension " +
+          DefaultSerializationStrategy<uint64_t>().serialize(dim) + " instead of " +
+          DefaultSerializationStrategy<size_t>().serialize(tableDim) + " in file " + filename);
+    }
+
+    // do not allocate more than the rest of the file can hold
+    if (static_cast<uint64_t>(fileSize - stream.tellg()) / sizeof(double) < tableDim) {
+      break;
+    }
+
+    base::DataVector x(tableDim);
+    double y;
+
+    if (!stream.read(reinterpret_cast<char*>(x.getPointer()), tableDim * sizeof(double))) {
+      break;
+    }
+
+    if (!stream.read(reinterpret_cast<char*>(&y), sizeof(double))) {
+      break;
+    }
+
+    addEntry(x, y);
+  }
+}
+
+void FunctionLookupTable::setPersistentCache(std::string const& filename) {
+  std::lock_guard<std::mutex> guard(impl->cacheMutex);
+  bool fileExists = std::ifstream(filename).good();
+
+  if (fileExists) {
+    loadFromFile(filename);
+    // rewrite the file such that an incomplete last entry is removed before appending
+    saveToFile(filename);
+  }
+
+  impl->cacheStream.reset(
+      new std::ofstream(filename, std::ios::out | std::ios::binary | std::ios::app));
+
+  if (!impl->cacheStream->is_open()) {
+    impl->cacheStream.reset();
+    throw std::runtime_error("FunctionLookupTable::setPersistentCache(): cannot open file " +
+                             filename);
+  }
+
+  if (!fileExists) {
+    writeLookupTableHeader(*impl->cacheStream);
+    impl->cacheStream->flush();
+  }
+}
+
 bool FunctionLookupTable::containsEntry(const base::DataVector& x) {
-  auto it = impl->hashmap->find(x);
-  return it != impl->hashmap->end();
+  FunctionLookupTableShard& shard = impl->getShard(x);
+  std::lock_guard<std::mutex> guard(shard.shardMutex);
+  return shard.hashmap.find(x) != shard.hashmap.end();
 }
 
-size_t FunctionLookupTable::getNumEntries() const { return impl->hashmap->size(); }
+size_t FunctionLookupTable::getNumEntries() const {
+  size_t numEntries = 0;
+
+  for (auto& shard : impl->shards) {
+    std::lock_guard<std::mutex> guard(shard->shardMutex);
+    numEntries += shard->hashmap.size();
+  }
+
+  return numEntries;
+}
 
 MultiFunction FunctionLookupTable::toMultiFunction() const { return MultiFunction(*this); }
 
@@ -25,6 +25,15 @@ struct FunctionLookupTableImpl;
  * This class wraps a MultiFunction and stores computed values using a hashtable to avoid
  * reevaluating a function at points where it already has been evaluated. This means that only the
  * exact same parameter will allow retrieving the function value.
+ *
+ * The hashtable is split into shards that are selected by the hash of the parameter, each shard
+ * has its own mutex. Thus, threads that access the table concurrently (evalThreadsafe,
+ * containsEntry, addEntry) only compete if their parameters fall into the same shard.
+ *
+ * The stored values can be saved to a binary file (saveToFile) and restored (loadFromFile). With
+ * setPersistentCache(), the table is warm-started from a file and every newly computed function
+ * value is appended to it immediately, such that a rerun (even of an interrupted computation)
+ * does not have to reevaluate the function at points that were already computed.
  */
 class FunctionLookupTable {
   std::shared_ptr<FunctionLookupTableImpl> impl;
@@ -51,12 +60,12 @@ class FunctionLookupTable {
   double evalThreadsafe(base::DataVector const &x);
 
   /**
-   * @returns true iff the hashtable contains a function value for the parameter x.
+   * @returns true iff the hashtable contains a function value for the parameter x (thread-safe).
    */
   bool containsEntry(base::DataVector const &x);
 
   /**
-   * Adds a function value into the storage.
+   * Adds a function value into the storage (thread-safe).
    * @param x Parameter of the function.
    * @param y Result of the function evaluation.
    */
@@ -72,6 +81,29 @@ class FunctionLookupTable {
    */
   void deserialize(std::string const &value);
 
+  /**
+   * Stores the stored values into a binary file. The values are stored exactly, the file is
+   * written in native byte order.
+   * @param filename Name of the file.
+   */
+  void saveToFile(std::string const &filename) const;
+
+  /**
+   * Adds the values stored in a binary file written by saveToFile() or by the persistent cache.
+   * An incomplete last entry is ignored. Throws if the parameters of the file do not have the
+   * dimension of the stored parameters (or of the first parameter of the file).
+   * @param filename Name of the file.
+   */
+  void loadFromFile(std::string const &filename);
+
+  /**
+   * Uses a binary file as persistent cache: If the file exists, its values are added to the
+   * table. Afterwards, every function value that is computed by operator(), eval() or
+   * evalThreadsafe() is appended to the file (thread-safe).
+   * @param filename Name of the file.
+   */
+  void setPersistentCache(std::string const &filename);
+
   /**
    * @return the number of stored function values.
    */
@@ -0,0 +1,98 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FLATSTORAGE_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FLATSTORAGE_HPP_
+
+#include <sgpp/combigrid/storage/AbstractMultiStorage.hpp>
+#include <sgpp/combigrid/storage/flat/FlatStorageContext.hpp>
+#include <sgpp/combigrid/storage/flat/FlatStorageGuidedIterator.hpp>
+#include <sgpp/combigrid/storage/flat/FlatStorageStoredDataIterator.hpp>
+
+#include <memory>
+#include <stdexcept>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * The FlatStorage class stores values addressed by MultiIndex-objects like TreeStorage, but without
+ * node objects and virtual calls: The nodes of each level are kept in contiguous arrays and the
+ * position of a child is computed from the offset of its parent's block (see FlatStorageContext).
+ * The values for the last dimension are stored contiguously in rows.
+ * FlatStorage can be configured with a function that computes a value for a multi-index such that
+ * FlatStorage caches its values.
+ * Multi-Indices start from 0 in each dimension.
+ * The class T has to have a default constructor.
+ * For more information see AbstractMultiStorage.
+ */
+template <typename T>
+class FlatStorage : public AbstractMultiStorage<T> {
+  FlatStorageContext<T> context;
+
+  FlatStorage(FlatStorage<T> const &) = delete;
+
+ public:
+  typedef std::function<T(MultiIndex const &)> function_type;
+
+  /**
+   * Constructor.
+   * @param numDimensions number of dimensions of the multi-indices that the storage is addressed
+   * with
+   * @param func "Default-value-function" that is called to compute entries that are not already
+   * stored. If this parameter is not specified, func will be set to a function returning T().
+   */
+  explicit FlatStorage(size_t numDimensions, function_type func = multiIndexToDefaultValue<T>())
+      : context(numDimensions, func) {}
+
+  virtual ~FlatStorage() {}
+
+  virtual size_t getNumDimensions() const { return context.numDimensions; }
+
+  /**
+   * Returns the value for the given MultiIndex. If the value is not stored, it is computed using
+   * the function and then stored and returned.
+   */
+  virtual T &get(MultiIndex const &index) {
+    if (index.size() != context.numDimensions) {
+      throw std::runtime_error("FlatStorage::get(): index.size() != context.numDimensions");
+    }
+    return context.getInRow(context.getOrCreateRow(index), index);
+  }
+
+  /**
+   * Changes the function that generates the entries.
+   */
+  virtual void setFunc(function_type func) { context.func = func; }
+
+  /**
+   * Unlike get(), this function does not activate a computation if there is no entry for the given
+   * multi-index in the storage.
+   * Instead, it directly sets the given value.
+   */
+  virtual void set(MultiIndex const &index, T const &value) {
+    context.setInRow(context.getOrCreateRow(index), index, value);
+  }
+
+  virtual bool containsIndex(MultiIndex const &index) const {
+    size_t row = context.findRow(index);
+    return row != FlatStorageContext<T>::NONE &&
+           context.rows[row].isStored(index[context.numDimensions - 1]);
+  }
+
+  virtual std::shared_ptr<AbstractMultiStorageIterator<T>> getStoredDataIterator() {
+    return std::make_shared<FlatStorageStoredDataIterator<T>>(context);
+  }
+
+  virtual std::shared_ptr<AbstractMultiStorageIterator<T>> getGuidedIterator(
+      MultiIndexIterator &indexIter, IterationPolicy const &policy = IterationPolicy::Default) {
+    return std::make_shared<FlatStorageGuidedIterator<T>>(policy, context, indexIter);
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FLATSTORAGE_HPP_ */
@@ -0,0 +1,205 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FLATSTORAGECONTEXT_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FLATSTORAGECONTEXT_HPP_
+
+#include <sgpp/combigrid/definitions.hpp>
+#include <sgpp/combigrid/storage/tree/AbstractTreeStorageNode.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Data of the FlatStorage class, which is shared with its iterators.
+ * The storage has the same structure as a TreeStorage, but the nodes of each level of the tree are
+ * kept in flat arrays: For each of the first numDimensions - 1 levels, blocks[d][node] describes
+ * the range of children[d] that contains the children of the given node, and the child with index
+ * i is found at children[d][blocks[d][node].offset + i]. The children of the last of these levels
+ * are rows, which contain the values for the last dimension contiguously.
+ * Nodes and rows are addressed by their position in these arrays instead of pointers.
+ */
+template <typename T>
+class FlatStorageContext {
+ public:
+  typedef std::function<T(MultiIndex const &)> function_type;
+
+  /**
+   * Marks child slots that do not contain a node.
+   */
+  static const size_t NONE = std::numeric_limits<size_t>::max();
+
+  /**
+   * Range of a node's children in the children array of its level.
+   */
+  struct Block {
+    size_t offset;
+    size_t size;
+  };
+
+  /**
+   * Contains the values of all entries that only differ in the last dimension.
+   */
+  struct Row {
+    std::vector<StorageStatus> statusVector;
+    std::vector<T> elements;
+
+    /**
+     * Fills elements and statusVector until they contain the given index.
+     */
+    void ensureVectorEntry(size_t index) {
+      if (index >= elements.size()) {
+        elements.resize(index + 1);
+        statusVector.resize(index + 1, StorageStatus::NOT_STORED);
+      }
+    }
+
+    bool isStored(size_t index) const {
+      return index < statusVector.size() && statusVector[index] == StorageStatus::STORED;
+    }
+  };
+
+  size_t numDimensions;
+  function_type func;
+
+  std::vector<std::vector<Block>> blocks;
+  std::vector<std::vector<size_t>> children;
+  std::vector<Row> rows;
+
+  FlatStorageContext(size_t numDimensions, function_type func)
+      : numDimensions(numDimensions),
+        func(func),
+        blocks(numInternalLevels()),
+        children(numInternalLevels()),
+        rows() {
+    // the root is either the first node of level 0 or the only row
+    if (numInternalLevels() > 0) {
+      blocks[0].push_back(Block{0, 0});
+    } else {
+      rows.emplace_back();
+    }
+  }
+
+  /**
+   * @return the number of levels that consist of nodes and not of rows
+   */
+  size_t numInternalLevels() const { return numDimensions <= 1 ? 0 : numDimensions - 1; }
+
+  /**
+   * @param d level of the node
+   * @param node position of the node in its level
+   * @param index index of the child
+   * @return position of the child in the next level (or of the row if d is the last internal
+   * level), NONE if the child does not exist
+   */
+  size_t getChild(size_t d, size_t node, size_t index) const {
+    Block const &block = blocks[d][node];
+    return index < block.size ? children[d][block.offset + index] : NONE;
+  }
+
+  /**
+   * Like getChild(), but a child that does not exist is created. If the block of the node is too
+   * small, it is moved to the end of the children array of the level with twice the size.
+   */
+  size_t getOrCreateChild(size_t d, size_t node, size_t index) {
+    std::vector<size_t> &levelChildren = children[d];
+    Block &block = blocks[d][node];
+
+    if (index >= block.size) {
+      size_t newSize = std::max(index + 1, 2 * block.size);
+      size_t newOffset = levelChildren.size();
+      levelChildren.resize(newOffset + newSize, NONE);
+      std::copy(levelChildren.begin() + block.offset,
+                levelChildren.begin() + block.offset + block.size,
+                levelChildren.begin() + newOffset);
+      block.offset = newOffset;
+      block.size = newSize;
+    }
+
+    size_t &child = levelChildren[block.offset + index];
+
+    if (child == NONE) {
+      if (d + 1 < numInternalLevels()) {
+        child = blocks[d + 1].size();
+        blocks[d + 1].push_back(Block{0, 0});
+      } else {
+        child = rows.size();
+        rows.emplace_back();
+      }
+    }
+
+    return child;
+  }
+
+  /**
+   * @return position of the row that contains the given multi-index, NONE if it does not exist
+   */
+  size_t findRow(MultiIndex const &index) const {
+    size_t current = 0;
+
+    for (size_t d = 0; d < numInternalLevels() && current != NONE; ++d) {
+      current = getChild(d, current, index[d]);
+    }
+
+    return current;
+  }
+
+  /**
+   * @return position of the row that contains the given multi-index, the row and the nodes on the
+   * way are created if they do not exist
+   */
+  size_t getOrCreateRow(MultiIndex const &index) {
+    size_t current = 0;
+
+    for (size_t d = 0; d < numInternalLevels(); ++d) {
+      current = getOrCreateChild(d, current, index[d]);
+    }
+
+    return current;
+  }
+
+  /**
+   * @return reference to the entry of the given row at the last index of the given multi-index.
+   * If the entry is not stored, it is computed with func.
+   */
+  T &getInRow(size_t row, MultiIndex const &index) {
+    Row &currentRow = rows[row];
+    size_t lastIndex = index[numDimensions - 1];
+    currentRow.ensureVectorEntry(lastIndex);
+
+    if (currentRow.statusVector[lastIndex] != StorageStatus::STORED) {
+      currentRow.elements[lastIndex] = func(index);
+      currentRow.statusVector[lastIndex] = StorageStatus::STORED;
+    }
+
+    return currentRow.elements[lastIndex];
+  }
+
+  /**
+   * Stores the value at the last index of the given multi-index in the given row without calling
+   * func.
+   */
+  void setInRow(size_t row, MultiIndex const &index, T const &value) {
+    Row &currentRow = rows[row];
+    size_t lastIndex = index[numDimensions - 1];
+    currentRow.ensureVectorEntry(lastIndex);
+    currentRow.elements[lastIndex] = value;
+    currentRow.statusVector[lastIndex] = StorageStatus::STORED;
+  }
+};
+
+template <typename T>
+const size_t FlatStorageContext<T>::NONE;
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FLATSTORAGECONTEXT_HPP_ */
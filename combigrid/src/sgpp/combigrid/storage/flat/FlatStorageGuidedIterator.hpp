@@ -0,0 +1,146 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FLATSTORAGEGUIDEDITERATOR_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FLATSTORAGEGUIDEDITERATOR_HPP_
+
+#include <sgpp/combigrid/common/MultiIndexIterator.hpp>
+#include <sgpp/combigrid/definitions.hpp>
+#include <sgpp/combigrid/storage/AbstractMultiStorageIterator.hpp>
+#include <sgpp/combigrid/storage/IterationPolicy.hpp>
+#include <sgpp/combigrid/storage/flat/FlatStorageContext.hpp>
+
+#include <cstddef>
+
+#include <functional>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Iterator class that travels "along" a MultiIndexIterator through a FlatStorage.
+ * If entries are not already contained, they are created during iteration.
+ * The position of the current row is only updated if the multi-index changes in a dimension other
+ * than the last one, so most steps directly access the contiguous row.
+ * For a detailed method description, see AbstractMultiStorageIterator.
+ */
+template <typename T>
+class FlatStorageGuidedIterator : public AbstractMultiStorageIterator<T> {
+  FlatStorageContext<T> &context;
+  MultiIndexIterator &iterator;
+  MultiIndex permutedIndex;
+
+  /**
+   * nodes[d] is the position of the current node in level d, the last entry is the position of the
+   * current row.
+   */
+  std::vector<size_t> nodes;
+
+  IterationPolicy policy;
+
+  size_t lastDim() const { return nodes.size() - 1; }
+
+  /**
+   * Updates permutedIndex for the last dimension and returns it.
+   */
+  size_t updateLastIndex() {
+    size_t permutedLastIndex = policy.value(lastDim(), iterator.indexAt(lastDim()));
+    permutedIndex[lastDim()] = permutedLastIndex;
+    return permutedLastIndex;
+  }
+
+ public:
+  FlatStorageGuidedIterator(IterationPolicy const &policy, FlatStorageContext<T> &context,
+                            MultiIndexIterator &iterator)
+      : context(context),
+        iterator(iterator),
+        permutedIndex(context.numDimensions, 0),
+        nodes(context.numInternalLevels() + 1, 0),
+        policy(policy) {
+    for (size_t d = 0; d < context.numInternalLevels(); ++d) {
+      size_t currentIndex = this->policy.value(d, 0);
+      permutedIndex[d] = currentIndex;
+      nodes[d + 1] = context.getOrCreateChild(d, nodes[d], currentIndex);
+    }
+  }
+
+  virtual ~FlatStorageGuidedIterator() {}
+
+  /**
+   * @return Returns the difference of the greatest dimension and the lowest updated dimension,
+   * i. e. the lowest dimension where the corresponding multi-index changed.
+   * This will be mostly be zero, if the last dimension has many points.
+   * Returns -1 if the next entry is invalid.
+   */
+  virtual int moveToNext() {
+    int h = iterator.moveToNext();
+
+    if (h == 0) {
+      policy.moveToNext(lastDim());
+      return 0;
+    } else if (h < 0) {
+      return h;
+    }
+
+    policy.reset(lastDim());
+
+    // update the nodes in all levels below the lowest changed dimension
+    size_t d = lastDim() - h;
+    size_t nextValue = policy.moveAndGetValue(d, iterator.indexAt(d));
+    permutedIndex[d] = nextValue;
+    nodes[d + 1] = context.getOrCreateChild(d, nodes[d], nextValue);
+
+    for (++d; d < lastDim(); ++d) {
+      nextValue = policy.resetAndGetValue(d, 0);
+      permutedIndex[d] = nextValue;
+      nodes[d + 1] = context.getOrCreateChild(d, nodes[d], nextValue);
+    }
+
+    return h;
+  }
+
+  virtual T &value() {
+    updateLastIndex();
+    return context.getInRow(nodes[lastDim()], permutedIndex);
+  }
+
+  virtual void setValue(T const &input) {
+    updateLastIndex();
+    context.setInRow(nodes[lastDim()], permutedIndex, input);
+  }
+
+  /**
+   * @return returns true if the iterator points to a valid position.
+   */
+  virtual bool isValid() { return iterator.isValid(); }
+
+  virtual size_t indexAt(size_t d) const { return iterator.indexAt(d); }
+
+  virtual MultiIndex getMultiIndex() const { return iterator.getMultiIndex(); }
+
+  virtual bool computationRequested() {
+    auto const &row = context.rows[nodes[lastDim()]];
+    size_t permutedLastIndex = policy.value(lastDim(), iterator.indexAt(lastDim()));
+    return permutedLastIndex < row.statusVector.size() &&
+           row.statusVector[permutedLastIndex] >= StorageStatus::REQUESTED;
+  }
+
+  virtual std::function<T()> requestComputationTask() {
+    auto &row = context.rows[nodes[lastDim()]];
+    size_t permutedLastIndex = updateLastIndex();
+    row.ensureVectorEntry(permutedLastIndex);
+    row.statusVector[permutedLastIndex] = StorageStatus::REQUESTED;
+
+    auto myContext = &context;
+    auto myPermutedIndex = permutedIndex;
+    return [myContext, myPermutedIndex]() { return myContext->func(myPermutedIndex); };
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FLATSTORAGEGUIDEDITERATOR_HPP_ */
@@ -0,0 +1,173 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FLATSTORAGESTOREDDATAITERATOR_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FLATSTORAGESTOREDDATAITERATOR_HPP_
+
+#include <sgpp/combigrid/definitions.hpp>
+#include <sgpp/combigrid/storage/AbstractMultiStorageIterator.hpp>
+#include <sgpp/combigrid/storage/flat/FlatStorageContext.hpp>
+
+#include <cstddef>
+
+#include <functional>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Iterator for the FlatStorage class that only traverses entries stored in the storage.
+ * The entries are traversed in lexicographical order (lexicographically ascending multi-indices).
+ * For a detailed method description, see AbstractMultiStorageIterator.
+ */
+template <typename T>
+class FlatStorageStoredDataIterator : public AbstractMultiStorageIterator<T> {
+  FlatStorageContext<T> &context;
+  MultiIndex index;
+
+  /**
+   * nodes[d] is the position of the current node in level d, the last entry is the position of the
+   * current row.
+   */
+  std::vector<size_t> nodes;
+
+  bool valid;
+
+  size_t lastDim() const { return nodes.size() - 1; }
+
+  /**
+   * Helper function that moves to the first existing child with index >= start of the current node
+   * in level d.
+   * @return true if such a child exists
+   */
+  bool moveToChild(size_t d, size_t start) {
+    size_t numChildren = context.blocks[d][nodes[d]].size;
+
+    for (size_t i = start; i < numChildren; ++i) {
+      size_t child = context.getChild(d, nodes[d], i);
+
+      if (child != FlatStorageContext<T>::NONE) {
+        index[d] = i;
+        nodes[d + 1] = child;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * Helper function that moves to the next entry of the current row or to the first entry of the
+   * next row. This entry might not be stored and so this function might have to be called multiple
+   * times until a stored entry is reached.
+   */
+  int moveToNextImpl() {
+    size_t nextLastIndex = index[lastDim()] + 1;
+
+    if (nextLastIndex < context.rows[nodes[lastDim()]].elements.size()) {
+      index[lastDim()] = nextLastIndex;
+      return 0;
+    }
+
+    // advance in the lowest dimension that has a next child, since every node except for the root
+    // is created along with a path to a row, the levels below can always be entered
+    int d = static_cast<int>(lastDim()) - 1;
+
+    while (d >= 0 && !moveToChild(d, index[d] + 1)) {
+      --d;
+    }
+
+    if (d < 0) {
+      valid = false;
+      return -1;
+    }
+
+    for (size_t dim = d + 1; dim < lastDim(); ++dim) {
+      moveToChild(dim, 0);
+    }
+
+    index[lastDim()] = 0;
+
+    return static_cast<int>(lastDim()) - d;
+  }
+
+ public:
+  explicit FlatStorageStoredDataIterator(FlatStorageContext<T> &context)
+      : context(context),
+        index(context.numDimensions, 0),
+        nodes(context.numInternalLevels() + 1, 0),
+        valid(true) {
+    for (size_t d = 0; d < context.numInternalLevels(); ++d) {
+      if (!moveToChild(d, 0)) {
+        // the storage is empty
+        valid = false;
+        return;
+      }
+    }
+
+    if (!context.rows[nodes[lastDim()]].isStored(0)) {
+      moveToNext();
+    }
+  }
+
+  virtual ~FlatStorageStoredDataIterator() {}
+
+  /**
+   * @return Returns the difference of the greatest dimension and the lowest updated dimension,
+   * i. e. the lowest dimension where the corresponding multi-index changed.
+   * This will be mostly be zero, if the last dimension has many points.
+   * Returns -1 if the next entry is invalid.
+   */
+  virtual int moveToNext() {
+    int h = 0;
+
+    do {
+      int newH = moveToNextImpl();
+
+      if (newH == -1) {
+        return -1;
+      }
+
+      if (newH > h) {
+        h = newH;
+      }
+    } while (!context.rows[nodes[lastDim()]].isStored(index[lastDim()]));
+
+    return h;
+  }
+
+  virtual T &value() { return context.rows[nodes[lastDim()]].elements[index[lastDim()]]; }
+
+  virtual void setValue(T const &input) {
+    context.rows[nodes[lastDim()]].elements[index[lastDim()]] = input;
+  }
+
+  /**
+   * @return returns true if the iterator points to a valid position.
+   */
+  virtual bool isValid() { return valid; }
+
+  virtual size_t indexAt(size_t d) const { return index[d]; }
+
+  virtual MultiIndex getMultiIndex() const { return index; }
+
+  /**
+   * Returns true because the iterator only iterates over already stored data.
+   */
+  virtual bool computationRequested() { return true; }
+
+  /**
+   * Returns a dummy function because the values pointed to are already stored.
+   */
+  virtual std::function<T()> requestComputationTask() {
+    return []() { return T(); };  // no computation necessary
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FLATSTORAGESTOREDDATAITERATOR_HPP_ */
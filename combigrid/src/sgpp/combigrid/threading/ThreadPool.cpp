@@ -6,103 +6,207 @@
 #include <sgpp/combigrid/definitions.hpp>
 #include <sgpp/combigrid/threading/ThreadPool.hpp>
 
-#include <chrono>
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+
+/**
+ * Pool and index of the pool thread that is running on the current thread
+ */
+struct WorkerIdentity {
+  const ThreadPool* pool;
+  size_t index;
+};
+
+thread_local WorkerIdentity workerIdentity = {nullptr, 0};
+
+}  // namespace
+
 ThreadPool::IdleCallback ThreadPool::terminateWhenIdle((ThreadPool::doTerminateWhenIdle));
 
 ThreadPool::ThreadPool(size_t numThreads)
     : numThreads(numThreads),
       threads(),
-      tasks(),
-      poolMutex(),
+      queues(),
+      numQueuedTasks(0),
+      nextQueue(0),
       terminateFlag(false),
       useIdleCallback(false),
-      idleCallback() {}
+      idleCallback() {
+  for (size_t i = 0; i < std::max(numThreads, static_cast<size_t>(1)); ++i) {
+    queues.emplace_back(new WorkerQueue());
+  }
+}
 
 ThreadPool::ThreadPool(size_t numThreads, IdleCallback idleCallback)
     : numThreads(numThreads),
       threads(),
-      tasks(),
-      poolMutex(),
+      queues(),
+      numQueuedTasks(0),
+      nextQueue(0),
       terminateFlag(false),
       useIdleCallback(true),
-      idleCallback(idleCallback) {}
+      idleCallback(idleCallback) {
+  for (size_t i = 0; i < std::max(numThreads, static_cast<size_t>(1)); ++i) {
+    queues.emplace_back(new WorkerQueue());
+  }
+}
 
 ThreadPool::~ThreadPool() {
   triggerTermination();
   join();
 }
 
+size_t ThreadPool::currentWorker() const {
+  return (workerIdentity.pool == this) ? workerIdentity.index : numThreads;
+}
+
 void ThreadPool::addTask(const Task& task) {
-  CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(poolMutex));
-  tasks.push_back(task);
+  size_t worker = currentWorker();
+
+  if (worker >= queues.size()) {
+    worker = nextQueue++ % queues.size();
+  }
+
+  WorkerQueue& queue = *queues[worker];
+  CGLOG_SURROUND(std::lock_guard<std::mutex> guard(queue.mutex));
+  queue.tasks.push_back(task);
+  ++numQueuedTasks;
 }
 
 void ThreadPool::addTasks(const std::vector<Task>& newTasks) {
-  CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(poolMutex));
-  tasks.insert(tasks.end(), newTasks.begin(), newTasks.end());
+  size_t worker = currentWorker();
+
+  if (worker < queues.size()) {
+    WorkerQueue& queue = *queues[worker];
+    CGLOG_SURROUND(std::lock_guard<std::mutex> guard(queue.mutex));
+    queue.tasks.insert(queue.tasks.end(), newTasks.begin(), newTasks.end());
+    numQueuedTasks += newTasks.size();
+    return;
+  }
+
+  // distribute contiguous blocks, starting with the deque that would receive the next task
+  size_t firstQueue = nextQueue.fetch_add(queues.size());
+  size_t blockSize = (newTasks.size() + queues.size() - 1) / queues.size();
+
+  for (size_t i = 0; i < queues.size(); ++i) {
+    size_t blockBegin = std::min(i * blockSize, newTasks.size());
+    size_t blockEnd = std::min(blockBegin + blockSize, newTasks.size());
+
+    if (blockBegin == blockEnd) {
+      break;
+    }
+
+    WorkerQueue& queue = *queues[(firstQueue + i) % queues.size()];
+    CGLOG_SURROUND(std::lock_guard<std::mutex> guard(queue.mutex));
+    queue.tasks.insert(queue.tasks.end(), newTasks.begin() + blockBegin,
+                       newTasks.begin() + blockEnd);
+    numQueuedTasks += blockEnd - blockBegin;
+  }
 }
 
-void ThreadPool::start() {
-  for (size_t i = 0; i < numThreads; ++i) {
-    threads.push_back(std::make_shared<std::thread>([this]() {
-      while (true) {
-        Task nextTask;
-
-        // wait for terminate or next task
-        while (true) {
-          {
-            CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(this->poolMutex));
-            if (this->terminateFlag) {
-              return;
-            }
-            if (!this->tasks.empty()) {
-              nextTask = tasks.front();
-              tasks.pop_front();
-              break;
-            } else if (!useIdleCallback) {
-              return;
-            }
-            CGLOG("leave outer guard(this->poolMutex)");
-          }
-
-          // no tasks, so acquire tasks
-
-          if (useIdleCallback) {
-            CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> idleLock(idleMutex));
-
-            {
-              CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(this->poolMutex));
-              if (this->terminateFlag || !this->tasks.empty()) {
-                CGLOG("leave inner guard(this->poolMutex)");
-                continue;
-              }
-              CGLOG("leave inner guard(this->poolMutex)");
-            }
-
-            idleCallback(*this);
-            CGLOG("leave idleLock(idleMutex)");
-          } else {
-            std::this_thread::sleep_for(std::chrono::milliseconds(5));
-          }
-        }
-
-        // execute next task
-        nextTask();
+bool ThreadPool::acquireTask(size_t worker, Task& task) {
+  WorkerQueue& ownQueue = *queues[worker];
+
+  {
+    CGLOG_SURROUND(std::lock_guard<std::mutex> guard(ownQueue.mutex));
+
+    if (!ownQueue.tasks.empty()) {
+      task = ownQueue.tasks.back();
+      ownQueue.tasks.pop_back();
+      --numQueuedTasks;
+      return true;
+    }
+  }
+
+  // own deque is empty, steal half of the tasks of the next thread that has some
+  for (size_t i = 1; i < queues.size(); ++i) {
+    if (numQueuedTasks == 0) {
+      return false;
+    }
+
+    WorkerQueue& victimQueue = *queues[(worker + i) % queues.size()];
+    std::vector<Task> stolenTasks;
+
+    {
+      CGLOG_SURROUND(std::lock_guard<std::mutex> guard(victimQueue.mutex));
+
+      if (victimQueue.tasks.empty()) {
+        continue;
       }
-    }));
+
+      size_t numStolen = (victimQueue.tasks.size() + 1) / 2;
+      stolenTasks.assign(std::make_move_iterator(victimQueue.tasks.begin()),
+                         std::make_move_iterator(victimQueue.tasks.begin() + numStolen));
+      victimQueue.tasks.erase(victimQueue.tasks.begin(), victimQueue.tasks.begin() + numStolen);
+    }
+
+    // execute the first stolen task, keep the others (they are still counted as queued)
+    task = stolenTasks.front();
+    --numQueuedTasks;
+
+    if (stolenTasks.size() > 1) {
+      CGLOG_SURROUND(std::lock_guard<std::mutex> guard(ownQueue.mutex));
+      ownQueue.tasks.insert(ownQueue.tasks.begin(),
+                            std::make_move_iterator(stolenTasks.begin() + 1),
+                            std::make_move_iterator(stolenTasks.end()));
+    }
+
+    return true;
   }
+
+  return false;
 }
 
-void ThreadPool::triggerTermination() {
-  CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(poolMutex));
-  terminateFlag = true;
+void ThreadPool::work(size_t worker) {
+  workerIdentity.pool = this;
+  workerIdentity.index = worker;
+
+  while (true) {
+    Task nextTask;
+
+    // wait for terminate or next task
+    while (true) {
+      if (terminateFlag) {
+        return;
+      }
+
+      if (acquireTask(worker, nextTask)) {
+        break;
+      } else if (!useIdleCallback) {
+        return;
+      }
+
+      // no tasks, so acquire tasks
+      CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> idleLock(idleMutex));
+
+      if (terminateFlag || numQueuedTasks > 0) {
+        CGLOG("leave idleLock(idleMutex)");
+        continue;
+      }
+
+      idleCallback(*this);
+      CGLOG("leave idleLock(idleMutex)");
+    }
+
+    // execute next task
+    nextTask();
+  }
 }
 
+void ThreadPool::start() {
+  for (size_t i = 0; i < numThreads; ++i) {
+    threads.push_back(std::make_shared<std::thread>([this, i]() { this->work(i); }));
+  }
+}
+
+void ThreadPool::triggerTermination() { terminateFlag = true; }
+
 void ThreadPool::join() {
   for (auto thread_ptr : threads) {
     thread_ptr->join();
@@ -9,6 +9,7 @@
 #include <sgpp/combigrid/GeneralFunction.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <atomic>
 #include <deque>
 #include <functional>
 #include <memory>
@@ -22,6 +23,17 @@ namespace combigrid {
 /**
  * This implements a thread-pool with a pre-specified number of threads that process a list of
  * tasks.
+ *
+ * Each thread has its own task deque. Tasks that are added by a thread of the pool (e.g., from
+ * a task or from the idle callback) are put into the deque of this thread, tasks that are added
+ * from outside are distributed evenly among the deques. A thread takes its tasks from the back
+ * of its deque; if the deque is empty, it steals half of the tasks from the front of the deque of
+ * another thread. Thus, the threads only compete for a lock if one of them has run out of work.
+ *
+ * Note that the tasks are not executed in the order in which they were added: a thread executes
+ * the tasks of its own deque in reverse order (LIFO, the most recently added task first), only
+ * stealing takes the oldest tasks of a deque first (FIFO). In particular, a pool with a single
+ * thread executes all tasks in reverse order. Callers must not rely on the execution order.
  */
 class ThreadPool {
  public:
@@ -31,15 +43,47 @@ class ThreadPool {
   typedef GeneralFunction<void, ThreadPool &> IdleCallback;
 
  private:
+  /**
+   * Task deque of a single thread
+   */
+  struct WorkerQueue {
+    std::deque<Task> tasks;
+    std::mutex mutex;
+  };
+
   size_t numThreads;
   std::vector<std::shared_ptr<std::thread>> threads;
-  std::deque<Task> tasks;
-  std::recursive_mutex poolMutex;
+  std::vector<std::unique_ptr<WorkerQueue>> queues;
+  /// total number of tasks in all deques
+  std::atomic<size_t> numQueuedTasks;
+  /// deque that receives the next task that is added from outside the pool
+  std::atomic<size_t> nextQueue;
   std::recursive_mutex idleMutex;
-  bool terminateFlag;
+  std::atomic<bool> terminateFlag;
   bool useIdleCallback;
   IdleCallback idleCallback;
 
+  /**
+   * @return index of the calling thread in this pool, numThreads if the calling thread does not
+   * belong to the pool
+   */
+  size_t currentWorker() const;
+
+  /**
+   * Takes a task from the back of the deque of a thread, or, if it is empty, steals tasks from
+   * the deques of the other threads.
+   * @param worker index of the thread
+   * @param task the task that was found
+   * @return whether a task was found
+   */
+  bool acquireTask(size_t worker, Task &task);
+
+  /**
+   * Main loop of a thread.
+   * @param worker index of the thread
+   */
+  void work(size_t worker);
+
  public:
   /**
    * Creates a ThreadPool that processes available tasks. When no more tasks are available, the
@@ -59,12 +103,16 @@ class ThreadPool {
   ~ThreadPool();
 
   /**
-   * Adds a single task to the task list (thread-safe).
+   * Adds a single task to the task list (thread-safe). If called from a thread of the pool, the
+   * task is put into the deque of this thread (and is executed before the older tasks of the
+   * deque).
    */
   void addTask(Task const &task);
 
   /**
-   * Adds a list of tasks to the task list (thread-safe).
+   * Adds a list of tasks to the task list (thread-safe). If called from a thread of the pool, the
+   * tasks are put into the deque of this thread, otherwise they are split into contiguous blocks
+   * that are distributed among the deques.
    */
   void addTasks(std::vector<Task> const &newTasks);
 
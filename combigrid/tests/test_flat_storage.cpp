@@ -0,0 +1,194 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/combigrid/storage/flat/FlatStorage.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
+#include <sgpp/combigrid/common/MultiIndexIterator.hpp>
+
+#include <random>
+#include <vector>
+
+using sgpp::combigrid::FlatStorage;
+using sgpp::combigrid::TreeStorage;
+using sgpp::combigrid::MultiIndex;
+using sgpp::combigrid::MultiIndexIterator;
+
+BOOST_AUTO_TEST_CASE(testFlatStorageGetSet) {
+  FlatStorage<int> storage(3);
+
+  MultiIndex index(3, 0);
+
+  BOOST_CHECK(!storage.containsIndex(index));
+
+  BOOST_CHECK_EQUAL(storage.get(index), 0);
+
+  BOOST_CHECK(storage.containsIndex(index));
+
+  storage.get(index) = 5;
+
+  BOOST_CHECK_EQUAL(storage.get(index), 5);
+
+  index[1] = 5;
+  index[2] = 5;
+
+  BOOST_CHECK(!storage.containsIndex(index));
+
+  storage.set(index, 7);
+
+  BOOST_CHECK_EQUAL(storage.get(index), 7);
+  BOOST_CHECK(storage.containsIndex(index));
+
+  index[2] = 4;
+  BOOST_CHECK(!storage.containsIndex(index));
+
+  FlatStorage<size_t> functionStorage(
+      2, [](MultiIndex const &index) { return 10 * index[0] + index[1]; });
+  BOOST_CHECK_EQUAL(functionStorage.get(MultiIndex{3, 4}), 34);
+}
+
+BOOST_AUTO_TEST_CASE(testFlatStorageDataIterator) {
+  FlatStorage<int> storage(3);
+
+  MultiIndex index(3, 0);
+  storage.set(index, 1);
+
+  index[2] = 2;
+  storage.set(index, 2);
+
+  index[0] = 2;
+  storage.set(index, 3);
+
+  auto it = storage.getStoredDataIterator();
+
+  BOOST_CHECK(it->isValid());
+
+  BOOST_CHECK_EQUAL(it->indexAt(0), 0);
+  BOOST_CHECK_EQUAL(it->indexAt(1), 0);
+  BOOST_CHECK_EQUAL(it->indexAt(2), 0);
+
+  BOOST_CHECK_EQUAL(it->value(), 1);
+
+  BOOST_CHECK_EQUAL(it->moveToNext(), 0);
+  BOOST_CHECK_EQUAL(it->value(), 2);
+
+  BOOST_CHECK_EQUAL(it->moveToNext(), 2);
+  BOOST_CHECK_EQUAL(it->value(), 3);
+
+  BOOST_CHECK_EQUAL(it->moveToNext(), -1);
+
+  BOOST_CHECK(!it->isValid());
+
+  // the iterator starts at the first stored entry
+  FlatStorage<int> otherStorage(2);
+  otherStorage.set(MultiIndex{1, 3}, 4);
+  it = otherStorage.getStoredDataIterator();
+  BOOST_CHECK(it->isValid());
+  BOOST_CHECK(it->getMultiIndex() == (MultiIndex{1, 3}));
+  BOOST_CHECK_EQUAL(it->value(), 4);
+  BOOST_CHECK_EQUAL(it->moveToNext(), -1);
+
+  FlatStorage<int> emptyStorage(3);
+  BOOST_CHECK(!emptyStorage.getStoredDataIterator()->isValid());
+}
+
+BOOST_AUTO_TEST_CASE(testFlatStorageGuidedIterator) {
+  FlatStorage<int> storage(3);
+
+  MultiIndex bounds(3, 2);
+  MultiIndexIterator multiIter(bounds);
+  MultiIndex index(3, 0);
+  storage.set(index, 1);
+
+  index[2] = 2;
+  storage.set(index, 2);
+
+  index[0] = 2;
+  storage.set(index, 3);
+
+  auto it = storage.getGuidedIterator(multiIter);
+
+  BOOST_CHECK(it->isValid());
+
+  BOOST_CHECK_EQUAL(it->indexAt(0), 0);
+  BOOST_CHECK_EQUAL(it->indexAt(1), 0);
+  BOOST_CHECK_EQUAL(it->indexAt(2), 0);
+
+  BOOST_CHECK_EQUAL(it->value(), 1);
+
+  std::vector<int> expectedH = {0, 1, 0, 2, 0, 1, 0};
+
+  for (int h : expectedH) {
+    BOOST_CHECK_EQUAL(it->moveToNext(), h);
+    BOOST_CHECK_EQUAL(it->value(), 0);
+  }
+
+  BOOST_CHECK_EQUAL(it->moveToNext(), -1);
+  BOOST_CHECK_EQUAL(it->isValid(), false);
+}
+
+BOOST_AUTO_TEST_CASE(testFlatStorageEqualsTreeStorage) {
+  const size_t numDimensions = 4;
+  auto func = [](MultiIndex const &index) {
+    double result = 0.0;
+    for (size_t i : index) {
+      result = 7.0 * result + static_cast<double>(i);
+    }
+    return result;
+  };
+  FlatStorage<double> flatStorage(numDimensions, func);
+  TreeStorage<double> treeStorage(numDimensions, func);
+
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<size_t> distribution(0, 5);
+
+  for (size_t i = 0; i < 200; ++i) {
+    MultiIndex index(numDimensions);
+    for (auto &value : index) {
+      value = distribution(generator);
+    }
+
+    if (i % 2 == 0) {
+      flatStorage.set(index, static_cast<double>(i));
+      treeStorage.set(index, static_cast<double>(i));
+    } else {
+      BOOST_CHECK_EQUAL(flatStorage.get(index), treeStorage.get(index));
+    }
+  }
+
+  // the tree may contain entries that are not stored at the beginning of a row, so the stored
+  // entries of the flat storage are compared with the tree storage
+  size_t numStored = 0;
+  for (auto it = flatStorage.getStoredDataIterator(); it->isValid(); it->moveToNext()) {
+    MultiIndex index = it->getMultiIndex();
+    BOOST_CHECK(treeStorage.containsIndex(index));
+    BOOST_CHECK_EQUAL(it->value(), treeStorage.get(index));
+    ++numStored;
+  }
+
+  size_t numTreeStored = 0;
+  for (auto it = treeStorage.getStoredDataIterator(); it->isValid(); it->moveToNext()) {
+    if (treeStorage.containsIndex(it->getMultiIndex())) {
+      ++numTreeStored;
+    }
+  }
+  BOOST_CHECK_EQUAL(numStored, numTreeStored);
+
+  // the guided iterators traverse the same values with the same h
+  MultiIndex bounds(numDimensions, 4);
+  MultiIndexIterator flatIter(bounds);
+  MultiIndexIterator treeIter(bounds);
+  auto flatIt = flatStorage.getGuidedIterator(flatIter);
+  auto treeIt = treeStorage.getGuidedIterator(treeIter);
+
+  while (treeIt->isValid()) {
+    BOOST_REQUIRE(flatIt->isValid());
+    BOOST_CHECK_EQUAL(flatIt->value(), treeIt->value());
+    BOOST_CHECK_EQUAL(flatIt->moveToNext(), treeIt->moveToNext());
+  }
+  BOOST_CHECK(!flatIt->isValid());
+}
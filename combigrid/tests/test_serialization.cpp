@@ -16,6 +16,9 @@
 #include <sgpp/globaldef.hpp>
 
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <limits>
 #include <string>
@@ -92,6 +95,77 @@ BOOST_AUTO_TEST_CASE(testFunctionLookupTableSerialization) {
   BOOST_CHECK_EQUAL(func(vec), table2(vec));
 }
 
+BOOST_AUTO_TEST_CASE(testFunctionLookupTableBinaryFile) {
+  size_t numEvaluations = 0;
+  MultiFunction countingFunc([&numEvaluations](sgpp::base::DataVector const &x) {
+    ++numEvaluations;
+    return testFunc1(x);
+  });
+  std::string filename = "tmpFunctionLookupTable.bin";
+
+  sgpp::base::DataVector vec(2);
+  vec[1] = 1.0 / 3.0;
+
+  {
+    FunctionLookupTable table(countingFunc);
+    table.setPersistentCache(filename);
+
+    for (size_t i = 0; i < 10; ++i) {
+      vec[0] = static_cast<double>(i) / 7.0;
+      BOOST_CHECK_EQUAL(testFunc1(vec), table(vec));
+    }
+  }
+
+  BOOST_CHECK_EQUAL(numEvaluations, 10);
+
+  // warm start from the persistent cache, values are restored exactly
+  FunctionLookupTable table2(countingFunc);
+  table2.setPersistentCache(filename);
+  BOOST_CHECK_EQUAL(table2.getNumEntries(), 10);
+
+  for (size_t i = 0; i < 12; ++i) {
+    vec[0] = static_cast<double>(i) / 7.0;
+    BOOST_CHECK_EQUAL(testFunc1(vec), table2(vec));
+  }
+
+  BOOST_CHECK_EQUAL(numEvaluations, 12);
+
+  // the two new values have been appended
+  FunctionLookupTable table3((MultiFunction(testFunc2)));
+  table3.loadFromFile(filename);
+  BOOST_CHECK_EQUAL(table3.getNumEntries(), 12);
+
+  // saveToFile writes the same values
+  table3.saveToFile(filename);
+  FunctionLookupTable table4((MultiFunction(testFunc2)));
+  table4.loadFromFile(filename);
+  BOOST_CHECK_EQUAL(table4.getNumEntries(), 12);
+
+  for (size_t i = 0; i < 12; ++i) {
+    vec[0] = static_cast<double>(i) / 7.0;
+    BOOST_CHECK_EQUAL(testFunc1(vec), table4(vec));
+  }
+
+  // an incomplete last entry is ignored
+  {
+    std::ofstream stream(filename, std::ios::out | std::ios::binary | std::ios::app);
+    uint64_t dim = 2;
+    stream.write(reinterpret_cast<const char *>(&dim), sizeof(uint64_t));
+    stream.write(reinterpret_cast<const char *>(vec.getPointer()), sizeof(double));
+  }
+
+  FunctionLookupTable table5((MultiFunction(testFunc2)));
+  table5.loadFromFile(filename);
+  BOOST_CHECK_EQUAL(table5.getNumEntries(), 12);
+
+  // parameters of a different dimension are rejected
+  FunctionLookupTable table6((MultiFunction(testFunc2)));
+  table6.addEntry(sgpp::base::DataVector(3, 0.5), 1.0);
+  BOOST_CHECK_THROW(table6.loadFromFile(filename), std::runtime_error);
+
+  std::remove(filename.c_str());
+}
+
 BOOST_AUTO_TEST_CASE(testCombigridTreeStorageSerialization) {
   std::vector<std::shared_ptr<AbstractPointHierarchy>> hierarchies(
       2, std::make_shared<NonNestedPointHierarchy>(
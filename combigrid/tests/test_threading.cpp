@@ -7,6 +7,7 @@
 #include <sgpp/combigrid/integration/MCIntegrator.hpp>
 #include <sgpp/combigrid/operation/CombigridMultiOperation.hpp>
 #include <sgpp/combigrid/operation/CombigridOperation.hpp>
+#include <sgpp/combigrid/storage/FunctionLookupTable.hpp>
 #include <sgpp/combigrid/storage/tree/CombigridTreeStorage.hpp>
 #include <sgpp/combigrid/threading/ThreadPool.hpp>
 #include <sgpp/combigrid/utils/Stopwatch.hpp>
@@ -14,12 +15,21 @@
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
 using sgpp::base::DataVector;
+using sgpp::combigrid::FunctionLookupTable;
+using sgpp::combigrid::MultiFunction;
 using sgpp::combigrid::ThreadPool;
 
 static int counter = 0;
@@ -83,3 +93,137 @@ BOOST_AUTO_TEST_CASE(testThreadingWithCallback) {
 
   checkCorrectness();
 }
+
+BOOST_AUTO_TEST_CASE(testThreadingTaskOrder) {
+  // a thread takes the tasks of its own deque from the back (LIFO)
+  auto tp = std::make_shared<ThreadPool>(1);
+  std::vector<size_t> order;
+
+  for (size_t i = 0; i < 5; ++i) {
+    tp->addTask(ThreadPool::Task([&order, i]() { order.push_back(i); }));
+  }
+
+  tp->start();
+  tp->join();
+
+  std::vector<size_t> expectedOrder = {4, 3, 2, 1, 0};
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expectedOrder.begin(),
+                                expectedOrder.end());
+}
+
+BOOST_AUTO_TEST_CASE(testThreadingWorkStealing) {
+  // one task puts 10 tasks into the deque of its thread and waits until the other thread has
+  // executed all of them, which is only possible by stealing: the thief steals the front half of
+  // the remaining tasks (FIFO), executes the first stolen task and takes the others from the back
+  // of its own deque (LIFO)
+  const size_t numChildren = 10;
+  std::atomic<size_t> numExecuted(0);
+  std::vector<size_t> order;
+  std::mutex orderMutex;
+
+  // keep the idle thread alive until the children have been executed
+  ThreadPool::IdleCallback waitForChildren([&numExecuted](ThreadPool &pool) {
+    if (numExecuted == numChildren) {
+      pool.triggerTermination();
+    } else {
+      std::this_thread::yield();
+    }
+  });
+
+  auto tp = std::make_shared<ThreadPool>(2, waitForChildren);
+  ThreadPool *pool = tp.get();
+
+  tp->addTask(ThreadPool::Task([pool, &numExecuted, &order, &orderMutex, numChildren]() {
+    std::vector<ThreadPool::Task> children;
+
+    for (size_t i = 0; i < numChildren; ++i) {
+      children.push_back(ThreadPool::Task([&numExecuted, &order, &orderMutex, i]() {
+        std::lock_guard<std::mutex> guard(orderMutex);
+        order.push_back(i);
+        ++numExecuted;
+      }));
+    }
+
+    pool->addTasks(children);
+
+    while (numExecuted < numChildren) {
+      std::this_thread::yield();
+    }
+  }));
+
+  tp->start();
+  tp->join();
+
+  std::vector<size_t> expectedOrder = {0, 4, 3, 2, 1, 5, 7, 6, 8, 9};
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expectedOrder.begin(),
+                                expectedOrder.end());
+}
+
+BOOST_AUTO_TEST_CASE(testThreadingNestedTasks) {
+  // tasks that are added from within tasks go to the deque of the executing thread and can be
+  // stolen by the other threads
+  auto tp = std::make_shared<ThreadPool>(4);
+  std::atomic<size_t> numExecuted(0);
+  ThreadPool *pool = tp.get();
+
+  for (size_t i = 0; i < 10; ++i) {
+    tp->addTask(ThreadPool::Task([pool, &numExecuted]() {
+      std::vector<ThreadPool::Task> children;
+      for (size_t j = 0; j < 100; ++j) {
+        children.push_back(ThreadPool::Task([&numExecuted]() { ++numExecuted; }));
+      }
+      pool->addTasks(children);
+      ++numExecuted;
+    }));
+  }
+
+  tp->start();
+  tp->join();
+
+  BOOST_CHECK_EQUAL(numExecuted.load(), 1010);
+}
+
+BOOST_AUTO_TEST_CASE(testFunctionLookupTableConcurrent) {
+  // many threads look up the same points concurrently
+  std::atomic<size_t> numEvaluations(0);
+  FunctionLookupTable table(MultiFunction([&numEvaluations](DataVector const &x) {
+    ++numEvaluations;
+    return x[0] * x[1];
+  }));
+  std::string filename = "tmpFunctionLookupTableConcurrent.bin";
+  table.setPersistentCache(filename);
+
+  const size_t numPoints = 1000;
+  std::vector<std::thread> threads;
+  std::atomic<size_t> numErrors(0);
+
+  for (size_t t = 0; t < 8; ++t) {
+    threads.emplace_back([&table, &numErrors, numPoints, t]() {
+      DataVector x(2);
+      for (size_t i = 0; i < numPoints; ++i) {
+        x[0] = static_cast<double>((i + t * 97) % numPoints);
+        x[1] = 0.5;
+        if (table.evalThreadsafe(x) != x[0] * x[1]) {
+          ++numErrors;
+        }
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  BOOST_CHECK_EQUAL(numErrors.load(), 0);
+  BOOST_CHECK_EQUAL(table.getNumEntries(), numPoints);
+  // a point may be evaluated more than once if two threads request it at the same time
+  BOOST_CHECK_GE(numEvaluations.load(), numPoints);
+
+  // but only the stored value is appended to the persistent cache (16 bytes header, entries of
+  // dimension, parameter and value)
+  std::ifstream stream(filename, std::ios::in | std::ios::binary | std::ios::ate);
+  BOOST_CHECK_EQUAL(static_cast<size_t>(stream.tellg()),
+                    16 + numPoints * (sizeof(uint64_t) + 3 * sizeof(double)));
+  stream.close();
+  std::remove(filename.c_str());
+}
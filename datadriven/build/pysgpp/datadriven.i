@@ -97,6 +97,7 @@
 %include "datadriven/src/sgpp/datadriven/application/SparseGridDensityEstimator.hpp"
 %newobject sgpp::datadriven::SparseGridDensityEstimator::margToDimX(size_t idim);
 %newobject sgpp::datadriven::SparseGridDensityEstimator::marginalize(size_t idim);
+%newobject sgpp::datadriven::OperationDensityMargTo1D::create1DGrid(size_t dim_x);
 
 %include "datadriven/src/sgpp/datadriven/application/LearnerSGDE.hpp"
 %include "datadriven/src/sgpp/datadriven/application/RegressionLearner.hpp"
@@ -89,8 +89,12 @@
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
 
-#ifdef __AVX__
+#if defined(__AVX__) || defined(USE_KERNEL_DISPATCH)
+#include <sgpp/datadriven/operation/hash/KernelDispatch.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/combined/OperationMultipleEvalSubspaceCombined.hpp>
+#endif
+
+#ifdef __AVX__
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/simple/OperationMultipleEvalSubspaceSimple.hpp>
 #endif
 
@@ -453,7 +457,11 @@ base::OperationMultipleEval* createOperationMultipleEval(
     } else if (configuration.getType() == datadriven::OperationMultipleEvalType::SUBSPACELINEAR) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT ||
           configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::COMBINED) {
-#ifdef __AVX__
+#if defined(__AVX__) || defined(USE_KERNEL_DISPATCH)
+        if (!datadriven::KernelDispatch::isSupported(datadriven::KernelISA::AVX)) {
+          throw base::factory_exception("Error creating function: the CPU doesn't support AVX");
+        }
+
         return new datadriven::OperationMultipleEvalSubspaceCombined(grid, dataset);
 #else
         throw base::factory_exception(
@@ -20,7 +20,15 @@ DBMatDMSBackSub::~DBMatDMSBackSub() {}
 void DBMatDMSBackSub::solve(sgpp::base::DataMatrix& DecompMatrix,
                             sgpp::base::DataVector& alpha,
                             sgpp::base::DataVector& b) {
+  solve(DBMatOfflineFile::MatrixView{DecompMatrix.data(), DecompMatrix.getNrows(),
+                                     DecompMatrix.getNcols()},
+        alpha, b);
+}
+
+void DBMatDMSBackSub::solve(const DBMatOfflineFile::MatrixView& DecompMatrix,
+                            sgpp::base::DataVector& alpha, sgpp::base::DataVector& b) {
   size_t resultSize = alpha.getSize();
+  const size_t ncols = DecompMatrix.ncols;
 
   clock_t end;
   clock_t begin;
@@ -34,7 +42,7 @@ void DBMatDMSBackSub::solve(sgpp::base::DataMatrix& DecompMatrix,
   for (size_t i = 0; i < resultSize; i++) {
     y[i] = b[i];
     for (size_t j = 0; j < i; j++) {
-      y[i] -= DecompMatrix.get(i, j) * y[j];
+      y[i] -= DecompMatrix.data[i * ncols + j] * y[j];
     }
     // There is no need to divide by the diagonal element, because all
     // of them are 1 in L
@@ -44,9 +52,9 @@ void DBMatDMSBackSub::solve(sgpp::base::DataMatrix& DecompMatrix,
   for (int i = static_cast<int>(resultSize) - 1; i >= 0; i--) {
     alpha[i] = y[i];
     for (size_t j = i + 1; j < resultSize; j++) {
-      alpha[i] -= DecompMatrix.get(i, j) * alpha[j];
+      alpha[i] -= DecompMatrix.data[i * ncols + j] * alpha[j];
     }
-    alpha[i] /= DecompMatrix.get(i, i);
+    alpha[i] /= DecompMatrix.data[i * ncols + i];
   }
 
   end = clock();
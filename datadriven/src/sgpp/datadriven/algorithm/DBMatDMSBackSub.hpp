@@ -9,6 +9,7 @@
 #define DBMatDMSBackSub_HPP_
 
 #include <sgpp/datadriven/algorithm/DBMatDecompMatrixSolver.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 
 namespace sgpp {
 namespace datadriven {
@@ -38,6 +39,17 @@ class DBMatDMSBackSub : public DBMatDecompMatrixSolver {
    */
   void solve(sgpp::base::DataMatrix& DecompMatrix,
              sgpp::base::DataVector& alpha, sgpp::base::DataVector& b);
+
+  /**
+   * Solves a system of equations with a read-only LU decomposed left hand side (e.g., in the
+   * mapping of a file)
+   *
+   * @param DecompMatrix the LU decomposed left hand side
+   * @param alpha the vector of unknowns (the result is stored there)
+   * @param b the right hand vector of the equation system
+   */
+  void solve(const DBMatOfflineFile::MatrixView& DecompMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b);
 };
 
 }  // namespace datadriven
@@ -23,9 +23,17 @@ void DBMatDMSEigen::solve(sgpp::base::DataMatrix& eigenVectors,
                           sgpp::base::DataVector& eigenValues,
                           sgpp::base::DataVector& alpha,
                           sgpp::base::DataVector& rhs, double lambda) {
-  size_t n = eigenVectors.getNcols();
+  solve(DBMatOfflineFile::MatrixView{eigenVectors.data(), eigenVectors.getNrows(),
+                                     eigenVectors.getNcols()},
+        eigenValues, alpha, rhs, lambda);
+}
+
+void DBMatDMSEigen::solve(const DBMatOfflineFile::MatrixView& eigenVectors,
+                          sgpp::base::DataVector& eigenValues, sgpp::base::DataVector& alpha,
+                          sgpp::base::DataVector& rhs, double lambda) {
+  size_t n = eigenVectors.ncols;
   // Create a matrix view for the eigenvectors
-  gsl_matrix_view q = gsl_matrix_view_array(eigenVectors.getPointer(), n, n);
+  gsl_matrix_const_view q = gsl_matrix_const_view_array(eigenVectors.data, n, n);
   // Create a vector view for the right hand side
   gsl_vector_view b = gsl_vector_view_array(rhs.getPointer(), n);
   // Create a vector view for the eigenvalues
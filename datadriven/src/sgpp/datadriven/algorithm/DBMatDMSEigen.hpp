@@ -9,6 +9,7 @@
 #define DBMATDMSEigen_HPP_
 
 #include <sgpp/datadriven/algorithm/DBMatDecompMatrixSolver.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 
 namespace sgpp {
 namespace datadriven {
@@ -40,6 +41,19 @@ class DBMatDMSEigen : public DBMatDecompMatrixSolver {
   void solve(sgpp::base::DataMatrix& eigenVectors,
              sgpp::base::DataVector& eigenValues, sgpp::base::DataVector& alpha,
              sgpp::base::DataVector& rhs, double lambda);
+
+  /**
+   * Solves a system of equations with read-only eigenvectors (e.g., in the mapping of a file)
+   *
+   * @param eigenVectors the eigendecomposed left hand side (as above)
+   * @param eigenValues the eigenvalues (overwritten)
+   * @param alpha the vector of unknowns (the result is stored there)
+   * @param rhs the right hand vector of the equation system
+   * @param lambda the regularization parameter
+   */
+  void solve(const DBMatOfflineFile::MatrixView& eigenVectors,
+             sgpp::base::DataVector& eigenValues, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& rhs, double lambda);
 };
 
 }  // namespace datadriven
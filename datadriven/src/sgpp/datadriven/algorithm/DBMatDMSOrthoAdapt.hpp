@@ -7,6 +7,7 @@
 
 #include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatDecompMatrixSolver.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/configuration/ParallelConfiguration.hpp>
 #include <sgpp/datadriven/scalapack/DataMatrixDistributed.hpp>
 #include <sgpp/datadriven/scalapack/DataVectorDistributed.hpp>
@@ -40,6 +41,19 @@ class DBMatDMSOrthoAdapt : public DBMatDecompMatrixSolver {
   void solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMatrix& Q, sgpp::base::DataMatrix& B,
              sgpp::base::DataVector& b, sgpp::base::DataVector& alpha);
 
+  /**
+   * Version of solve with read-only T_inv and Q (e.g., in the mapping of a file).
+   *
+   * @param T_inv Inverse of a tridiagonal matrix
+   * @param Q     Orthogonal matrix, part of hessenberg_decomp of the lhs matrix
+   * @param B     Storage of the online objects refined/coarsened points
+   * @param b     The right side of the system
+   * @param alpha The solution vector of the system, computed values go there
+   */
+  void solve(const DBMatOfflineFile::MatrixView& T_inv, const DBMatOfflineFile::MatrixView& Q,
+             sgpp::base::DataMatrix& B, sgpp::base::DataVector& b,
+             sgpp::base::DataVector& alpha);
+
   /**
    * Parallel (distributed) version of solve.
    *
@@ -12,8 +12,10 @@
 #include <sgpp/base/tools/json/json_exception.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 
 #include <algorithm>
+#include <sstream>
 #include <string>
 
 namespace sgpp {
@@ -81,23 +83,7 @@ void DBMatDatabase::putDataMatrix(sgpp::base::GeneralGridConfiguration& gridConf
   if (entry_index < 0) {
     // Create a new list node in the json object
     json::DictNode& entry = dynamic_cast<json::DictNode&>(database->addDictValue());
-    // Add a grid configuration entry
-    json::DictNode& gridConfigEntry = dynamic_cast<json::DictNode&>(
-        entry.addDictAttr(keyGridConfiguration));
-    gridConfigEntry.addTextAttr(keyGridType, sgpp::datadriven::GeneralGridTypeParser::toString(
-        gridConfig.generalType_));
-    gridConfigEntry.addIDAttr(keyGridDimension, static_cast<uint64_t>(gridConfig.dim_));
-    gridConfigEntry.addIDAttr(keyGridLevel, static_cast<int64_t>(gridConfig.level_));
-    // Add a regularization configuration entry
-    json::DictNode& regularizationConfigEntry = dynamic_cast<json::DictNode&>(entry.addDictAttr(
-        keyRegularizationConfiguration));
-    regularizationConfigEntry.addIDAttr(keyRegularizationStrength, regularizationConfig.lambda_);
-    // Add a density estimation configuration entry
-    json::DictNode& densityEstimationConfigEntry = dynamic_cast<json::DictNode&>(entry.addDictAttr(
-        keyDensityEstimationConfiguration));
-    densityEstimationConfigEntry.addTextAttr(keyDecompositionType,
-        sgpp::datadriven::MatrixDecompositionTypeParser::toString(
-            densityEstimationConfig.decomposition_));
+    addConfigurationAttributes(entry, gridConfig, regularizationConfig, densityEstimationConfig);
     // Add the filepath
     entry.addTextAttr(keyFilepath, filepath);
     // Serialize the entire database
@@ -118,6 +104,85 @@ void DBMatDatabase::putDataMatrix(sgpp::base::GeneralGridConfiguration& gridConf
   }
 }
 
+void DBMatDatabase::putDataMatrixFromFile(const std::string& filepath, bool overwriteEntry) {
+  DBMatOfflineFile file(filepath);
+  json::JSON description;
+  description.deserializeFromString(file.getDescription());
+
+  if (!description.contains(keyGridConfiguration) ||
+      !description.contains(keyRegularizationConfiguration) ||
+      !description.contains(keyDensityEstimationConfiguration)) {
+    throw sgpp::base::data_exception(
+        "DBMatDatabase: matrix file does not contain a description of its configuration");
+  }
+
+  // Reconstruct the configuration from the description
+  json::Node& gridConfigNode = description[keyGridConfiguration];
+  sgpp::base::GeneralGridConfiguration gridConfig;
+  gridConfig.generalType_ =
+      sgpp::datadriven::GeneralGridTypeParser::parse(gridConfigNode[keyGridType].get());
+  gridConfig.dim_ = gridConfigNode[keyGridDimension].getUInt();
+  gridConfig.level_ = static_cast<int>(gridConfigNode[keyGridLevel].getInt());
+
+  if (gridConfig.generalType_ == sgpp::base::GeneralGridType::ComponentGrid) {
+    throw sgpp::base::data_exception(
+        "DBMatDatabase: component grids cannot be put into the database from a matrix file");
+  }
+
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.lambda_ =
+      description[keyRegularizationConfiguration][keyRegularizationStrength].getDouble();
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionTypeParser::parse(
+      description[keyDensityEstimationConfiguration][keyDecompositionType].get());
+
+  if (densityEstimationConfig.decomposition_ != file.getDecompositionType()) {
+    throw sgpp::base::data_exception(
+        "DBMatDatabase: decomposition type of the description does not match the matrix file");
+  }
+
+  putDataMatrix(gridConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig,
+      filepath, overwriteEntry);
+}
+
+std::string DBMatDatabase::describeDataMatrix(sgpp::base::GeneralGridConfiguration& gridConfig,
+    sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+    sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+    sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig) {
+  json::DictNode description;
+  addConfigurationAttributes(description, gridConfig, regularizationConfig,
+      densityEstimationConfig);
+  std::ostringstream stream;
+  description.serialize(stream, 0);
+  return stream.str();
+}
+
+void DBMatDatabase::addConfigurationAttributes(json::Node& entry,
+    sgpp::base::GeneralGridConfiguration& gridConfig,
+    sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+    sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig) {
+  // Add a grid configuration entry
+  json::DictNode& gridConfigEntry = dynamic_cast<json::DictNode&>(
+      entry.addDictAttr(keyGridConfiguration));
+  gridConfigEntry.addTextAttr(keyGridType, sgpp::datadriven::GeneralGridTypeParser::toString(
+      gridConfig.generalType_));
+  gridConfigEntry.addIDAttr(keyGridDimension, static_cast<uint64_t>(gridConfig.dim_));
+  gridConfigEntry.addIDAttr(keyGridLevel, static_cast<int64_t>(gridConfig.level_));
+  // Add a regularization configuration entry
+  json::DictNode& regularizationConfigEntry = dynamic_cast<json::DictNode&>(entry.addDictAttr(
+      keyRegularizationConfiguration));
+  regularizationConfigEntry.addIDAttr(keyRegularizationStrength, regularizationConfig.lambda_);
+  // Add a density estimation configuration entry
+  json::DictNode& densityEstimationConfigEntry = dynamic_cast<json::DictNode&>(entry.addDictAttr(
+      keyDensityEstimationConfiguration));
+  densityEstimationConfigEntry.addTextAttr(keyDecompositionType,
+      sgpp::datadriven::MatrixDecompositionTypeParser::toString(
+          densityEstimationConfig.decomposition_));
+}
+
 bool DBMatDatabase::gridConfigurationMatches(json::DictNode *node,
       sgpp::base::GeneralGridConfiguration& gridConfig, size_t entry_num) {
   // Check if grid general type matches
@@ -73,6 +73,31 @@ class DBMatDatabase{
       sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
       std::string filepath, bool overwriteEntry = false);
 
+  /**
+   * Puts a filepath in the database that refers to a matrix file in the binary format of
+   * DBMatOfflineFile. The configuration of the entry is read from the description that was
+   * stored with the decomposition (see describeDataMatrix and DBMatOffline::store).
+   * @param filepath the path where the matrix decomposition is located at
+   * @param overwriteEntry replaces existing entries with the same configuration if and only if
+   * this parameter is set
+   */
+  void putDataMatrixFromFile(const std::string& filepath, bool overwriteEntry = false);
+
+  /**
+   * Describes a configuration in the format of the database entries (without the filepath).
+   * The description can be stored with a decomposition, see DBMatOffline::store, so that the
+   * file can be put into the database with putDataMatrixFromFile.
+   * @param gridConfig the grid configuration the matrix matches
+   * @param adaptivityConfig the adaptivity configuration the matrix matches
+   * @param regularizationConfig the regularization configuration the matrix matches
+   * @param densityEstimationConfig the density estimation configuration the matrix matches
+   * @return json description of the configuration
+   */
+  static std::string describeDataMatrix(sgpp::base::GeneralGridConfiguration& gridConfig,
+      sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+      sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+      sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
+
 
  private:
   /**
@@ -105,6 +130,18 @@ class DBMatDatabase{
       sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
       sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
 
+  /**
+   * Adds the configuration attributes of a database entry to a json dict node.
+   * @param entry the root node of the entry
+   * @param gridConfig the grid configuration the matrix matches
+   * @param regularizationConfig the regularization configuration the matrix matches
+   * @param densityEstimationConfig the density estimation configuration the matrix matches
+   */
+  static void addConfigurationAttributes(json::Node& entry,
+      sgpp::base::GeneralGridConfiguration& gridConfig,
+      sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+      sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
+
   /**
    * Checks weather the grid configuration of a json dict node representing a database entry root
    * matches the grid configuration passed to the database.
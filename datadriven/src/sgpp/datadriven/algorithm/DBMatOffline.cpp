@@ -14,14 +14,11 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitModLinear.hpp>
 
-#ifdef USE_GSL
-#include <gsl/gsl_matrix_double.h>
-#endif /* USE_GSL */
-
 #include <math.h>
 #include <stdio.h>
 #include <algorithm>
@@ -56,6 +53,8 @@ DBMatOffline::DBMatOffline(const DBMatOffline& rhs)
       isConstructed(rhs.isConstructed),
       isDecomposed(rhs.isDecomposed),
       lhsInverse(rhs.lhsInverse),
+      description(rhs.description),
+      mappedFile(rhs.mappedFile),
       interactions(rhs.interactions) {}
 
 DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs) {
@@ -66,26 +65,73 @@ DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs)
   isConstructed = rhs.isConstructed;
   isDecomposed = rhs.isDecomposed;
   lhsInverse = rhs.lhsInverse;
+  description = rhs.description;
+  mappedFile = rhs.mappedFile;
   interactions = rhs.interactions;
   return *this;
 }
 
 DBMatOffline::DBMatOffline(const std::string& filepath)
     : lhsMatrix(), isConstructed(true), isDecomposed(true), lhsInverse() {
-  // Parse the interactions
-  parseInter(filepath, interactions);
+  if (DBMatOfflineFile::isBinaryFile(filepath)) {
+    mapFile(filepath);
+  } else {
+    // Parse the interactions of the old text format,
+    // parsing of lhsMatrix will be done in subclass implementations
+    parseInter(filepath, interactions);
+  }
+}
+
+void DBMatOffline::mapFile(const std::string& fileName) {
+  mappedFile = std::make_shared<DBMatOfflineFile>(fileName);
+  interactions = mappedFile->getInteractions();
+  description = mappedFile->getDescription();
+}
+
+const DBMatOfflineFile& DBMatOffline::getMappedFile() const {
+  // verifying the checksum reads the whole file, hence it is not done before it is needed
+  if (!mappedFile->verifyChecksum()) {
+    throw data_exception("DBMatOffline: checksum of the serialized object does not match");
+  }
+
+  return *mappedFile;
+}
 
-  // Parsing of lhsMatrix will be done in subclass implementations
+void DBMatOffline::loadMappedMatrices() {
+  if (mappedFile != nullptr) {
+    getMappedMatrices(getMappedFile());
+    mappedFile.reset();
+  }
 }
 
+DBMatOfflineFile::MatrixView DBMatOffline::getMatrixView(size_t i,
+                                                         const DataMatrix& matrix) const {
+  if (mappedFile != nullptr) {
+    return getMappedFile().getMatrixView(i);
+  } else {
+    return DBMatOfflineFile::MatrixView{matrix.data(), matrix.getNrows(), matrix.getNcols()};
+  }
+}
+
+void DBMatOffline::getMappedMatrices(const DBMatOfflineFile& file) { file.getMatrix(0, lhsMatrix); }
+
 DataMatrix& DBMatOffline::getDecomposedMatrix() {
   if (isDecomposed) {
+    loadMappedMatrices();
     return lhsMatrix;
   } else {
     throw data_exception("Matrix was not decomposed yet");
   }
 }
 
+DBMatOfflineFile::MatrixView DBMatOffline::getDecomposedMatrixView() {
+  if (isDecomposed) {
+    return getMatrixView(0, lhsMatrix);
+  } else {
+    throw data_exception("Matrix was not decomposed yet");
+  }
+}
+
 DataMatrix& DBMatOffline::getInverseMatrix() { return this->lhsInverse; }
 
 DataMatrixDistributed& DBMatOffline::getDecomposedMatrixDistributed() {
@@ -117,9 +163,10 @@ void DBMatOffline::syncDistributedDecomposition(std::shared_ptr<BlacsProcessGrid
                                                 const ParallelConfiguration& parallelConfig) {
 #ifdef USE_SCALAPACK
   if (isDecomposed) {
+    const DBMatOfflineFile::MatrixView lhsView = getMatrixView(0, lhsMatrix);
     lhsDistributed = DataMatrixDistributed::fromSharedData(
-        lhsMatrix.data(), processGrid, lhsMatrix.getNrows(), lhsMatrix.getNcols(),
-        parallelConfig.rowBlockSize_, parallelConfig.columnBlockSize_);
+        lhsView.data, processGrid, lhsView.nrows, lhsView.ncols, parallelConfig.rowBlockSize_,
+        parallelConfig.columnBlockSize_);
   } else {
     throw data_exception(
         "In DBMatOffline::syncDistributedDecomposition\nCan't sync, because lhsMatrix "
@@ -165,46 +212,47 @@ void DBMatOffline::buildMatrix(Grid* grid, RegularizationConfiguration& regulari
 }
 
 void DBMatOffline::store(const std::string& fileName) {
-#ifdef USE_GSL
   if (!isDecomposed) {
     throw algorithm_exception("Matrix not decomposed yet");
   }
 
-  // Write configuration
-  std::ofstream outputFile(fileName, std::ofstream::out);
+  std::vector<DBMatOfflineFile::MatrixView> matrices;
+  std::vector<size_t> permutation;
 
-  if (!outputFile) {
-    throw algorithm_exception{"cannot open file for writing"};
-  }
+  if (mappedFile != nullptr) {
+    // the matrices have not been modified, so they are written from the mapping
+    const DBMatOfflineFile& file = getMappedFile();
 
-  std::string inter = "," + std::to_string(interactions.size());
-  for (const std::set<size_t>& i : interactions) {
-    inter.append("," + std::to_string(i.size()));
-    for (size_t j : i) {
-      inter.append("," + std::to_string(j));
+    for (size_t i = 0; i < file.getNumberOfMatrices(); i++) {
+      matrices.push_back(file.getMatrixView(i));
     }
-  }
 
-  outputFile << lhsMatrix.getNrows() << "," << lhsMatrix.getNcols() << ","
-             << static_cast<int>(getDecompositionType()) << inter << "\n";
-  outputFile.close();
+    file.getPermutation(permutation);
+  } else {
+    std::vector<const DataMatrix*> storedMatrices;
+    getStoredData(storedMatrices, permutation);
 
-  // write matrix
-  // switch to c FILE API for GSL
-  FILE* outputCFile = fopen(fileName.c_str(), "ab");
-  if (!outputCFile) {
-    throw algorithm_exception{"cannot open file for writing"};
+    for (const DataMatrix* matrix : storedMatrices) {
+      matrices.push_back(
+          DBMatOfflineFile::MatrixView{matrix->data(), matrix->getNrows(), matrix->getNcols()});
+    }
   }
-  gsl_matrix_view matrixView =
-      gsl_matrix_view_array(lhsMatrix.getPointer(), lhsMatrix.getNrows(), lhsMatrix.getNcols());
-  gsl_matrix_fwrite(outputCFile, &matrixView.matrix);
 
-  fclose(outputCFile);
-  std::cout << "Stored " << lhsMatrix.getNrows() << "x" << lhsMatrix.getNcols() << " matrix"
+  DBMatOfflineFile::write(fileName, getDecompositionType(), interactions, matrices, permutation,
+                          description);
+  std::cout << "Stored " << matrices[0].nrows << "x" << matrices[0].ncols << " matrix"
             << std::endl;
-#else
-  throw base::not_implemented_exception("built without GSL");
-#endif /* USE_GSL */
+}
+
+void DBMatOffline::setDescription(const std::string& description) {
+  this->description = description;
+}
+
+const std::string& DBMatOffline::getDescription() const { return description; }
+
+void DBMatOffline::getStoredData(std::vector<const DataMatrix*>& matrices,
+                                 std::vector<size_t>& permutation) {
+  matrices.push_back(&lhsMatrix);
 }
 
 void DBMatOffline::decomposeMatrixParallel(RegularizationConfiguration& regularizationConfig,
@@ -230,8 +278,9 @@ void DBMatOffline::compute_inverse_parallel(std::shared_ptr<BlacsProcessGrid> pr
 
 void DBMatOffline::printMatrix() {
   if (isDecomposed) {
-    std::cout << "Size: " << lhsMatrix.getNrows() << " , " << lhsMatrix.getNcols() << "\n"
-              << lhsMatrix.toString();
+    const DBMatOfflineFile::MatrixView lhsView = getMatrixView(0, lhsMatrix);
+    std::cout << "Size: " << lhsView.nrows << " , " << lhsView.ncols << "\n"
+              << DataMatrix(lhsView.data, lhsView.nrows, lhsView.ncols).toString();
   } else {
     throw data_exception("Matrix was not decomposed yet");
   }
@@ -278,9 +327,14 @@ void sgpp::datadriven::DBMatOffline::parseInter(
   std::cout << interactions.size() << std::endl;
 }
 
-size_t DBMatOffline::getGridSize() { return lhsMatrix.getNrows(); }
+size_t DBMatOffline::getGridSize() {
+  return (mappedFile != nullptr) ? mappedFile->getNrows(0) : lhsMatrix.getNrows();
+}
 
-sgpp::base::DataMatrix& DBMatOffline::getLhsMatrix_ONLY_FOR_TESTING() { return this->lhsMatrix; }
+sgpp::base::DataMatrix& DBMatOffline::getLhsMatrix_ONLY_FOR_TESTING() {
+  loadMappedMatrices();
+  return this->lhsMatrix;
+}
 
 }  // namespace datadriven
 }  // namespace sgpp
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
 #include <sgpp/datadriven/configuration/ParallelConfiguration.hpp>
 #include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
@@ -87,11 +88,22 @@ class DBMatOffline {
 
   /**
    * Get a reference to the decomposed matrix. Throws if matrix has not yet been decomposed.
+   * As the matrix may be modified through the reference, it is copied out of the file the object
+   * was deserialized from, use getDecomposedMatrixView for read-only access.
    *
    * @return decomposed matrix
    */
   DataMatrix& getDecomposedMatrix();
 
+  /**
+   * Read-only access to the decomposed matrix. Throws if matrix has not yet been decomposed.
+   * Unlike getDecomposedMatrix, the matrix is not copied out of the file the object was
+   * deserialized from.
+   *
+   * @return view of the decomposed matrix, valid until the matrix is modified
+   */
+  DBMatOfflineFile::MatrixView getDecomposedMatrixView();
+
   /**
    * Get a reference to the inverse matrix
    *
@@ -190,11 +202,23 @@ class DBMatOffline {
                                         const ParallelConfiguration& parallelConfig);
 
   /**
-   * Serialize the DBMatOffline Object
+   * Serialize the DBMatOffline Object in the binary format of DBMatOfflineFile, together with
+   * the description of the object
    * @param fileName path where to store the file.
    */
   virtual void store(const std::string& fileName);
 
+  /**
+   * @param description text stored with the decomposition, e.g., the configuration as written by
+   * DBMatDatabase::describeDataMatrix
+   */
+  void setDescription(const std::string& description);
+
+  /**
+   * @return text stored with the decomposition (read from the file for deserialized objects)
+   */
+  const std::string& getDescription() const;
+
   /**
    * Returns the dimensionality of the quadratic lhs matrix (i.e. the number of rows)
    * @return the grid size
@@ -214,6 +238,16 @@ class DBMatOffline {
   bool isDecomposed;      // If the matrix was decomposed
   DataMatrix lhsInverse;  // stores the explicitly computed inverse (only in SMW case)
 
+  // text stored with the decomposition
+  std::string description;
+
+  /**
+   * Binary file the object was deserialized from. The matrices stay in the read-only mapping of
+   * the file (shared by all copies of the object) until they are modified, see
+   * loadMappedMatrices.
+   */
+  std::shared_ptr<DBMatOfflineFile> mappedFile;
+
   // distributed lhs, only initialized in ScaLAPACK version
   DataMatrixDistributed lhsDistributed;
   DataMatrixDistributed lhsDistributedInverse;
@@ -230,6 +264,52 @@ class DBMatOffline {
    */
   void parseInter(const std::string& fileName,
                   std::set<std::set<size_t>>& interactions) const;
+
+  /**
+   * Collects the data that is serialized by store. The first matrix is read back into lhsMatrix
+   * by getMappedMatrices, subclasses that store more matrices have to read them there.
+   * @param matrices the matrices to store, lhsMatrix by default
+   * @param permutation the permutation to store, empty by default
+   */
+  virtual void getStoredData(std::vector<const DataMatrix*>& matrices,
+                             std::vector<size_t>& permutation);
+
+  /**
+   * Opens a binary file and reads the interactions and the description. The matrices are not
+   * copied (see loadMappedMatrices) and the checksum is verified when they are accessed first
+   * (see getMappedFile).
+   * @param fileName path of the serialized DBMatOffline object
+   */
+  void mapFile(const std::string& fileName);
+
+  /**
+   * Verifies the checksum of the file the object was deserialized from (once per file), throws if
+   * it does not match.
+   * @return the file
+   */
+  const DBMatOfflineFile& getMappedFile() const;
+
+  /**
+   * Copies the matrices out of the mapping of the file the object was deserialized from (if they
+   * have not been copied yet) and releases the mapping. Has to be called before the matrices are
+   * modified, read-only access should use getMatrixView instead.
+   */
+  void loadMappedMatrices();
+
+  /**
+   * Read-only access to a matrix of the object, which is taken from the mapping of the file the
+   * object was deserialized from if the matrices have not been copied yet.
+   * @param i number of the matrix in the file (in the order of getStoredData)
+   * @param matrix the matrix if it is not mapped
+   * @return view of the matrix
+   */
+  DBMatOfflineFile::MatrixView getMatrixView(size_t i, const DataMatrix& matrix) const;
+
+  /**
+   * Copies the matrices the object consists of out of a file, lhsMatrix by default.
+   * @param file the file to copy the matrices from
+   */
+  virtual void getMappedMatrices(const DBMatOfflineFile& file);
 };
 
 }  // namespace datadriven
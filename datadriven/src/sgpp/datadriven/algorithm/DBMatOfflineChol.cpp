@@ -119,11 +119,10 @@ void DBMatOfflineChol::compute_inverse() {
     throw sgpp::base::algorithm_exception(
         "in DBMatOfflineChol::compute_inverse:\noffline matrix not decomposed yet.\n");
   }
-  // initialize lhsInverse
-  this->lhsInverse = DataMatrix(this->lhsMatrix.getNrows(), this->lhsMatrix.getNcols());
-
-  // copy, in order to not mess with internal lhsMatrix of offlineChol object
-  this->lhsInverse.copyFrom(this->lhsMatrix);
+  // copy, in order to not mess with internal lhsMatrix of offlineChol object (which might still
+  // be in the mapping of a file)
+  const DBMatOfflineFile::MatrixView lhsView = getMatrixView(0, this->lhsMatrix);
+  this->lhsInverse = DataMatrix(lhsView.data, lhsView.nrows, lhsView.ncols);
 
   // create matrix view in style of decomposition, see ::decomposeMatrix
   gsl_matrix_view m =
@@ -144,12 +143,13 @@ void DBMatOfflineChol::compute_inverse_parallel(std::shared_ptr<BlacsProcessGrid
     throw sgpp::base::algorithm_exception(
         "in DBMatOfflineChol::compute_inverse_parallel:\noffline matrix not decomposed yet.\n");
   }
-  size_t n = this->lhsMatrix.getNrows();
+  const DBMatOfflineFile::MatrixView lhsView = getMatrixView(0, this->lhsMatrix);
+  size_t n = lhsView.nrows;
 
   // initializing distributed inverse matrix from lhs matrix
   this->lhsDistributedInverse = DataMatrixDistributed::fromSharedData(
-      this->lhsMatrix.getPointer(), processGrid, this->lhsMatrix.getNrows(),
-      this->lhsMatrix.getNcols(), parallelConfig.rowBlockSize_, parallelConfig.columnBlockSize_);
+      lhsView.data, processGrid, lhsView.nrows, lhsView.ncols, parallelConfig.rowBlockSize_,
+      parallelConfig.columnBlockSize_);
 
   // transpose, because fortran column-major
   lhsDistributedInverse = lhsDistributedInverse.transpose();
@@ -170,7 +170,7 @@ void DBMatOfflineChol::compute_inverse_parallel(std::shared_ptr<BlacsProcessGrid
   // Note: no need to transpose even though fortran column-major, because symmetric
 
   // syncing non-distri and distri inverse matrices
-  this->lhsInverse = DataMatrix(this->lhsMatrix.getNrows(), this->lhsMatrix.getNcols());
+  this->lhsInverse = DataMatrix(lhsView.nrows, lhsView.ncols);
   this->lhsDistributedInverse.toLocalDataMatrix(this->lhsInverse);
 
   return;
@@ -181,6 +181,7 @@ void DBMatOfflineChol::choleskyModification(Grid& grid, datadriven::DensityEstim
                                             size_t newPoints, std::list<size_t> deletedPoints,
                                             double lambda) {
 #ifdef USE_GSL
+  loadMappedMatrices();
 
   // Start coarsening
   // If list 'deletedPoints' is not empty, grid points got removed
@@ -12,6 +12,7 @@
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
 #include <gsl/gsl_blas.h>
@@ -34,6 +35,11 @@ DBMatOfflineEigen::DBMatOfflineEigen() {}
 
 sgpp::datadriven::DBMatOfflineEigen::DBMatOfflineEigen(const std::string& fileName)
     : DBMatOffline{fileName} {
+  if (DBMatOfflineFile::isBinaryFile(fileName)) {
+    // the file was mapped by the super constructor, lhsMatrix is copied on first access
+    return;
+  }
+
   // Read grid size from header (number of rows in lhsMatrix)
   std::ifstream filestream(fileName, std::istream::in);
   // Read configuration
@@ -9,10 +9,12 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineDenseIChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineEigen.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineLU.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
+#include <fstream>
 #include <string>
 #include <vector>
 
@@ -68,49 +70,61 @@ DBMatOffline* DBMatOfflineFactory::buildOfflineObject(
 }
 
 DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
-#ifdef USE_GSL
-  std::ifstream file(fileName, std::istream::in);
+  MatrixDecompositionType type;
 
-  if (!file) {
-    throw factory_exception("Failed to open File");
-  }
+  if (DBMatOfflineFile::isBinaryFile(fileName)) {
+    // Binary format, does not depend on GSL
+    DBMatOfflineFile file(fileName);
+    type = file.getDecompositionType();
+  } else {
+#ifdef USE_GSL
+    std::ifstream file(fileName, std::istream::in);
 
-  std::string str;
-  std::getline(file, str);
-  file.close();
+    if (!file) {
+      throw factory_exception("Failed to open File");
+    }
 
-  std::cout << str;
-  std::vector<std::string> tokens;
-  StringTokenizer::tokenize(str, ",", tokens);
-  std::cout << "tokens: ";
-  for (auto& item : tokens) {
-    std::cout << item << ",";
-  }
-  std::cout << std::endl;
+    std::string str;
+    std::getline(file, str);
+    file.close();
 
-  MatrixDecompositionType type = static_cast<MatrixDecompositionType>(std::stoi(tokens[2]));
+    std::vector<std::string> tokens;
+    StringTokenizer::tokenize(str, ",", tokens);
 
-  std::cout << "type: " << static_cast<int>(type) << std::endl;
+    type = static_cast<MatrixDecompositionType>(std::stoi(tokens[2]));
+#else
+    throw factory_exception("built without GSL");
+#endif /* USE_GSL */
+  }
 
   switch (type) {
     case (MatrixDecompositionType::Eigen):
+#ifdef USE_GSL
       return new DBMatOfflineEigen(fileName);
+#else
+      throw factory_exception("built without GSL");
+#endif /* USE_GSL */
+
     case (MatrixDecompositionType::LU):
+#ifdef USE_GSL
       return new DBMatOfflineLU(fileName);
+#else
+      throw factory_exception("built without GSL");
+#endif /* USE_GSL */
+
     case (MatrixDecompositionType::Chol):
     case (MatrixDecompositionType::SMW_chol):
       return new DBMatOfflineChol(fileName);
+
     case (MatrixDecompositionType::DenseIchol):
       return new DBMatOfflineDenseIChol(fileName);
+
     case (MatrixDecompositionType::OrthoAdapt):
     case (MatrixDecompositionType::SMW_ortho):
       return new DBMatOfflineOrthoAdapt(fileName);
   }
 
   throw factory_exception("Trying to build offline object from unknown decomposition type");
-#else
-  throw factory_exception("built without GSL");
-#endif /* USE_GSL */
 }
 
 } /* namespace datadriven */
@@ -0,0 +1,473 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::data_exception;
+using sgpp::base::file_exception;
+
+namespace {
+
+/// magic bytes at the beginning of the file
+const char DBMAT_FILE_MAGIC[8] = {'S', 'G', 'P', 'P', 'D', 'B', 'M', 'O'};
+/// written in native byte order, used to detect files written on a different architecture
+const uint32_t DBMAT_FILE_BYTE_ORDER_MARK = 0x01020304;
+/// version of the format
+const uint32_t DBMAT_FILE_VERSION = 1;
+/// alignment of the sections
+const size_t DBMAT_FILE_ALIGNMENT = 64;
+/// number of bytes that are hashed together in verifyChecksum
+const size_t DBMAT_FILE_CHECKSUM_BLOCK_SIZE = 1 << 20;
+
+struct DBMatOfflineFileHeader {
+  char magic[8];
+  uint32_t byteOrderMark;
+  uint32_t version;
+  int32_t decompositionType;
+  uint32_t numberOfMatrices;
+  uint64_t metadataSize;
+  uint64_t permutationSize;
+  uint64_t checksum;
+  uint64_t reserved[2];
+};
+
+static_assert(sizeof(DBMatOfflineFileHeader) == DBMAT_FILE_ALIGNMENT,
+              "header of DBMatOfflineFile must fill one aligned block");
+
+inline size_t alignOffset(size_t offset) {
+  return (offset + DBMAT_FILE_ALIGNMENT - 1) / DBMAT_FILE_ALIGNMENT * DBMAT_FILE_ALIGNMENT;
+}
+
+inline uint64_t combineHash(uint64_t hash, uint64_t value) {
+  // FNV-1a on 64 bit words
+  return (hash ^ value) * 0x100000001B3ULL;
+}
+
+uint64_t hashBlock(const char* block, size_t size) {
+  // four independent lanes of multiplicative hashing on 64 bit words
+  uint64_t lanes[4] = {0xCBF29CE484222325ULL, 0x84222325CBF29CE4ULL, 0x9E3779B97F4A7C15ULL,
+                       0xC2B2AE3D27D4EB4FULL};
+  const size_t numberOfWords = size / sizeof(uint64_t);
+  size_t k = 0;
+
+  for (; k + 4 <= numberOfWords; k += 4) {
+    for (size_t l = 0; l < 4; l++) {
+      uint64_t word;
+      std::memcpy(&word, block + (k + l) * sizeof(uint64_t), sizeof(uint64_t));
+      lanes[l] = combineHash(lanes[l], word);
+      lanes[l] ^= lanes[l] >> 29;
+    }
+  }
+
+  uint64_t hash = combineHash(combineHash(lanes[0], lanes[1]), combineHash(lanes[2], lanes[3]));
+
+  for (size_t i = k * sizeof(uint64_t); i < size; i++) {
+    hash = combineHash(hash, static_cast<unsigned char>(block[i]));
+  }
+
+  return combineHash(hash, size);
+}
+
+/**
+ * Hash of a section of the file, the blocks of the section are hashed in parallel.
+ */
+uint64_t hashSection(const char* section, size_t size) {
+  const size_t numberOfBlocks =
+      (size + DBMAT_FILE_CHECKSUM_BLOCK_SIZE - 1) / DBMAT_FILE_CHECKSUM_BLOCK_SIZE;
+  std::vector<uint64_t> blockHashes(numberOfBlocks);
+
+#pragma omp parallel for schedule(static)
+  for (size_t b = 0; b < numberOfBlocks; b++) {
+    const size_t blockBegin = b * DBMAT_FILE_CHECKSUM_BLOCK_SIZE;
+    blockHashes[b] = hashBlock(section + blockBegin,
+                               std::min(DBMAT_FILE_CHECKSUM_BLOCK_SIZE, size - blockBegin));
+  }
+
+  uint64_t hash = 0xCBF29CE484222325ULL;
+
+  for (uint64_t blockHash : blockHashes) {
+    hash = combineHash(hash, blockHash);
+  }
+
+  return hash;
+}
+
+/**
+ * Checksum of the file: the sections are hashed separately (the padding between them
+ * is not part of the checksum).
+ */
+uint64_t computeChecksum(const std::vector<std::pair<const char*, size_t>>& sections) {
+  uint64_t checksum = 0xCBF29CE484222325ULL;
+
+  for (const auto& section : sections) {
+    checksum = combineHash(checksum, hashSection(section.first, section.second));
+  }
+
+  return checksum;
+}
+
+void appendWord(std::vector<char>& bytes, uint64_t word) {
+  const char* wordBytes = reinterpret_cast<const char*>(&word);
+  bytes.insert(bytes.end(), wordBytes, wordBytes + sizeof(uint64_t));
+}
+
+uint64_t readWord(const char*& position, const char* end) {
+  if (static_cast<size_t>(end - position) < sizeof(uint64_t)) {
+    throw data_exception("DBMatOfflineFile: metadata section is truncated");
+  }
+
+  uint64_t word;
+  std::memcpy(&word, position, sizeof(uint64_t));
+  position += sizeof(uint64_t);
+  return word;
+}
+
+void writePadding(std::ofstream& stream, size_t& offset) {
+  const size_t alignedOffset = alignOffset(offset);
+  const char zeros[DBMAT_FILE_ALIGNMENT] = {};
+  stream.write(zeros, alignedOffset - offset);
+  offset = alignedOffset;
+}
+
+}  // namespace
+
+void DBMatOfflineFile::write(const std::string& fileName,
+                             MatrixDecompositionType decompositionType,
+                             const std::set<std::set<size_t>>& interactions,
+                             const std::vector<const DataMatrix*>& matrices,
+                             const std::vector<size_t>& permutation,
+                             const std::string& description) {
+  std::vector<MatrixView> matrixViews;
+
+  for (const DataMatrix* matrix : matrices) {
+    matrixViews.push_back(MatrixView{matrix->data(), matrix->getNrows(), matrix->getNcols()});
+  }
+
+  write(fileName, decompositionType, interactions, matrixViews, permutation, description);
+}
+
+void DBMatOfflineFile::write(const std::string& fileName,
+                             MatrixDecompositionType decompositionType,
+                             const std::set<std::set<size_t>>& interactions,
+                             const std::vector<MatrixView>& matrices,
+                             const std::vector<size_t>& permutation,
+                             const std::string& description) {
+  // metadata: matrix sizes, interactions, description
+  std::vector<char> metadata;
+
+  for (const MatrixView& matrix : matrices) {
+    appendWord(metadata, matrix.nrows);
+    appendWord(metadata, matrix.ncols);
+  }
+
+  appendWord(metadata, interactions.size());
+
+  for (const std::set<size_t>& interaction : interactions) {
+    appendWord(metadata, interaction.size());
+
+    for (size_t d : interaction) {
+      appendWord(metadata, d);
+    }
+  }
+
+  appendWord(metadata, description.size());
+  metadata.insert(metadata.end(), description.begin(), description.end());
+
+  std::vector<uint64_t> permutationWords(permutation.begin(), permutation.end());
+  std::vector<std::pair<const char*, size_t>> sections;
+  sections.emplace_back(metadata.data(), metadata.size());
+
+  for (const MatrixView& matrix : matrices) {
+    sections.emplace_back(reinterpret_cast<const char*>(matrix.data),
+                          matrix.nrows * matrix.ncols * sizeof(double));
+  }
+
+  sections.emplace_back(reinterpret_cast<const char*>(permutationWords.data()),
+                        permutationWords.size() * sizeof(uint64_t));
+
+  DBMatOfflineFileHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, DBMAT_FILE_MAGIC, sizeof(header.magic));
+  header.byteOrderMark = DBMAT_FILE_BYTE_ORDER_MARK;
+  header.version = DBMAT_FILE_VERSION;
+  header.decompositionType = static_cast<int32_t>(decompositionType);
+  header.numberOfMatrices = static_cast<uint32_t>(matrices.size());
+  header.metadataSize = metadata.size();
+  header.permutationSize = permutationWords.size();
+  header.checksum = computeChecksum(sections);
+
+  // write to a temporary file first, existing mappings of fileName stay valid
+  const std::string temporaryFileName = fileName + ".tmp";
+
+  {
+    std::ofstream stream(temporaryFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!stream.is_open()) {
+      throw file_exception("DBMatOfflineFile: cannot open file for writing");
+    }
+
+    size_t offset = 0;
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    offset += sizeof(header);
+
+    for (const auto& section : sections) {
+      if (section.first != metadata.data()) {
+        writePadding(stream, offset);
+      }
+
+      stream.write(section.first, section.second);
+      offset += section.second;
+    }
+
+    if (!stream) {
+      throw file_exception("DBMatOfflineFile: error while writing file");
+    }
+  }
+
+  if (std::rename(temporaryFileName.c_str(), fileName.c_str()) != 0) {
+    std::remove(temporaryFileName.c_str());
+    throw file_exception("DBMatOfflineFile: cannot rename temporary file");
+  }
+}
+
+bool DBMatOfflineFile::isBinaryFile(const std::string& fileName) {
+  std::ifstream stream(fileName, std::ios::in | std::ios::binary);
+  char magic[sizeof(DBMAT_FILE_MAGIC)];
+
+  if (!stream.read(magic, sizeof(magic))) {
+    return false;
+  }
+
+  return std::memcmp(magic, DBMAT_FILE_MAGIC, sizeof(magic)) == 0;
+}
+
+DBMatOfflineFile::DBMatOfflineFile(const std::string& fileName)
+    : data(nullptr),
+      fileSize(0),
+      isMapped(false),
+      buffer(),
+      decompositionType(MatrixDecompositionType::Chol),
+      interactions(),
+      description(),
+      rows(),
+      cols(),
+      matrixOffsets(),
+      permutationSize(0),
+      permutationOffset(0),
+      metadataSize(0),
+      checksum(0),
+      checksumFlag(),
+      isChecksumValid(false) {
+#ifndef _WIN32
+  const int fd = open(fileName.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    throw file_exception("DBMatOfflineFile: cannot open file");
+  }
+
+  struct stat fileStatus;
+
+  if (fstat(fd, &fileStatus) != 0) {
+    close(fd);
+    throw file_exception("DBMatOfflineFile: cannot determine file size");
+  }
+
+  fileSize = static_cast<size_t>(fileStatus.st_size);
+
+  if (fileSize > 0) {
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+
+    if (mapping != MAP_FAILED) {
+      data = static_cast<const char*>(mapping);
+      isMapped = true;
+    }
+  }
+
+  close(fd);
+#endif
+
+  if (!isMapped) {
+    // fallback if memory mapping is not available
+    std::ifstream stream(fileName, std::ios::in | std::ios::binary);
+
+    if (!stream.is_open()) {
+      throw file_exception("DBMatOfflineFile: cannot open file");
+    }
+
+    buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    data = buffer.data();
+    fileSize = buffer.size();
+  }
+
+  try {
+    parseHeader();
+  } catch (...) {
+#ifndef _WIN32
+    if (isMapped) {
+      munmap(const_cast<char*>(data), fileSize);
+    }
+#endif
+    throw;
+  }
+}
+
+DBMatOfflineFile::~DBMatOfflineFile() {
+#ifndef _WIN32
+  if (isMapped) {
+    munmap(const_cast<char*>(data), fileSize);
+  }
+#endif
+}
+
+void DBMatOfflineFile::parseHeader() {
+  if (fileSize < sizeof(DBMatOfflineFileHeader)) {
+    throw data_exception("DBMatOfflineFile: file is too small");
+  }
+
+  DBMatOfflineFileHeader header;
+  std::memcpy(&header, data, sizeof(header));
+
+  if (std::memcmp(header.magic, DBMAT_FILE_MAGIC, sizeof(header.magic)) != 0) {
+    throw data_exception("DBMatOfflineFile: not a binary DBMatOffline file");
+  }
+
+  if (header.byteOrderMark != DBMAT_FILE_BYTE_ORDER_MARK) {
+    throw data_exception("DBMatOfflineFile: file was written with a different byte order");
+  }
+
+  if (header.version != DBMAT_FILE_VERSION) {
+    throw data_exception("DBMatOfflineFile: unsupported version");
+  }
+
+  decompositionType = static_cast<MatrixDecompositionType>(header.decompositionType);
+  metadataSize = header.metadataSize;
+  permutationSize = header.permutationSize;
+  checksum = header.checksum;
+
+  if (metadataSize > fileSize - sizeof(header)) {
+    throw data_exception("DBMatOfflineFile: metadata section is truncated");
+  }
+
+  // metadata
+  const char* position = data + sizeof(header);
+  const char* metadataEnd = position + metadataSize;
+
+  for (uint32_t i = 0; i < header.numberOfMatrices; i++) {
+    rows.push_back(readWord(position, metadataEnd));
+    cols.push_back(readWord(position, metadataEnd));
+  }
+
+  const uint64_t numberOfInteractions = readWord(position, metadataEnd);
+
+  for (uint64_t i = 0; i < numberOfInteractions; i++) {
+    const uint64_t interactionSize = readWord(position, metadataEnd);
+    std::set<size_t> interaction;
+
+    for (uint64_t j = 0; j < interactionSize; j++) {
+      interaction.insert(readWord(position, metadataEnd));
+    }
+
+    interactions.insert(interaction);
+  }
+
+  const uint64_t descriptionLength = readWord(position, metadataEnd);
+
+  if (descriptionLength > static_cast<uint64_t>(metadataEnd - position)) {
+    throw data_exception("DBMatOfflineFile: metadata section is truncated");
+  }
+
+  description.assign(position, descriptionLength);
+
+  // data sections
+  size_t offset = sizeof(header) + metadataSize;
+
+  for (size_t i = 0; i < rows.size(); i++) {
+    offset = alignOffset(offset);
+    matrixOffsets.push_back(offset);
+    offset += rows[i] * cols[i] * sizeof(double);
+  }
+
+  offset = alignOffset(offset);
+  permutationOffset = offset;
+  offset += permutationSize * sizeof(uint64_t);
+
+  if (offset > fileSize) {
+    throw data_exception("DBMatOfflineFile: file is truncated");
+  }
+}
+
+MatrixDecompositionType DBMatOfflineFile::getDecompositionType() const {
+  return decompositionType;
+}
+
+const std::set<std::set<size_t>>& DBMatOfflineFile::getInteractions() const {
+  return interactions;
+}
+
+const std::string& DBMatOfflineFile::getDescription() const { return description; }
+
+size_t DBMatOfflineFile::getNumberOfMatrices() const { return rows.size(); }
+
+size_t DBMatOfflineFile::getNrows(size_t i) const { return rows.at(i); }
+
+size_t DBMatOfflineFile::getNcols(size_t i) const { return cols.at(i); }
+
+const double* DBMatOfflineFile::getMatrixData(size_t i) const {
+  return reinterpret_cast<const double*>(data + matrixOffsets.at(i));
+}
+
+DBMatOfflineFile::MatrixView DBMatOfflineFile::getMatrixView(size_t i) const {
+  return MatrixView{getMatrixData(i), getNrows(i), getNcols(i)};
+}
+
+void DBMatOfflineFile::getMatrix(size_t i, DataMatrix& matrix) const {
+  matrix = DataMatrix(getMatrixData(i), getNrows(i), getNcols(i));
+}
+
+void DBMatOfflineFile::getPermutation(std::vector<size_t>& permutation) const {
+  const uint64_t* words = reinterpret_cast<const uint64_t*>(data + permutationOffset);
+  permutation.assign(words, words + permutationSize);
+}
+
+bool DBMatOfflineFile::verifyChecksum() const {
+  std::call_once(checksumFlag, [this]() {
+    std::vector<std::pair<const char*, size_t>> sections;
+    sections.emplace_back(data + sizeof(DBMatOfflineFileHeader), metadataSize);
+
+    for (size_t i = 0; i < rows.size(); i++) {
+      sections.emplace_back(data + matrixOffsets[i], rows[i] * cols[i] * sizeof(double));
+    }
+
+    sections.emplace_back(data + permutationOffset, permutationSize * sizeof(uint64_t));
+    isChecksumValid = (computeChecksum(sections) == checksum);
+  });
+
+  return isChecksumValid;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,214 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::DataMatrix;
+
+/**
+ * Binary file format for the decompositions of DBMatOffline objects, independent of GSL.
+ *
+ * A file consists of a fixed-size header (decomposition type, number and sizes of the
+ * sections, checksum), the interactions, an optional text description (e.g., the configuration
+ * the decomposition was computed for, see DBMatDatabase), the matrices (row-major) and an
+ * optional permutation. The matrices and the permutation are aligned to 64 bytes. The file is
+ * written in the native byte order, reading a file with a different byte order fails.
+ *
+ * Opening a file maps it read-only into memory (on POSIX systems, otherwise it is read into a
+ * buffer), so the matrices can be accessed without copying (getMatrixView) and processes that
+ * open the same file share the pages. The checksum covers all sections and is verified in
+ * parallel by verifyChecksum.
+ */
+class DBMatOfflineFile {
+ public:
+  /**
+   * Read-only view of a matrix (row-major), e.g., of a matrix in a mapped file.
+   */
+  struct MatrixView {
+    /// entries of the matrix (row-major)
+    const double* data;
+    /// number of rows
+    size_t nrows;
+    /// number of columns
+    size_t ncols;
+  };
+
+  /**
+   * Writes a binary file. The file is written under a temporary name and renamed afterwards,
+   * so processes that have mapped an older version of the file are not affected.
+   *
+   * @param fileName name of the file
+   * @param decompositionType type of the decomposition
+   * @param interactions interactions of the grid (empty for a regular grid)
+   * @param matrices matrices to store
+   * @param permutation permutation to store (may be empty)
+   * @param description text description to store (may be empty)
+   */
+  static void write(const std::string& fileName, MatrixDecompositionType decompositionType,
+                    const std::set<std::set<size_t>>& interactions,
+                    const std::vector<const DataMatrix*>& matrices,
+                    const std::vector<size_t>& permutation = std::vector<size_t>(),
+                    const std::string& description = "");
+
+  /**
+   * Writes a binary file, like the other overload, but with matrices given as views (e.g., of
+   * the matrices of another mapped file).
+   *
+   * @param fileName name of the file
+   * @param decompositionType type of the decomposition
+   * @param interactions interactions of the grid (empty for a regular grid)
+   * @param matrices matrices to store
+   * @param permutation permutation to store (may be empty)
+   * @param description text description to store (may be empty)
+   */
+  static void write(const std::string& fileName, MatrixDecompositionType decompositionType,
+                    const std::set<std::set<size_t>>& interactions,
+                    const std::vector<MatrixView>& matrices,
+                    const std::vector<size_t>& permutation = std::vector<size_t>(),
+                    const std::string& description = "");
+
+  /**
+   * Checks whether a file is in the binary format (and not in the old text/GSL format).
+   *
+   * @param fileName name of the file
+   * @return whether the file starts with the magic bytes of the binary format
+   */
+  static bool isBinaryFile(const std::string& fileName);
+
+  /**
+   * Opens a binary file and maps it read-only into memory.
+   *
+   * @param fileName name of the file
+   */
+  explicit DBMatOfflineFile(const std::string& fileName);
+
+  /**
+   * Destructor, unmaps the file.
+   */
+  ~DBMatOfflineFile();
+
+  DBMatOfflineFile(const DBMatOfflineFile&) = delete;
+  DBMatOfflineFile& operator=(const DBMatOfflineFile&) = delete;
+
+  /**
+   * @return type of the stored decomposition
+   */
+  MatrixDecompositionType getDecompositionType() const;
+
+  /**
+   * @return interactions of the grid
+   */
+  const std::set<std::set<size_t>>& getInteractions() const;
+
+  /**
+   * @return text description stored with the decomposition
+   */
+  const std::string& getDescription() const;
+
+  /**
+   * @return number of stored matrices
+   */
+  size_t getNumberOfMatrices() const;
+
+  /**
+   * @param i number of the matrix
+   * @return number of rows of the matrix
+   */
+  size_t getNrows(size_t i) const;
+
+  /**
+   * @param i number of the matrix
+   * @return number of columns of the matrix
+   */
+  size_t getNcols(size_t i) const;
+
+  /**
+   * @param i number of the matrix
+   * @return read-only pointer to the entries of the matrix (row-major)
+   */
+  const double* getMatrixData(size_t i) const;
+
+  /**
+   * @param i number of the matrix
+   * @return read-only view of the matrix in the file
+   */
+  MatrixView getMatrixView(size_t i) const;
+
+  /**
+   * Copies a matrix.
+   *
+   * @param i number of the matrix
+   * @param[out] matrix copy of the matrix
+   */
+  void getMatrix(size_t i, DataMatrix& matrix) const;
+
+  /**
+   * Copies the permutation.
+   *
+   * @param[out] permutation copy of the permutation (empty if none was stored)
+   */
+  void getPermutation(std::vector<size_t>& permutation) const;
+
+  /**
+   * Recomputes the checksum of the file contents and compares it to the stored one. As this reads
+   * the whole file, the checksum is only computed on the first call (which may happen in
+   * parallel), later calls return the same result.
+   *
+   * @return whether the checksums match
+   */
+  bool verifyChecksum() const;
+
+ private:
+  /// pointer to the beginning of the file contents
+  const char* data;
+  /// size of the file in bytes
+  size_t fileSize;
+  /// whether data points to a memory mapping (otherwise to buffer)
+  bool isMapped;
+  /// file contents if the file could not be mapped
+  std::vector<char> buffer;
+  /// type of the stored decomposition
+  MatrixDecompositionType decompositionType;
+  /// interactions of the grid
+  std::set<std::set<size_t>> interactions;
+  /// text description
+  std::string description;
+  /// number of rows of the matrices
+  std::vector<size_t> rows;
+  /// number of columns of the matrices
+  std::vector<size_t> cols;
+  /// offsets of the matrices in the file
+  std::vector<size_t> matrixOffsets;
+  /// number of entries of the permutation
+  size_t permutationSize;
+  /// offset of the permutation in the file
+  size_t permutationOffset;
+  /// size of the section with the matrix sizes, the interactions and the description
+  size_t metadataSize;
+  /// stored checksum
+  uint64_t checksum;
+  /// ensures that the checksum is verified once
+  mutable std::once_flag checksumFlag;
+  /// result of the verification of the checksum
+  mutable bool isChecksumValid;
+
+  void parseHeader();
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -9,6 +9,7 @@
 #include <sgpp/base/exception/not_implemented_exception.hpp>
 #include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
 #ifdef USE_GSL
@@ -32,6 +33,11 @@ DBMatOfflineGE::DBMatOfflineGE() : DBMatOffline() {}
 
 sgpp::datadriven::DBMatOfflineGE::DBMatOfflineGE(const std::string& fileName)
     : DBMatOffline{fileName} {
+  if (DBMatOfflineFile::isBinaryFile(fileName)) {
+    // the file was mapped by the super constructor, lhsMatrix is copied on first access
+    return;
+  }
+
   // Read grid size from header (number of rows in lhsMatrix)
   std::ifstream filestream(fileName, std::istream::in);
   // Read configuration
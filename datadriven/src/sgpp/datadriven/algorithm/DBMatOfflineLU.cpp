@@ -6,6 +6,8 @@
 #ifdef USE_GSL
 
 #include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineLU.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
@@ -15,6 +17,7 @@
 #include <gsl/gsl_permutation.h>
 #include <gsl/gsl_permute.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -22,6 +25,7 @@ namespace sgpp {
 namespace datadriven {
 
 using sgpp::base::algorithm_exception;
+using sgpp::base::data_exception;
 using sgpp::base::DataVector;
 using sgpp::base::DataMatrix;
 
@@ -29,14 +33,15 @@ DBMatOfflineLU::DBMatOfflineLU() : DBMatOfflineGE{}, permutation{nullptr} {}
 
 DBMatOfflineLU::DBMatOfflineLU(const DBMatOfflineLU& rhs)
     : DBMatOfflineGE(rhs), permutation(nullptr) {
-  size_t gridSize = rhs.lhsMatrix.getNrows();
+  // the matrix of rhs might still be mapped, so use the size of the permutation
+  size_t gridSize = rhs.permutation->size;
   permutation =
       std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(gridSize)};
   gsl_permutation_memcpy(permutation.get(), rhs.permutation.get());
 }
 
 DBMatOfflineLU& DBMatOfflineLU::operator=(const DBMatOfflineLU& rhs) {
-  size_t gridSize = rhs.lhsMatrix.getNrows();
+  size_t gridSize = rhs.permutation->size;
   DBMatOffline::operator=(rhs);
   permutation =
       std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(gridSize)};
@@ -77,6 +82,23 @@ DBMatOfflineLU::DBMatOfflineLU(const std::string& fileName)
   isConstructed = true;
   isDecomposed = true;
 
+  if (DBMatOfflineFile::isBinaryFile(fileName)) {
+    // the LU factors stay in the mapping of the file until they are accessed
+    mapFile(fileName);
+
+    std::vector<size_t> storedPermutation;
+    mappedFile->getPermutation(storedPermutation);
+
+    if (storedPermutation.size() != mappedFile->getNrows(0)) {
+      throw data_exception("DBMatOfflineLU: serialized object does not contain the permutation");
+    }
+
+    permutation =
+        std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(storedPermutation.size())};
+    std::copy(storedPermutation.begin(), storedPermutation.end(), permutation->data);
+    return;
+  }
+
   // Read grid size from header (number of rows in lhsMatrix)
   std::ifstream filestream(fileName, std::istream::in);
   // Read configuration
@@ -128,17 +150,10 @@ void DBMatOfflineLU::permuteVector(DataVector& b) {
   }
 }
 
-void DBMatOfflineLU::store(const std::string& fileName) {
-  // first store header and matrix
-  DBMatOffline::store(fileName);
-  // then store permutation.
-  // c file API needed for GSL
-  FILE* outputCFile = fopen(fileName.c_str(), "ab");
-  if (!outputCFile) {
-    throw algorithm_exception{"cannot open file for writing"};
-  }
-  gsl_permutation_fwrite(outputCFile, permutation.get());
-  fclose(outputCFile);
+void DBMatOfflineLU::getStoredData(std::vector<const DataMatrix*>& matrices,
+                                   std::vector<size_t>& permutation) {
+  matrices.push_back(&lhsMatrix);
+  permutation.assign(this->permutation->data, this->permutation->data + this->permutation->size);
 }
 
 sgpp::datadriven::MatrixDecompositionType DBMatOfflineLU::getDecompositionType() {
@@ -11,6 +11,7 @@
 #include <gsl/gsl_permutation.h>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -65,7 +66,12 @@ class DBMatOfflineLU : public DBMatOfflineGE {
    */
   void permuteVector(DataVector& b);
 
-  void store(const std::string& fname) override;
+ protected:
+  /**
+   * Stores the LU factors and the permutation
+   */
+  void getStoredData(std::vector<const DataMatrix*>& matrices,
+                     std::vector<size_t>& permutation) override;
 
  private:
   /**
@@ -3,7 +3,9 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 #include <sgpp/datadriven/scalapack/DataMatrixDistributed.hpp>
@@ -24,6 +26,16 @@ DBMatOfflineOrthoAdapt::DBMatOfflineOrthoAdapt() : DBMatOffline() {
 
 DBMatOfflineOrthoAdapt::DBMatOfflineOrthoAdapt(const std::string& fileName)
     : DBMatOffline(fileName) {
+  if (DBMatOfflineFile::isBinaryFile(fileName)) {
+    // the file was mapped by the super constructor (its checksum is verified on first access)
+    if (mappedFile->getNumberOfMatrices() != 3) {
+      throw sgpp::base::data_exception(
+          "DBMatOfflineOrthoAdapt: serialized object does not contain Q and T^-1");
+    }
+
+    return;
+  }
+
   // Read grid size from header (number of rows in lhsMatrix)
   std::ifstream filestream(fileName, std::istream::in);
   // Read configuration
@@ -279,27 +291,17 @@ void DBMatOfflineOrthoAdapt::invert_symmetric_tridiag(sgpp::base::DataVector& di
 #endif /* USE_GSL */
 }
 
-void DBMatOfflineOrthoAdapt::store(const std::string& fileName) {
-#ifdef USE_GSL
-  DBMatOffline::store(fileName);
-
-  FILE* outCFile = fopen(fileName.c_str(), "ab");
-  if (!outCFile) {
-    throw sgpp::base::algorithm_exception{"cannot open file for writing"};
-  }
-
-  auto dim_a = getGridSize();
-  // store q_ortho_matrix_
-  gsl_matrix_view q_view = gsl_matrix_view_array(this->q_ortho_matrix_.getPointer(), dim_a, dim_a);
-  gsl_matrix_fwrite(outCFile, &q_view.matrix);
-
-  // store t_inv_tridiag_
-  gsl_matrix_view t_inv_view =
-      gsl_matrix_view_array(this->t_tridiag_inv_matrix_.getPointer(), dim_a, dim_a);
-  gsl_matrix_fwrite(outCFile, &t_inv_view.matrix);
+void DBMatOfflineOrthoAdapt::getStoredData(std::vector<const sgpp::base::DataMatrix*>& matrices,
+                                           std::vector<size_t>& permutation) {
+  matrices.push_back(&this->lhsMatrix);
+  matrices.push_back(&this->q_ortho_matrix_);
+  matrices.push_back(&this->t_tridiag_inv_matrix_);
+}
 
-  fclose(outCFile);
-#endif /* USE_GSL */
+void DBMatOfflineOrthoAdapt::getMappedMatrices(const DBMatOfflineFile& file) {
+  DBMatOffline::getMappedMatrices(file);
+  file.getMatrix(1, this->q_ortho_matrix_);
+  file.getMatrix(2, this->t_tridiag_inv_matrix_);
 }
 
 void DBMatOfflineOrthoAdapt::syncDistributedDecomposition(
@@ -310,13 +312,14 @@ void DBMatOfflineOrthoAdapt::syncDistributedDecomposition(
         "In DBMatOfflineOrthoAdapt::syncDistributedDecomposition\nCan't sync, because lhsMatrix "
         "was not decomposed yet");
   }
+  const DBMatOfflineFile::MatrixView qView = getQView();
   q_ortho_matrix_distributed_ = DataMatrixDistributed::fromSharedData(
-      q_ortho_matrix_.data(), processGrid, q_ortho_matrix_.getNrows(), q_ortho_matrix_.getNcols(),
-      parallelConfig.rowBlockSize_, parallelConfig.columnBlockSize_);
+      qView.data, processGrid, qView.nrows, qView.ncols, parallelConfig.rowBlockSize_,
+      parallelConfig.columnBlockSize_);
 
+  const DBMatOfflineFile::MatrixView tInvView = getTinvView();
   t_tridiag_inv_matrix_distributed_ = DataMatrixDistributed::fromSharedData(
-      t_tridiag_inv_matrix_.data(), processGrid, t_tridiag_inv_matrix_.getNrows(),
-      t_tridiag_inv_matrix_.getNcols(), parallelConfig.rowBlockSize_,
+      tInvView.data, processGrid, tInvView.nrows, tInvView.ncols, parallelConfig.rowBlockSize_,
       parallelConfig.columnBlockSize_);
 #endif
   // no action needed without scalapack
@@ -328,18 +331,19 @@ void DBMatOfflineOrthoAdapt::compute_inverse() {
     throw sgpp::base::algorithm_exception(
         "in DBMatOfflineOrthoAdapt::compute_inverse:\noffline matrix not decomposed yet.\n");
   }
+  // Q and T^-1 are only read, so they may stay in the mapping of a file
+  const DBMatOfflineFile::MatrixView tInv = getTinvView();
+  const DBMatOfflineFile::MatrixView q = getQView();
 
   // initialize lhsInverse
-  this->lhsInverse = DataMatrix(this->lhsMatrix.getNrows(), this->lhsMatrix.getNcols());
+  this->lhsInverse = DataMatrix(q.nrows, q.ncols);
 
   gsl_matrix_view inv_view = gsl_matrix_view_array(this->lhsInverse.getPointer(),
                                                    lhsInverse.getNrows(), lhsInverse.getNcols());
 
-  gsl_matrix_view t_inv_view = gsl_matrix_view_array(
-      this->getTinv().getPointer(), this->getTinv().getNrows(), this->getTinv().getNcols());
+  gsl_matrix_const_view t_inv_view = gsl_matrix_const_view_array(tInv.data, tInv.nrows, tInv.ncols);
 
-  gsl_matrix_view q_view = gsl_matrix_view_array(this->getQ().getPointer(), this->getQ().getNrows(),
-                                                 this->getQ().getNcols());
+  gsl_matrix_const_view q_view = gsl_matrix_const_view_array(q.data, q.nrows, q.ncols);
 
   gsl_matrix* QT = gsl_matrix_alloc(lhsInverse.getNrows(), lhsInverse.getNcols());
 
@@ -380,15 +384,16 @@ void DBMatOfflineOrthoAdapt::compute_inverse_parallel(std::shared_ptr<BlacsProce
   DataMatrixDistributed::mult(*QT, this->q_ortho_matrix_distributed_, *INV, false, true);
 
   // writing computed inverse into member and syncing both distri and non-distri matrices
-  this->lhsInverse = DataMatrix(this->lhsMatrix.getNrows(), this->lhsMatrix.getNcols());
+  const DBMatOfflineFile::MatrixView lhsView = getMatrixView(0, this->lhsMatrix);
+  this->lhsInverse = DataMatrix(lhsView.nrows, lhsView.ncols);
   INV->toLocalDataMatrix(this->lhsInverse);
   this->lhsDistributedInverse = DataMatrixDistributed::fromSharedData(
       this->lhsInverse.getPointer(), processGrid, dim_a, dim_a, parallelConfig.rowBlockSize_,
       parallelConfig.columnBlockSize_);
   this->lhsDistributedInverse.toLocalDataMatrix(this->lhsInverse);
   this->lhsDistributed = DataMatrixDistributed::fromSharedData(
-      this->lhsMatrix.data(), processGrid, lhsMatrix.getNrows(), lhsMatrix.getNcols(),
-      parallelConfig.rowBlockSize_, parallelConfig.columnBlockSize_);
+      lhsView.data, processGrid, lhsView.nrows, lhsView.ncols, parallelConfig.rowBlockSize_,
+      parallelConfig.columnBlockSize_);
 
   free(QT);
   free(INV);
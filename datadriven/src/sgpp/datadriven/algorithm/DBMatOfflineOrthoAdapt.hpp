@@ -17,6 +17,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -97,17 +98,6 @@ class DBMatOfflineOrthoAdapt : public DBMatOffline {
    */
   void invert_symmetric_tridiag(sgpp::base::DataVector& diag, sgpp::base::DataVector& subdiag);
 
-  /**
-   * Serializes the DBMatOfflineOrthoAdapt object
-   *
-   * q_ortho_matrix_ and t_inv_tridiag_ are stored into the specified file,
-   * which is the explicit representation of the decomposition needed for the
-   * online phase
-   *
-   * @param fileName path where to store the file
-   */
-  void store(const std::string& fileName) override;
-
   /**
    * Override to sync Q and Tinv
    */
@@ -130,9 +120,31 @@ class DBMatOfflineOrthoAdapt : public DBMatOffline {
   void compute_inverse_parallel(std::shared_ptr<BlacsProcessGrid> processGrid,
                                 const ParallelConfiguration& parallelConfig) override;
 
-  sgpp::base::DataMatrix& getQ() { return this->q_ortho_matrix_; }
+  sgpp::base::DataMatrix& getQ() {
+    loadMappedMatrices();
+    return this->q_ortho_matrix_;
+  }
 
-  sgpp::base::DataMatrix& getTinv() { return this->t_tridiag_inv_matrix_; }
+  sgpp::base::DataMatrix& getTinv() {
+    loadMappedMatrices();
+    return this->t_tridiag_inv_matrix_;
+  }
+
+  /**
+   * Read-only access to Q, which is not copied out of the file the object was deserialized from
+   * (unlike getQ)
+   * @return view of Q, valid until Q is modified
+   */
+  DBMatOfflineFile::MatrixView getQView() const { return getMatrixView(1, q_ortho_matrix_); }
+
+  /**
+   * Read-only access to T^-1, which is not copied out of the file the object was deserialized
+   * from (unlike getTinv)
+   * @return view of T^-1, valid until T^-1 is modified
+   */
+  DBMatOfflineFile::MatrixView getTinvView() const {
+    return getMatrixView(2, t_tridiag_inv_matrix_);
+  }
 
   DataMatrixDistributed& getQDistributed() { return this->q_ortho_matrix_distributed_; }
 
@@ -145,6 +157,18 @@ class DBMatOfflineOrthoAdapt : public DBMatOffline {
   // distributed matrices, only initialized if scalapack is used
   DataMatrixDistributed q_ortho_matrix_distributed_;
   DataMatrixDistributed t_tridiag_inv_matrix_distributed_;
+
+  /**
+   * Stores lhsMatrix, q_ortho_matrix_ and t_tridiag_inv_matrix_, which is the explicit
+   * representation of the decomposition needed for the online phase
+   */
+  void getStoredData(std::vector<const sgpp::base::DataMatrix*>& matrices,
+                     std::vector<size_t>& permutation) override;
+
+  /**
+   * Copies lhsMatrix, q_ortho_matrix_ and t_tridiag_inv_matrix_ out of the file
+   */
+  void getMappedMatrices(const DBMatOfflineFile& file) override;
 };
 }  // namespace datadriven
 }  // namespace sgpp
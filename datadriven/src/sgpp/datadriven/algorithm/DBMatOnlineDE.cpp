@@ -113,14 +113,15 @@ void DBMatOnlineDE::computeDensityFunction(DataVector& alpha, DataMatrix& m, Gri
                                            std::list<size_t>* deletedPoints, size_t newPoints) {
   if (!localVectorsInitialized) {
     // init bsave and bTotalPoints only here, as they are not needed in the parallel version
-    bSave = DataVector(offlineObject.getDecomposedMatrix().getNcols(), 0.0);
-    bTotalPoints = DataVector(offlineObject.getDecomposedMatrix().getNcols(), 0.0);
+    bSave = DataVector(offlineObject.getDecomposedMatrixView().ncols, 0.0);
+    bTotalPoints = DataVector(offlineObject.getDecomposedMatrixView().ncols, 0.0);
 
     localVectorsInitialized = true;
   }
 
   if (m.getNrows() > 0) {
-    DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+    // only the size is needed, the matrix may stay in the mapping of a file
+    const size_t lhsSize = offlineObject.getDecomposedMatrixView().ncols;
 
     // in case OrthoAdapt or both SMW_, the current size is not lhs size, but B size
     bool use_B_size = false;
@@ -150,7 +151,7 @@ void DBMatOnlineDE::computeDensityFunction(DataVector& alpha, DataMatrix& m, Gri
     // Compute right hand side of the equation:
     size_t numberOfPoints = m.getNrows();
     totalPoints++;
-    DataVector b(use_B_size ? B_size : lhsMatrix.getNcols());
+    DataVector b(use_B_size ? B_size : lhsSize);
     b.setAll(0);
     if (b.getSize() != grid.getSize()) {
       throw sgpp::base::algorithm_exception(
@@ -235,15 +236,16 @@ void DBMatOnlineDE::computeDensityFunctionParallel(
     // init bSaveDistributed and bTotalPointsDistributed only here, as they are not needed in the
     // local version
     bSaveDistributed = std::make_unique<DataVectorDistributed>(
-        processGrid, offlineObject.getDecomposedMatrix().getNcols(), parallelConfig.rowBlockSize_);
+        processGrid, offlineObject.getDecomposedMatrixView().ncols, parallelConfig.rowBlockSize_);
     bTotalPointsDistributed = std::make_unique<DataVectorDistributed>(
-        processGrid, offlineObject.getDecomposedMatrix().getNcols(), parallelConfig.rowBlockSize_);
+        processGrid, offlineObject.getDecomposedMatrixView().ncols, parallelConfig.rowBlockSize_);
 
     distributedVectorsInitialized = true;
   }
 
   if (m.getNrows() > 0) {
-    DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+    // only the size is needed, the matrix may stay in the mapping of a file
+    const size_t lhsSize = offlineObject.getDecomposedMatrixView().ncols;
 
     // in case OrthoAdapt, the current size is not lhs size, but B size
     bool use_B_size = false;
@@ -276,7 +278,7 @@ void DBMatOnlineDE::computeDensityFunctionParallel(
     size_t numberOfPoints = m.getNrows();
     totalPoints++;
 
-    size_t bSize = use_B_size ? B_size : lhsMatrix.getNcols();
+    size_t bSize = use_B_size ? B_size : lhsSize;
 
     DataVectorDistributed b(processGrid, bSize, parallelConfig.rowBlockSize_);
 
@@ -407,6 +409,8 @@ void DBMatOnlineDE::setBeta(double newBeta) { beta = newBeta; }
 
 double DBMatOnlineDE::getBeta() { return beta; }
 
+double DBMatOnlineDE::getNormFactor() { return normFactor; }
+
 double DBMatOnlineDE::normalize(DataVector& alpha, Grid& grid, size_t samples) {
   this->normFactor = 1.;
   double sum = 0.;
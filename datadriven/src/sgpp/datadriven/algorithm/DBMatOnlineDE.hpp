@@ -176,6 +176,11 @@ class DBMatOnlineDE : public DBMatOnline {
    */
   double getBeta();
 
+  /**
+   * Returns the factor the evaluations of the density function are scaled with
+   */
+  double getNormFactor();
+
   /**
    * Normalize the Density
    *
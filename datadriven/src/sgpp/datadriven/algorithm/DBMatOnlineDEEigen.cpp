@@ -9,6 +9,8 @@
 
 #include <sgpp/datadriven/algorithm/DBMatDMSEigen.hpp>
 
+#include <algorithm>
+
 namespace sgpp {
 namespace datadriven {
 DBMatOnlineDEEigen::DBMatOnlineDEEigen(DBMatOffline& offline, Grid& grid, double lambda,
@@ -17,14 +19,16 @@ DBMatOnlineDEEigen::DBMatOnlineDEEigen(DBMatOffline& offline, Grid& grid, double
 
 void DBMatOnlineDEEigen::solveSLE(DataVector& alpha, DataVector& b, Grid& grid,
     DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
-  DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+  // the decomposition is only read, so it may stay in the mapping of a file
+  const DBMatOfflineFile::MatrixView lhsMatrix = offlineObject.getDecomposedMatrixView();
 
   // Solve the system:
-  alpha.resizeZero(lhsMatrix.getNcols());
+  alpha.resizeZero(lhsMatrix.ncols);
 
-  size_t n = lhsMatrix.getNcols();
+  // the eigenvalues are stored in the last row
+  size_t n = lhsMatrix.ncols;
   DataVector e(n);
-  lhsMatrix.getRow(n, e);
+  std::copy(lhsMatrix.data + n * n, lhsMatrix.data + (n + 1) * n, e.begin());
   DBMatDMSEigen esolver;
 
   esolver.solve(lhsMatrix, e, alpha, b, lambda);
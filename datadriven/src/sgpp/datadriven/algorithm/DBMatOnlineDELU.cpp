@@ -20,10 +20,11 @@ sgpp::datadriven::DBMatOnlineDELU::DBMatOnlineDELU(DBMatOffline& offline, Grid&
 
 void sgpp::datadriven::DBMatOnlineDELU::solveSLE(DataVector& alpha, DataVector& b, Grid& grid,
     DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
-  DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+  // the decomposition is only read, so it may stay in the mapping of a file
+  const DBMatOfflineFile::MatrixView lhsMatrix = offlineObject.getDecomposedMatrixView();
 
   // Solve the system:
-  alpha = DataVector(lhsMatrix.getNcols());
+  alpha = DataVector(lhsMatrix.ncols);
   DBMatDMSBackSub lusolver;
   lusolver.solve(lhsMatrix, alpha, b);
 }
@@ -90,7 +90,8 @@ void DBMatOnlineDEOrthoAdapt::solveSLE(DataVector& alpha, DataVector& b, Grid& g
   sgpp::datadriven::DBMatDMSOrthoAdapt* solver = new sgpp::datadriven::DBMatDMSOrthoAdapt();
   // solve the created system
   alpha.resizeZero(b.getSize());
-  solver->solve(offline->getTinv(), offline->getQ(), this->getB(), b, alpha);
+  // Q and T^-1 are only read, so they may stay in the mapping of a file
+  solver->solve(offline->getTinvView(), offline->getQView(), this->getB(), b, alpha);
 
   free(solver);
 }
@@ -180,12 +181,13 @@ void DBMatOnlineDEOrthoAdapt::sherman_morrison_adapt(size_t newPoints, bool refi
     // e[unit_index] = 1 when refining, -1 when coarsening
     size_t unit_index = refine ? current_size - 1 : coarsenIndices[k];
 
-    // view of T^{-1} of the offline object
-    gsl_matrix_view t_inv_view =
-        gsl_matrix_view_array(offlinePtr->getTinv().getPointer(), dima, dima);
+    // view of T^{-1} of the offline object, only read, so it may be in the mapping of a file
+    gsl_matrix_const_view t_inv_view =
+        gsl_matrix_const_view_array(offlinePtr->getTinvView().data, dima, dima);
 
     // view of Q of the offline object
-    gsl_matrix_view q_view = gsl_matrix_view_array(offlinePtr->getQ().getPointer(), dima, dima);
+    gsl_matrix_const_view q_view =
+        gsl_matrix_const_view_array(offlinePtr->getQView().data, dima, dima);
 
     // view of B of the online object, which holds all information of refinement/coarsening
     gsl_matrix_view b_adapt_view =
@@ -4,18 +4,104 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/datadriven/algorithm/DMSystemMatrix.hpp>
+#include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
 #include <sgpp/base/exception/operation_exception.hpp>
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBoundaryBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyBoundaryBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyModifiedBasis.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+
+/// number of data points per block when building the cached data matrix
+const size_t basisMatrixBlockSize = 256;
+/// maximum number of data points used to estimate the size of the cached data matrix
+const size_t basisMatrixSampleSize = 64;
+
+/// grid point indices and values of the basis functions that are nonzero at a data point
+typedef std::vector<std::pair<size_t, double>> BasisMatrixRow;
+/// computes the nonzero entries of a row (data point) of the data matrix
+typedef std::function<void(size_t, BasisMatrixRow&)> BasisMatrixRowFunction;
+
+/**
+ * Computes the rows of the data matrix by traversing the grid like the operations based on
+ * base::AlgorithmDGEMV and base::AlgorithmMultipleEvaluation do.
+ */
+template <class BASIS>
+BasisMatrixRowFunction getAffectedBasisFunctions(base::Grid& grid, base::DataMatrix& dataset) {
+  BASIS& basis = dynamic_cast<BASIS&>(grid.getBasis());
+  base::GridStorage& storage = grid.getStorage();
+
+  return [&basis, &storage, &dataset](size_t j, BasisMatrixRow& row) {
+    base::DataVector point(dataset.getNcols());
+    dataset.getRow(j, point);
+    base::GetAffectedBasisFunctions<BASIS> ga(storage);
+    ga(basis, point, row);
+  };
+}
+
+/**
+ * Computes the rows of the data matrix by evaluating all basis functions like the naive
+ * operations do (the points have to be transformed to the unit cube).
+ */
+BasisMatrixRowFunction getAllBasisFunctions(base::Grid& grid,
+                                            const base::DataMatrix& pointsInUnitCube) {
+  base::SBasis& basis = grid.getBasis();
+  base::GridStorage& storage = grid.getStorage();
+
+  return [&basis, &storage, &pointsInUnitCube](size_t j, BasisMatrixRow& row) {
+    const size_t d = storage.getDimension();
+    row.clear();
+
+    for (size_t i = 0; i < storage.getSize(); i++) {
+      const base::GridPoint& gp = storage[i];
+      double value = 1.0;
+
+      for (size_t t = 0; t < d; t++) {
+        value *= basis.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube.get(j, t));
+
+        if (value == 0.0) {
+          break;
+        }
+      }
+
+      if (value != 0.0) {
+        row.emplace_back(i, value);
+      }
+    }
+  };
+}
+
+}  // namespace
+
 DMSystemMatrix::DMSystemMatrix(sgpp::base::Grid& grid, sgpp::base::DataMatrix& trainData,
                                std::shared_ptr<base::OperationMatrix> C, double lambdaRegression)
-    : DMSystemMatrixBase(trainData, lambdaRegression), grid(grid), C(std::move(C)) {
+    : DMSystemMatrixBase(trainData, lambdaRegression),
+      grid(grid),
+      C(std::move(C)),
+      basisMatrixBudget(0),
+      basisMatrixUpToDate(false),
+      basisMatrixCached(false),
+      basisMatrixGridSize(0),
+      basisMatrixGridHash(0) {
   // this->B = sgpp::op_factory::createOperationMultiEval(grid);
   this->B.reset(sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
 }
@@ -28,59 +114,305 @@ void DMSystemMatrix::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector&
   size_t M = this->dataset_.getNrows();
 
   // Operation B
-  //      this->B->mult((*this->dataset_), alpha, temp);
-  //      this->B->multTranspose((*this->dataset_), temp, result);
-
-  // this->B->mult(alpha, temp);
-
-  std::unique_ptr<base::OperationMultipleEval> op(
-      sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
-  sgpp::base::DataVector temp2(this->dataset_.getNrows());
-  // op->mult(*(this->dataset_), alpha, temp2);
-  op->mult(alpha, temp);
-
-  /*if (temp.getSize() != temp2.getSize()) {
-   std::cout << "error: sizes don't match" << std::endl;
-   std::cout << "ref: " << temp.getSize() << " mine: " << temp2.getSize() << std::endl;
-   }*/
-
-  /*for (size_t i = 0; i < temp.getSize(); i++) {
-   if (temp[i] != temp2[i]) {
-   if (fabs(temp[i] - temp2[i]) > 0.0000001) {
-   std::cout << "ref: " << temp[i] << " mine: " << temp2[i] << " i: " << i << std::endl;
-   }
-   }
-   }*/
-
-  //      this->B->multTranspose(temp, result);
-  //      sgpp::base::DataVector result2(result);
-  //      op->multTranspose(*(this->dataset_), temp, result2);
-  //      if (result.getSize() != result2.getSize()) {
-  //        std::cout << "ref: " << result.getSize() << " mine: " << result2.getSize() << std::endl;
-  //      }
-  //      for (size_t i = 0; i < result.getSize(); i++) {
-  //        if (result[i] != result2[i]) {
-  //          if (fabs(result[i] - result2[i]) > 0.0000001) {
-  //            std::cout << "ref: " << result[i] << " mine: "  << result2[i] << " i: " << i <<
-  //              std::endl;
-  //          }
-  //        }
-  //      }
-  op->multTranspose(temp, result);
+  if (updateBasisMatrix()) {
+    multBasisMatrix(alpha, temp);
+    multTransposeBasisMatrix(temp, result);
+  } else {
+    std::unique_ptr<base::OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+    op->mult(alpha, temp);
+    op->multTranspose(temp, result);
+  }
 
   sgpp::base::DataVector temptwo(alpha.getSize());
   this->C->mult(alpha, temptwo);
   result.axpy(static_cast<double>(M) * this->lambda_, temptwo);
 }
 
+void DMSystemMatrix::multBatch(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) {
+  size_t M = this->dataset_.getNrows();
+  size_t numVectors = alpha.getNcols();
+  result.resizeZero(alpha.getNrows(), numVectors);
+
+  const bool cached = updateBasisMatrix();
+  std::unique_ptr<base::OperationMultipleEval> op;
+
+  if (!cached) {
+    op.reset(sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+  }
+
+  // B^T * B * alpha_j for every column j
+  sgpp::base::DataVector resultColumn(alpha.getNrows());
+  sgpp::base::DataVector temp(M);
+
+  if (cached) {
+    sgpp::base::DataVector alphaColumn(alpha.getNrows());
+
+    for (size_t j = 0; j < numVectors; j++) {
+      alpha.getColumn(j, alphaColumn);
+      multBasisMatrix(alphaColumn, temp);
+      multTransposeBasisMatrix(temp, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  } else {
+    // all columns are evaluated at once, which shares the basis evaluations
+    sgpp::base::DataMatrix tempBatch;
+    op->mult(alpha, tempBatch);
+
+    for (size_t j = 0; j < numVectors; j++) {
+      tempBatch.getColumn(j, temp);
+      op->multTranspose(temp, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
+
+  // + M * lambda * C * alpha
+  sgpp::base::DataMatrix temptwo(alpha.getNrows(), numVectors);
+  this->C->multBatch(alpha, temptwo);
+  temptwo.mult(static_cast<double>(M) * this->lambda_);
+  result.add(temptwo);
+}
+
 void DMSystemMatrix::generateb(sgpp::base::DataVector& classes, sgpp::base::DataVector& b) {
   // this->B->multTranspose((*this->dataset_), classes, b);
   // this->B->multTranspose(classes, b);
 
+  if (updateBasisMatrix()) {
+    multTransposeBasisMatrix(classes, b);
+    return;
+  }
+
   std::unique_ptr<base::OperationMultipleEval> op(
       sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
   op->multTranspose(classes, b);
 }
 
+void DMSystemMatrix::setBasisMatrixCache(size_t memoryBudget) {
+  basisMatrixBudget = memoryBudget;
+  basisMatrixUpToDate = false;
+  basisMatrixCached = false;
+  std::vector<size_t>().swap(basisMatrixRowOffsets);
+  std::vector<size_t>().swap(basisMatrixColumns);
+  std::vector<double>().swap(basisMatrixValues);
+}
+
+bool DMSystemMatrix::isBasisMatrixCached() const { return basisMatrixCached; }
+
+bool DMSystemMatrix::updateBasisMatrix() {
+  if (basisMatrixBudget == 0) {
+    return false;
+  }
+
+  // the size alone does not detect refinement steps that insert as many points as were coarsened
+  const size_t gridSize = grid.getSize();
+  const size_t gridHash = grid.getStorage().computeHash();
+
+  if (basisMatrixUpToDate && (basisMatrixGridSize == gridSize) &&
+      (basisMatrixGridHash == gridHash)) {
+    return basisMatrixCached;
+  }
+
+  setBasisMatrixCache(basisMatrixBudget);
+  basisMatrixUpToDate = true;
+  basisMatrixGridSize = gridSize;
+  basisMatrixGridHash = gridHash;
+
+  // the rows are computed in the same way as by the operation that is used otherwise
+  base::DataMatrix pointsInUnitCube;
+  BasisMatrixRowFunction computeRow;
+
+  switch (grid.getType()) {
+    case base::GridType::Linear:
+      computeRow = getAffectedBasisFunctions<base::SLinearBase>(grid, this->dataset_);
+      break;
+    case base::GridType::LinearL0Boundary:
+    case base::GridType::LinearBoundary:
+      computeRow = getAffectedBasisFunctions<base::SLinearBoundaryBase>(grid, this->dataset_);
+      break;
+    case base::GridType::ModLinear:
+      computeRow = getAffectedBasisFunctions<base::SLinearModifiedBase>(grid, this->dataset_);
+      break;
+    case base::GridType::Poly:
+      computeRow = getAffectedBasisFunctions<base::SPolyBase>(grid, this->dataset_);
+      break;
+    case base::GridType::PolyBoundary:
+      computeRow = getAffectedBasisFunctions<base::SPolyBoundaryBase>(grid, this->dataset_);
+      break;
+    case base::GridType::ModPoly:
+      computeRow = getAffectedBasisFunctions<base::SPolyModifiedBase>(grid, this->dataset_);
+      break;
+    case base::GridType::Bspline:
+    case base::GridType::BsplineBoundary:
+    case base::GridType::ModBspline:
+    case base::GridType::BsplineClenshawCurtis:
+    case base::GridType::ModBsplineClenshawCurtis:
+      pointsInUnitCube = this->dataset_;
+      grid.getStorage().getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
+      computeRow = getAllBasisFunctions(grid, pointsInUnitCube);
+      break;
+    default:
+      return false;
+  }
+
+  const size_t m = this->dataset_.getNrows();
+  const size_t offsetsSize = (m + 1) * sizeof(size_t);
+
+  if (offsetsSize > basisMatrixBudget) {
+    return false;
+  }
+
+  const size_t maxEntries = (basisMatrixBudget - offsetsSize) / (sizeof(size_t) + sizeof(double));
+  BasisMatrixRow row;
+
+  // estimate the number of nonzero entries from evenly spaced data points
+  const size_t sampleSize = std::min(m, basisMatrixSampleSize);
+  size_t sampleEntries = 0;
+
+  for (size_t k = 0; k < sampleSize; k++) {
+    computeRow(k * m / sampleSize, row);
+    sampleEntries += row.size();
+  }
+
+  if ((sampleSize > 0) && (static_cast<double>(sampleEntries) / static_cast<double>(sampleSize) *
+                               static_cast<double>(m) >
+                           static_cast<double>(maxEntries))) {
+    return false;
+  }
+
+  // compute the rows block by block in parallel, stop as soon as the budget is exceeded
+  const size_t numBlocks = (m + basisMatrixBlockSize - 1) / basisMatrixBlockSize;
+  std::vector<std::vector<size_t>> blockColumns(numBlocks);
+  std::vector<std::vector<double>> blockValues(numBlocks);
+  basisMatrixRowOffsets.assign(m + 1, 0);
+  size_t numEntries = 0;
+  bool exceeded = false;
+
+#pragma omp parallel private(row)
+  {
+#pragma omp for schedule(dynamic)
+    for (size_t b = 0; b < numBlocks; b++) {
+      bool skip;
+#pragma omp atomic read
+      skip = exceeded;
+
+      if (skip) {
+        continue;
+      }
+
+      const size_t end = std::min(m, (b + 1) * basisMatrixBlockSize);
+
+      for (size_t j = b * basisMatrixBlockSize; j < end; j++) {
+        computeRow(j, row);
+        size_t rowEntries = 0;
+
+        for (const std::pair<size_t, double>& entry : row) {
+          if (entry.second != 0.0) {
+            blockColumns[b].push_back(entry.first);
+            blockValues[b].push_back(entry.second);
+            rowEntries++;
+          }
+        }
+
+        basisMatrixRowOffsets[j + 1] = rowEntries;
+      }
+
+      size_t totalEntries;
+#pragma omp atomic capture
+      totalEntries = numEntries += blockColumns[b].size();
+
+      if (totalEntries > maxEntries) {
+#pragma omp atomic write
+        exceeded = true;
+      }
+    }
+  }
+
+  if (exceeded) {
+    setBasisMatrixCache(basisMatrixBudget);
+    basisMatrixUpToDate = true;
+    return false;
+  }
+
+  for (size_t j = 0; j < m; j++) {
+    basisMatrixRowOffsets[j + 1] += basisMatrixRowOffsets[j];
+  }
+
+  basisMatrixColumns.resize(numEntries);
+  basisMatrixValues.resize(numEntries);
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t b = 0; b < numBlocks; b++) {
+    const size_t offset = basisMatrixRowOffsets[b * basisMatrixBlockSize];
+    std::copy(blockColumns[b].begin(), blockColumns[b].end(),
+              basisMatrixColumns.begin() + static_cast<std::ptrdiff_t>(offset));
+    std::copy(blockValues[b].begin(), blockValues[b].end(),
+              basisMatrixValues.begin() + static_cast<std::ptrdiff_t>(offset));
+    std::vector<size_t>().swap(blockColumns[b]);
+    std::vector<double>().swap(blockValues[b]);
+  }
+
+  basisMatrixCached = true;
+  return true;
+}
+
+void DMSystemMatrix::multBasisMatrix(const base::DataVector& alpha,
+                                     base::DataVector& result) const {
+  const size_t m = basisMatrixRowOffsets.size() - 1;
+  result.resize(m);
+
+#pragma omp parallel for schedule(static)
+  for (size_t j = 0; j < m; j++) {
+    double sum = 0.0;
+
+    for (size_t k = basisMatrixRowOffsets[j]; k < basisMatrixRowOffsets[j + 1]; k++) {
+      sum += basisMatrixValues[k] * alpha[basisMatrixColumns[k]];
+    }
+
+    result[j] = sum;
+  }
+}
+
+void DMSystemMatrix::multTransposeBasisMatrix(const base::DataVector& source,
+                                              base::DataVector& result) const {
+  const size_t m = basisMatrixRowOffsets.size() - 1;
+  const size_t n = basisMatrixGridSize;
+  size_t numThreads = 1;
+#ifdef _OPENMP
+  numThreads = static_cast<size_t>(omp_get_max_threads());
+#endif /* _OPENMP */
+
+  // every thread sums up the contributions of a contiguous range of data points,
+  // then the partial results are added in the order of the threads
+  std::vector<base::DataVector> partialResults(numThreads, base::DataVector(n, 0.0));
+  result.resize(n);
+
+#pragma omp parallel num_threads(static_cast<int>(numThreads))
+  {
+    size_t threadId = 0;
+#ifdef _OPENMP
+    threadId = static_cast<size_t>(omp_get_thread_num());
+#endif /* _OPENMP */
+    base::DataVector& partialResult = partialResults[threadId];
+
+#pragma omp for schedule(static)
+    for (size_t j = 0; j < m; j++) {
+      for (size_t k = basisMatrixRowOffsets[j]; k < basisMatrixRowOffsets[j + 1]; k++) {
+        partialResult[basisMatrixColumns[k]] += basisMatrixValues[k] * source[j];
+      }
+    }
+
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < n; i++) {
+      double sum = 0.0;
+
+      for (size_t t = 0; t < numThreads; t++) {
+        sum += partialResults[t][i];
+      }
+
+      result[i] = sum;
+    }
+  }
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
@@ -17,6 +17,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -33,6 +34,50 @@ class DMSystemMatrix : public DMSystemMatrixBase {
   /// OperationB for calculating the data matrix
   std::unique_ptr<base::OperationMultipleEval> B;
 
+  /// maximum size of the cached data matrix in bytes, 0 if the cache is disabled
+  size_t basisMatrixBudget;
+  /// whether it has been decided for the current grid if the data matrix is cached
+  bool basisMatrixUpToDate;
+  /// whether the data matrix is cached for the current grid
+  bool basisMatrixCached;
+  /// number of grid points when the data matrix was cached
+  size_t basisMatrixGridSize;
+  /// hash of the grid points (see base::HashGridStorage::computeHash) when the data matrix was
+  /// cached
+  size_t basisMatrixGridHash;
+  /// offsets of the rows (data points) of the cached data matrix in the arrays below (CSR)
+  std::vector<size_t> basisMatrixRowOffsets;
+  /// grid point indices of the nonzero entries of the cached data matrix
+  std::vector<size_t> basisMatrixColumns;
+  /// values of the nonzero entries of the cached data matrix
+  std::vector<double> basisMatrixValues;
+
+  /**
+   * Caches the data matrix if the cache is enabled, the grid type is supported and the matrix fits
+   * into the memory budget. The matrix is rebuilt if the grid points changed, i.e., if their
+   * number or their hash changed.
+   *
+   * @return whether the cached data matrix can be used
+   */
+  bool updateBasisMatrix();
+
+  /**
+   * Multiplies the cached data matrix with a vector of grid point coefficients.
+   *
+   * @param alpha vector of grid point coefficients
+   * @param result vector into which the values at the data points are stored
+   */
+  void multBasisMatrix(const base::DataVector& alpha, base::DataVector& result) const;
+
+  /**
+   * Multiplies the transposed cached data matrix with a vector of data point values. For a fixed
+   * number of OpenMP threads, the summation order (and thus the result) is deterministic.
+   *
+   * @param source vector of data point values
+   * @param result vector into which the values at the grid points are stored
+   */
+  void multTransposeBasisMatrix(const base::DataVector& source, base::DataVector& result) const;
+
  public:
   /**
    * Std-Constructor
@@ -52,6 +97,15 @@ class DMSystemMatrix : public DMSystemMatrixBase {
 
   virtual void mult(base::DataVector& alpha, base::DataVector& result);
 
+  /**
+   * Applies the system matrix to several coefficient vectors at once. The data operation is
+   * created only once for the whole batch and the regularization operator is applied batched.
+   *
+   * @param alpha matrix whose columns are the coefficient vectors
+   * @param result matrix into whose columns the results are stored
+   */
+  virtual void multBatch(base::DataMatrix& alpha, base::DataMatrix& result);
+
   /**
    * Generates the right hand side of the classification equation
    *
@@ -60,6 +114,33 @@ class DMSystemMatrix : public DMSystemMatrixBase {
    *   multiplication on the rhs
    */
   virtual void generateb(base::DataVector& classes, base::DataVector& b);
+
+  /**
+   * Enables caching the data matrix B, i.e., the values of all basis functions at all training
+   * data points. Instead of evaluating the basis functions in every multiplication, the nonzero
+   * entries are computed once (in parallel) and stored in compressed sparse row format, which
+   * speeds up iterative solvers that apply the system matrix many times. The matrix is built in
+   * the next multiplication. If its estimated size exceeds the memory budget or the basis
+   * functions of the grid type are not supported, the data matrix is evaluated on the fly as
+   * before.
+   *
+   * The cache assumes that the training data does not change. It is rebuilt automatically if grid
+   * points are inserted, deleted or reordered, which is detected by the number and the hash of
+   * the grid points; call this method again if the bounding box of the grid is modified.
+   *
+   * Supported grid types: Linear, LinearL0Boundary, LinearBoundary, ModLinear, Poly,
+   * PolyBoundary, ModPoly, Bspline, BsplineBoundary, ModBspline, BsplineClenshawCurtis and
+   * ModBsplineClenshawCurtis.
+   *
+   * @param memoryBudget maximum size of the cached data matrix in bytes, 0 disables the cache
+   */
+  void setBasisMatrixCache(size_t memoryBudget);
+
+  /**
+   * @return whether the data matrix is cached for the current grid (only known after the first
+   *   multiplication after enabling the cache)
+   */
+  bool isBasisMatrixCached() const;
 };
 
 }  // namespace datadriven
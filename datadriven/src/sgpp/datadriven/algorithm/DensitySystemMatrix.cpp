@@ -47,6 +47,22 @@ void DensitySystemMatrix::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVe
   result.axpy(lambda, tmp);
 }
 
+void DensitySystemMatrix::multBatch(sgpp::base::DataMatrix& alpha,
+                                    sgpp::base::DataMatrix& result) {
+  result.resizeZero(alpha.getNrows(), alpha.getNcols());
+
+  // A * alpha
+  A->multBatch(alpha, result);
+
+  // C * alpha
+  base::DataMatrix tmp(alpha.getNrows(), alpha.getNcols());
+  C->multBatch(alpha, tmp);
+
+  // A * alpha + lambda * C * alpha
+  tmp.mult(lambda);
+  result.add(tmp);
+}
+
 // Matrix-Multiplikation verwenden
 void DensitySystemMatrix::generateb(sgpp::base::DataVector& rhs) {
   sgpp::base::DataVector y(numSamples);
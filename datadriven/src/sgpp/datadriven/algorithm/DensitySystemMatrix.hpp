@@ -68,6 +68,15 @@ class DensitySystemMatrix : public base::OperationMatrix {
    */
   void mult(base::DataVector& alpha, base::DataVector& result);
 
+  /**
+   * Generates the left hand side of the classification equation for several coefficient
+   * vectors at once
+   *
+   * @param alpha matrix whose columns are the parameters for the sparse grid functions
+   * @param result reference to the matrix whose columns will contain the results
+   */
+  void multBatch(base::DataMatrix& alpha, base::DataMatrix& result);
+
   /**
    * Generates the right hand side of the classification equation
    *
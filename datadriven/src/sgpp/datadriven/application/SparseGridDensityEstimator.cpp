@@ -547,12 +547,7 @@ base::OperationMatrix* SparseGridDensityEstimator::computeLTwoDotProductMatrix(b
 
 base::OperationMultipleEval* SparseGridDensityEstimator::computeMultipleEvalMatrix(
     base::Grid& grid, base::DataMatrix& train) {
-  if (grid.getType() == base::GridType::Bspline ||
-      grid.getType() == base::GridType::BsplineBoundary ||
-      grid.getType() == base::GridType::BsplineClenshawCurtis ||
-      grid.getType() == base::GridType::ModBsplineClenshawCurtis ||
-      grid.getType() == base::GridType::ModBspline ||
-      grid.getType() == base::GridType::PolyClenshawCurtis ||
+  if (grid.getType() == base::GridType::PolyClenshawCurtis ||
       grid.getType() == base::GridType::PolyClenshawCurtisBoundary ||
       grid.getType() == base::GridType::ModPolyClenshawCurtis) {
     return op_factory::createOperationMultipleEvalNaive(grid, train);
@@ -21,6 +21,9 @@ struct CrossvalidationConfiguration {
   int seed_;      // seed for randomized k-fold
   bool shuffle_;  // randomized/sequential k-fold
   bool silent_;   // verbosity
+  // number of folds that are trained concurrently (0: as many as possible); the available
+  // threads are split evenly between the concurrent folds
+  size_t foldThreads_ = 0;
 
   // regularization parameter optimization
   double lambda_;       // regularization parameter
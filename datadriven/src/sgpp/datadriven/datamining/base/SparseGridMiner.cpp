@@ -32,6 +32,8 @@ void SparseGridMiner::print(const std::string& message) {
 #ifdef USE_SCALAPACK
   if (BlacsProcessGrid::getCurrentProcess() == 0) {
 #endif
+    // messages may come from folds that are trained concurrently
+#pragma omp critical(SparseGridMinerPrint)
     std::cout << message << std::endl;
 #ifdef USE_SCALAPACK
   }
@@ -9,7 +9,15 @@
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 namespace sgpp {
@@ -35,101 +43,70 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
 
   const CrossvalidationConfiguration& crossValidationConfig =
       dataSource->getCrossValidationConfig();
+  const size_t kfold = crossValidationConfig.kfold_;
 
-  std::vector<double> scores;
-  scores.reserve(crossValidationConfig.kfold_);
-
-  for (size_t fold = 0; fold < crossValidationConfig.kfold_; fold++) {
-    dataSource->setFold(fold);
-
-    // todo(fuchsgdk):
-    // This is the kind of cv implemented by Lettrich in the scorer class and it was
-    // merely moved to fit into the data source. Conceptual changes might be done in order to
-    // really support batch based learning with cv and not only regression.
-    // What should be done is reimplementing the data source such that it provides batches
-
-    std::ostringstream out;
-    out << "###############"
-        << "Fold #" << fold;
-    print(out);
-
-    // Create a refinement monitor for this fold
-    RefinementMonitorFactory monitorFactory;
-    RefinementMonitor* monitor = monitorFactory.createRefinementMonitor(
-        fitter->getFitterConfiguration().getRefinementConfig());
+  std::vector<double> scores(kfold);
+  size_t concurrentFolds = getNumberOfConcurrentFolds(kfold);
 
-    // Reset the fitter
-    fitter->reset();
+  // every fold gets its own fitter and its own view of the data source
+  std::vector<std::unique_ptr<ModelFittingBase>> foldFitters;
+  std::vector<std::unique_ptr<DataSourceCrossValidation>> foldDataSources;
 
-    for (size_t epoch = 0; epoch < dataSource->getConfig().epochs; epoch++) {
-      if (verbose) {
-        std::ostringstream out;
-        out << "###############"
-            << "Starting training epoch #" << epoch;
-        print(out);
-      }
-      dataSource->reset();
-      Dataset* validationData = dataSource->getValidationData();
-      size_t validationSize = validationData->getNumberInstances();
+  if (concurrentFolds <= 1) {
+    for (size_t fold = 0; fold < kfold; fold++) {
+      dataSource->setFold(fold);
+      scores[fold] = learnFold(*fitter, *dataSource, fold, verbose);
+    }
+  } else {
+    for (size_t fold = 0; fold < kfold; fold++) {
+      foldFitters.emplace_back(fitter->clone());
+      foldDataSources.emplace_back(dataSource->createFoldView(fold));
+    }
 
-      if (verbose) {
-        std::ostringstream out;
-        out << "Validation data size: " << validationSize;
-        print(out);
-      }
-      // Process dataset iteratively
-      size_t iteration = 0;
-      while (true) {
-        std::unique_ptr<Dataset> dataset(dataSource->getNextSamples());
-        size_t numInstances = dataset->getNumberInstances();
-        if (numInstances == 0) {
-          // The source does not provide any more samples
-          break;
-        }
+#ifdef _OPENMP
+    // split the threads evenly between the concurrent folds
+    const size_t numThreads = static_cast<size_t>(omp_get_max_threads());
+    const size_t threadsPerFold = std::max(numThreads / concurrentFolds, static_cast<size_t>(1));
+    const size_t remainingThreads =
+        (numThreads > concurrentFolds) ? (numThreads % concurrentFolds) : 0;
+    const int maxActiveLevels = omp_get_max_active_levels();
 
-        if (verbose) {
-          std::ostringstream out;
-          out << "###############"
-              << "Iteration #" << (iteration) << std::endl
-              << "Batch size: " << numInstances;
-          print(out);
-        }
+    if (threadsPerFold > 1) {
+      omp_set_max_active_levels(std::max(maxActiveLevels, omp_get_level() + 2));
+    }
+#endif /* _OPENMP */
 
-        // Train model on new batch
-        fitter->update(*dataset);
+    std::exception_ptr exception;
 
-        // Evaluate the score on the training and validation data
-        double scoreTrain = scorer->test(*fitter, *dataset);
-        double scoreVal = scorer->test(*fitter, *validationData);
+#pragma omp parallel num_threads(static_cast<int>(concurrentFolds))
+    {
+#ifdef _OPENMP
+      const size_t threadIdx = static_cast<size_t>(omp_get_thread_num());
+      omp_set_num_threads(
+          static_cast<int>(threadsPerFold + ((threadIdx < remainingThreads) ? 1 : 0)));
+#endif /* _OPENMP */
 
-        if (verbose) {
-          std::ostringstream out;
-          out << "Score on batch: " << scoreTrain << std::endl
-              << "Score on validation data: " << scoreVal;
-          print(out);
+#pragma omp for schedule(dynamic)
+      for (size_t fold = 0; fold < kfold; fold++) {
+        try {
+          scores[fold] = learnFold(*foldFitters[fold], *foldDataSources[fold], fold, verbose);
+        } catch (...) {
+#pragma omp critical(SparseGridMinerCrossValidationException)
+          exception = std::current_exception();
         }
+      }
+    }
 
-        visualizer->runVisualization(*fitter, *dataSource, fold, iteration);
-        // Refine the model if neccessary
-        monitor->pushToBuffer(numInstances, scoreVal, scoreTrain);
-        size_t refinements = monitor->refinementsNecessary();
-        while (refinements--) {
-          fitter->refine();
-        }
+#ifdef _OPENMP
+    omp_set_max_active_levels(maxActiveLevels);
+#endif /* _OPENMP */
 
-        if (verbose) {
-          std::ostringstream out;
-          out << "###############"
-              << "Iteration finished.";
-          print(out);
-        }
-        iteration++;
-      }
+    if (exception) {
+      std::rethrow_exception(exception);
     }
-    // Evaluate the final score on the validation data
-    dataSource->reset();
-    Dataset* validationData = dataSource->getValidationData();
-    scores.push_back(scorer->test(*fitter, *validationData));
+
+    // like in the sequential case, the model of the last fold is the model of the miner
+    fitter = std::move(foldFitters.back());
   }
 
   // Calculate mean score and std deviation
@@ -151,5 +128,131 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
   print(out);
   return meanScore;
 }
+
+double SparseGridMinerCrossValidation::learnFold(ModelFittingBase& foldFitter,
+                                                 DataSourceCrossValidation& foldDataSource,
+                                                 size_t fold, bool verbose) {
+  // todo(fuchsgdk):
+  // This is the kind of cv implemented by Lettrich in the scorer class and it was
+  // merely moved to fit into the data source. Conceptual changes might be done in order to
+  // really support batch based learning with cv and not only regression.
+  // What should be done is reimplementing the data source such that it provides batches
+
+  std::ostringstream out;
+  out << "###############"
+      << "Fold #" << fold;
+  print(out);
+
+  // Create a refinement monitor for this fold
+  RefinementMonitorFactory monitorFactory;
+  std::unique_ptr<RefinementMonitor> monitor(monitorFactory.createRefinementMonitor(
+      foldFitter.getFitterConfiguration().getRefinementConfig()));
+
+  // Reset the fitter
+  foldFitter.reset();
+
+  for (size_t epoch = 0; epoch < foldDataSource.getConfig().epochs; epoch++) {
+    if (verbose) {
+      std::ostringstream out;
+      out << "###############"
+          << "Starting training epoch #" << epoch;
+      print(out);
+    }
+    foldDataSource.reset();
+    Dataset* validationData = foldDataSource.getValidationData();
+    size_t validationSize = validationData->getNumberInstances();
+
+    if (verbose) {
+      std::ostringstream out;
+      out << "Validation data size: " << validationSize;
+      print(out);
+    }
+    // Process dataset iteratively
+    size_t iteration = 0;
+    while (true) {
+      std::unique_ptr<Dataset> dataset(foldDataSource.getNextSamples());
+      size_t numInstances = dataset->getNumberInstances();
+      if (numInstances == 0) {
+        // The source does not provide any more samples
+        break;
+      }
+
+      if (verbose) {
+        std::ostringstream out;
+        out << "###############"
+            << "Iteration #" << (iteration) << std::endl
+            << "Batch size: " << numInstances;
+        print(out);
+      }
+
+      // Train model on new batch
+      foldFitter.update(*dataset);
+
+      // Evaluate the score on the training and validation data
+      double scoreTrain = scorer->test(foldFitter, *dataset);
+      double scoreVal = scorer->test(foldFitter, *validationData);
+
+      if (verbose) {
+        std::ostringstream out;
+        out << "Score on batch: " << scoreTrain << std::endl
+            << "Score on validation data: " << scoreVal;
+        print(out);
+      }
+
+      visualizer->runVisualization(foldFitter, foldDataSource, fold, iteration);
+      // Refine the model if neccessary
+      monitor->pushToBuffer(numInstances, scoreVal, scoreTrain);
+      size_t refinements = monitor->refinementsNecessary();
+      while (refinements--) {
+        foldFitter.refine();
+      }
+
+      if (verbose) {
+        std::ostringstream out;
+        out << "###############"
+            << "Iteration finished.";
+        print(out);
+      }
+      iteration++;
+    }
+  }
+  if (verbose && foldDataSource.getConfig().prefetchDepth > 0) {
+    std::ostringstream out;
+    out << "Time spent waiting for prefetched batches: " << foldDataSource.getPrefetchStallTime()
+        << " s";
+    print(out);
+  }
+  // Evaluate the final score on the validation data
+  foldDataSource.reset();
+  Dataset* validationData = foldDataSource.getValidationData();
+  return scorer->test(foldFitter, *validationData);
+}
+
+size_t SparseGridMinerCrossValidation::getNumberOfConcurrentFolds(size_t kfold) const {
+#ifdef USE_SCALAPACK
+  if (fitter->getFitterConfiguration().getParallelConfig().scalapackEnabled_) {
+    return 1;
+  }
+#endif /* USE_SCALAPACK */
+
+  // the folds are trained one after another if the fitter cannot be cloned
+  if (!fitter->supportsClone()) {
+    return 1;
+  }
+
+  // the visualizers keep state across the folds
+  if (visualizer->getVisualizerConfiguration().getGeneralConfig().execute) {
+    return 1;
+  }
+
+#ifdef _OPENMP
+  const size_t numThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t numThreads = 1;
+#endif /* _OPENMP */
+  const size_t foldThreads = dataSource->getCrossValidationConfig().foldThreads_;
+
+  return std::min((foldThreads == 0) ? numThreads : foldThreads, kfold);
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
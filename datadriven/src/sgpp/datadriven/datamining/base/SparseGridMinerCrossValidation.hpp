@@ -69,10 +69,35 @@ class SparseGridMinerCrossValidation : public SparseGridMiner {
    * Perform Learning cycle: Get samples from data source and based on the scoring procedure,
    * generalize data by fitting and asses quality of the fit. Each cycle is performed once per
    * fold.
+   *
+   * If possible, several folds are trained concurrently, each with its own clone of the fitter
+   * and its own view of the data source (see CrossvalidationConfiguration::foldThreads_). The
+   * OpenMP threads are split evenly between the concurrent folds, which use their share for the
+   * parallelism within the fitter. The folds are trained one after another if the fitter cannot
+   * be cloned (see ModelFittingBase::supportsClone()), if ScaLAPACK is used or if the
+   * visualization is enabled.
+   * Afterwards, the model of the last fold is the model of the miner.
    */
   double learn(bool verbose) override;
 
  private:
+  /**
+   * Perform the learning cycle of one fold.
+   * @param foldFitter fitter to train, it is reset before training
+   * @param foldDataSource data source of the fold
+   * @param fold index of the fold
+   * @param verbose whether to print the progress
+   * @return score on the validation data of the fold
+   */
+  double learnFold(ModelFittingBase& foldFitter, DataSourceCrossValidation& foldDataSource,
+                   size_t fold, bool verbose);
+
+  /**
+   * @param kfold number of folds
+   * @return number of folds that can be trained concurrently
+   */
+  size_t getNumberOfConcurrentFolds(size_t kfold) const;
+
   /**
    * DataSource provides samples that will be used by fitter to generalize data and scorer to
    * validate and assess model robustness.
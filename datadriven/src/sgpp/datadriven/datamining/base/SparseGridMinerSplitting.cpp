@@ -91,6 +91,12 @@ double SparseGridMinerSplitting::learn(bool verbose) {
       iteration++;
     }
   }
+  if (verbose && dataSource->getConfig().prefetchDepth > 0) {
+    std::ostringstream out;
+    out << "Time spent waiting for prefetched batches: " << dataSource->getPrefetchStallTime()
+        << " s";
+    print(out);
+  }
   return scorer->test(*fitter, *(dataSource->getValidationData()));
 }  // namespace datadriven
 }  // namespace datadriven
@@ -44,10 +44,11 @@ DataSourceBuilder& DataSourceBuilder::withBatchSize(size_t batchSize) {
 DataSourceBuilder& DataSourceBuilder::withCompression(bool isCompressed) {
   config.isCompressed = isCompressed;
 
-#ifndef ZLIB
+#if !defined(ZLIB) && !defined(ZSTD)
   if (isCompressed) {
     throw sgpp::base::application_exception{
-        "sgpp has been built without zlib support. Reading compressed files is not possible"};
+        "sgpp has been built without zlib and zstd support. Reading compressed files is not "
+        "possible"};
   }
 #endif
 
@@ -78,9 +79,10 @@ DataSourceSplitting* DataSourceBuilder::splittingAssemble() const {
   }
 
   if (config.isCompressed) {
-#ifndef ZLIB
+#if !defined(ZLIB) && !defined(ZSTD)
     throw sgpp::base::application_exception{
-        "sgpp has been built without zlib support. Reading compressed files is not possible"};
+        "sgpp has been built without zlib and zstd support. Reading compressed files is not "
+        "possible"};
 #else
     sampleProvider = new GzipFileSampleDecorator(static_cast<FileSampleProvider*>(sampleProvider));
 #endif
@@ -116,9 +118,10 @@ DataSourceCrossValidation* DataSourceBuilder::crossValidationAssemble() const {
   }
 
   if (config.isCompressed) {
-#ifndef ZLIB
+#if !defined(ZLIB) && !defined(ZSTD)
     throw sgpp::base::application_exception{
-        "sgpp has been built without zlib support. Reading compressed files is not possible"};
+        "sgpp has been built without zlib and zstd support. Reading compressed files is not "
+        "possible"};
 #else
     sampleProvider = new GzipFileSampleDecorator(static_cast<FileSampleProvider*>(sampleProvider));
 #endif
@@ -149,8 +152,8 @@ void DataSourceBuilder::grabTypeInfoFromFilePath() {
     // TODO(Michael Lettrich): test if this works with umlauts
     std::transform(t.begin(), t.end(), t.begin(), ::tolower);
   }
-  // check if there is gz compression
-  if (tokens.back() == "gz") {
+  // check if there is gzip or zstd compression
+  if ((tokens.back() == "gz") || (tokens.back() == "zst")) {
     withCompression(true);
   }
 
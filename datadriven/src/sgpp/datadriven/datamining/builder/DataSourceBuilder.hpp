@@ -35,7 +35,7 @@ class DataSourceBuilder {
   DataSourceBuilder& withPath(const std::string& filePath);
 
   /**
-   * Optionally Specify if the file used is gz compressed. If data source does not use any files,
+   * Optionally Specify if the file used is gzip or zstd compressed. If data source does not use any files,
    * this is set to false by default.
    * @param isCompressed true if the file is compressed, false otherwise.
    * @return Reference to this object, used for chaining.
@@ -54,10 +54,10 @@ ModelFittingBase *DensityEstimationMinerFactory::createFitter(
 HyperparameterOptimizer *DensityEstimationMinerFactory::buildHPO(const std::string &path) const {
   DataMiningConfigParser parser(path);
   if (parser.getHPOMethod("bayesian") == "harmonica") {
-    return new HarmonicaHyperparameterOptimizer(buildMiner(path),
+    return new HarmonicaHyperparameterOptimizer(buildHPOMiners(path, parser),
                                                 new DensityEstimationFitterFactory(parser), parser);
   } else {
-    return new BoHyperparameterOptimizer(buildMiner(path),
+    return new BoHyperparameterOptimizer(buildHPOMiners(path, parser),
                                          new DensityEstimationFitterFactory(parser), parser);
   }
 }
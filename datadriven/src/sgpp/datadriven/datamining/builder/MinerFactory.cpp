@@ -16,7 +16,9 @@
 #include <sgpp/datadriven/datamining/modules/hpo/HarmonicaHyperparameterOptimizer.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -38,13 +40,28 @@ SparseGridMiner* MinerFactory::buildMiner(const std::string& path) const {
 sgpp::datadriven::HyperparameterOptimizer* MinerFactory::buildHPO(const std::string& path) const {
   DataMiningConfigParser parser(path);
   if (parser.getHPOMethod("bayesian") == "harmonica") {
-    return new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser),
-                                                parser);
+    return new HarmonicaHyperparameterOptimizer(buildHPOMiners(path, parser),
+                                                createFitterFactory(parser), parser);
   } else {
-    return new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser);
+    return new BoHyperparameterOptimizer(buildHPOMiners(path, parser),
+                                         createFitterFactory(parser), parser);
   }
 }
 
+std::vector<SparseGridMiner*> MinerFactory::buildHPOMiners(const std::string& path,
+                                                           DataMiningConfigParser& parser) const {
+  HPOConfig hpoConfig;
+  hpoConfig.setupDefaults();
+  parser.getHPOConfig(hpoConfig);
+
+  const int64_t numMiners = std::max(hpoConfig.getParallelTrials(), static_cast<int64_t>(1));
+  std::vector<SparseGridMiner*> miners;
+  for (int64_t i = 0; i < numMiners; i++) {
+    miners.push_back(buildMiner(path));
+  }
+  return miners;
+}
+
 DataSourceSplitting* MinerFactory::createDataSourceSplitting(
     const DataMiningConfigParser& parser) const {
   DataSourceConfig config{};
@@ -12,6 +12,7 @@
 #include <sgpp/datadriven/datamining/modules/visualization/Visualizer.hpp>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -41,6 +42,17 @@ class MinerFactory {
   virtual sgpp::datadriven::HyperparameterOptimizer *buildHPO(const std::string &path) const;
 
  protected:
+  /**
+   * Builds the miners that evaluate the configurations of a hyperparameter optimization, one
+   * miner per configuration that is evaluated concurrently (hpo[parallelTrials]). Each miner
+   * reads its own copy of the data.
+   * @param path Path to a configuration file that defines the structure of the miner objects.
+   * @param parser the datamining configuration parser instance of the configuration file
+   * @return miner objects that are owned by the caller
+   */
+  std::vector<SparseGridMiner*> buildHPOMiners(const std::string& path,
+                                               DataMiningConfigParser& parser) const;
+
   /**
    * Factory method to build a splitting based data source, i.e. a data source that splits
    * data into validation and training data.
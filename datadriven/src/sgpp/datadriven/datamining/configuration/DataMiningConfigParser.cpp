@@ -177,6 +177,8 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
     config.randomSeed =
         parseUInt(*dataSourceConfig, "randomSeed", defaults.randomSeed, "dataSource");
     config.epochs = parseUInt(*dataSourceConfig, "epochs", defaults.epochs, "dataSource");
+    config.prefetchDepth =
+        parseUInt(*dataSourceConfig, "prefetchDepth", defaults.prefetchDepth, "dataSource");
 
     // Parse info for test data
     config.testFilePath = parseString(*dataSourceConfig, "testFilePath",
@@ -391,6 +393,8 @@ bool DataMiningConfigParser::getFitterCrossvalidationConfig(
         parseBool(*crossvalidationConfig, "shuffle", defaults.shuffle_, "crossValidation");
     config.silent_ =
         parseBool(*crossvalidationConfig, "silent", defaults.silent_, "crossValidation");
+    config.foldThreads_ = parseUInt(*crossvalidationConfig, "foldThreads", defaults.foldThreads_,
+                                    "crossValidation");
     config.lambda_ =
         parseDouble(*crossvalidationConfig, "lambda", defaults.lambda_, "crossValidation");
     config.lambdaStart_ = parseDouble(*crossvalidationConfig, "lambdaStart", defaults.lambdaStart_,
@@ -937,6 +941,9 @@ void DataMiningConfigParser::getHPOConfig(HPOConfig &config) {
     auto node = static_cast<DictNode *>(&(*configFile)["hpo"]);
     config.setSeed(parseInt(*node, "randomSeed", config.getSeed(), "hpo"));
     config.setNTrainSamples(parseInt(*node, "trainSize", config.getNTrainSamples(), "hpo"));
+    config.setParallelTrials(
+        parseInt(*node, "parallelTrials", config.getParallelTrials(), "hpo"));
+    config.setResumeFile(parseString(*node, "resumeFile", config.getResumeFile(), "hpo"));
     if (node->contains("harmonica")) {
       auto harmonica = static_cast<DictNode *>(&(*node)["harmonica"]);
       config.setLambda(parseDouble(*harmonica, "lambda", config.getLambda(), "hpo"));
@@ -9,8 +9,13 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
-#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorSequential.hpp>
+#include <sgpp/datadriven/tools/BlockDecompressor.hpp>
+#include <sgpp/datadriven/tools/StreamingDataParser.hpp>
 
+#include <exception>
+#include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -19,22 +24,33 @@ namespace sgpp {
 namespace datadriven {
 
 ArffFileSampleProvider::ArffFileSampleProvider(DataShufflingFunctor *shuffling)
-    : shuffling{shuffling}, dataset(Dataset{}), counter(0) {}
+    : shuffling{shuffling}, dataset(Dataset{}), counter(0), parser(nullptr), cursor() {}
 
 SampleProvider* ArffFileSampleProvider::clone() const {
-  return dynamic_cast<SampleProvider*>(new ArffFileSampleProvider{*this});
+  auto clonedProvider = new ArffFileSampleProvider{*this};
+
+  // the parser keeps the state of the decompression, so the clones must not share it
+  if (parser != nullptr) {
+    clonedProvider->parser = std::make_shared<StreamingDataParser>(*parser);
+  }
+
+  return dynamic_cast<SampleProvider*>(clonedProvider);
 }
 
 size_t ArffFileSampleProvider::getDim() const {
-  if (dataset.getDimension() != 0) {
-    return dataset.getDimension();
+  const size_t dimension = (parser != nullptr) ? parser->getDimension() : dataset.getDimension();
+
+  if (dimension != 0) {
+    return dimension;
   } else {
     throw base::file_exception{"No dataset loaded."};
   }
 }
 
 size_t ArffFileSampleProvider::getNumSamples() const {
-  if (dataset.getDimension() != 0) {
+  if ((parser != nullptr) && (parser->getDimension() != 0)) {
+    return parser->getNumberInstances();
+  } else if (dataset.getDimension() != 0) {
     return dataset.getNumberInstances();
   } else {
     throw base::file_exception{"No dataset loaded."};
@@ -47,17 +63,39 @@ void ArffFileSampleProvider::readFile(const std::string& fileName,
                                       std::vector<size_t> readinColumns,
                                       std::vector<double> readinClasses) {
   try {
-    dataset = ARFFTools::readARFFFromFile(fileName, hasTargets, readinCutoff,
-        readinColumns, readinClasses);
+    auto newParser = std::make_shared<StreamingDataParser>(
+        StreamingDataParser::Format::ARFF, hasTargets, readinCutoff, readinColumns, readinClasses);
+    newParser->readFile(fileName);
+    initialize(newParser);
   } catch (...) {
-    // TODO(lettrich): catching all exceptions is bad design. Replace call to ARFFTools with
+    // TODO(lettrich): catching all exceptions is bad design. Replace call to the parser with
     // exception safe implementation.
     throw base::data_exception{"Failed to parse ARFF File."};
   }
 }
 
+void ArffFileSampleProvider::readCompressedFile(const std::string& fileName,
+                                                bool hasTargets,
+                                                size_t readinCutoff,
+                                                std::vector<size_t> readinColumns,
+                                                std::vector<double> readinClasses) {
+  try {
+    auto newParser = std::make_shared<StreamingDataParser>(
+        StreamingDataParser::Format::ARFF, hasTargets, readinCutoff, readinColumns, readinClasses);
+    newParser->readCompressedFile(fileName);
+    initialize(newParser);
+  } catch (const std::exception& e) {
+    throw base::data_exception{
+        "Failed to parse compressed ARFF file " + fileName + " (compression: " +
+        BlockDecompressor::getCompressionName(BlockDecompressor::detectCompression(fileName)) +
+        "): " + e.what()};
+  }
+}
+
 Dataset* ArffFileSampleProvider::getNextSamples(size_t howMany) {
-  if (dataset.getDimension() != 0) {
+  if ((parser != nullptr) && (parser->getDimension() != 0)) {
+    return parser->readNext(cursor, howMany);
+  } else if (dataset.getDimension() != 0) {
     return splitDataset(howMany);
   } else {
     throw base::file_exception("No dataset loaded.");
@@ -65,7 +103,15 @@ Dataset* ArffFileSampleProvider::getNextSamples(size_t howMany) {
 }
 
 Dataset* ArffFileSampleProvider::getAllSamples() {
-  if (dataset.getDimension() != 0) {
+  if ((parser != nullptr) && (parser->getDimension() != 0)) {
+    if (cursor.numberRead == 0) {
+      // nothing has been read yet, so the whole input can be parsed in parallel chunks
+      cursor = parser->end();
+      return parser->readAll();
+    } else {
+      return parser->readNext(cursor, std::numeric_limits<size_t>::max());
+    }
+  } else if (dataset.getDimension() != 0) {
     return this->getNextSamples(dataset.getNumberInstances());
   } else {
     throw base::file_exception{"No dataset loaded."};
@@ -78,10 +124,12 @@ void ArffFileSampleProvider::readString(const std::string& input,
                                         std::vector<size_t> readinColumns,
                                         std::vector<double> readinClasses) {
   try {
-    dataset = ARFFTools::readARFFFromString(input, hasTargets, readinCutoff,
-        readinColumns, readinClasses);
+    auto newParser = std::make_shared<StreamingDataParser>(
+        StreamingDataParser::Format::ARFF, hasTargets, readinCutoff, readinColumns, readinClasses);
+    newParser->readString(input);
+    initialize(newParser);
   } catch (...) {
-    // TODO(lettrich): catching all exceptions is bad design. Replace call to ARFFTools with
+    // TODO(lettrich): catching all exceptions is bad design. Replace call to the parser with
     // exception safe implementation.
     throw base::data_exception{"Failed to parse ARFF data."};
   }
@@ -116,6 +164,25 @@ Dataset* ArffFileSampleProvider::splitDataset(size_t howMany) {
 
 void ArffFileSampleProvider::reset() {
   counter = 0;
+
+  if (parser != nullptr) {
+    cursor = parser->begin();
+  }
+}
+
+void ArffFileSampleProvider::initialize(std::shared_ptr<StreamingDataParser> newParser) {
+  counter = 0;
+
+  if ((shuffling == nullptr) ||
+      (dynamic_cast<DataShufflingFunctorSequential*>(shuffling) != nullptr)) {
+    parser = newParser;
+    cursor = parser->begin();
+    dataset = Dataset{};
+  } else {
+    parser.reset();
+    std::unique_ptr<Dataset> samples(newParser->readAll());
+    dataset = std::move(*samples);
+  }
 }
 
 } /* namespace datadriven */
@@ -0,0 +1,124 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/BatchPrefetcher.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace sgpp {
+namespace datadriven {
+
+BatchPrefetcher::BatchPrefetcher(std::function<Dataset*()> fetch, size_t depth)
+    : fetch{std::move(fetch)},
+      depth{std::max(depth, static_cast<size_t>(1))},
+      stopRequested{false},
+      finished{false},
+      exception{nullptr},
+      stallTime{0.0},
+      numberOfStalls{0} {}
+
+BatchPrefetcher::~BatchPrefetcher() { stop(); }
+
+Dataset* BatchPrefetcher::getNextSamples() {
+  if (!worker.joinable()) {
+    worker = std::thread(&BatchPrefetcher::run, this);
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+
+  if (queue.empty() && !finished) {
+    const auto start = std::chrono::steady_clock::now();
+    batchAvailable.wait(lock, [this] { return !queue.empty() || finished; });
+    stallTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    numberOfStalls++;
+  }
+
+  if (!queue.empty()) {
+    std::unique_ptr<Dataset> batch = std::move(queue.front());
+    queue.pop_front();
+    slotAvailable.notify_one();
+    return batch.release();
+  }
+
+  // the background thread finished, it does not use the fetch function anymore
+  std::exception_ptr failure = exception;
+  lock.unlock();
+
+  if (failure) {
+    stop();
+    std::rethrow_exception(failure);
+  }
+
+  // the end of the data has been reached, further calls behave like calls of fetch
+  return fetch();
+}
+
+void BatchPrefetcher::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopRequested = true;
+  }
+  slotAvailable.notify_all();
+
+  if (worker.joinable()) {
+    worker.join();
+  }
+
+  queue.clear();
+  stopRequested = false;
+  finished = false;
+  exception = nullptr;
+}
+
+double BatchPrefetcher::getStallTime() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return stallTime;
+}
+
+size_t BatchPrefetcher::getNumberOfStalls() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return numberOfStalls;
+}
+
+void BatchPrefetcher::run() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      slotAvailable.wait(lock, [this] { return stopRequested || queue.size() < depth; });
+      if (stopRequested) {
+        return;
+      }
+    }
+
+    std::unique_ptr<Dataset> batch;
+    std::exception_ptr failure;
+    try {
+      batch.reset(fetch());
+    } catch (...) {
+      failure = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (failure) {
+        exception = failure;
+        finished = true;
+      } else {
+        finished = (batch->getNumberInstances() == 0);
+        queue.push_back(std::move(batch));
+      }
+    }
+    batchAvailable.notify_one();
+
+    if (failure || finished) {
+      return;
+    }
+  }
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -0,0 +1,141 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * BatchPrefetcher reads batches ahead on a background thread, so the consumer (e.g., the epoch loop
+ * of a #sgpp::datadriven::SparseGridMiner) can process the current batch while the next ones are
+ * being read and transformed. The batches are produced by a fetch function in the same order as
+ * if it was called by the consumer directly. An empty batch marks the end of the data.
+ *
+ * While the background thread is running, the fetch function and all state it depends on must not
+ * be used by anyone else. Call stop() before, e.g., resetting the underlying sample provider.
+ */
+class BatchPrefetcher {
+ public:
+  /**
+   * Constructor
+   * @param fetch function that reads the next batch, the caller of the function owns the batch
+   * @param depth maximum number of batches that are read ahead (at least 1)
+   */
+  BatchPrefetcher(std::function<Dataset*()> fetch, size_t depth);
+
+  BatchPrefetcher(const BatchPrefetcher& rhs) = delete;
+
+  BatchPrefetcher& operator=(const BatchPrefetcher& rhs) = delete;
+
+  /**
+   * Destructor, stops the background thread.
+   */
+  ~BatchPrefetcher();
+
+  /**
+   * Get the next batch, waiting for the background thread if it has not been read yet. Starts the
+   * background thread if it is not running. Exceptions of the fetch function are rethrown here.
+   * @return next batch, owned by the caller
+   */
+  Dataset* getNextSamples();
+
+  /**
+   * Stops the background thread and discards all batches that have been read ahead. The next call
+   * of getNextSamples() starts reading ahead again.
+   */
+  void stop();
+
+  /**
+   * @return total time in seconds the consumer waited for batches that had not been read yet
+   */
+  double getStallTime() const;
+
+  /**
+   * @return number of batches the consumer had to wait for
+   */
+  size_t getNumberOfStalls() const;
+
+ private:
+  /**
+   * Loop of the background thread, reads batches until the queue is full, the end of the data is
+   * reached or stop() is called.
+   */
+  void run();
+
+  /**
+   * Function that reads the next batch
+   */
+  std::function<Dataset*()> fetch;
+
+  /**
+   * Maximum number of batches that are read ahead
+   */
+  size_t depth;
+
+  /**
+   * Batches that have been read ahead
+   */
+  std::deque<std::unique_ptr<Dataset>> queue;
+
+  /**
+   * Protects all members that are shared with the background thread
+   */
+  mutable std::mutex mutex;
+
+  /**
+   * Signals the consumer that a batch has been read or the background thread finished
+   */
+  std::condition_variable batchAvailable;
+
+  /**
+   * Signals the background thread that a batch has been taken from the queue or it has to stop
+   */
+  std::condition_variable slotAvailable;
+
+  /**
+   * Whether the background thread has to stop
+   */
+  bool stopRequested;
+
+  /**
+   * Whether the background thread finished, i.e., reached the end of the data or failed
+   */
+  bool finished;
+
+  /**
+   * Exception thrown by the fetch function on the background thread
+   */
+  std::exception_ptr exception;
+
+  /**
+   * Total time in seconds the consumer waited for batches
+   */
+  double stallTime;
+
+  /**
+   * Number of batches the consumer waited for
+   */
+  size_t numberOfStalls;
+
+  /**
+   * Background thread
+   */
+  std::thread worker;
+};
+
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -6,13 +6,14 @@
 #pragma once
 
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/StreamingDataParser.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
 // TODO(lettrich): allow different splitting techniques e.g. proportional splitting for
 // classification
-// TODO(lettrich): save memory by only storing the dataset if data is accessed in batches.
 namespace sgpp {
 namespace datadriven {
 
@@ -21,6 +22,11 @@ namespace datadriven {
  * object. Data can currently only be a file containing CSV data with the first line containing
  * column titles (is skipped).
  *
+ * If the samples are not shuffled (no or sequential shuffling), the input is not stored: each call
+ * of #getNextSamples parses only the requested batch with a
+ * #sgpp::datadriven::StreamingDataParser, so the learner can start working on the first batches
+ * before the whole file has been parsed. Otherwise, all samples are parsed (in parallel) and
+ * stored for the shuffled access.
  */
 class CSVFileSampleProvider : public FileSampleProvider {
  public:
@@ -61,7 +67,23 @@ class CSVFileSampleProvider : public FileSampleProvider {
                 std::vector<double> readinClasses = std::vector<double>()) override;
 
   /**
-   * Currently not implemented.
+   * Open an existing gzip or zstd compressed CSV file, it is decompressed while the samples are
+   * read. Throws if file can not be opened, decompressed or parsed.
+   * @param filePath Path to an existing file.
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readCompressedFile(const std::string &filePath,
+                          bool hasTargets,
+                          size_t readinCutoff = -1,
+                          std::vector<size_t> readinColumns = std::vector<size_t>(),
+                          std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Parse contents of a string containing information in CSV format (the first line contains the
+   * column titles and is skipped). Throws if string can not be parsed.
    * @param input string containing information in CSV file format
    * @param hasTargets whether the file has targest (i.e. supervised learning)
    * @param readinCutoff see FileSampleProvider.hpp
@@ -103,6 +125,25 @@ class CSVFileSampleProvider : public FileSampleProvider {
    * desired amount of samples (if available - else all remaining samples) and updates counter.
    */
   Dataset *splitDataset(size_t howMany);
+
+  /**
+   * Parser of the input if the samples are read in batches, nullptr if they are stored in
+   * dataset. Every clone has its own copy of the parser (sharing only the input, not the
+   * decompression state) and its own cursor.
+   */
+  std::shared_ptr<StreamingDataParser> parser;
+
+  /**
+   * Position of the sample that #getNextSamples returns next if the samples are read in batches.
+   */
+  StreamingDataParser::Cursor cursor;
+
+  /**
+   * Either keeps the parser for reading in batches or stores all samples in dataset, depending
+   * on the shuffling.
+   * @param newParser parser whose input has been set
+   */
+  void initialize(std::shared_ptr<StreamingDataParser> newParser);
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -20,7 +20,11 @@ namespace sgpp {
 namespace datadriven {
 
 DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp)
-    : config(conf), currentIteration(0), sampleProvider(std::unique_ptr<SampleProvider>(sp)) {
+    : config(conf),
+      currentIteration(0),
+      sampleProvider(std::unique_ptr<SampleProvider>(sp)),
+      readIteration(0),
+      prefetcher(nullptr) {
   // if a file name was specified, we are reading from a file, so we need to open it.
   if (!this->config.filePath.empty()) {
     std::cout << "Read file " << config.filePath << std::endl;
@@ -31,6 +35,12 @@ DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp)
   // Build data transformation
   DataTransformationBuilder dataTrBuilder;
   dataTransformation = dataTrBuilder.buildTransformation(conf.dataTransformationConfig);
+
+  // reading all samples at once yields a single batch, so there is nothing to read ahead
+  if (config.prefetchDepth > 0 && !(config.numBatches == 1 && config.batchSize == 0)) {
+    prefetcher = std::make_unique<BatchPrefetcher>([this]() { return readNextSamples(); },
+                                                   config.prefetchDepth);
+  }
 }
 
 DataSourceIterator DataSource::begin() { return DataSourceIterator(*this, 0); }
@@ -40,6 +50,8 @@ DataSourceIterator DataSource::end() { return DataSourceIterator(*this, config.n
 Dataset* DataSource::getAllSamples() {
   Dataset* dataset = nullptr;
 
+  stopPrefetching();
+
   sampleProvider->reset();
 
   dataset = sampleProvider->getAllSamples();
@@ -57,11 +69,20 @@ Dataset* DataSource::getAllSamples() {
 }
 
 Dataset* DataSource::getNextSamples() {
+  currentIteration++;
+  if (prefetcher != nullptr) {
+    return prefetcher->getNextSamples();
+  } else {
+    return readNextSamples();
+  }
+}
+
+Dataset* DataSource::readNextSamples() {
   Dataset* dataset = nullptr;
 
   // only one iteration: we want all samples
   if (config.numBatches == 1 && config.batchSize == 0) {
-    currentIteration++;
+    readIteration++;
     dataset = sampleProvider->getAllSamples();
 
     // Transform dataset if wanted
@@ -74,10 +95,10 @@ Dataset* DataSource::getNextSamples() {
     // several iterations
   } else {
     dataset = sampleProvider->getNextSamples(config.batchSize);
-    currentIteration++;
+    readIteration++;
 
     // If data transformation wanted and first batch -> initialize transformation
-    if (currentIteration == 1 &&
+    if (readIteration == 1 &&
         !(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
       dataTransformation->initialize(dataset, config.dataTransformationConfig);
       return dataTransformation->doTransformation(dataset);
@@ -95,5 +116,15 @@ const DataSourceConfig& DataSource::getConfig() const { return config; }
 
 size_t DataSource::getCurrentIteration() const { return currentIteration; }
 
+double DataSource::getPrefetchStallTime() const {
+  return (prefetcher != nullptr) ? prefetcher->getStallTime() : 0.0;
+}
+
+void DataSource::stopPrefetching() {
+  if (prefetcher != nullptr) {
+    prefetcher->stop();
+  }
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -5,12 +5,14 @@
 
 #pragma once
 
+#include <sgpp/datadriven/datamining/modules/dataSource/BatchPrefetcher.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceIterator.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformation.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#include <memory>
 #include <string>
 
 namespace sgpp {
@@ -42,7 +44,8 @@ class DataSource {
 
   /**
    * Request data from the underlying SampleProvider as specified in the provided configuration
-   * object upon construction.
+   * object upon construction. If prefetching is enabled (see DataSourceConfig::prefetchDepth), the
+   * batch has already been read and transformed on a background thread.
    * @return #sgpp::datadriven::Dataset containing requested amount of samples (if available).
    */
   virtual Dataset* getNextSamples();
@@ -76,6 +79,12 @@ class DataSource {
    */
   size_t getCurrentIteration() const;
 
+  /**
+   * Return how long the consumer had to wait for batches that were not prefetched yet.
+   * @return total waiting time in seconds, 0 if prefetching is disabled.
+   */
+  double getPrefetchStallTime() const;
+
   /**
    * Returns the data that is used for validation
    * @return pointer to the validation dataset
@@ -83,6 +92,19 @@ class DataSource {
   virtual Dataset *getValidationData() = 0;
 
  protected:
+  /**
+   * Read the next batch from the underlying SampleProvider and transform it if wanted. Runs on the
+   * background thread if prefetching is enabled.
+   * @return #sgpp::datadriven::Dataset containing requested amount of samples (if available).
+   */
+  Dataset* readNextSamples();
+
+  /**
+   * Stops prefetching and discards the prefetched batches. Has to be called before the state of
+   * the sample provider is changed outside of getNextSamples(), e.g., on reset.
+   */
+  void stopPrefetching();
+
   /**
    * Configuration file that determines all relevant properties of the object.
    */
@@ -102,6 +124,17 @@ class DataSource {
    * pointer to DataTransformation to perform transformations on init.
    */
   DataTransformation* dataTransformation;
+
+  /**
+   * number of batches read from the sample provider, ahead of currentIteration if prefetching.
+   */
+  size_t readIteration;
+
+  /**
+   * reads batches ahead on a background thread, nullptr if prefetching is disabled. Declared last,
+   * so the background thread is stopped before the other members are destroyed.
+   */
+  std::unique_ptr<BatchPrefetcher> prefetcher;
 };
 
 } /* namespace datadriven */
@@ -75,6 +75,12 @@ struct DataSourceConfig {
    * The number of epochs to train on
    */
   size_t epochs = 1;
+  /**
+   * How many batches are read and transformed ahead on a background thread while the current
+   * batch is processed - if 0, batches are read on request. Ignored if all samples are read at
+   * once (numBatches == 1 and batchSize == 0)
+   */
+  size_t prefetchDepth = 0;
   /**
    * After how many (valid) lines of the sourcefile to stop reading
    */
@@ -5,7 +5,10 @@
 
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/SharedDatasetSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorSequential.hpp>
 
+#include <memory>
 #include <vector>
 #include <iostream>
 
@@ -23,11 +26,33 @@ DataSourceCrossValidation::DataSourceCrossValidation(
         validationData{nullptr}, crossValidationConfig{crossValidationConfig}, shuffling(shuffling)
          { }
 
+DataSourceCrossValidation::DataSourceCrossValidation(
+    const DataSourceConfig& dataSourceConfig,
+    const CrossvalidationConfiguration& crossValidationConfig,
+    std::shared_ptr<const Dataset> samples, size_t foldIdx)
+    : DataSource{dataSourceConfig, nullptr}, validationData{nullptr},
+      crossValidationConfig{crossValidationConfig}, shuffling{nullptr},
+      foldBaseShuffling{new DataShufflingFunctorSequential()},
+      foldShuffling{new DataShufflingFunctorCrossValidation(crossValidationConfig,
+                                                            foldBaseShuffling.get())} {
+  // the samples are already shuffled, so the view only has to move its fold to the front
+  shuffling = foldShuffling.get();
+  shuffling->setFold(foldIdx);
+  sampleProvider.reset(new SharedDatasetSampleProvider(samples, shuffling));
+}
+
+DataSourceCrossValidation::~DataSourceCrossValidation() {
+  // the prefetching thread may use the shuffling of this view
+  stopPrefetching();
+  delete validationData;
+}
+
 Dataset* DataSourceCrossValidation::getValidationData() {
   return validationData;
 }
 
 void DataSourceCrossValidation::reset() {
+  stopPrefetching();
   sampleProvider->reset();
 
   // Retrieve validation data again
@@ -37,6 +62,7 @@ void DataSourceCrossValidation::reset() {
 }
 
 void DataSourceCrossValidation::setFold(size_t foldIdx) {
+  stopPrefetching();
   shuffling->setFold(foldIdx);
 }
 
@@ -45,6 +71,23 @@ const CrossvalidationConfiguration& DataSourceCrossValidation::getCrossValidatio
   return crossValidationConfig;
 }
 
+DataSourceCrossValidation* DataSourceCrossValidation::createFoldView(size_t foldIdx) {
+  if (sharedSamples == nullptr) {
+    stopPrefetching();
+    // for the first fold, the cross validation shuffling coincides with the chained shuffling,
+    // i.e., the samples are read in the shuffled order
+    shuffling->setFold(0);
+    sampleProvider->reset();
+    sharedSamples.reset(sampleProvider->getAllSamples());
+    sampleProvider->reset();
+  }
+
+  // the samples have already been read, the views must not read the file again
+  DataSourceConfig foldConfig = config;
+  foldConfig.filePath = "";
+  return new DataSourceCrossValidation(foldConfig, crossValidationConfig, sharedSamples, foldIdx);
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
 
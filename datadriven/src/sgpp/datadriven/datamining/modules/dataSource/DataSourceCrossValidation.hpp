@@ -9,6 +9,7 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSource.hpp>
 #include <sgpp/datadriven/configuration/CrossvalidationConfiguration.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace sgpp {
@@ -34,6 +35,11 @@ class DataSourceCrossValidation : public DataSource {
       DataShufflingFunctorCrossValidation* shuffling,
       SampleProvider* sampleProvider);
 
+  /**
+   * Destructor
+   */
+  ~DataSourceCrossValidation() override;
+
   /**
    * Returns the data that is used for validation, i.e. the current fold.d If all folds were already
    * iterated over, this method throws.
@@ -58,7 +64,29 @@ class DataSourceCrossValidation : public DataSource {
    */
   const CrossvalidationConfiguration& getCrossValidationConfig() const;
 
+  /**
+   * Creates a data source that provides the training and validation data of one fold. The views
+   * of all folds share the samples of this data source, which are read only once (on the first
+   * call), but each view keeps its own state (epoch, batch, validation data). Therefore, the
+   * views of different folds can be used concurrently, e.g., to train the folds in parallel.
+   * This method itself must not be called concurrently.
+   * @param foldIdx index of the fold
+   * @return data source of the fold, owned by the caller
+   */
+  DataSourceCrossValidation* createFoldView(size_t foldIdx);
+
  private:
+  /**
+   * Constructor for the views of single folds
+   * @param dataSourceConfig configuration of the data source (without file)
+   * @param crossValidationConfig configuration of the cross validation
+   * @param samples shuffled samples of all folds
+   * @param foldIdx index of the fold
+   */
+  DataSourceCrossValidation(const DataSourceConfig& dataSourceConfig,
+                            const CrossvalidationConfiguration& crossValidationConfig,
+                            std::shared_ptr<const Dataset> samples, size_t foldIdx);
+
   /**
    * Validation dataset
    */
@@ -71,6 +99,15 @@ class DataSourceCrossValidation : public DataSource {
    * Shuffling functor that is held by the sample provider.
    */
   DataShufflingFunctorCrossValidation* shuffling;
+  /**
+   * Shuffled samples shared by the views of the folds (read on the first call of createFoldView)
+   */
+  std::shared_ptr<const Dataset> sharedSamples;
+  /**
+   * Shuffling functors owned by the view of a fold
+   */
+  std::unique_ptr<DataShufflingFunctor> foldBaseShuffling;
+  std::unique_ptr<DataShufflingFunctorCrossValidation> foldShuffling;
 };
 
 } /* namespace datadriven */
@@ -47,6 +47,15 @@ void FileSampleDecorator::readFile(const std::string &fileName,
   fileSampleProvider->readFile(fileName, hasTargets, readinCutoff, readinColumns, readinClasses);
 }
 
+void FileSampleDecorator::readCompressedFile(const std::string &fileName,
+                                             bool hasTargets,
+                                             size_t readinCutoff,
+                                             std::vector<size_t> readinColumns,
+                                             std::vector<double> readinClasses) {
+  fileSampleProvider->readCompressedFile(fileName, hasTargets, readinCutoff, readinColumns,
+                                         readinClasses);
+}
+
 void FileSampleDecorator::readString(const std::string &input,
                                      bool hasTargets,
                                      size_t readinCutoff,
@@ -65,6 +65,20 @@ class FileSampleDecorator : public FileSampleProvider {
                 size_t readinCutoff = -1,
                 std::vector<size_t> readinColumns = std::vector<size_t>(),
                 std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Reads a compressed file's content
+   * @param fileName path to the file
+   * @param hasTargets whether the file has targets (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readCompressedFile(const std::string &fileName,
+                          bool hasTargets,
+                          size_t readinCutoff = -1,
+                          std::vector<size_t> readinColumns = std::vector<size_t>(),
+                          std::vector<double> readinClasses = std::vector<double>()) override;
   /**
    * Reads a file's content
    * @param input the file's content
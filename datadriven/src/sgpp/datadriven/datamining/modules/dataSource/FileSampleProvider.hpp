@@ -37,6 +37,24 @@ class FileSampleProvider : public SampleProvider {
                         std::vector<size_t> readinColumns = std::vector<size_t>(),
                         std::vector<double> readinClasses = std::vector<double>()) = 0;
 
+  /**
+   * Read the contents of a gzip or zstd compressed file. The file is decompressed block by block
+   * while the samples are read, so the decompressed contents are never held in memory as a whole.
+   * Has to throw an exception if the file can not be opened, decompressed or parsed.
+   * @param filePath valid path to an existing file.
+   * @param hasTargets whether the file has targets (i.e. supervised learning)
+   * @param readinCutoff data line number after which to stop reading. Default: MAX_UINT - 1
+   * @param readinColumns specifies a subset of columns (dimensions). Only these columns are read in
+   *        Order sensitive. Default: empty which means all columns are considered
+   * @param readinClasses specifies a subset of classes. Only data lines with one of these classes
+   *        is read in. Default: empty which means all classes are considered
+   */
+  virtual void readCompressedFile(const std::string &filePath,
+                                  bool hasTargets,
+                                  size_t readinCutoff = -1,
+                                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                                  std::vector<double> readinClasses = std::vector<double>()) = 0;
+
   /**
    * Read the contents of a string, for example a deflated archive. Has to throw an exception if
    * string can not be parsed. Results of parsing can be optained via
@@ -3,7 +3,7 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#ifdef ZLIB
+#if defined(ZLIB) || defined(ZSTD)
 #pragma once
 
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleDecorator.hpp>
@@ -14,10 +14,12 @@
 namespace sgpp {
 namespace datadriven {
 /**
- * Adds the ability to read gzip compressed files to file sample providers.
+ * Adds the ability to read gzip or zstd compressed files to file sample providers.
  *
- * This class wraps any valid #sgpp::datadriven::FileSampleProvider object and adds a decompression
- * step to the #readFile member function before trying to parse the contents of the file.
+ * This class wraps any valid #sgpp::datadriven::FileSampleProvider object and makes its #readFile
+ * member function decompress the file block by block while the samples are parsed (see
+ * #sgpp::datadriven::BlockDecompressor), so the decompressed contents are never held in memory as
+ * a whole. Gzip files require ZLIB, zstd files require ZSTD support.
  */
 class GzipFileSampleDecorator : public FileSampleDecorator {
  public:
@@ -31,8 +33,7 @@ class GzipFileSampleDecorator : public FileSampleDecorator {
   SampleProvider* clone() const override;
 
   /**
-   * Decompresses a .gz file and delegates the contents down to the
-   * sample provider.
+   * Reads a .gz or .zst file with the sample provider, which decompresses it while it parses it.
    * @param fileName path to the file
    * @param hasTargets whether the file has targets (i.e. supervised learning)
    * @param readinCutoff see FileSampleProvider.hpp
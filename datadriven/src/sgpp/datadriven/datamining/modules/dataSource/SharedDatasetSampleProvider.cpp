@@ -0,0 +1,63 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/SharedDatasetSampleProvider.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace sgpp {
+namespace datadriven {
+
+SharedDatasetSampleProvider::SharedDatasetSampleProvider(std::shared_ptr<const Dataset> dataset,
+                                                         DataShufflingFunctor* shuffling)
+    : dataset{dataset}, shuffling{shuffling}, counter{0} {
+  if (this->dataset == nullptr) {
+    throw base::data_exception("SharedDatasetSampleProvider: no dataset given.");
+  }
+}
+
+SampleProvider* SharedDatasetSampleProvider::clone() const {
+  return new SharedDatasetSampleProvider{*this};
+}
+
+Dataset* SharedDatasetSampleProvider::getNextSamples(size_t howMany) {
+  const size_t numSamples = dataset->getNumberInstances();
+  const size_t dim = dataset->getDimension();
+  const size_t size = std::min(howMany, numSamples - counter);
+  auto samples = std::make_unique<Dataset>(size, dim);
+
+  const double* srcData = dataset->getData().getPointer();
+  const base::DataVector& srcTargets = dataset->getTargets();
+  double* destData = samples->getData().getPointer();
+  base::DataVector& destTargets = samples->getTargets();
+
+  for (size_t i = 0; i < size; i++) {
+    const size_t srcIdx =
+        (shuffling != nullptr) ? (*shuffling)(counter + i, numSamples) : (counter + i);
+    std::copy(srcData + srcIdx * dim, srcData + (srcIdx + 1) * dim, destData + i * dim);
+    destTargets[i] = srcTargets[srcIdx];
+  }
+
+  counter += size;
+  return samples.release();
+}
+
+Dataset* SharedDatasetSampleProvider::getAllSamples() {
+  return getNextSamples(dataset->getNumberInstances());
+}
+
+size_t SharedDatasetSampleProvider::getDim() const { return dataset->getDimension(); }
+
+size_t SharedDatasetSampleProvider::getNumSamples() const {
+  return dataset->getNumberInstances();
+}
+
+void SharedDatasetSampleProvider::reset() { counter = 0; }
+
+} /* namespace datadriven */
+} /* namespace sgpp */
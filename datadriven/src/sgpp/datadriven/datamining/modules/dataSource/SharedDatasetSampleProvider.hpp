@@ -0,0 +1,70 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctor.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <memory>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * SharedDatasetSampleProvider provides the samples of a #sgpp::datadriven::Dataset that is already
+ * in memory and may be shared with other sample providers, e.g., one provider per fold of a cross
+ * validation. The samples are never modified, each provider only keeps its own position and
+ * shuffling, so providers on the same dataset can be used concurrently.
+ */
+class SharedDatasetSampleProvider : public SampleProvider {
+ public:
+  /**
+   * Constructor
+   * @param dataset dataset to provide the samples of
+   * @param shuffling functor to permute the sample indexes (nullptr for the identity); the
+   * functor is not owned by the provider and must only be used by this provider
+   */
+  explicit SharedDatasetSampleProvider(std::shared_ptr<const Dataset> dataset,
+                                       DataShufflingFunctor* shuffling = nullptr);
+
+  /**
+   * Clone Pattern to allow copying of derived classes. The clone shares the dataset and the
+   * shuffling functor.
+   * @return a Pointer to a new instance of #sgpp::datadriven::SharedDatasetSampleProvider with
+   * copied state. Caller owns the new object.
+   */
+  SampleProvider* clone() const override;
+
+  Dataset* getNextSamples(size_t howMany) override;
+
+  Dataset* getAllSamples() override;
+
+  size_t getDim() const override;
+
+  size_t getNumSamples() const override;
+
+  void reset() override;
+
+ private:
+  /**
+   * Dataset the samples are taken from
+   */
+  std::shared_ptr<const Dataset> dataset;
+
+  /**
+   * Functor to permute the sample indexes
+   */
+  DataShufflingFunctor* shuffling;
+
+  /**
+   * Number of samples already provided
+   */
+  size_t counter;
+};
+
+} /* namespace datadriven */
+} /* namespace sgpp */
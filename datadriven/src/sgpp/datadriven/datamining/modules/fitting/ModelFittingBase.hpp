@@ -80,12 +80,22 @@ class ModelFittingBase {
    */
   virtual ~ModelFittingBase() = default;
 
-  // TODO(lettrich): fix this as soon as all member variables are copyable.
+  // TODO(lettrich): copy the trained state as soon as all member variables are copyable.
+  /**
+   * Polymorphic clone pattern. As not all member variables can be copied yet, only the
+   * configuration is copied, i.e., the clone is in the state of this object after reset().
+   * @return untrained copy of this object. New object is owned by caller.
+   */
+  virtual ModelFittingBase* clone() const {
+    throw sgpp::base::not_implemented_exception("clone() not implemented in this fitter");
+  }
+
   /**
-   * Polymorphic clone pattern
-   * @return deep copy of this object. New object is owned by caller.
+   * Whether clone() is implemented by this fitter. Callers that work on clones, e.g. the
+   * concurrent folds of the cross validation, have to fall back to this object otherwise.
+   * @return true if clone() returns a new fitter, false if it throws
    */
-  // virtual ModelFittingBase* clone() const = 0;
+  virtual bool supportsClone() const { return false; }
 
   // TODO(lettrich): dataset should be const.
   /**
@@ -18,8 +18,12 @@
 #include <sgpp/datadriven/functors/classification/MultipleClassRefinementFunctor.hpp>
 #include <sgpp/datadriven/functors/classification/ZeroCrossingRefinementFunctor.hpp>
 
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+
+#include <algorithm>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include <limits>
@@ -37,6 +41,44 @@ using sgpp::datadriven::RefinementFunctorType;
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+
+/// number of samples that are evaluated at once by the fused prediction
+const size_t classificationTileSize = 1 << 14;
+
+/**
+ * Checks whether two grids have the same type, domain and grid points (in the same order), i.e.,
+ * whether they only differ in the surpluses.
+ */
+bool haveSameGridPoints(Grid& first, Grid& second) {
+  base::GridStorage& firstStorage = first.getStorage();
+  base::GridStorage& secondStorage = second.getStorage();
+
+  if ((first.getType() != second.getType()) || (first.getSize() != second.getSize()) ||
+      (firstStorage.getDimension() != secondStorage.getDimension())) {
+    return false;
+  }
+
+  for (size_t t = 0; t < firstStorage.getDimension(); t++) {
+    if ((firstStorage.getBoundingBox()->getIntervalOffset(t) !=
+         secondStorage.getBoundingBox()->getIntervalOffset(t)) ||
+        (firstStorage.getBoundingBox()->getIntervalWidth(t) !=
+         secondStorage.getBoundingBox()->getIntervalWidth(t))) {
+      return false;
+    }
+  }
+
+  for (size_t i = 0; i < firstStorage.getSize(); i++) {
+    if (!firstStorage[i].equals(secondStorage[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
 ModelFittingClassification::ModelFittingClassification(
     const FitterConfigurationClassification& config)
     : refinementsPerformed{0} {
@@ -116,6 +158,10 @@ void ModelFittingClassification::evaluate(DataMatrix& samples, DataVector& resul
   }
 #endif  // USE_SCALAPACK
 
+  if (evaluateFused(samples, results)) {
+    return;
+  }
+
   std::vector<double> priors = getClassPriors();
   std::vector<DataVector> classResults(models.size());
   for (auto& p : classIdx) {
@@ -139,6 +185,114 @@ void ModelFittingClassification::evaluate(DataMatrix& samples, DataVector& resul
   }
 }
 
+bool ModelFittingClassification::evaluateFused(DataMatrix& samples, DataVector& results) {
+  std::vector<double> priors = getClassPriors();
+  std::vector<double> labels;
+  std::vector<Grid*> grids;
+  std::vector<DataVector*> surpluses;
+  std::vector<double> factors;
+  std::vector<double> classPriors;
+
+  for (auto& p : classIdx) {
+    size_t idx = p.second;
+    double factor;
+
+    if (classNumberInstances[idx] == 0) {
+      // The model for this class was not trained -> no prediction possible for this model
+      continue;
+    } else if (!models[idx]->getEvaluationFactor(factor)) {
+      return false;
+    }
+
+    labels.push_back(p.first);
+    grids.push_back(&models[idx]->getGrid());
+    surpluses.push_back(&models[idx]->getSurpluses());
+    factors.push_back(factor);
+    classPriors.push_back(priors[idx]);
+  }
+
+  bool sharedGrid = true;
+
+  for (size_t c = 1; (c < grids.size()) && sharedGrid; c++) {
+    sharedGrid = haveSameGridPoints(*grids[0], *grids[c]);
+  }
+
+  // the samples are evaluated tile by tile, so only the values of the current tile are stored
+  // and the most probable class is updated after each class; the evaluation operations bind their
+  // data set at construction, so there is one operation per tile (and class without shared grid)
+  const size_t numSamples = samples.getNrows();
+  const size_t dim = samples.getNcols();
+  const size_t tileSize = std::min(numSamples, classificationTileSize);
+  DataMatrix sharedSurpluses;
+
+  if (sharedGrid && !grids.empty()) {
+    sharedSurpluses.resize(grids[0]->getSize(), grids.size());
+
+    for (size_t c = 0; c < grids.size(); c++) {
+      sharedSurpluses.setColumn(c, *surpluses[c]);
+    }
+  }
+
+  results.resize(numSamples);
+  results.setAll(0.0);
+  DataVector maxDensities(tileSize);
+  DataVector values(tileSize);
+  DataMatrix classValues;
+
+  for (size_t begin = 0; begin < numSamples; begin += tileSize) {
+    const size_t end = std::min(numSamples, begin + tileSize);
+    const size_t numTileSamples = end - begin;
+    DataMatrix tile;
+    DataMatrix* tileSamples = &samples;
+
+    if (numTileSamples < numSamples) {
+      tile.resize(numTileSamples, dim);
+      std::copy(samples.data() + begin * dim, samples.data() + end * dim, tile.data());
+      tileSamples = &tile;
+    }
+
+    maxDensities.resize(numTileSamples);
+    maxDensities.setAll(std::numeric_limits<double>::lowest());
+
+    // updates the most probable class of the samples of the tile with the densities of class c
+    auto updatePrediction = [&](size_t c, const DataVector& classDensities) {
+#pragma omp parallel for schedule(static)
+      for (size_t j = 0; j < numTileSamples; j++) {
+        const double density = classDensities[j] * factors[c] * classPriors[c];
+
+        if (maxDensities[j] < density) {
+          maxDensities[j] = density;
+          results[begin + j] = labels[c];
+        }
+      }
+    };
+
+    if (sharedGrid && !grids.empty()) {
+      // a single operation evaluates all classes in one pass, one coefficient vector per column
+      std::unique_ptr<base::OperationMultipleEval> op(
+          op_factory::createOperationMultipleEval(*grids[0], *tileSamples));
+      classValues.resize(numTileSamples, grids.size());
+      op->mult(sharedSurpluses, classValues);
+
+      for (size_t c = 0; c < grids.size(); c++) {
+        values.resize(numTileSamples);
+        classValues.getColumn(c, values);
+        updatePrediction(c, values);
+      }
+    } else {
+      for (size_t c = 0; c < grids.size(); c++) {
+        std::unique_ptr<base::OperationMultipleEval> op(
+            op_factory::createOperationMultipleEval(*grids[c], *tileSamples));
+        values.resize(numTileSamples);
+        op->eval(*surpluses[c], values);
+        updatePrediction(c, values);
+      }
+    }
+  }
+
+  return true;
+}
+
 std::vector<double> ModelFittingClassification::getClassPriors() const {
   auto& learnerConfig = this->config->getLearnerConfig();
   size_t numInstances = 0;
@@ -385,6 +539,16 @@ void ModelFittingClassification::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase* ModelFittingClassification::clone() const {
+  // the configuration is stored as density estimation configuration
+  FitterConfigurationClassification classificationConfig;
+  static_cast<FitterConfigurationDensityEstimation&>(classificationConfig) =
+      dynamic_cast<const FitterConfigurationDensityEstimation&>(*config);
+  auto clonedFitter = new ModelFittingClassification(classificationConfig);
+  clonedFitter->verboseSolver = verboseSolver;
+  return clonedFitter;
+}
+
 void ModelFittingClassification::storeClassificator() {
   std::cout << "Storing Classificator..." << std::endl;
 
@@ -74,6 +74,18 @@ class ModelFittingClassification : public ModelFittingBase {
    */
   void evaluate(DataMatrix& samples, DataVector& results) override;
 
+  /**
+   * Creates an untrained fitter with the same configuration
+   * @return new fitter object that is owned by the caller
+   */
+  ModelFittingBase* clone() const override;
+
+  /**
+   * This fitter can be cloned
+   * @return true
+   */
+  bool supportsClone() const override { return true; }
+
   /**
    * Resets the state of the entire model
    */
@@ -111,6 +123,19 @@ class ModelFittingClassification : public ModelFittingBase {
 
   std::vector<double> getClassPriors() const;
 
+  /**
+   * Predicts the classes for a set of data points by evaluating the sparse grid functions of all
+   * classes directly (without the models). The samples are processed in tiles: all classes are
+   * evaluated on a tile and the most probable class is updated after each of them, so only the
+   * values of one tile are kept instead of those of all samples and classes. If the grids of all
+   * classes consist of the same grid points, a single evaluation operation evaluates all classes
+   * in one pass over the tile, otherwise there is one operation and one pass per class.
+   * @param samples matrix where each row represents a data sample
+   * @param results vector to output the predicted classes
+   * @return false if a model cannot be evaluated this way (the results are not set then)
+   */
+  bool evaluateFused(DataMatrix& samples, DataVector& results);
+
   /**
    * Returns the refinement functor suitable for the model settings.
    * @param grids vector of pointers to grids for each class
@@ -60,6 +60,8 @@ RefinementFunctor *ModelFittingDensityEstimation::getRefinementFunctor() {
   return nullptr;
 }
 
+bool ModelFittingDensityEstimation::getEvaluationFactor(double& factor) { return false; }
+
 bool ModelFittingDensityEstimation::refine() {
   if (grid != nullptr && this->isRefinable()) {
     if (refinementsPerformed < config->getRefinementConfig().numRefinements_) {
@@ -73,6 +73,15 @@ class ModelFittingDensityEstimation : public ModelFittingBaseSingleGrid {
    */
   sgpp::base::RefinementFunctor* getRefinementFunctor();
 
+  /**
+   * Determines whether evaluating the model amounts to evaluating the sparse grid function given
+   * by the grid and the surpluses of the model and scaling the result. Such models can be
+   * evaluated together with other models, e.g., by ModelFittingClassification.
+   * @param factor the scaling factor is stored here
+   * @return whether the model can be evaluated this way
+   */
+  virtual bool getEvaluationFactor(double& factor);
+
  protected:
   /**
    * Count the amount of refinement operations performed on the current dataset.
@@ -51,6 +51,11 @@ void ModelFittingDensityEstimationCG::evaluate(DataMatrix& samples, DataVector&
   sgpp::op_factory::createOperationMultipleEval(*grid, samples)->eval(alpha, results);
 }
 
+bool ModelFittingDensityEstimationCG::getEvaluationFactor(double& factor) {
+  factor = 1.0;
+  return grid != nullptr;
+}
+
 void ModelFittingDensityEstimationCG::fit(Dataset& newDataset) {
   dataset = &newDataset;
   fit(newDataset.getData());
@@ -166,5 +171,12 @@ void ModelFittingDensityEstimationCG::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase* ModelFittingDensityEstimationCG::clone() const {
+  auto clonedFitter = new ModelFittingDensityEstimationCG(
+      dynamic_cast<const FitterConfigurationDensityEstimation&>(*config));
+  clonedFitter->verboseSolver = verboseSolver;
+  return clonedFitter;
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
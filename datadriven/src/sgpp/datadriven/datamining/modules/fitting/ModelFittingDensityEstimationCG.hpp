@@ -93,6 +93,20 @@ class ModelFittingDensityEstimationCG : public ModelFittingDensityEstimation {
    */
   void evaluate(DataMatrix& samples, DataVector& results) override;
 
+  bool getEvaluationFactor(double& factor) override;
+
+  /**
+   * Creates an untrained fitter with the same configuration
+   * @return new fitter object that is owned by the caller
+   */
+  ModelFittingBase* clone() const override;
+
+  /**
+   * This fitter can be cloned
+   * @return true
+   */
+  bool supportsClone() const override { return true; }
+
   /**
    * Resets the state of the entire model
    */
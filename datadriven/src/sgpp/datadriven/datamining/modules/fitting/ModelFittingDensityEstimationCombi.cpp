@@ -213,6 +213,14 @@ void ModelFittingDensityEstimationCombi::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase* ModelFittingDensityEstimationCombi::clone() const {
+  FitterConfigurationDensityEstimation densityEstimationConfig(
+      dynamic_cast<const FitterConfigurationDensityEstimation&>(*config));
+  auto clonedFitter = new ModelFittingDensityEstimationCombi(densityEstimationConfig);
+  clonedFitter->verboseSolver = verboseSolver;
+  return clonedFitter;
+}
+
 std::unique_ptr<ModelFittingDensityEstimation> ModelFittingDensityEstimationCombi::createNewModel(
     sgpp::datadriven::FitterConfigurationDensityEstimation& densityEstimationConfig) {
   switch (densityEstimationConfig.getDensityEstimationConfig().type_) {
@@ -89,6 +89,18 @@ class ModelFittingDensityEstimationCombi : public ModelFittingDensityEstimation
    */
   bool refine(size_t newNoPoints, std::list<size_t>* deletedGridPoints) override;
 
+  /**
+   * Creates an untrained fitter with the same configuration
+   * @return new fitter object that is owned by the caller
+   */
+  ModelFittingBase* clone() const override;
+
+  /**
+   * This fitter can be cloned
+   * @return true
+   */
+  bool supportsClone() const override { return true; }
+
   /**
    * Resets the state of the entire model
    */
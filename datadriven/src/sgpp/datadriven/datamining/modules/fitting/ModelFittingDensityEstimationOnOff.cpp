@@ -51,6 +51,17 @@ void ModelFittingDensityEstimationOnOff::evaluate(DataMatrix& samples, DataVecto
   online->eval(alpha, samples, results, *grid);
 }
 
+bool ModelFittingDensityEstimationOnOff::getEvaluationFactor(double& factor) {
+  // grids with interactions are evaluated by a different operation
+  if ((grid == nullptr) || (online == nullptr) || !online->isComputed() ||
+      !online->getOfflineObject().interactions.empty()) {
+    return false;
+  }
+
+  factor = online->getNormFactor();
+  return true;
+}
+
 void ModelFittingDensityEstimationOnOff::fit(Dataset& newDataset) {
   dataset = &newDataset;
   fit(newDataset.getData());
@@ -182,5 +193,12 @@ void ModelFittingDensityEstimationOnOff::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase* ModelFittingDensityEstimationOnOff::clone() const {
+  auto clonedFitter = new ModelFittingDensityEstimationOnOff(
+      dynamic_cast<const FitterConfigurationDensityEstimation&>(*config));
+  clonedFitter->verboseSolver = verboseSolver;
+  return clonedFitter;
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
@@ -93,6 +93,8 @@ class ModelFittingDensityEstimationOnOff : public ModelFittingDensityEstimation
    */
   void evaluate(DataMatrix& samples, DataVector& results) override;
 
+  bool getEvaluationFactor(double& factor) override;
+
   /**
    * Function that indicates whether a model is refinable at all (certain on/off settings do not
    * allow for refinement)
@@ -100,6 +102,18 @@ class ModelFittingDensityEstimationOnOff : public ModelFittingDensityEstimation
    */
   bool isRefinable() override;
 
+  /**
+   * Creates an untrained fitter with the same configuration
+   * @return new fitter object that is owned by the caller
+   */
+  ModelFittingBase* clone() const override;
+
+  /**
+   * This fitter can be cloned
+   * @return true
+   */
+  bool supportsClone() const override { return true; }
+
   /**
    * Resets the state of the entire model
    */
@@ -247,6 +247,14 @@ void ModelFittingDensityEstimationOnOffParallel::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase* ModelFittingDensityEstimationOnOffParallel::clone() const {
+  // the clone shares the process grid
+  auto clonedFitter = new ModelFittingDensityEstimationOnOffParallel(
+      dynamic_cast<const FitterConfigurationDensityEstimation&>(*config), processGrid);
+  clonedFitter->verboseSolver = verboseSolver;
+  return clonedFitter;
+}
+
 std::shared_ptr<BlacsProcessGrid> ModelFittingDensityEstimationOnOffParallel::getProcessGrid()
     const {
   return processGrid;
@@ -116,6 +116,18 @@ class ModelFittingDensityEstimationOnOffParallel : public ModelFittingDensityEst
    */
   bool isRefinable() override;
 
+  /**
+   * Creates an untrained fitter with the same configuration
+   * @return new fitter object that is owned by the caller
+   */
+  ModelFittingBase* clone() const override;
+
+  /**
+   * This fitter can be cloned
+   * @return true
+   */
+  bool supportsClone() const override { return true; }
+
   /**
    * Resets the state of the entire model
    */
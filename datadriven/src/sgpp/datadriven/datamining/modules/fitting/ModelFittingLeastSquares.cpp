@@ -123,6 +123,13 @@ void ModelFittingLeastSquares::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase *ModelFittingLeastSquares::clone() const {
+  auto clonedFitter =
+      new ModelFittingLeastSquares(dynamic_cast<const FitterConfigurationLeastSquares &>(*config));
+  clonedFitter->verboseSolver = verboseSolver;
+  return clonedFitter;
+}
+
 void ModelFittingLeastSquares::assembleSystemAndSolve(const SLESolverConfiguration &solverConfig,
                                                       DataVector &alpha) const {
   auto systemMatrix = std::unique_ptr<DMSystemMatrixBase>(
@@ -4,9 +4,12 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/tools/Printer.hpp>
+#include <sgpp/base/tools/RandomNumberGenerator.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/BoHyperparameterOptimizer.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/bo/BayesianOptimization.hpp>
 
+#include <algorithm>
+#include <iomanip>
 #include <vector>
 #include <string>
 #include <limits>
@@ -20,6 +23,12 @@ BoHyperparameterOptimizer::BoHyperparameterOptimizer(SparseGridMiner* miner,
         : HyperparameterOptimizer(miner, fitterFactory, parser) {
 }
 
+BoHyperparameterOptimizer::BoHyperparameterOptimizer(
+    const std::vector<SparseGridMiner *> &miners, FitterFactory *fitterFactory,
+    DataMiningConfigParser &parser)
+    : HyperparameterOptimizer(miners, fitterFactory, parser) {
+}
+
 double BoHyperparameterOptimizer::run(bool writeToFile) {
   // mute auxiliary optimizers
   base::Printer::getInstance().disableStatusPrinting();
@@ -33,6 +42,8 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
   // output initialization
   std::ofstream myfile;
   std::stringstream fn;
+  // the scores are written with full precision, a resumed run reuses them exactly
+  myfile << std::setprecision(std::numeric_limits<double>::max_digits10);
 
   if (writeToFile) {
     time_t now = time(nullptr);
@@ -55,34 +66,48 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
 
 
 
+  // number of configurations that are evaluated at once
+  const size_t batchSize =
+      static_cast<size_t>(std::max(config.getParallelTrials(), static_cast<int64_t>(1)));
+
+  // seed the auxiliary optimizers, so that an interrupted run proposes the same samples again
+  base::RandomNumberGenerator::getInstance().setSeed(
+      static_cast<base::RandomNumberGenerator::SeedType>(config.getSeed()));
+
   // list/vector of configs, start setup
   std::vector<BOConfig> initialConfigs{};
-  initialConfigs.reserve(static_cast<size_t>(config.getNRandom()));
+  const size_t nRandom = static_cast<size_t>(config.getNRandom());
+  initialConfigs.reserve(nRandom);
   std::mt19937 generator(static_cast<size_t>(config.getSeed()));
 
-  // random warmup phase
-  for (int i = 0; i < config.getNRandom(); ++i) {
+  // random warmup phase, all random samples are independent of each other
+  std::vector<ModelFittingBase *> fitters(nRandom);
+  std::vector<std::string> configStrings(nRandom);
+  for (size_t i = 0; i < nRandom; ++i) {
     initialConfigs.emplace_back(prototype);
     initialConfigs[i].randomize(generator);
     fitterFactory->setBO(initialConfigs[i]);
-    std::string configString = fitterFactory->printConfig();
-    // std::unique_ptr<ModelFittingBase> fitter(fitterFactory->buildFitter());
-    miner->setModel(fitterFactory->buildFitter());
-    double result = miner->learn(false);
-    // hpoScorer->calculateScore(*fitter, *trainData, &stdDeviation);
+    configStrings[i] = fitterFactory->printConfig();
+    fitters[i] = fitterFactory->buildFitter();
+  }
+  DataVector results(nRandom);
+  evaluateFitters(fitters, configStrings, 1, results);
+
+  for (size_t i = 0; i < nRandom; ++i) {
+    double result = results[i];
     initialConfigs[i].setScore(transformScore(result));
-    std::cout << (i + 1) << configString << ", " << result;
+    std::cout << (i + 1) << configStrings[i] << ", " << result;
     if (writeToFile) {
       myfile.open(fn.str(), std::ios_base::app);
       if (myfile.is_open()) {
-        myfile << (i + 1) << configString << ", " << result << std::endl;
+        myfile << (i + 1) << configStrings[i] << ", " << result << std::endl;
       }
       myfile.close();
     }
     if (result < best) {
       best = result;
-      bestscnt = i + 1;
-      bestconfigstring = configString;
+      bestscnt = static_cast<int>(i + 1);
+      bestconfigstring = configStrings[i];
       std::cout << " new best!";
     }
     std::cout << std::endl;
@@ -94,31 +119,42 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
   bo.setScales(bo.fitScales(), 0.7);
 
 
-  // main loop
-  for (int q = 0; q < config.getNRuns(); q++) {
-    BOConfig nextConfig = bo.main(prototype);
-    fitterFactory->setBO(nextConfig);
-    std::string configString = fitterFactory->printConfig();
-    miner->setModel(fitterFactory->buildFitter());
-    double result = miner->learn(false);
-    nextConfig.setScore(transformScore(result));
-    bo.updateGP(nextConfig, true);
-    bo.setScales(bo.fitScales(), 0.1);
-    std::cout << (q + config.getNRandom() + 1) << configString << ", " << result;
-    if (writeToFile) {
-      myfile.open(fn.str(), std::ios_base::app);
-      if (myfile.is_open()) {
-        myfile << (q + config.getNRandom() + 1) << configString << ", " << result << std::endl;
-      }
-      myfile.close();
+  // main loop, batchSize samples are proposed and evaluated at once
+  const size_t nRuns = static_cast<size_t>(config.getNRuns());
+  for (size_t q = 0; q < nRuns; q += batchSize) {
+    std::vector<BOConfig> nextConfigs = bo.proposeBatch(prototype, std::min(batchSize, nRuns - q));
+    fitters.resize(nextConfigs.size());
+    configStrings.resize(nextConfigs.size());
+    for (size_t k = 0; k < nextConfigs.size(); k++) {
+      fitterFactory->setBO(nextConfigs[k]);
+      configStrings[k] = fitterFactory->printConfig();
+      fitters[k] = fitterFactory->buildFitter();
     }
-    if (result < best) {
-      best = result;
-      bestscnt = static_cast<int>(q + config.getNRandom() + 1);
-      bestconfigstring = configString;
-      std::cout << " new best!";
+    results.resize(nextConfigs.size());
+    evaluateFitters(fitters, configStrings, q + nRandom + 1, results);
+
+    for (size_t k = 0; k < nextConfigs.size(); k++) {
+      const size_t sampleNo = q + k + nRandom + 1;
+      double result = results[k];
+      nextConfigs[k].setScore(transformScore(result));
+      bo.updateGP(nextConfigs[k], true);
+      std::cout << sampleNo << configStrings[k] << ", " << result;
+      if (writeToFile) {
+        myfile.open(fn.str(), std::ios_base::app);
+        if (myfile.is_open()) {
+          myfile << sampleNo << configStrings[k] << ", " << result << std::endl;
+        }
+        myfile.close();
+      }
+      if (result < best) {
+        best = result;
+        bestscnt = static_cast<int>(sampleNo);
+        bestconfigstring = configStrings[k];
+        std::cout << " new best!";
+      }
+      std::cout << std::endl;
     }
-    std::cout << std::endl;
+    bo.setScales(bo.fitScales(), 0.1);
   }
   if (writeToFile) {
     myfile.open(fn.str(), std::ios_base::app);
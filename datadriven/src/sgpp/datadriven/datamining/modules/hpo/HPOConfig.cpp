@@ -5,6 +5,7 @@
 
 #include <sgpp/datadriven/datamining/modules/hpo/HPOConfig.hpp>
 
+#include <string>
 #include <vector>
 
 
@@ -18,6 +19,8 @@ void HPOConfig::setupDefaults() {
   constraints = {2, 2};
   lambda = 1;
   nRandom = 10;
+  parallelTrials = 1;
+  resumeFile = "";
 }
 
 int64_t HPOConfig::getSeed() const {
@@ -75,5 +78,20 @@ int64_t HPOConfig::getNTrainSamples() const {
 void HPOConfig::setNTrainSamples(int64_t nTrainSamples) {
   HPOConfig::nTrainSamples = nTrainSamples;
 }
+int64_t HPOConfig::getParallelTrials() const {
+  return parallelTrials;
+}
+
+void HPOConfig::setParallelTrials(int64_t parallelTrials) {
+  HPOConfig::parallelTrials = parallelTrials;
+}
+
+const std::string &HPOConfig::getResumeFile() const {
+  return resumeFile;
+}
+
+void HPOConfig::setResumeFile(const std::string &resumeFile) {
+  HPOConfig::resumeFile = resumeFile;
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <vector>
 
 namespace sgpp {
@@ -48,6 +49,14 @@ class HPOConfig {
 
   void setNTrainSamples(int64_t nTrainSamples);
 
+  int64_t getParallelTrials() const;
+
+  void setParallelTrials(int64_t parallelTrials);
+
+  const std::string &getResumeFile() const;
+
+  void setResumeFile(const std::string &resumeFile);
+
  private:
   /**
    * Seed for random sampling in both harmonica and bayesian optimization
@@ -77,6 +86,14 @@ class HPOConfig {
    * number of samples bayesian optimization is run for
    */
   int64_t nRuns;
+  /**
+   * Number of configurations that are evaluated at once (batch size of bayesian optimization)
+   */
+  int64_t parallelTrials;
+  /**
+   * Results file of an interrupted run, the scores of its samples are reused
+   */
+  std::string resumeFile;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -7,6 +7,7 @@
 
 #include <sgpp/datadriven/datamining/modules/hpo/harmonica/Harmonica.hpp>
 
+#include <iomanip>
 #include <vector>
 #include <string>
 #include <limits>
@@ -20,6 +21,12 @@ HarmonicaHyperparameterOptimizer::HarmonicaHyperparameterOptimizer(SparseGridMin
         : HyperparameterOptimizer(miner, fitterFactory, parser) {
 }
 
+HarmonicaHyperparameterOptimizer::HarmonicaHyperparameterOptimizer(
+    const std::vector<SparseGridMiner *> &miners, FitterFactory *fitterFactory,
+    DataMiningConfigParser &parser)
+    : HyperparameterOptimizer(miners, fitterFactory, parser) {
+}
+
 
 double HarmonicaHyperparameterOptimizer::run(bool writeToFile) {
   Harmonica harmonica{fitterFactory.get()};
@@ -31,6 +38,8 @@ double HarmonicaHyperparameterOptimizer::run(bool writeToFile) {
   // output initialization
   std::ofstream myfile;
   std::stringstream fn;
+  // the scores are written with full precision, a resumed run reuses them exactly
+  myfile << std::setprecision(std::numeric_limits<double>::max_digits10);
 
   if (writeToFile) {
     time_t now = time(nullptr);
@@ -60,11 +69,10 @@ double HarmonicaHyperparameterOptimizer::run(bool writeToFile) {
     std::vector<std::string> configStrings(nRuns);
     harmonica.prepareConfigs(fitters, static_cast<int>(config.getSeed()), configStrings);
 
-    // run samples (parallelize here)
+    // run samples, the samples of a stage are independent of each other
+    evaluateFitters(fitters, configStrings, static_cast<size_t>(scnt), scores);
+
     for (size_t i = 0; i < nRuns; i++) {
-      miner->setModel(fitters[i]);
-      scores[i] = miner->learn(false);
-      // hpoScorer->calculateScore(*(fitters[i]), *trainData, &stdDeviation);
       std::cout << scnt << configStrings[i] << ", " << scores[i];
       if (scores[i] < best) {
         best = scores[i];
@@ -12,6 +12,7 @@
 #include <sgpp/datadriven/datamining/modules/hpo/HyperparameterOptimizer.hpp>
 
 #include <memory>
+#include <vector>
 
 
 namespace sgpp {
@@ -35,6 +36,19 @@ class HarmonicaHyperparameterOptimizer : public HyperparameterOptimizer{
                           FitterFactory *fitterFactory,
                           DataMiningConfigParser &parser);
 
+  /**
+   * Constructor for evaluating several configurations concurrently
+   * @param miners configured instances of SGMiner objects, one per concurrently evaluated
+   * configuration. The HyperparameterOptimizer instance will take ownership of the passed objects.
+   * @param fitterFactory configured instance of factory object that provides fitters with
+   * manipulated hyperparameters. The HyperparameterOptimizer instance will take ownership of the
+   * passed object.
+   * @param parser reference to parser object to read configuration info
+   */
+  HarmonicaHyperparameterOptimizer(const std::vector<SparseGridMiner *> &miners,
+                          FitterFactory *fitterFactory,
+                          DataMiningConfigParser &parser);
+
   /**
    * Copy constructor deleted - not all members can be copied or cloned .
    * @param rhs the object to copy from
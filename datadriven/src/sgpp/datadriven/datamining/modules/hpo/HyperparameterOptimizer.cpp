@@ -5,10 +5,22 @@
 
 #include <sgpp/datadriven/datamining/modules/hpo/HyperparameterOptimizer.hpp>
 
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
+#include <algorithm>
+#include <cctype>
+#include <exception>
+#include <fstream>
+#include <iostream>
 #include <vector>
 #include <string>
 #include <limits>
+#include <stdexcept>
 
 namespace sgpp {
 namespace datadriven {
@@ -16,9 +28,132 @@ namespace datadriven {
 HyperparameterOptimizer::HyperparameterOptimizer(SparseGridMiner* miner,
                                                  FitterFactory *fitterFactory,
                                                  DataMiningConfigParser &parser)
-    : miner(miner), fitterFactory(fitterFactory) {
+    : HyperparameterOptimizer(std::vector<SparseGridMiner *>{miner}, fitterFactory, parser) {
+}
+
+HyperparameterOptimizer::HyperparameterOptimizer(const std::vector<SparseGridMiner *> &miners,
+                                                 FitterFactory *fitterFactory,
+                                                 DataMiningConfigParser &parser)
+    : fitterFactory(fitterFactory) {
+  for (auto miner : miners) {
+    this->miners.emplace_back(miner);
+  }
+  if (this->miners.empty()) {
+    throw base::data_exception("HyperparameterOptimizer: at least one miner is required.");
+  }
   config.setupDefaults();
   parser.getHPOConfig(config);
+  readPreviousResults();
+}
+
+void HyperparameterOptimizer::evaluateFitters(std::vector<ModelFittingBase *> &fitters,
+                                              const std::vector<std::string> &configStrings,
+                                              size_t firstSampleNo, DataVector &scores) {
+  // reuse the scores of the run to resume from
+  std::vector<size_t> pending;
+  for (size_t i = 0; i < fitters.size(); i++) {
+    auto previous = previousResults.find(firstSampleNo + i);
+    if (previous != previousResults.end() && previous->second.first == configStrings[i]) {
+      scores[i] = previous->second.second;
+      delete fitters[i];
+      fitters[i] = nullptr;
+    } else {
+      pending.push_back(i);
+    }
+  }
+
+  const size_t concurrentTrials = std::min(miners.size(), pending.size());
+
+  if (concurrentTrials <= 1) {
+    for (size_t i : pending) {
+      miners.front()->setModel(fitters[i]);
+      scores[i] = miners.front()->learn(false);
+    }
+    return;
+  }
+
+#ifdef _OPENMP
+  // split the threads evenly between the concurrent trials
+  const size_t numThreads = static_cast<size_t>(omp_get_max_threads());
+  const size_t threadsPerTrial = std::max(numThreads / concurrentTrials, static_cast<size_t>(1));
+  const size_t remainingThreads =
+      (numThreads > concurrentTrials) ? (numThreads % concurrentTrials) : 0;
+  const int maxActiveLevels = omp_get_max_active_levels();
+
+  if (threadsPerTrial > 1) {
+    omp_set_max_active_levels(std::max(maxActiveLevels, omp_get_level() + 2));
+  }
+#endif /* _OPENMP */
+
+  std::exception_ptr exception;
+
+#pragma omp parallel num_threads(static_cast<int>(concurrentTrials))
+  {
+    size_t threadIdx = 0;
+#ifdef _OPENMP
+    threadIdx = static_cast<size_t>(omp_get_thread_num());
+    omp_set_num_threads(
+        static_cast<int>(threadsPerTrial + ((threadIdx < remainingThreads) ? 1 : 0)));
+#endif /* _OPENMP */
+    // each thread evaluates its trials with its own miner
+    SparseGridMiner &miner = *miners[threadIdx];
+
+#pragma omp for schedule(dynamic)
+    for (size_t k = 0; k < pending.size(); k++) {
+      const size_t i = pending[k];
+      try {
+        miner.setModel(fitters[i]);
+        scores[i] = miner.learn(false);
+      } catch (...) {
+#pragma omp critical(HyperparameterOptimizerException)
+        exception = std::current_exception();
+      }
+    }
+  }
+
+#ifdef _OPENMP
+  omp_set_max_active_levels(maxActiveLevels);
+#endif /* _OPENMP */
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void HyperparameterOptimizer::readPreviousResults() {
+  if (config.getResumeFile().empty()) {
+    return;
+  }
+
+  std::ifstream file(config.getResumeFile());
+  if (!file.is_open()) {
+    throw base::file_exception("HyperparameterOptimizer: failed to open the results file to resume "
+                               "from.");
+  }
+
+  // results are written as "<sample number><configuration string>, <score>", all other lines
+  // (headline, summary of the best result) are skipped
+  std::string line;
+  while (std::getline(file, line)) {
+    const size_t configStart = line.find(',');
+    const size_t scoreStart = line.rfind(", ");
+    if (configStart == 0 || configStart == std::string::npos ||
+        !std::all_of(line.begin(), line.begin() + static_cast<std::ptrdiff_t>(configStart),
+                     [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; })) {
+      continue;
+    }
+    try {
+      const size_t sampleNo = std::stoul(line.substr(0, configStart));
+      const double score = std::stod(line.substr(scoreStart + 2));
+      previousResults.emplace(
+          sampleNo, std::make_pair(line.substr(configStart, scoreStart - configStart), score));
+    } catch (const std::logic_error &) {
+      continue;
+    }
+  }
+
+  std::cout << "Resuming from '" << config.getResumeFile() << "' with " << previousResults.size()
+            << " evaluated samples." << std::endl;
 }
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -11,7 +11,11 @@
 #include <sgpp/datadriven/datamining/modules/hpo/FitterFactory.hpp>
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 
+#include <map>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -35,6 +39,21 @@ class HyperparameterOptimizer {
                           FitterFactory *fitterFactory,
                           DataMiningConfigParser &parser);
 
+  /**
+   * Constructor for evaluating several configurations concurrently
+   * @param miners configured instances of SGMiner objects, that will provide the learning
+   * process. One configuration is evaluated per miner at a time, so the number of miners limits
+   * the number of concurrent evaluations. The HyperparameterOptimizer instance will take ownership
+   * of the passed objects.
+   * @param fitterFactory configured instance of factory object that provides fitters with
+   * manipulated hyperparameters. The HyperparameterOptimizer instance will take ownership
+   * of the passed object.
+   * @param parser reference to parser object to read configuration info
+   */
+  HyperparameterOptimizer(const std::vector<SparseGridMiner *> &miners,
+                          FitterFactory *fitterFactory,
+                          DataMiningConfigParser &parser);
+
   /**
    * Copy constructor deleted - not all members can be copied or cloned .
    * @param rhs the object to copy from
@@ -72,9 +91,23 @@ class HyperparameterOptimizer {
 
  protected:
   /**
-   * Miner providing all testing facilities
+   * Evaluates the given fitters, one fitter per sample. If the results file of an earlier run
+   * contains a sample with the same number and configuration, its score is reused instead. The
+   * remaining samples are evaluated concurrently, as many at once as there are miners; the
+   * available threads are split evenly between them.
+   * @param fitters fitters to evaluate, ownership is taken over
+   * @param configStrings configurations of the fitters in string form
+   * @param firstSampleNo number of the sample of the first fitter
+   * @param scores container to store the scores of the fitters
    */
-  std::unique_ptr<SparseGridMiner> miner;
+  void evaluateFitters(std::vector<ModelFittingBase *> &fitters,
+                       const std::vector<std::string> &configStrings, size_t firstSampleNo,
+                       DataVector &scores);
+
+  /**
+   * Miners providing all testing facilities, the first one is used for sequential evaluations
+   */
+  std::vector<std::unique_ptr<SparseGridMiner>> miners;
 
   /**
    * FitterFactory to provide fitters for running different hyperparameter configurations.
@@ -85,6 +118,17 @@ class HyperparameterOptimizer {
    * Configuration for all hpo details.
    */
   HPOConfig config;
+
+ private:
+  /**
+   * Reads the results of the run to resume from (see HPOConfig::getResumeFile()).
+   */
+  void readPreviousResults();
+
+  /**
+   * Configuration strings and scores of the run to resume from, by sample number
+   */
+  std::map<size_t, std::pair<std::string, double>> previousResults;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
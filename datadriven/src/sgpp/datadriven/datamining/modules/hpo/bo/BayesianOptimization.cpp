@@ -101,6 +101,30 @@ BOConfig BayesianOptimization::main(BOConfig &prototype) {
   return bestConfig;
 }
 
+std::vector<BOConfig> BayesianOptimization::proposeBatch(BOConfig &prototype, size_t batchSize) {
+  std::vector<BOConfig> batch;
+  batch.reserve(batchSize);
+  if (batchSize == 0) {
+    return batch;
+  }
+  batch.push_back(main(prototype));
+  if (batchSize > 1) {
+    // the lie is the best (lowest) score evaluated so far
+    double lie = std::numeric_limits<double>::infinity();
+    for (auto &config : allConfigs) {
+      lie = std::fmin(lie, config.getScore());
+    }
+    BayesianOptimization fantasy(*this);
+    for (size_t i = 1; i < batchSize; i++) {
+      BOConfig pending(batch.back());
+      pending.setScore(lie);
+      fantasy.updateGP(pending, true);
+      batch.push_back(fantasy.main(prototype));
+    }
+  }
+  return batch;
+}
+
 double BayesianOptimization::acquisitionOuter(const base::DataVector &inp) {
   base::DataVector kernelrow(allConfigs.size());
   for (size_t i = 0; i < allConfigs.size(); i++) {
@@ -65,6 +65,16 @@ class BayesianOptimization {
    */
   BOConfig main(BOConfig &prototype);
 
+  /**
+   * Find several new sample points to be evaluated at once (constant liar heuristic). After each
+   * proposal, the Gaussian Process is updated as if the proposed sample had the best score so
+   * far, which steers the following proposals away from it. This object is not modified.
+   * @param prototype baseline BOConfig
+   * @param batchSize number of sample points to propose
+   * @return new sample points
+   */
+  std::vector<BOConfig> proposeBatch(BOConfig &prototype, size_t batchSize);
+
 
   /**
    * kernel function
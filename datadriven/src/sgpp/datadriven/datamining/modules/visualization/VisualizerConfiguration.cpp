@@ -45,6 +45,10 @@ VisualizationGeneralConfig &VisualizerConfiguration::getGeneralConfig() {
   return generalConfig;
 }
 
+const VisualizationGeneralConfig &VisualizerConfiguration::getGeneralConfig() const {
+  return generalConfig;
+}
+
 VisualizationParameters &VisualizerConfiguration::getVisualizationParameters() {
   return visualizationParameters;
 }
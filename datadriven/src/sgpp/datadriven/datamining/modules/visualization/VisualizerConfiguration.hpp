@@ -42,6 +42,11 @@ class VisualizerConfiguration{
    */
   VisualizationGeneralConfig &getGeneralConfig();
 
+  /**
+   * read general configuration parameters
+   */
+  const VisualizationGeneralConfig &getGeneralConfig() const;
+
   /**
    * read general configuration parameters
    */
@@ -0,0 +1,220 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/KernelAutotuner.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/**
+ * Kernel name, instruction set, number of candidates, candidate set hash, dimension,
+ * rounded number of grid and data points
+ */
+typedef std::tuple<std::string, int, size_t, size_t, size_t, size_t, size_t> TuningKey;
+
+const size_t numRepetitions = 3;
+
+// candidate block sizes of the non-AVX-512 Streaming kernels
+const size_t streamingChunkDataPointsCandidates[] = {24, 48, 96};
+const size_t streamingChunkGridPointsCandidates[] = {12, 24, 48};
+const size_t streamingDefaultChunkGridPoints = 12;
+
+std::mutex cacheMutex;
+std::map<TuningKey, size_t> cache;
+
+bool isEnabledByEnvironment() {
+  const char* value = std::getenv("SGPP_KERNEL_AUTOTUNE");
+  return (value == nullptr) || (std::string(value) != "0");
+}
+
+std::atomic<bool> autotuningEnabled(isEnabledByEnvironment());
+
+size_t roundUpToPowerOfTwo(size_t n) {
+  size_t result = 1;
+
+  while (result < n) {
+    result <<= 1;
+  }
+
+  return result;
+}
+
+void hashCombine(size_t& seed, size_t value) {
+  seed ^= std::hash<size_t>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+}  // namespace
+
+size_t KernelAutotuner::tune(const std::string& kernelName, KernelISA isa, size_t gridSize,
+                             size_t dim, size_t dataSize, size_t numCandidates,
+                             size_t defaultCandidate,
+                             const std::function<void(size_t)>& benchmark,
+                             size_t candidateSetHash) {
+  if (defaultCandidate >= numCandidates) {
+    throw base::operation_exception("KernelAutotuner: default candidate out of range");
+  }
+
+  if (!autotuningEnabled || (numCandidates <= 1)) {
+    return defaultCandidate;
+  }
+
+  TuningKey key(kernelName, static_cast<int>(isa), numCandidates, candidateSetHash, dim,
+                roundUpToPowerOfTwo(gridSize), roundUpToPowerOfTwo(dataSize));
+
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = cache.find(key);
+
+    if ((it != cache.end()) && (it->second < numCandidates)) {
+      return it->second;
+    }
+  }
+
+  base::SGppStopwatch stopwatch;
+  size_t bestCandidate = defaultCandidate;
+  double bestTime = std::numeric_limits<double>::infinity();
+
+  for (size_t candidate = 0; candidate < numCandidates; candidate++) {
+    double time = std::numeric_limits<double>::infinity();
+
+    for (size_t i = 0; i < numRepetitions; i++) {
+      stopwatch.start();
+      benchmark(candidate);
+      time = std::min(time, stopwatch.stop());
+    }
+
+    if (time < bestTime) {
+      bestTime = time;
+      bestCandidate = candidate;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  cache[key] = bestCandidate;
+  return bestCandidate;
+}
+
+KernelAutotuner::StreamingConfiguration KernelAutotuner::tuneStreaming(
+    const std::string& kernelName, const std::vector<StreamingConfiguration>& configurations,
+    size_t gridSize, size_t dim, size_t dataSize,
+    const std::function<void(const StreamingConfiguration&)>& benchmark) {
+  if (configurations.empty()) {
+    throw base::operation_exception("KernelAutotuner: no candidate configurations");
+  }
+
+  // the candidate set differs, e.g., if the instruction set of the kernel is fixed
+  size_t candidateSetHash = 0;
+
+  for (const StreamingConfiguration& configuration : configurations) {
+    hashCombine(candidateSetHash, static_cast<size_t>(configuration.isa));
+    hashCombine(candidateSetHash, configuration.chunkDataPoints);
+    hashCombine(candidateSetHash, configuration.chunkGridPoints);
+  }
+
+  size_t bestConfiguration =
+      tune(kernelName, configurations.front().isa, gridSize, dim, dataSize, configurations.size(),
+           0, [&](size_t i) { benchmark(configurations[i]); }, candidateSetHash);
+
+  if (bestConfiguration >= configurations.size()) {
+    throw base::operation_exception("KernelAutotuner: tuned configuration out of range");
+  }
+
+  return configurations[bestConfiguration];
+}
+
+std::vector<KernelAutotuner::StreamingConfiguration> KernelAutotuner::getStreamingConfigurations(
+    KernelISA isa, bool hasFixedISA, size_t avx512ChunkDataPoints) {
+  std::vector<KernelISA> isas = {isa};
+
+  if (!hasFixedISA) {
+    std::vector<KernelISA> availableISAs = KernelDispatch::getAvailableISAs();
+
+    if ((availableISAs.size() > 1) && (availableISAs[1] != KernelISA::Scalar)) {
+      isas.push_back(availableISAs[1]);
+    }
+  }
+
+  // the first configuration is the default one
+  std::vector<StreamingConfiguration> configurations;
+
+  for (KernelISA candidateISA : isas) {
+    // the AVX-512 kernels always process avx512ChunkDataPoints data points
+    if (candidateISA == KernelISA::AVX512) {
+      configurations.push_back(
+          {candidateISA, avx512ChunkDataPoints, streamingDefaultChunkGridPoints});
+      continue;
+    }
+
+    for (size_t candidateChunkDataPoints : streamingChunkDataPointsCandidates) {
+      for (size_t candidateChunkGridPoints : streamingChunkGridPointsCandidates) {
+        configurations.push_back(
+            {candidateISA, candidateChunkDataPoints, candidateChunkGridPoints});
+      }
+    }
+  }
+
+  return configurations;
+}
+
+size_t KernelAutotuner::getDefaultStreamingChunkDataPoints(KernelISA isa,
+                                                           size_t avx512ChunkDataPoints) {
+  if (isa == KernelISA::AVX512) {
+    return avx512ChunkDataPoints;
+  } else {
+    return streamingChunkDataPointsCandidates[0];
+  }
+}
+
+size_t KernelAutotuner::getStreamingDataPadding(size_t avx512ChunkDataPoints) {
+  // least common multiple of all possible values of chunkDataPoints
+  const size_t largestCandidate = streamingChunkDataPointsCandidates[2];
+  size_t padding = largestCandidate;
+
+  while (padding % avx512ChunkDataPoints != 0) {
+    padding += largestCandidate;
+  }
+
+  return padding;
+}
+
+size_t KernelAutotuner::getBenchmarkSize(size_t work, size_t gridSize, size_t dim,
+                                         size_t dataSize, size_t alignment) {
+  size_t sampleSize = work / std::max<size_t>(gridSize * dim, 1);
+  sampleSize = ((sampleSize + alignment - 1) / alignment) * alignment;
+  return std::max(std::min(sampleSize, dataSize), std::min(alignment, dataSize));
+}
+
+void KernelAutotuner::setEnabled(bool enabled) { autotuningEnabled = enabled; }
+
+bool KernelAutotuner::isEnabled() { return autotuningEnabled; }
+
+void KernelAutotuner::clearCache() {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  cache.clear();
+}
+
+size_t KernelAutotuner::getCacheSize() {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  return cache.size();
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
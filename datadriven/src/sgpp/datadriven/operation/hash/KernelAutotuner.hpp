@@ -0,0 +1,140 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/operation/hash/KernelDispatch.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Chooses the parameters of the vectorized MultiEval kernels (block sizes, thresholds, ...)
+ * by benchmarking all candidate configurations the first time a kernel is used for a problem.
+ * The fastest candidate is cached per kernel, instruction set, candidate set and problem shape,
+ * i.e., the dimension and the number of grid and data points (both rounded up to the next power
+ * of two, such that the choice is reused after small refinement steps).
+ *
+ * Autotuning can be disabled with setEnabled(false) or by setting the environment variable
+ * SGPP_KERNEL_AUTOTUNE=0; the kernels then use their default configuration.
+ */
+class KernelAutotuner {
+ public:
+  /**
+   * Configuration of the Streaming kernels
+   */
+  struct StreamingConfiguration {
+    /// instruction set of the kernels
+    KernelISA isa;
+    /// number of data points processed per block
+    size_t chunkDataPoints;
+    /// number of grid points processed per block
+    size_t chunkGridPoints;
+  };
+
+  /**
+   * Returns the fastest candidate for the given kernel and problem shape. If the shape has not
+   * been tuned before, every candidate is benchmarked (the minimum of a few runs is used).
+   *
+   * @param kernelName name of the kernel
+   * @param isa instruction set of the kernel
+   * @param gridSize number of grid points
+   * @param dim dimension
+   * @param dataSize number of data points
+   * @param numCandidates number of candidate configurations
+   * @param defaultCandidate candidate that is used if autotuning is disabled
+   * @param benchmark runs the kernel with the given candidate configuration once
+   * @param candidateSetHash identifies the candidate set, if a kernel uses different sets
+   * @return index of the fastest candidate (smaller than numCandidates)
+   */
+  static size_t tune(const std::string& kernelName, KernelISA isa, size_t gridSize, size_t dim,
+                     size_t dataSize, size_t numCandidates, size_t defaultCandidate,
+                     const std::function<void(size_t)>& benchmark, size_t candidateSetHash = 0);
+
+  /**
+   * Tunes a Streaming kernel, the first configuration is the default one.
+   *
+   * @param kernelName name of the kernel
+   * @param configurations candidate configurations, e.g., from getStreamingConfigurations
+   * @param gridSize number of grid points
+   * @param dim dimension
+   * @param dataSize number of data points
+   * @param benchmark runs the kernel with the given candidate configuration once
+   * @return the fastest configuration
+   */
+  static StreamingConfiguration tuneStreaming(
+      const std::string& kernelName, const std::vector<StreamingConfiguration>& configurations,
+      size_t gridSize, size_t dim, size_t dataSize,
+      const std::function<void(const StreamingConfiguration&)>& benchmark);
+
+  /**
+   * Creates the candidate configurations of the Streaming kernels. Besides the block sizes, the
+   * most capable instruction set is compared with the next one (unless the instruction set is
+   * fixed), as the most capable one is not always the fastest (e.g., due to clock throttling).
+   *
+   * @param isa default instruction set
+   * @param hasFixedISA whether only the default instruction set may be used
+   * @param avx512ChunkDataPoints data points per block of the AVX-512 kernel (its unrolling width)
+   * @return candidate configurations, the first one is the default one
+   */
+  static std::vector<StreamingConfiguration> getStreamingConfigurations(
+      KernelISA isa, bool hasFixedISA, size_t avx512ChunkDataPoints);
+
+  /**
+   * @param isa instruction set
+   * @param avx512ChunkDataPoints data points per block of the AVX-512 kernel
+   * @return default number of data points per block of the Streaming kernels
+   */
+  static size_t getDefaultStreamingChunkDataPoints(KernelISA isa, size_t avx512ChunkDataPoints);
+
+  /**
+   * @param avx512ChunkDataPoints data points per block of the AVX-512 kernel
+   * @return padding of the data set, such that every candidate block size divides it
+   */
+  static size_t getStreamingDataPadding(size_t avx512ChunkDataPoints);
+
+  /**
+   * Chooses the number of data points of a benchmark run, such that a run takes a few
+   * milliseconds.
+   *
+   * @param work number of grid points times data points times dimension of a run
+   * @param gridSize number of grid points
+   * @param dim dimension
+   * @param dataSize number of (padded) data points
+   * @param alignment the result is a multiple of alignment (unless dataSize is smaller)
+   * @return number of data points of a benchmark run
+   */
+  static size_t getBenchmarkSize(size_t work, size_t gridSize, size_t dim, size_t dataSize,
+                                 size_t alignment);
+
+  /**
+   * @param enabled whether kernels should be autotuned
+   */
+  static void setEnabled(bool enabled);
+
+  /**
+   * @return whether kernels are autotuned
+   */
+  static bool isEnabled();
+
+  /**
+   * Forgets all tuned configurations.
+   */
+  static void clearCache();
+
+  /**
+   * @return number of cached configurations
+   */
+  static size_t getCacheSize();
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
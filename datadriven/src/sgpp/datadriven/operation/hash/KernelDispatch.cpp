@@ -0,0 +1,116 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/KernelDispatch.hpp>
+
+#include <sgpp/base/exception/application_exception.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+KernelISA KernelDispatch::getCompiledISA() { return SGPP_COMPILED_KERNEL_ISA; }
+
+bool KernelDispatch::isCompiled(KernelISA isa) {
+  return SGPP_KERNEL_ISA_IS_COMPILED(static_cast<int>(isa));
+}
+
+bool KernelDispatch::isSupported(KernelISA isa) {
+#if defined(__MIC__)
+  return isa <= KernelISA::AVX512;
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_cpu_init();
+
+  switch (isa) {
+    case KernelISA::Scalar:
+      return true;
+    case KernelISA::SSE3:
+      return __builtin_cpu_supports("sse3");
+    case KernelISA::AVX:
+      return __builtin_cpu_supports("avx");
+    case KernelISA::AVX2:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case KernelISA::AVX512:
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd") &&
+             __builtin_cpu_supports("fma");
+  }
+
+  return false;
+#else
+  // no runtime detection available, assume that SG++ has been compiled for this machine
+  return isa <= getCompiledISA();
+#endif
+}
+
+bool KernelDispatch::isAvailable(KernelISA isa) { return isCompiled(isa) && isSupported(isa); }
+
+KernelISA KernelDispatch::getBestISA() { return getAvailableISAs().front(); }
+
+std::vector<KernelISA> KernelDispatch::getAvailableISAs() {
+  KernelISA maxISA = KernelISA::AVX512;
+  const char* maxISAName = std::getenv("SGPP_KERNEL_ISA");
+
+  if (maxISAName != nullptr) {
+    maxISA = fromString(maxISAName);
+  }
+
+  std::vector<KernelISA> isas;
+
+  for (int i = static_cast<int>(maxISA); i >= static_cast<int>(KernelISA::Scalar); i--) {
+    KernelISA isa = static_cast<KernelISA>(i);
+
+    if (isAvailable(isa)) {
+      isas.push_back(isa);
+    }
+  }
+
+  if (isas.empty()) {
+    isas.push_back(getCompiledISA());
+  }
+
+  return isas;
+}
+
+std::string KernelDispatch::toString(KernelISA isa) {
+  switch (isa) {
+    case KernelISA::Scalar:
+      return "scalar";
+    case KernelISA::SSE3:
+      return "sse3";
+    case KernelISA::AVX:
+      return "avx";
+    case KernelISA::AVX2:
+      return "avx2";
+    case KernelISA::AVX512:
+      return "avx512";
+  }
+
+  return "unknown";
+}
+
+KernelISA KernelDispatch::fromString(const std::string& name) {
+  std::string lowerName(name);
+  std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
+
+  for (int i = static_cast<int>(KernelISA::Scalar); i <= static_cast<int>(KernelISA::AVX512);
+       i++) {
+    KernelISA isa = static_cast<KernelISA>(i);
+
+    if (lowerName == toString(isa)) {
+      return isa;
+    }
+  }
+
+  throw base::application_exception(
+      "KernelDispatch: unknown instruction set, expected scalar, sse3, avx, avx2 or avx512");
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
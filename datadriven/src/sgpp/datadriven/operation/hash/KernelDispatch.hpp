@@ -0,0 +1,135 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+#include <vector>
+
+/**
+ * Levels of the instruction sets the vectorized MultiEval kernels (Streaming, ModMaskStreaming,
+ * SubspaceCombined) are written for, ordered from the least to the most capable one.
+ * The values are the ones of the enum sgpp::datadriven::KernelISA.
+ */
+#define SGPP_KERNEL_ISA_LEVEL_SCALAR 0
+#define SGPP_KERNEL_ISA_LEVEL_SSE3 1
+#define SGPP_KERNEL_ISA_LEVEL_AVX 2
+#define SGPP_KERNEL_ISA_LEVEL_AVX2 3
+#define SGPP_KERNEL_ISA_LEVEL_AVX512 4
+
+/**
+ * Instruction set the current translation unit is compiled for. The kernel sources use this macro
+ * to name the specialization they define, the same kernel source is compiled once per instruction
+ * set if SG++ is built with USE_KERNEL_DISPATCH. For the additional instruction sets, the build
+ * system defines SGPP_KERNEL_TARGET_ISA_LEVEL (see KernelTargetBegin.hpp).
+ */
+#if defined(SGPP_KERNEL_TARGET_ISA_LEVEL)
+#define SGPP_COMPILED_KERNEL_ISA_LEVEL SGPP_KERNEL_TARGET_ISA_LEVEL
+#elif defined(__MIC__) || defined(__AVX512F__)
+#define SGPP_COMPILED_KERNEL_ISA_LEVEL SGPP_KERNEL_ISA_LEVEL_AVX512
+#elif defined(__AVX2__)
+#define SGPP_COMPILED_KERNEL_ISA_LEVEL SGPP_KERNEL_ISA_LEVEL_AVX2
+#elif defined(__AVX__)
+#define SGPP_COMPILED_KERNEL_ISA_LEVEL SGPP_KERNEL_ISA_LEVEL_AVX
+#elif defined(__SSE3__)
+#define SGPP_COMPILED_KERNEL_ISA_LEVEL SGPP_KERNEL_ISA_LEVEL_SSE3
+#else
+#define SGPP_COMPILED_KERNEL_ISA_LEVEL SGPP_KERNEL_ISA_LEVEL_SCALAR
+#endif
+
+#define SGPP_COMPILED_KERNEL_ISA \
+  static_cast<sgpp::datadriven::KernelISA>(SGPP_COMPILED_KERNEL_ISA_LEVEL)
+
+/**
+ * Whether the library contains the kernels for the instruction set of the given level.
+ * With USE_KERNEL_DISPATCH, the build system compiles the kernels additionally for all vector
+ * instruction sets that are more capable than the one SG++ is compiled for (see ARCH).
+ */
+#ifdef USE_KERNEL_DISPATCH
+#define SGPP_KERNEL_ISA_IS_COMPILED(level)        \
+  (((level) == SGPP_COMPILED_KERNEL_ISA_LEVEL) || \
+   (((level) >= SGPP_KERNEL_ISA_LEVEL_AVX) && ((level) > SGPP_COMPILED_KERNEL_ISA_LEVEL)))
+#else
+#define SGPP_KERNEL_ISA_IS_COMPILED(level) ((level) == SGPP_COMPILED_KERNEL_ISA_LEVEL)
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Instruction sets of the vectorized MultiEval kernels, see SGPP_KERNEL_ISA_LEVEL_SCALAR etc.
+ */
+enum class KernelISA {
+  Scalar = SGPP_KERNEL_ISA_LEVEL_SCALAR,
+  SSE3 = SGPP_KERNEL_ISA_LEVEL_SSE3,
+  AVX = SGPP_KERNEL_ISA_LEVEL_AVX,
+  AVX2 = SGPP_KERNEL_ISA_LEVEL_AVX2,
+  AVX512 = SGPP_KERNEL_ISA_LEVEL_AVX512
+};
+
+/**
+ * Runtime selection of the instruction set used by the vectorized MultiEval kernels.
+ *
+ * Without USE_KERNEL_DISPATCH, only the kernels for the instruction set SG++ is compiled for
+ * (see the ARCH build option) are available. With USE_KERNEL_DISPATCH, the kernels are
+ * additionally compiled for AVX, AVX2 and AVX-512 (if these are more capable than ARCH) and
+ * the most capable instruction set supported by the CPU is chosen at runtime.
+ * The choice can be limited with the environment variable SGPP_KERNEL_ISA
+ * (e.g., SGPP_KERNEL_ISA=avx2).
+ */
+class KernelDispatch {
+ public:
+  /**
+   * @return instruction set SG++ is compiled for (without dispatching)
+   */
+  static KernelISA getCompiledISA();
+
+  /**
+   * @param isa instruction set
+   * @return whether the library contains kernels for the instruction set
+   */
+  static bool isCompiled(KernelISA isa);
+
+  /**
+   * @param isa instruction set
+   * @return whether the CPU (and the operating system) supports the instruction set
+   */
+  static bool isSupported(KernelISA isa);
+
+  /**
+   * @param isa instruction set
+   * @return whether kernels for the instruction set can be used on this machine
+   */
+  static bool isAvailable(KernelISA isa);
+
+  /**
+   * @return most capable available instruction set (limited by SGPP_KERNEL_ISA if set);
+   *         if none is available, the instruction set SG++ is compiled for
+   */
+  static KernelISA getBestISA();
+
+  /**
+   * @return available instruction sets (limited by SGPP_KERNEL_ISA if set), from the most to the
+   *         least capable one; if none is available, the instruction set SG++ is compiled for
+   */
+  static std::vector<KernelISA> getAvailableISAs();
+
+  /**
+   * @param isa instruction set
+   * @return lower case name of the instruction set, e.g., "avx2"
+   */
+  static std::string toString(KernelISA isa);
+
+  /**
+   * @param name name of an instruction set as returned by toString (case insensitive)
+   * @return instruction set
+   */
+  static KernelISA fromString(const std::string& name);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
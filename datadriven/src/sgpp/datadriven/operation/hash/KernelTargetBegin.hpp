@@ -0,0 +1,83 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+// NOLINT(build/header_guard): included once before and once after (KernelTargetEnd.hpp)
+// the kernels of a translation unit
+
+/**
+ * Start of the kernels of a translation unit that is additionally compiled for the instruction
+ * set SGPP_KERNEL_TARGET_ISA_LEVEL (see USE_KERNEL_DISPATCH and KernelDispatch).
+ *
+ * Such translation units are compiled with the flags of ARCH, only the code between this header
+ * and KernelTargetEnd.hpp is compiled for the more capable instruction set. All other headers
+ * have to be included before this header. Then the inline functions and templates they define
+ * keep the instruction set of ARCH, otherwise the linker could pick, e.g., the AVX2 version of
+ * an inline function of DataVector for the whole library. The macros of the instruction set
+ * (e.g., __AVX2__), with which the kernels choose their implementation, are defined until
+ * KernelTargetEnd.hpp.
+ *
+ * Without SGPP_KERNEL_TARGET_ISA_LEVEL, the kernels are compiled for ARCH and this header does
+ * nothing.
+ */
+#ifdef SGPP_KERNEL_TARGET_ISA_LEVEL
+
+#if defined(__clang__) || !defined(__GNUC__)
+#error "SGPP_KERNEL_TARGET_ISA_LEVEL is only supported for GCC"
+#endif
+
+#ifdef SGPP_KERNEL_TARGET_ACTIVE
+#error "KernelTargetBegin.hpp included twice without KernelTargetEnd.hpp"
+#endif
+#define SGPP_KERNEL_TARGET_ACTIVE
+
+#include <sgpp/datadriven/operation/hash/KernelDispatch.hpp>
+
+// the intrinsics of GCC can be included independently of the instruction set
+#include <immintrin.h>
+
+#pragma GCC push_options
+
+#if SGPP_KERNEL_TARGET_ISA_LEVEL == SGPP_KERNEL_ISA_LEVEL_AVX512
+#pragma GCC target("avx512f,avx512cd,avx2,fma")
+#elif SGPP_KERNEL_TARGET_ISA_LEVEL == SGPP_KERNEL_ISA_LEVEL_AVX2
+#pragma GCC target("avx2,fma")
+#elif SGPP_KERNEL_TARGET_ISA_LEVEL == SGPP_KERNEL_ISA_LEVEL_AVX
+#pragma GCC target("avx")
+#else
+#error "SGPP_KERNEL_TARGET_ISA_LEVEL has to be the level of AVX, AVX2 or AVX-512"
+#endif
+
+// GCC does not define the macros of the instruction set for #pragma GCC target
+#ifndef __SSE3__
+#define __SSE3__ 1
+#define SGPP_KERNEL_TARGET_UNDEF_SSE3
+#endif
+
+#ifndef __AVX__
+#define __AVX__ 1
+#define SGPP_KERNEL_TARGET_UNDEF_AVX
+#endif
+
+#if (SGPP_KERNEL_TARGET_ISA_LEVEL >= SGPP_KERNEL_ISA_LEVEL_AVX2) && !defined(__AVX2__)
+#define __AVX2__ 1
+#define SGPP_KERNEL_TARGET_UNDEF_AVX2
+#endif
+
+#if (SGPP_KERNEL_TARGET_ISA_LEVEL >= SGPP_KERNEL_ISA_LEVEL_AVX2) && !defined(__FMA__)
+#define __FMA__ 1
+#define SGPP_KERNEL_TARGET_UNDEF_FMA
+#endif
+
+#if (SGPP_KERNEL_TARGET_ISA_LEVEL >= SGPP_KERNEL_ISA_LEVEL_AVX512) && !defined(__AVX512F__)
+#define __AVX512F__ 1
+#define SGPP_KERNEL_TARGET_UNDEF_AVX512F
+#endif
+
+#if (SGPP_KERNEL_TARGET_ISA_LEVEL >= SGPP_KERNEL_ISA_LEVEL_AVX512) && !defined(__AVX512CD__)
+#define __AVX512CD__ 1
+#define SGPP_KERNEL_TARGET_UNDEF_AVX512CD
+#endif
+
+#endif /* SGPP_KERNEL_TARGET_ISA_LEVEL */
@@ -0,0 +1,50 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+// NOLINT(build/header_guard): see KernelTargetBegin.hpp
+
+/**
+ * End of the kernels of a translation unit, see KernelTargetBegin.hpp.
+ */
+#ifdef SGPP_KERNEL_TARGET_ISA_LEVEL
+
+#ifndef SGPP_KERNEL_TARGET_ACTIVE
+#error "KernelTargetEnd.hpp included without KernelTargetBegin.hpp"
+#endif
+#undef SGPP_KERNEL_TARGET_ACTIVE
+
+#pragma GCC pop_options
+
+#ifdef SGPP_KERNEL_TARGET_UNDEF_SSE3
+#undef __SSE3__
+#undef SGPP_KERNEL_TARGET_UNDEF_SSE3
+#endif
+
+#ifdef SGPP_KERNEL_TARGET_UNDEF_AVX
+#undef __AVX__
+#undef SGPP_KERNEL_TARGET_UNDEF_AVX
+#endif
+
+#ifdef SGPP_KERNEL_TARGET_UNDEF_AVX2
+#undef __AVX2__
+#undef SGPP_KERNEL_TARGET_UNDEF_AVX2
+#endif
+
+#ifdef SGPP_KERNEL_TARGET_UNDEF_FMA
+#undef __FMA__
+#undef SGPP_KERNEL_TARGET_UNDEF_FMA
+#endif
+
+#ifdef SGPP_KERNEL_TARGET_UNDEF_AVX512F
+#undef __AVX512F__
+#undef SGPP_KERNEL_TARGET_UNDEF_AVX512F
+#endif
+
+#ifdef SGPP_KERNEL_TARGET_UNDEF_AVX512CD
+#undef __AVX512CD__
+#undef SGPP_KERNEL_TARGET_UNDEF_AVX512CD
+#endif
+
+#endif /* SGPP_KERNEL_TARGET_ISA_LEVEL */
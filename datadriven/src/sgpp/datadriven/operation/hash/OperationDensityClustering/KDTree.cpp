@@ -0,0 +1,152 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationDensityClustering/KDTree.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityClustering {
+
+KDTree::KDTree(const base::DataMatrix& data, size_t leafSize)
+    : data(data),
+      dims(data.getNcols()),
+      numPoints(data.getNrows()),
+      leafSize(std::max(leafSize, static_cast<size_t>(1))) {
+  permutation.resize(numPoints);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    permutation[i] = i;
+  }
+
+  if (numPoints > 0) {
+    build(0, numPoints);
+  }
+
+  coords.resize(dims * numPoints);
+
+  for (size_t d = 0; d < dims; d++) {
+    for (size_t p = 0; p < numPoints; p++) {
+      coords[d * numPoints + p] = data.get(permutation[p], d);
+    }
+  }
+}
+
+size_t KDTree::build(size_t begin, size_t end) {
+  const size_t node = nodes.size();
+  nodes.push_back(Node{begin, end, 0, 0, 0, 0.0});
+
+  if (end - begin <= leafSize) {
+    return node;
+  }
+
+  // split the dimension with the largest spread at the median
+  size_t splitDim = 0;
+  double maxSpread = -1.0;
+
+  for (size_t d = 0; d < dims; d++) {
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+
+    for (size_t p = begin; p < end; p++) {
+      const double x = data.get(permutation[p], d);
+      min = std::min(min, x);
+      max = std::max(max, x);
+    }
+
+    if (max - min > maxSpread) {
+      maxSpread = max - min;
+      splitDim = d;
+    }
+  }
+
+  const size_t mid = begin + (end - begin) / 2;
+  std::nth_element(permutation.begin() + begin, permutation.begin() + mid,
+                   permutation.begin() + end, [this, splitDim](size_t i, size_t j) {
+                     return data.get(i, splitDim) < data.get(j, splitDim);
+                   });
+  // the children reorder the permutation, so the split value has to be stored first
+  nodes[node].splitDim = splitDim;
+  nodes[node].splitValue = data.get(permutation[mid], splitDim);
+
+  const size_t left = build(begin, mid);
+  const size_t right = build(mid, end);
+  nodes[node].left = left;
+  nodes[node].right = right;
+  return node;
+}
+
+void KDTree::findNearestNeighbors(size_t index, size_t k, std::vector<Neighbor>& neighbors,
+                                  std::vector<double>& distances) const {
+  neighbors.clear();
+
+  if ((k == 0) || nodes.empty()) {
+    return;
+  }
+
+  search(0, data.getPointer() + index * dims, index, k, neighbors, distances);
+  std::sort_heap(neighbors.begin(), neighbors.end());
+}
+
+void KDTree::search(size_t node, const double* point, size_t index, size_t k,
+                    std::vector<Neighbor>& neighbors, std::vector<double>& distances) const {
+  const Node& current = nodes[node];
+
+  if (current.left == 0) {
+    const size_t size = current.end - current.begin;
+    distances.assign(size, 0.0);
+    double* dist = distances.data();
+
+    // the squared distances are accumulated dimension by dimension in the same order as
+    // in a brute force search, hence the values are bitwise identical
+    for (size_t d = 0; d < dims; d++) {
+      const double x = point[d];
+      const double* c = &coords[d * numPoints + current.begin];
+
+#pragma omp simd
+      for (size_t p = 0; p < size; p++) {
+        const double diff = x - c[p];
+        dist[p] += diff * diff;
+      }
+    }
+
+    for (size_t p = 0; p < size; p++) {
+      const Neighbor candidate(dist[p], permutation[current.begin + p]);
+
+      if (candidate.second == index) {
+        continue;
+      }
+
+      if (neighbors.size() < k) {
+        neighbors.push_back(candidate);
+        std::push_heap(neighbors.begin(), neighbors.end());
+      } else if (candidate < neighbors.front()) {
+        std::pop_heap(neighbors.begin(), neighbors.end());
+        neighbors.back() = candidate;
+        std::push_heap(neighbors.begin(), neighbors.end());
+      }
+    }
+
+    return;
+  }
+
+  const double diff = point[current.splitDim] - current.splitValue;
+  const size_t nearChild = (diff < 0.0) ? current.left : current.right;
+  const size_t farChild = (diff < 0.0) ? current.right : current.left;
+
+  search(nearChild, point, index, k, neighbors, distances);
+
+  // the far side may contain points with an equal distance and a smaller index
+  if ((neighbors.size() < k) || (diff * diff <= neighbors.front().first)) {
+    search(farChild, point, index, k, neighbors, distances);
+  }
+}
+
+}  // namespace DensityClustering
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,85 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityClustering {
+
+/**
+ * kd-tree for exact k nearest neighbor queries within a dataset.
+ *
+ * The tree splits the dataset at the median of the dimension with the largest spread until a
+ * node contains at most leafSize points. The coordinates are stored reordered along the leaves
+ * and dimension by dimension, such that the distances to all points of a leaf can be computed in
+ * a vectorized loop.
+ */
+class KDTree {
+ public:
+  /// (squared distance, index) pair of a neighbor candidate
+  typedef std::pair<double, size_t> Neighbor;
+
+  /**
+   * Constructor, builds the tree.
+   *
+   * @param data dataset, one point per row
+   * @param leafSize maximal number of points per leaf
+   */
+  explicit KDTree(const base::DataMatrix& data, size_t leafSize = 32);
+
+  /**
+   * Finds the k nearest neighbors of a point of the dataset, the point itself is excluded. Ties
+   * are broken in favor of the smaller index, i.e., the result equals the one of a brute force
+   * search that scans the dataset in order.
+   *
+   * @param index index of the point in the dataset
+   * @param k number of neighbors
+   * @param neighbors neighbors sorted ascending by (squared distance, index),
+   * also used as workspace
+   * @param distances workspace for the distances to the points of a leaf
+   */
+  void findNearestNeighbors(size_t index, size_t k, std::vector<Neighbor>& neighbors,
+                            std::vector<double>& distances) const;
+
+ protected:
+  /// node of the tree, the points of a node are the positions [begin, end) of permutation
+  struct Node {
+    size_t begin;
+    size_t end;
+    /// children, zero for leaves (the root is never a child)
+    size_t left;
+    size_t right;
+    size_t splitDim;
+    double splitValue;
+  };
+
+  const base::DataMatrix& data;
+  size_t dims;
+  size_t numPoints;
+  size_t leafSize;
+  std::vector<Node> nodes;
+  /// indices of the points in the order of the leaves
+  std::vector<size_t> permutation;
+  /// coordinates in the order of permutation, stored dimension by dimension
+  std::vector<double> coords;
+
+  /// builds the subtree of the given points and returns its node index
+  size_t build(size_t begin, size_t end);
+
+  /// searches the subtree of the given node and updates the neighbor candidates (max-heap)
+  void search(size_t node, const double* point, size_t index, size_t k,
+              std::vector<Neighbor>& neighbors, std::vector<double>& distances) const;
+};
+
+}  // namespace DensityClustering
+}  // namespace datadriven
+}  // namespace sgpp
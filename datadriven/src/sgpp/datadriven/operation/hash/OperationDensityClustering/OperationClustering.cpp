@@ -0,0 +1,180 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationDensityClustering/OperationClustering.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/DensitySystemMatrix.hpp>
+#include <sgpp/datadriven/operation/hash/OperationDensityClustering/OperationCreateGraph.hpp>
+#include <sgpp/datadriven/operation/hash/OperationDensityClustering/OperationPruneGraph.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityClustering {
+
+namespace {
+
+/// @return root of the tree of node, halving the path on the way
+size_t findRoot(std::vector<std::atomic<size_t>>& parents, size_t node) {
+  size_t parent = parents[node].load();
+
+  while (parent != node) {
+    size_t grandparent = parents[parent].load();
+    // path halving, a failed exchange only means that another thread was faster
+    parents[node].compare_exchange_weak(parent, grandparent);
+    node = grandparent;
+    parent = parents[node].load();
+  }
+
+  return node;
+}
+
+/// merges the trees of a and b, the larger root is linked to the smaller one
+void unite(std::vector<std::atomic<size_t>>& parents, size_t a, size_t b) {
+  while (true) {
+    a = findRoot(parents, a);
+    b = findRoot(parents, b);
+
+    if (a == b) {
+      return;
+    }
+
+    if (a < b) {
+      std::swap(a, b);
+    }
+
+    size_t expected = a;
+
+    if (parents[a].compare_exchange_strong(expected, b)) {
+      return;
+    }
+  }
+}
+
+}  // namespace
+
+OperationClustering::OperationClustering(bool verbose) : verbose(verbose) {}
+
+std::vector<size_t> OperationClustering::calculate_clusters(base::Grid& grid,
+                                                            base::DataMatrix& dataset,
+                                                            double lambda, size_t k,
+                                                            double threshold) {
+  std::chrono::time_point<std::chrono::system_clock> start, end;
+  const size_t gridsize = grid.getSize();
+  base::DataVector alpha(gridsize);
+  base::DataVector b(gridsize);
+
+  start = std::chrono::system_clock::now();
+  DensitySystemMatrix systemMatrix(grid, dataset, op_factory::createOperationIdentity(grid),
+                                   lambda);
+
+  if (verbose) {
+    std::cout << "Creating rhs..." << std::endl;
+  }
+
+  systemMatrix.generateb(b);
+
+  if (verbose) {
+    std::cout << "Creating alpha..." << std::endl;
+  }
+
+  solver::ConjugateGradients cg(1000, 0.001);
+  cg.solve(systemMatrix, alpha, b, false, verbose);
+  const double max = alpha.max();
+  const double min = alpha.min();
+
+  for (size_t i = 0; i < gridsize; i++) {
+    alpha[i] = alpha[i] * 1.0 / (max - min);
+  }
+
+  if (verbose) {
+    std::cout << "Starting graph creation..." << std::endl;
+  }
+
+  std::vector<int> graph(dataset.getNrows() * k);
+  OperationCreateGraph graphOperation(dataset, k);
+  graphOperation.create_graph(graph);
+
+  if (verbose) {
+    std::cout << "Starting graph pruning..." << std::endl;
+  }
+
+  OperationPruneGraph pruneOperation(grid, alpha, dataset, threshold, k);
+  pruneOperation.prune_graph(graph);
+
+  std::vector<size_t> clusters = find_clusters(graph, k);
+  end = std::chrono::system_clock::now();
+  std::chrono::duration<double> elapsed_seconds = end - start;
+
+  if (verbose) {
+    std::cout << "Time required for clustering: " << elapsed_seconds.count() << std::endl;
+  }
+
+  return clusters;
+}
+
+std::vector<size_t> OperationClustering::find_clusters(const std::vector<int>& graph, size_t k) {
+  const size_t numNodes = graph.size() / k;
+  std::vector<char> isNoise(numNodes);
+  std::vector<std::atomic<size_t>> parents(numNodes);
+
+#pragma omp parallel for
+  for (size_t i = 0; i < numNodes; i++) {
+    bool noise = true;
+
+    for (size_t j = 0; j < k; j++) {
+      if (graph[i * k + j] >= 0) {
+        noise = false;
+        break;
+      }
+    }
+
+    isNoise[i] = noise;
+    parents[i].store(i);
+  }
+
+#pragma omp parallel for schedule(dynamic, 256)
+  for (size_t i = 0; i < numNodes; i++) {
+    if (isNoise[i]) {
+      continue;
+    }
+
+    for (size_t j = 0; j < k; j++) {
+      const int neighbor = graph[i * k + j];
+
+      if ((neighbor >= 0) && !isNoise[neighbor]) {
+        unite(parents, i, static_cast<size_t>(neighbor));
+      }
+    }
+  }
+
+  // every root is the smallest node of its component, so the components can be numbered
+  // in a single pass
+  std::vector<size_t> clusters(numNodes, 0);
+  size_t clustercount = 0;
+
+  for (size_t i = 0; i < numNodes; i++) {
+    if (isNoise[i]) {
+      continue;
+    }
+
+    const size_t root = findRoot(parents, i);
+    clusters[i] = (root == i) ? ++clustercount : clusters[root];
+  }
+
+  return clusters;
+}
+
+}  // namespace DensityClustering
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,65 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityClustering {
+
+/**
+ * CPU version of OperationClusteringOCL: density based clustering with a k nearest neighbor
+ * graph that is pruned in areas of low sparse grid density. The clusters are the connected
+ * components of the pruned graph.
+ */
+class OperationClustering {
+ public:
+  /**
+   * Constructor
+   *
+   * @param verbose print progress and timings
+   */
+  explicit OperationClustering(bool verbose = false);
+
+  /**
+   * Computes the density of the dataset on the grid, creates and prunes the k nearest neighbor
+   * graph of the dataset and assigns the clusters.
+   *
+   * @param grid grid of the density
+   * @param dataset dataset, one point per row
+   * @param lambda regularization parameter of the density estimation
+   * @param k number of neighbors per point
+   * @param threshold density threshold for the pruning (relative to the density coefficients
+   * scaled to a range of 1)
+   * @return cluster of each point as computed by find_clusters
+   */
+  std::vector<size_t> calculate_clusters(base::Grid& grid, base::DataMatrix& dataset,
+                                         double lambda, size_t k, double threshold);
+
+  /**
+   * Assigns a cluster to each node of a pruned k nearest neighbor graph with a parallel
+   * union-find. Nodes that were removed or whose edges were all removed are noise (cluster 0),
+   * the other nodes are assigned to the connected components of the remaining edges between
+   * them. The components are numbered starting from 1 in the order of their smallest node.
+   *
+   * @param graph pruned graph, the edges of node i are stored in graph[i * k, (i + 1) * k)
+   * @param k number of neighbors per node
+   * @return cluster of each node
+   */
+  static std::vector<size_t> find_clusters(const std::vector<int>& graph, size_t k);
+
+ protected:
+  bool verbose;
+};
+
+}  // namespace DensityClustering
+}  // namespace datadriven
+}  // namespace sgpp
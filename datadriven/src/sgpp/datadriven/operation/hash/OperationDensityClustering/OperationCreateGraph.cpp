@@ -0,0 +1,58 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationDensityClustering/OperationCreateGraph.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityClustering {
+
+OperationCreateGraph::OperationCreateGraph(base::DataMatrix& data, size_t k)
+    : data(data), k(k), tree(data) {
+  if (k >= data.getNrows()) {
+    throw base::operation_exception(
+        "OperationCreateGraph: k has to be smaller than the number of data points");
+  }
+}
+
+void OperationCreateGraph::create_graph(std::vector<int>& resultVector, size_t startid,
+                                        size_t chunksize) {
+  const size_t numPoints = data.getNrows();
+
+  if (startid > numPoints) {
+    throw base::operation_exception("OperationCreateGraph: startid out of range");
+  }
+
+  if ((chunksize == 0) || (startid + chunksize > numPoints)) {
+    chunksize = numPoints - startid;
+  }
+
+  if (resultVector.size() < chunksize * k) {
+    resultVector.resize(chunksize * k);
+  }
+
+#pragma omp parallel
+  {
+    std::vector<KDTree::Neighbor> neighbors;
+    std::vector<double> distances;
+
+#pragma omp for schedule(dynamic, 64)
+    for (size_t i = 0; i < chunksize; i++) {
+      tree.findNearestNeighbors(startid + i, k, neighbors, distances);
+
+      for (size_t j = 0; j < k; j++) {
+        resultVector[i * k + j] = static_cast<int>(neighbors[j].second);
+      }
+    }
+  }
+}
+
+}  // namespace DensityClustering
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,51 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/datadriven/operation/hash/OperationDensityClustering/KDTree.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityClustering {
+
+/**
+ * CPU version of OperationCreateGraphOCL: creates the k nearest neighbor graph of a dataset
+ * with a kd-tree, the queries are distributed to the OpenMP threads.
+ */
+class OperationCreateGraph {
+ public:
+  /**
+   * Constructor, builds the kd-tree of the dataset.
+   *
+   * @param data dataset, one point per row
+   * @param k number of neighbors per point
+   */
+  OperationCreateGraph(base::DataMatrix& data, size_t k);
+
+  /**
+   * Finds the k nearest neighbors of the points [startid, startid + chunksize) of the dataset.
+   * Like in the OpenCL version, the neighbor indices of the i-th point of the chunk are stored
+   * in resultVector[i * k, (i + 1) * k), but here they are sorted ascending by their distance.
+   *
+   * @param resultVector neighbor indices, resized if it is too small for the chunk
+   * @param startid first point of the chunk
+   * @param chunksize number of points of the chunk, 0 for all points after startid
+   */
+  void create_graph(std::vector<int>& resultVector, size_t startid = 0, size_t chunksize = 0);
+
+ protected:
+  base::DataMatrix& data;
+  size_t k;
+  KDTree tree;
+};
+
+}  // namespace DensityClustering
+}  // namespace datadriven
+}  // namespace sgpp
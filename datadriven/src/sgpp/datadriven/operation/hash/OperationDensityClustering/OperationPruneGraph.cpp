@@ -0,0 +1,91 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationDensityClustering/OperationPruneGraph.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityClustering {
+
+OperationPruneGraph::OperationPruneGraph(base::Grid& grid, base::DataVector& alpha,
+                                         base::DataMatrix& data, double threshold, size_t k)
+    : grid(grid), alpha(alpha), data(data), threshold(threshold), k(k) {}
+
+void OperationPruneGraph::prune_graph(std::vector<int>& graph, size_t startid,
+                                      size_t chunksize) {
+  const size_t numPoints = data.getNrows();
+  const size_t dims = data.getNcols();
+
+  if (startid > numPoints) {
+    throw base::operation_exception("OperationPruneGraph: startid out of range");
+  }
+
+  if ((chunksize == 0) || (startid + chunksize > numPoints)) {
+    chunksize = numPoints - startid;
+  }
+
+  if (graph.size() < chunksize * k) {
+    throw base::operation_exception("OperationPruneGraph: graph is smaller than the chunk");
+  }
+
+  // evaluation points: the nodes of the chunk followed by the midpoints of their edges
+  base::DataMatrix evalPoints(chunksize * (k + 1), dims);
+
+#pragma omp parallel for
+  for (size_t i = 0; i < chunksize; i++) {
+    const size_t node = startid + i;
+
+    for (size_t d = 0; d < dims; d++) {
+      evalPoints.set(i, d, data.get(node, d));
+    }
+
+    for (size_t j = 0; j < k; j++) {
+      const int neighbor = graph[i * k + j];
+      const size_t row = chunksize + i * k + j;
+
+      if (neighbor < 0) {
+        continue;
+      }
+
+      for (size_t d = 0; d < dims; d++) {
+        const double x = data.get(neighbor, d);
+        evalPoints.set(row, d, x + (data.get(node, d) - x) * 0.5);
+      }
+    }
+  }
+
+  base::DataVector densities(evalPoints.getNrows());
+  std::unique_ptr<base::OperationMultipleEval> opEval(
+      op_factory::createOperationMultipleEval(grid, evalPoints));
+  opEval->mult(alpha, densities);
+
+#pragma omp parallel for
+  for (size_t i = 0; i < chunksize; i++) {
+    if (densities[i] < threshold) {
+      for (size_t j = 0; j < k; j++) {
+        graph[i * k + j] = -1;
+      }
+
+      continue;
+    }
+
+    for (size_t j = 0; j < k; j++) {
+      if ((graph[i * k + j] >= 0) && (densities[chunksize + i * k + j] < threshold)) {
+        graph[i * k + j] = -2;
+      }
+    }
+  }
+}
+
+}  // namespace DensityClustering
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,60 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityClustering {
+
+/**
+ * CPU version of OperationPruneGraphOCL: removes the nodes and edges of a k nearest neighbor
+ * graph that lie in areas of low density. The sparse grid density is evaluated at all nodes and
+ * edge midpoints of the chunk at once with OperationMultipleEval.
+ */
+class OperationPruneGraph {
+ public:
+  /**
+   * Constructor
+   *
+   * @param grid grid of the density
+   * @param alpha coefficient vector of the density
+   * @param data dataset the graph was created for
+   * @param threshold density threshold
+   * @param k number of neighbors per node
+   */
+  OperationPruneGraph(base::Grid& grid, base::DataVector& alpha, base::DataMatrix& data,
+                      double threshold, size_t k);
+
+  /**
+   * Prunes the graph chunk of the nodes [startid, startid + chunksize), the edges of the i-th
+   * node of the chunk are stored in graph[i * k, (i + 1) * k). An edge is marked with -2 if the
+   * density at the midpoint between the node and its neighbor is below the threshold, all edges
+   * of a node are marked with -1 if the density at the node is below the threshold.
+   *
+   * @param graph graph chunk, as created by OperationCreateGraph
+   * @param startid first node of the chunk
+   * @param chunksize number of nodes of the chunk, 0 for all nodes after startid
+   */
+  void prune_graph(std::vector<int>& graph, size_t startid = 0, size_t chunksize = 0);
+
+ protected:
+  base::Grid& grid;
+  base::DataVector& alpha;
+  base::DataMatrix& data;
+  double threshold;
+  size_t k;
+};
+
+}  // namespace DensityClustering
+}  // namespace datadriven
+}  // namespace sgpp
@@ -4,20 +4,54 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/KernelAutotuner.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <vector>
 
 namespace sgpp {
 namespace datadriven {
 
+// the kernels are defined in OperationMultiEvalModMaskStreaming_multImpl.cpp and
+// OperationMultiEvalModMaskStreaming_multTransposeImpl.cpp, once for every compiled instruction set
+#define STREAMING_MODLINEAR_DECLARE_KERNELS(kernelISA)                                           \
+  template <>                                                                                    \
+  void OperationMultiEvalModMaskStreaming::multImpl<kernelISA>(                                  \
+      std::vector<double> & level, std::vector<double> & index, std::vector<double> & mask,      \
+      std::vector<double> & offset, sgpp::base::DataMatrix * dataset,                            \
+      sgpp::base::DataVector & alpha, sgpp::base::DataVector & result,                           \
+      const size_t start_index_grid, const size_t end_index_grid, const size_t start_index_data, \
+      const size_t end_index_data);                                                              \
+  template <>                                                                                    \
+  void OperationMultiEvalModMaskStreaming::multTransposeImpl<kernelISA>(                         \
+      std::vector<double> & level, std::vector<double> & index, std::vector<double> & mask,      \
+      std::vector<double> & offset, sgpp::base::DataMatrix * dataset,                            \
+      sgpp::base::DataVector & source, sgpp::base::DataVector & result,                          \
+      const size_t start_index_grid, const size_t end_index_grid, const size_t start_index_data, \
+      const size_t end_index_data);
+
+STREAMING_MODLINEAR_DECLARE_KERNELS(KernelISA::Scalar)
+STREAMING_MODLINEAR_DECLARE_KERNELS(KernelISA::SSE3)
+STREAMING_MODLINEAR_DECLARE_KERNELS(KernelISA::AVX)
+STREAMING_MODLINEAR_DECLARE_KERNELS(KernelISA::AVX2)
+STREAMING_MODLINEAR_DECLARE_KERNELS(KernelISA::AVX512)
+
+#undef STREAMING_MODLINEAR_DECLARE_KERNELS
+
 OperationMultiEvalModMaskStreaming::OperationMultiEvalModMaskStreaming(base::Grid& grid,
                                                                        base::DataMatrix& dataset)
     : OperationMultipleEval(grid, dataset),
       preparedDataset(dataset),
       myTimer_(sgpp::base::SGppStopwatch()),
-      duration(-1.0) {
+      duration(-1.0),
+      isa(KernelDispatch::getBestISA()),
+      chunkDataPoints(KernelAutotuner::getDefaultStreamingChunkDataPoints(
+          isa, STREAMING_MODLINEAR_MIC_AVX512_UNROLLING_WIDTH)),
+      chunkGridPoints(12),
+      hasFixedISA(false),
+      isTuned(false) {
   this->storage = &grid.getStorage();
   this->padDataset(this->preparedDataset);
   this->preparedDataset.transpose();
@@ -80,18 +114,175 @@ void OperationMultiEvalModMaskStreaming::getOpenMPPartitionSegment(size_t start,
 
 size_t OperationMultiEvalModMaskStreaming::getChunkGridPoints() {
   // not used by the MIC-implementation
-  return 12;
+  return this->chunkGridPoints;
+}
+size_t OperationMultiEvalModMaskStreaming::getChunkDataPoints() { return this->chunkDataPoints; }
+
+size_t OperationMultiEvalModMaskStreaming::getDataPadding() {
+  return KernelAutotuner::getStreamingDataPadding(STREAMING_MODLINEAR_MIC_AVX512_UNROLLING_WIDTH);
+}
+
+KernelISA OperationMultiEvalModMaskStreaming::getKernelISA() { return this->isa; }
+
+void OperationMultiEvalModMaskStreaming::setKernelISA(KernelISA isa) {
+  if (!KernelDispatch::isAvailable(isa)) {
+    throw sgpp::base::operation_exception(
+        "OperationMultiEvalModMaskStreaming: instruction set is not available on this machine");
+  }
+
+  this->isa = isa;
+  this->chunkDataPoints = KernelAutotuner::getDefaultStreamingChunkDataPoints(
+      isa, STREAMING_MODLINEAR_MIC_AVX512_UNROLLING_WIDTH);
+  this->chunkGridPoints = 12;
+  this->hasFixedISA = true;
+  this->isTuned = false;
+}
+
+void OperationMultiEvalModMaskStreaming::autotune() {
+  std::vector<KernelAutotuner::StreamingConfiguration> configurations =
+      KernelAutotuner::getStreamingConfigurations(this->isa, this->hasFixedISA,
+                                                  STREAMING_MODLINEAR_MIC_AVX512_UNROLLING_WIDTH);
+
+  // benchmark on a subset of the data points, such that a run takes a few milliseconds
+  const size_t gridSize = this->storage->getSize();
+  const size_t dims = this->storage->getDimension();
+  const size_t paddedDataSize = this->preparedDataset.getNcols();
+  const size_t sampleSize = KernelAutotuner::getBenchmarkSize(
+      STREAMING_MODLINEAR_AUTOTUNE_WORK, gridSize, dims, paddedDataSize, getDataPadding());
+
+  sgpp::base::DataVector alpha(gridSize, 1.0);
+  sgpp::base::DataVector result(paddedDataSize);
+  sgpp::base::DataVector source(paddedDataSize, 1.0);
+  sgpp::base::DataVector resultTranspose(gridSize);
+
+  auto applyConfiguration = [this](const KernelAutotuner::StreamingConfiguration& configuration) {
+    this->isa = configuration.isa;
+    this->chunkDataPoints = configuration.chunkDataPoints;
+    this->chunkGridPoints = configuration.chunkGridPoints;
+  };
+
+  applyConfiguration(KernelAutotuner::tuneStreaming(
+      "OperationMultiEvalModMaskStreaming", configurations, gridSize, dims, paddedDataSize,
+      [&](const KernelAutotuner::StreamingConfiguration& configuration) {
+        applyConfiguration(configuration);
+
+#pragma omp parallel
+        {
+          size_t start;
+          size_t end;
+          getOpenMPPartitionSegment(0, sampleSize, &start, &end, getChunkDataPoints());
+          this->multDispatch(this->level, this->index, this->mask, this->offset,
+                             &this->preparedDataset, alpha, result, 0, gridSize, start, end);
+
+          getOpenMPPartitionSegment(0, gridSize, &start, &end, 1);
+          this->multTransposeDispatch(this->level, this->index, this->mask, this->offset,
+                                      &this->preparedDataset, source, resultTranspose, start, end,
+                                      0, sampleSize);
+        }
+      }));
+  this->isTuned = true;
+}
+
+void OperationMultiEvalModMaskStreaming::multDispatch(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  switch (this->isa) {
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_SCALAR)
+    case KernelISA::Scalar:
+      this->multImpl<KernelISA::Scalar>(level, index, mask, offset, dataset, alpha, result,
+                                        start_index_grid, end_index_grid, start_index_data,
+                                        end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_SSE3)
+    case KernelISA::SSE3:
+      this->multImpl<KernelISA::SSE3>(level, index, mask, offset, dataset, alpha, result,
+                                      start_index_grid, end_index_grid, start_index_data,
+                                      end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_AVX)
+    case KernelISA::AVX:
+      this->multImpl<KernelISA::AVX>(level, index, mask, offset, dataset, alpha, result,
+                                     start_index_grid, end_index_grid, start_index_data,
+                                     end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_AVX2)
+    case KernelISA::AVX2:
+      this->multImpl<KernelISA::AVX2>(level, index, mask, offset, dataset, alpha, result,
+                                      start_index_grid, end_index_grid, start_index_data,
+                                      end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_AVX512)
+    case KernelISA::AVX512:
+      this->multImpl<KernelISA::AVX512>(level, index, mask, offset, dataset, alpha, result,
+                                        start_index_grid, end_index_grid, start_index_data,
+                                        end_index_data);
+      return;
+#endif
+    default:
+      throw sgpp::base::operation_exception(
+          "OperationMultiEvalModMaskStreaming: no kernel compiled for the instruction set");
+  }
 }
-size_t OperationMultiEvalModMaskStreaming::getChunkDataPoints() {
-#if defined(__MIC__) || defined(__AVX512F__)
-  return STREAMING_MODLINEAR_MIC_AVX512_UNROLLING_WIDTH;
-#else
-  return 24;  // must be divisible by 24
+
+void OperationMultiEvalModMaskStreaming::multTransposeDispatch(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  switch (this->isa) {
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_SCALAR)
+    case KernelISA::Scalar:
+      this->multTransposeImpl<KernelISA::Scalar>(level, index, mask, offset, dataset, source,
+                                                 result, start_index_grid, end_index_grid,
+                                                 start_index_data, end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_SSE3)
+    case KernelISA::SSE3:
+      this->multTransposeImpl<KernelISA::SSE3>(level, index, mask, offset, dataset, source,
+                                               result, start_index_grid, end_index_grid,
+                                               start_index_data, end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_AVX)
+    case KernelISA::AVX:
+      this->multTransposeImpl<KernelISA::AVX>(level, index, mask, offset, dataset, source,
+                                              result, start_index_grid, end_index_grid,
+                                              start_index_data, end_index_data);
+      return;
 #endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_AVX2)
+    case KernelISA::AVX2:
+      this->multTransposeImpl<KernelISA::AVX2>(level, index, mask, offset, dataset, source,
+                                               result, start_index_grid, end_index_grid,
+                                               start_index_data, end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_AVX512)
+    case KernelISA::AVX512:
+      this->multTransposeImpl<KernelISA::AVX512>(level, index, mask, offset, dataset, source,
+                                                 result, start_index_grid, end_index_grid,
+                                                 start_index_data, end_index_data);
+      return;
+#endif
+    default:
+      throw sgpp::base::operation_exception(
+          "OperationMultiEvalModMaskStreaming: no kernel compiled for the instruction set");
+  }
 }
 
 void OperationMultiEvalModMaskStreaming::mult(sgpp::base::DataVector& alpha,
                                               sgpp::base::DataVector& result) {
+  if (!this->isTuned) {
+    this->autotune();
+  }
+
   this->myTimer_.start();
 
   size_t originalSize = result.getSize();
@@ -107,8 +298,8 @@ void OperationMultiEvalModMaskStreaming::mult(sgpp::base::DataVector& alpha,
     getOpenMPPartitionSegment(0, this->preparedDataset.getNcols(), &start, &end,
                               getChunkDataPoints());
 
-    this->multImpl(this->level, this->index, this->mask, this->offset, &this->preparedDataset,
-                   alpha, result, 0, alpha.getSize(), start, end);
+    this->multDispatch(this->level, this->index, this->mask, this->offset, &this->preparedDataset,
+                       alpha, result, 0, alpha.getSize(), start, end);
   }
   result.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -116,6 +307,10 @@ void OperationMultiEvalModMaskStreaming::mult(sgpp::base::DataVector& alpha,
 
 void OperationMultiEvalModMaskStreaming::multTranspose(sgpp::base::DataVector& source,
                                                        sgpp::base::DataVector& result) {
+  if (!this->isTuned) {
+    this->autotune();
+  }
+
   this->myTimer_.start();
 
   size_t originalSize = source.getSize();
@@ -136,16 +331,16 @@ void OperationMultiEvalModMaskStreaming::multTranspose(sgpp::base::DataVector& s
 
     getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
 
-    this->multTransposeImpl(this->level, this->index, this->mask, this->offset,
-                            &this->preparedDataset, source, result, start, end, 0,
-                            this->preparedDataset.getNcols());
+    this->multTransposeDispatch(this->level, this->index, this->mask, this->offset,
+                                &this->preparedDataset, source, result, start, end, 0,
+                                this->preparedDataset.getNcols());
   }
   source.resize(originalSize);
   this->duration = this->myTimer_.stop();
 }
 
 size_t OperationMultiEvalModMaskStreaming::padDataset(sgpp::base::DataMatrix& dataset) {
-  size_t vecWidth = this->getChunkDataPoints();
+  size_t vecWidth = getDataPadding();
 
   // Assure that data has a even number of instances -> padding might be needed
   size_t remainder = dataset.getNrows() % vecWidth;
@@ -167,7 +362,10 @@ size_t OperationMultiEvalModMaskStreaming::padDataset(sgpp::base::DataMatrix& da
 
 double OperationMultiEvalModMaskStreaming::getDuration() { return this->duration; }
 
-void OperationMultiEvalModMaskStreaming::prepare() { this->recalculateLevelIndexMask(); }
+void OperationMultiEvalModMaskStreaming::prepare() {
+  this->recalculateLevelIndexMask();
+  this->isTuned = false;
+}
 
 void OperationMultiEvalModMaskStreaming::recalculateLevelIndexMask() {
   size_t localWorkSize = this->getChunkGridPoints();
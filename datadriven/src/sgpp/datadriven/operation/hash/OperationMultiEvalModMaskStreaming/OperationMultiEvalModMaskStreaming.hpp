@@ -12,6 +12,7 @@
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
 #include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/datadriven/operation/hash/KernelDispatch.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -22,6 +23,11 @@
 #define STREAMING_MODLINEAR_MIC_AVX512_UNROLLING_WIDTH 96
 #endif
 
+#ifndef STREAMING_MODLINEAR_AUTOTUNE_WORK
+// number of grid points times data points times dimension of an autotuning benchmark run
+#define STREAMING_MODLINEAR_AUTOTUNE_WORK (1 << 24)
+#endif
+
 namespace sgpp {
 namespace datadriven {
 
@@ -42,6 +48,17 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
 
   double duration;
 
+  /// Instruction set of the kernels
+  KernelISA isa;
+  /// Number of data points processed per block, multiple of the kernel's unrolling width
+  size_t chunkDataPoints;
+  /// Number of grid points processed per block
+  size_t chunkGridPoints;
+  /// Whether the instruction set has been set explicitly (and is not subject to autotuning)
+  bool hasFixedISA;
+  /// Whether the kernel configuration has been tuned for the current grid
+  bool isTuned;
+
  public:
   OperationMultiEvalModMaskStreaming(base::Grid& grid,
                                      base::DataMatrix& dataset);
@@ -62,6 +79,16 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
 
   double getDuration() override;
 
+  /**
+   * @return instruction set of the kernels, by default the most capable one of this machine
+   */
+  KernelISA getKernelISA();
+
+  /**
+   * @param isa instruction set of the kernels, must be available on this machine
+   */
+  void setKernelISA(KernelISA isa);
+
  private:
   void getPartitionSegment(size_t start, size_t end, size_t segmentCount,
                            size_t segmentNumber, size_t* segmentStart,
@@ -69,9 +96,29 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
 
   size_t padDataset(sgpp::base::DataMatrix& dataset);
 
+  static size_t getDataPadding();
+
   void getOpenMPPartitionSegment(size_t start, size_t end, size_t* segmentStart,
                                  size_t* segmentEnd, size_t blocksize);
 
+  void autotune();
+
+  void multDispatch(std::vector<double>& level, std::vector<double>& index,
+                    std::vector<double>& mask, std::vector<double>& offset,
+                    sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+                    sgpp::base::DataVector& result, const size_t start_index_grid,
+                    const size_t end_index_grid, const size_t start_index_data,
+                    const size_t end_index_data);
+
+  void multTransposeDispatch(std::vector<double>& level, std::vector<double>& index,
+                             std::vector<double>& mask, std::vector<double>& offset,
+                             sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+                             sgpp::base::DataVector& result, const size_t start_index_grid,
+                             const size_t end_index_grid, const size_t start_index_data,
+                             const size_t end_index_data);
+
+  // the kernels are compiled once for every available instruction set, see KernelDispatch
+  template <KernelISA kernelISA>
   void multImpl(std::vector<double>& level, std::vector<double>& index,
                 std::vector<double>& mask, std::vector<double>& offset,
                 sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
@@ -79,6 +126,7 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
                 const size_t end_index_grid, const size_t start_index_data,
                 const size_t end_index_data);
 
+  template <KernelISA kernelISA>
   void multTransposeImpl(std::vector<double>& level, std::vector<double>& index,
                          std::vector<double>& mask, std::vector<double>& offset,
                          sgpp::base::DataMatrix* dataset,
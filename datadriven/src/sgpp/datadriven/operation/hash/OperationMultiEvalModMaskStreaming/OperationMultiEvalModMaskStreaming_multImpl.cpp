@@ -22,11 +22,15 @@
 #include <vector>
 #include <algorithm>
 
+// with USE_KERNEL_DISPATCH, only the kernels are compiled for the additional instruction sets
+#include <sgpp/datadriven/operation/hash/KernelTargetBegin.hpp>
+
 namespace sgpp {
 namespace datadriven {
 
 #if defined(__SSE3__) && !defined(__AVX__) && !defined(__AVX512F__)
-void OperationMultiEvalModMaskStreaming::multImpl(
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<SGPP_COMPILED_KERNEL_ISA>(
     std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
     std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
     sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
@@ -157,7 +161,8 @@ void OperationMultiEvalModMaskStreaming::multImpl(
 #endif
 
 #if defined(__SSE3__) && defined(__AVX__) && !defined(__AVX512F__)
-void OperationMultiEvalModMaskStreaming::multImpl(
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<SGPP_COMPILED_KERNEL_ISA>(
     std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
     std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
     sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
@@ -294,7 +299,8 @@ void OperationMultiEvalModMaskStreaming::multImpl(
 #endif
 
 #if defined(__MIC__) || defined(__AVX512F__)
-void OperationMultiEvalModMaskStreaming::multImpl(
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<SGPP_COMPILED_KERNEL_ISA>(
     std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
     std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
     sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
@@ -602,7 +608,8 @@ void OperationMultiEvalModMaskStreaming::multImpl(
 #endif
 
 #if !defined(__SSE3__) && !defined(__AVX__) && !defined(__MIC__) && !defined(__AVX512F__)
-void OperationMultiEvalModMaskStreaming::multImpl(
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<SGPP_COMPILED_KERNEL_ISA>(
     std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
     std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
     sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
@@ -661,3 +668,5 @@ void OperationMultiEvalModMaskStreaming::multImpl(
 
 }  // namespace datadriven
 }  // namespace sgpp
+
+#include <sgpp/datadriven/operation/hash/KernelTargetEnd.hpp>
@@ -21,10 +21,14 @@
 #include <vector>
 #include <algorithm>
 
+// with USE_KERNEL_DISPATCH, only the kernels are compiled for the additional instruction sets
+#include <sgpp/datadriven/operation/hash/KernelTargetBegin.hpp>
+
 namespace sgpp {
 namespace datadriven {
 
-void OperationMultiEvalModMaskStreaming::multTransposeImpl(
+template <>
+void OperationMultiEvalModMaskStreaming::multTransposeImpl<SGPP_COMPILED_KERNEL_ISA>(
     std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
     std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
     sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
@@ -521,3 +525,5 @@ void OperationMultiEvalModMaskStreaming::multTransposeImpl(
 }
 }  // namespace datadriven
 }  // namespace sgpp
+
+#include <sgpp/datadriven/operation/hash/KernelTargetEnd.hpp>
@@ -4,18 +4,53 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/KernelAutotuner.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 namespace sgpp {
 namespace datadriven {
 
+// the kernels are defined in OperationMultiEvalStreaming_multImpl.cpp and
+// OperationMultiEvalStreaming_multTransposeImpl.cpp, once for every compiled instruction set
+#define STREAMING_LINEAR_DECLARE_KERNELS(kernelISA)                                              \
+  template <>                                                                                  \
+  void OperationMultiEvalStreaming::multImpl<kernelISA>(                                       \
+      sgpp::base::DataMatrix * level, sgpp::base::DataMatrix * index,                          \
+      sgpp::base::DataMatrix * dataset, sgpp::base::DataVector & alpha,                        \
+      sgpp::base::DataVector & result, const size_t start_index_grid,                          \
+      const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data); \
+  template <>                                                                                  \
+  void OperationMultiEvalStreaming::multTransposeImpl<kernelISA>(                              \
+      sgpp::base::DataMatrix * level, sgpp::base::DataMatrix * index,                          \
+      sgpp::base::DataMatrix * dataset, sgpp::base::DataVector & source,                       \
+      sgpp::base::DataVector & result, const size_t start_index_grid,                          \
+      const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data);
+
+STREAMING_LINEAR_DECLARE_KERNELS(KernelISA::Scalar)
+STREAMING_LINEAR_DECLARE_KERNELS(KernelISA::SSE3)
+STREAMING_LINEAR_DECLARE_KERNELS(KernelISA::AVX)
+STREAMING_LINEAR_DECLARE_KERNELS(KernelISA::AVX2)
+STREAMING_LINEAR_DECLARE_KERNELS(KernelISA::AVX512)
+
+#undef STREAMING_LINEAR_DECLARE_KERNELS
+
 OperationMultiEvalStreaming::OperationMultiEvalStreaming(base::Grid& grid,
                                                          base::DataMatrix& dataset)
     : OperationMultipleEval(grid, dataset),
       preparedDataset(dataset),
       myTimer_(sgpp::base::SGppStopwatch()),
-      duration(-1.0) {
+      duration(-1.0),
+      isa(KernelDispatch::getBestISA()),
+      chunkDataPoints(KernelAutotuner::getDefaultStreamingChunkDataPoints(
+          isa, STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH)),
+      chunkGridPoints(12),
+      hasFixedISA(false),
+      isTuned(false) {
   this->storage = &grid.getStorage();
   this->padDataset(this->preparedDataset);
   this->preparedDataset.transpose();
@@ -79,18 +114,167 @@ void OperationMultiEvalStreaming::getOpenMPPartitionSegment(size_t start, size_t
 
 size_t OperationMultiEvalStreaming::getChunkGridPoints() {
   // not used by the MIC-implementation
-  return 12;
+  return this->chunkGridPoints;
+}
+size_t OperationMultiEvalStreaming::getChunkDataPoints() { return this->chunkDataPoints; }
+
+size_t OperationMultiEvalStreaming::getDataPadding() {
+  return KernelAutotuner::getStreamingDataPadding(STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH);
+}
+
+KernelISA OperationMultiEvalStreaming::getKernelISA() { return this->isa; }
+
+void OperationMultiEvalStreaming::setKernelISA(KernelISA isa) {
+  if (!KernelDispatch::isAvailable(isa)) {
+    throw sgpp::base::operation_exception(
+        "OperationMultiEvalStreaming: instruction set is not available on this machine");
+  }
+
+  this->isa = isa;
+  this->chunkDataPoints = KernelAutotuner::getDefaultStreamingChunkDataPoints(
+      isa, STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH);
+  this->chunkGridPoints = 12;
+  this->hasFixedISA = true;
+  this->isTuned = false;
+}
+
+void OperationMultiEvalStreaming::autotune() {
+  std::vector<KernelAutotuner::StreamingConfiguration> configurations =
+      KernelAutotuner::getStreamingConfigurations(this->isa, this->hasFixedISA,
+                                                  STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH);
+
+  // benchmark on a subset of the data points, such that a run takes a few milliseconds
+  const size_t gridSize = this->storage->getSize();
+  const size_t dims = this->storage->getDimension();
+  const size_t paddedDataSize = this->preparedDataset.getNcols();
+  const size_t sampleSize = KernelAutotuner::getBenchmarkSize(
+      STREAMING_LINEAR_AUTOTUNE_WORK, gridSize, dims, paddedDataSize, getDataPadding());
+
+  sgpp::base::DataVector alpha(gridSize, 1.0);
+  sgpp::base::DataVector result(paddedDataSize);
+  sgpp::base::DataVector source(paddedDataSize, 1.0);
+  sgpp::base::DataVector resultTranspose(gridSize);
+
+  auto applyConfiguration = [this](const KernelAutotuner::StreamingConfiguration& configuration) {
+    this->isa = configuration.isa;
+    this->chunkDataPoints = configuration.chunkDataPoints;
+    this->chunkGridPoints = configuration.chunkGridPoints;
+  };
+
+  applyConfiguration(KernelAutotuner::tuneStreaming(
+      "OperationMultiEvalStreaming", configurations, gridSize, dims, paddedDataSize,
+      [&](const KernelAutotuner::StreamingConfiguration& configuration) {
+        applyConfiguration(configuration);
+
+#pragma omp parallel
+        {
+          size_t start;
+          size_t end;
+          getOpenMPPartitionSegment(0, sampleSize, &start, &end, getChunkDataPoints());
+          this->multDispatch(level_, index_, &this->preparedDataset, alpha, result, 0, gridSize,
+                             start, end);
+
+          getOpenMPPartitionSegment(0, gridSize, &start, &end, 1);
+          this->multTransposeDispatch(level_, index_, &this->preparedDataset, source,
+                                      resultTranspose, start, end, 0, sampleSize);
+        }
+      }));
+  this->isTuned = true;
 }
-size_t OperationMultiEvalStreaming::getChunkDataPoints() {
-#if defined(__MIC__) || defined(__AVX512F__)
-  return STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH;
-#else
-  return 24;  // must be divisible by 24
+
+void OperationMultiEvalStreaming::multDispatch(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  switch (this->isa) {
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_SCALAR)
+    case KernelISA::Scalar:
+      this->multImpl<KernelISA::Scalar>(level, index, dataset, alpha, result, start_index_grid,
+                                        end_index_grid, start_index_data, end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_SSE3)
+    case KernelISA::SSE3:
+      this->multImpl<KernelISA::SSE3>(level, index, dataset, alpha, result, start_index_grid,
+                                      end_index_grid, start_index_data, end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_AVX)
+    case KernelISA::AVX:
+      this->multImpl<KernelISA::AVX>(level, index, dataset, alpha, result, start_index_grid,
+                                     end_index_grid, start_index_data, end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_AVX2)
+    case KernelISA::AVX2:
+      this->multImpl<KernelISA::AVX2>(level, index, dataset, alpha, result, start_index_grid,
+                                      end_index_grid, start_index_data, end_index_data);
+      return;
 #endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_AVX512)
+    case KernelISA::AVX512:
+      this->multImpl<KernelISA::AVX512>(level, index, dataset, alpha, result, start_index_grid,
+                                        end_index_grid, start_index_data, end_index_data);
+      return;
+#endif
+    default:
+      throw sgpp::base::operation_exception(
+          "OperationMultiEvalStreaming: no kernel compiled for the instruction set");
+  }
+}
+
+void OperationMultiEvalStreaming::multTransposeDispatch(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  switch (this->isa) {
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_SCALAR)
+    case KernelISA::Scalar:
+      this->multTransposeImpl<KernelISA::Scalar>(level, index, dataset, source, result,
+                                                 start_index_grid, end_index_grid,
+                                                 start_index_data, end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_SSE3)
+    case KernelISA::SSE3:
+      this->multTransposeImpl<KernelISA::SSE3>(level, index, dataset, source, result,
+                                               start_index_grid, end_index_grid, start_index_data,
+                                               end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_AVX)
+    case KernelISA::AVX:
+      this->multTransposeImpl<KernelISA::AVX>(level, index, dataset, source, result,
+                                              start_index_grid, end_index_grid, start_index_data,
+                                              end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_AVX2)
+    case KernelISA::AVX2:
+      this->multTransposeImpl<KernelISA::AVX2>(level, index, dataset, source, result,
+                                               start_index_grid, end_index_grid, start_index_data,
+                                               end_index_data);
+      return;
+#endif
+#if SGPP_KERNEL_ISA_IS_COMPILED(SGPP_KERNEL_ISA_LEVEL_AVX512)
+    case KernelISA::AVX512:
+      this->multTransposeImpl<KernelISA::AVX512>(level, index, dataset, source, result,
+                                                 start_index_grid, end_index_grid,
+                                                 start_index_data, end_index_data);
+      return;
+#endif
+    default:
+      throw sgpp::base::operation_exception(
+          "OperationMultiEvalStreaming: no kernel compiled for the instruction set");
+  }
 }
 
 void OperationMultiEvalStreaming::mult(sgpp::base::DataVector& alpha,
                                        sgpp::base::DataVector& result) {
+  if (!this->isTuned) {
+    this->autotune();
+  }
+
   this->myTimer_.start();
 
   size_t originalSize = result.getSize();
@@ -106,15 +290,102 @@ void OperationMultiEvalStreaming::mult(sgpp::base::DataVector& alpha,
     getOpenMPPartitionSegment(0, this->preparedDataset.getNcols(), &start, &end,
                               getChunkDataPoints());
 
-    this->multImpl(level_, index_, &this->preparedDataset, alpha, result, 0, alpha.getSize(), start,
-                   end);
+    this->multDispatch(level_, index_, &this->preparedDataset, alpha, result, 0, alpha.getSize(),
+                       start, end);
   }
   result.resize(originalSize);
   this->duration = this->myTimer_.stop();
 }
 
+void OperationMultiEvalStreaming::mult(sgpp::base::DataMatrix& alpha,
+                                       sgpp::base::DataMatrix& result) {
+  this->myTimer_.start();
+
+  const size_t numberOfVectors = alpha.getNcols();
+  const size_t gridSize = this->storage->getSize();
+  const size_t dims = this->preparedDataset.getNrows();
+  const size_t paddedDataSize = this->preparedDataset.getNcols();
+  const size_t dataSize = this->dataset.getNrows();
+  const double* ptrLevel = this->level_->getPointer();
+  const double* ptrIndex = this->index_->getPointer();
+  const double* ptrData = this->preparedDataset.getPointer();
+  const double* ptrAlpha = alpha.getPointer();
+
+  result.resizeRowsCols(dataSize, numberOfVectors);
+
+#pragma omp parallel
+  {
+    const size_t chunkSize = getChunkDataPoints();
+    size_t start;
+    size_t end;
+    getOpenMPPartitionSegment(0, paddedDataSize, &start, &end, chunkSize);
+
+    std::vector<double> support(chunkSize);
+    // results of the chunk, chunkSize entries per coefficient vector
+    std::vector<double> chunkResult(numberOfVectors * chunkSize);
+
+    for (size_t c = start; c < end; c += chunkSize) {
+      const size_t chunkEnd = std::min(c + chunkSize, end);
+      const size_t chunkPoints = chunkEnd - c;
+      double* ptrSupport = support.data();
+
+      std::fill(chunkResult.begin(), chunkResult.end(), 0.0);
+
+      for (size_t j = 0; j < gridSize; j++) {
+        std::fill(support.begin(), support.end(), 1.0);
+
+        for (size_t d = 0; d < dims; d++) {
+          const double level = ptrLevel[(j * dims) + d];
+          const double index = ptrIndex[(j * dims) + d];
+          const double* x = &ptrData[(d * paddedDataSize) + c];
+
+#pragma omp simd
+          for (size_t k = 0; k < chunkPoints; k++) {
+            ptrSupport[k] *= std::max(1.0 - std::fabs(level * x[k] - index), 0.0);
+          }
+        }
+
+        double maxSupport = 0.0;
+
+#pragma omp simd reduction(max : maxSupport)
+        for (size_t k = 0; k < chunkPoints; k++) {
+          maxSupport = std::max(maxSupport, ptrSupport[k]);
+        }
+
+        if (maxSupport == 0.0) {
+          continue;
+        }
+
+        // the basis function is evaluated once for all coefficient vectors
+        for (size_t v = 0; v < numberOfVectors; v++) {
+          const double curAlpha = ptrAlpha[(j * numberOfVectors) + v];
+          double* vectorResult = &chunkResult[v * chunkSize];
+
+#pragma omp simd
+          for (size_t k = 0; k < chunkPoints; k++) {
+            vectorResult[k] += curAlpha * ptrSupport[k];
+          }
+        }
+      }
+
+      // the padding points are not part of the result
+      for (size_t k = 0; (k < chunkPoints) && (c + k < dataSize); k++) {
+        for (size_t v = 0; v < numberOfVectors; v++) {
+          result.set(c + k, v, chunkResult[(v * chunkSize) + k]);
+        }
+      }
+    }
+  }
+
+  this->duration = this->myTimer_.stop();
+}
+
 void OperationMultiEvalStreaming::multTranspose(sgpp::base::DataVector& source,
                                                 sgpp::base::DataVector& result) {
+  if (!this->isTuned) {
+    this->autotune();
+  }
+
   this->myTimer_.start();
 
   size_t originalSize = source.getSize();
@@ -135,8 +406,8 @@ void OperationMultiEvalStreaming::multTranspose(sgpp::base::DataVector& source,
 
     getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
 
-    this->multTransposeImpl(this->level_, this->index_, &this->preparedDataset, source, result,
-                            start, end, 0, this->preparedDataset.getNcols());
+    this->multTransposeDispatch(this->level_, this->index_, &this->preparedDataset, source,
+                                result, start, end, 0, this->preparedDataset.getNcols());
   }
   source.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -156,7 +427,7 @@ void OperationMultiEvalStreaming::recalculateLevelAndIndex() {
 }
 
 size_t OperationMultiEvalStreaming::padDataset(sgpp::base::DataMatrix& dataset) {
-  size_t vecWidth = this->getChunkDataPoints();
+  size_t vecWidth = getDataPadding();
 
   // Assure that data has a even number of instances -> padding might be needed
   size_t remainder = dataset.getNrows() % vecWidth;
@@ -178,6 +449,9 @@ size_t OperationMultiEvalStreaming::padDataset(sgpp::base::DataMatrix& dataset)
 
 double OperationMultiEvalStreaming::getDuration() { return this->duration; }
 
-void OperationMultiEvalStreaming::prepare() { this->recalculateLevelAndIndex(); }
+void OperationMultiEvalStreaming::prepare() {
+  this->recalculateLevelAndIndex();
+  this->isTuned = false;
+}
 }  // namespace datadriven
 }  // namespace sgpp
@@ -12,6 +12,7 @@
 #include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/datadriven/operation/hash/KernelDispatch.hpp>
 #include <sgpp/globaldef.hpp>
 
 #ifndef STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH
@@ -19,6 +20,11 @@
 #define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 96
 #endif
 
+#ifndef STREAMING_LINEAR_AUTOTUNE_WORK
+// number of grid points times data points times dimension of an autotuning benchmark run
+#define STREAMING_LINEAR_AUTOTUNE_WORK (1 << 24)
+#endif
+
 namespace sgpp {
 namespace datadriven {
 
@@ -36,6 +42,17 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   double duration;
 
+  /// Instruction set of the kernels
+  KernelISA isa;
+  /// Number of data points processed per block, multiple of the kernel's unrolling width
+  size_t chunkDataPoints;
+  /// Number of grid points processed per block
+  size_t chunkGridPoints;
+  /// Whether the instruction set has been set explicitly (and is not subject to autotuning)
+  bool hasFixedISA;
+  /// Whether the kernel configuration has been tuned for the current grid
+  bool isTuned;
+
  public:
   OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset);
 
@@ -47,27 +64,66 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
 
+  /**
+   * Evaluates several coefficient vectors at once. The basis functions are evaluated only once
+   * for each chunk of data points and applied to all coefficient vectors. This uses portable
+   * SIMD loops instead of the instruction set specific kernels.
+   *
+   * @param alpha matrix with one coefficient vector per column
+   * @param result the results, one column per coefficient vector
+   */
+  void mult(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) override;
+
   void multTranspose(sgpp::base::DataVector& source, sgpp::base::DataVector& result) override;
 
   void prepare() override;
 
   double getDuration() override;
 
+  /**
+   * @return instruction set of the kernels, by default the most capable one of this machine
+   */
+  KernelISA getKernelISA();
+
+  /**
+   * @param isa instruction set of the kernels, must be available on this machine
+   */
+  void setKernelISA(KernelISA isa);
+
  private:
   void getPartitionSegment(size_t start, size_t end, size_t segmentCount, size_t segmentNumber,
                            size_t* segmentStart, size_t* segmentEnd, size_t blockSize);
 
   size_t padDataset(sgpp::base::DataMatrix& dataset);
 
+  static size_t getDataPadding();
+
   void getOpenMPPartitionSegment(size_t start, size_t end, size_t* segmentStart, size_t* segmentEnd,
                                  size_t blocksize);
 
+  void autotune();
+
+  void multDispatch(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                    sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+                    sgpp::base::DataVector& result, const size_t start_index_grid,
+                    const size_t end_index_grid, const size_t start_index_data,
+                    const size_t end_index_data);
+
+  void multTransposeDispatch(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                             sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+                             sgpp::base::DataVector& result, const size_t start_index_grid,
+                             const size_t end_index_grid, const size_t start_index_data,
+                             const size_t end_index_data);
+
+  // the kernels are compiled once for every available instruction set, see KernelDispatch
+  template <KernelISA kernelISA>
   void multImpl(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
                 sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
                 sgpp::base::DataVector& result, const size_t start_index_grid,
                 const size_t end_index_grid, const size_t start_index_data,
                 const size_t end_index_data);
 
+  template <KernelISA kernelISA>
   void multTransposeImpl(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
                          sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
                          sgpp::base::DataVector& result, const size_t start_index_grid,
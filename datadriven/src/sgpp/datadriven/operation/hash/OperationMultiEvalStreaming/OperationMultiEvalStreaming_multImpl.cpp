@@ -21,11 +21,15 @@
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
 #include <sgpp/globaldef.hpp>
 
+// with USE_KERNEL_DISPATCH, only the kernels are compiled for the additional instruction sets
+#include <sgpp/datadriven/operation/hash/KernelTargetBegin.hpp>
+
 namespace sgpp {
 namespace datadriven {
 
 #if defined(__SSE3__) && !defined(__AVX__) && !defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
+template <>
+void OperationMultiEvalStreaming::multImpl<SGPP_COMPILED_KERNEL_ISA>(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -148,7 +152,8 @@ void OperationMultiEvalStreaming::multImpl(
 #endif
 
 #if defined(__SSE3__) && defined(__AVX__) && !defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
+template <>
+void OperationMultiEvalStreaming::multImpl<SGPP_COMPILED_KERNEL_ISA>(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -278,7 +283,8 @@ void OperationMultiEvalStreaming::multImpl(
 #endif
 
 #if defined(__MIC__) || defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
+template <>
+void OperationMultiEvalStreaming::multImpl<SGPP_COMPILED_KERNEL_ISA>(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -295,6 +301,7 @@ void OperationMultiEvalStreaming::multImpl(
   _mm512_extload_pd(A, _MM_UPCONV_PD_NONE, _MM_BROADCAST_1X8, _MM_HINT_NONE)
 #define _mm512_max_pd(A, B) _mm512_gmax_pd(A, B)
 #define _mm512_set1_epi64(A) _mm512_set_1to8_epi64(A)
+#define _mm512_set1_pd(A) _mm512_set_1to8_pd(A)
 #endif
 #if defined(__AVX512F__)
 #define _mm512_broadcast_sd(A) _mm512_broadcastsd_pd(_mm_load_sd(A))
@@ -409,7 +416,7 @@ void OperationMultiEvalStreaming::multImpl(
         eval_11 = _mm512_castsi512_pd(_mm512_and_epi64(abs2Mask, _mm512_castpd_si512(eval_11)));
 #endif
 
-        __m512d one = _mm512_set_1to8_pd(1.0);
+        __m512d one = _mm512_set1_pd(1.0);
 
         eval_0 = _mm512_sub_pd(one, eval_0);
         eval_1 = _mm512_sub_pd(one, eval_1);
@@ -573,7 +580,8 @@ void OperationMultiEvalStreaming::multImpl(
 #endif
 
 #if !defined(__SSE3__) && !defined(__AVX__) && !defined(__MIC__) && !defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
+template <>
+void OperationMultiEvalStreaming::multImpl<SGPP_COMPILED_KERNEL_ISA>(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -623,3 +631,5 @@ void OperationMultiEvalStreaming::multImpl(
 
 }  // namespace datadriven
 }  // namespace sgpp
+
+#include <sgpp/datadriven/operation/hash/KernelTargetEnd.hpp>
@@ -20,10 +20,14 @@
 #include <immintrin.h>  // NOLINT(build/include)
 #endif
 
+// with USE_KERNEL_DISPATCH, only the kernels are compiled for the additional instruction sets
+#include <sgpp/datadriven/operation/hash/KernelTargetBegin.hpp>
+
 namespace sgpp {
 namespace datadriven {
 
-void OperationMultiEvalStreaming::multTransposeImpl(
+template <>
+void OperationMultiEvalStreaming::multTransposeImpl<SGPP_COMPILED_KERNEL_ISA>(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -509,3 +513,5 @@ void OperationMultiEvalStreaming::multTransposeImpl(
 }
 }  // namespace datadriven
 }  // namespace sgpp
+
+#include <sgpp/datadriven/operation/hash/KernelTargetEnd.hpp>
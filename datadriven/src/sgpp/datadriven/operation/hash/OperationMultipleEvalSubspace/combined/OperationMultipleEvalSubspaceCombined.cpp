@@ -5,9 +5,11 @@
 
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/combined/OperationMultipleEvalSubspaceCombined.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/AbstractOperationMultipleEvalSubspace.hpp>
+#include <sgpp/datadriven/operation/hash/KernelAutotuner.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -15,12 +17,27 @@ using sgpp::base::Grid;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 
+// with USE_KERNEL_DISPATCH, the operation is compiled for AVX, see KernelTargetBegin.hpp
+#include <sgpp/datadriven/operation/hash/KernelTargetBegin.hpp>
+
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+
+// candidates for the autotuning, the data point candidates have to divide
+// X86COMBINED_PARALLEL_DATA_POINTS and to be multiples of X86COMBINED_VEC_PADDING
+const size_t parallelDataPointsCandidates[] = {64, 128, 256};
+const uint32_t streamingThresholdCandidates[] = {64, 128, 256};
+
+}  // namespace
+
 OperationMultipleEvalSubspaceCombined::OperationMultipleEvalSubspaceCombined(Grid& grid,
                                                                              DataMatrix& dataset)
-    : AbstractOperationMultipleEvalSubspace(grid, dataset) {
+    : AbstractOperationMultipleEvalSubspace(grid, dataset),
+      parallelDataPoints(X86COMBINED_PARALLEL_DATA_POINTS),
+      streamingThreshold(X86COMBINED_STREAMING_THRESHOLD),
+      preparedStreamingThreshold(0) {
   this->paddedDataset = this->padDataset(dataset);
   this->storage = &grid.getStorage();
   // this->dataset = dataset;
@@ -58,10 +75,78 @@ OperationMultipleEvalSubspaceCombined::~OperationMultipleEvalSubspaceCombined()
 }
 
 void OperationMultipleEvalSubspaceCombined::prepare() {
+  // the grid might have changed
+  this->preparedStreamingThreshold = 0;
+
+  this->autotune();
+  this->prepareSubspaces();
+}
+
+void OperationMultipleEvalSubspaceCombined::prepareSubspaces() {
+  if (this->preparedStreamingThreshold == this->streamingThreshold) {
+    return;
+  }
+
   this->allLevelsIndexMap.clear();
   this->allSubspaceNodes.clear();
 
   this->prepareSubspaceIterator();
+  this->preparedStreamingThreshold = this->streamingThreshold;
+}
+
+void OperationMultipleEvalSubspaceCombined::autotune() {
+  struct Configuration {
+    size_t parallelDataPoints;
+    uint32_t streamingThreshold;
+  };
+
+  // the first configuration is the default one, the others are sorted by the streaming threshold
+  // such that the subspaces have to be recreated as rarely as possible
+  std::vector<Configuration> configurations = {
+      {X86COMBINED_PARALLEL_DATA_POINTS, X86COMBINED_STREAMING_THRESHOLD}};
+
+  for (uint32_t candidateStreamingThreshold : streamingThresholdCandidates) {
+    for (size_t candidateParallelDataPoints : parallelDataPointsCandidates) {
+      if ((X86COMBINED_PARALLEL_DATA_POINTS % candidateParallelDataPoints != 0) ||
+          (candidateParallelDataPoints % X86COMBINED_VEC_PADDING != 0) ||
+          ((candidateParallelDataPoints == X86COMBINED_PARALLEL_DATA_POINTS) &&
+           (candidateStreamingThreshold == X86COMBINED_STREAMING_THRESHOLD))) {
+        continue;
+      }
+
+      configurations.push_back({candidateParallelDataPoints, candidateStreamingThreshold});
+    }
+  }
+
+  // benchmark on a subset of the data points, such that a run takes a few milliseconds
+  const size_t gridSize = this->storage->getSize();
+  const size_t paddedDataSize = this->getPaddedDatasetSize();
+  const size_t sampleSize =
+      KernelAutotuner::getBenchmarkSize(X86COMBINED_AUTOTUNE_WORK, gridSize, this->dim,
+                                        paddedDataSize, X86COMBINED_PARALLEL_DATA_POINTS);
+
+  DataVector alpha(gridSize, 1.0);
+  DataVector result(paddedDataSize);
+
+  size_t bestConfiguration = KernelAutotuner::tune(
+      "OperationMultipleEvalSubspaceCombined", KernelISA::AVX, gridSize, this->dim,
+      paddedDataSize, configurations.size(), 0, [&](size_t i) {
+        this->parallelDataPoints = configurations[i].parallelDataPoints;
+        this->streamingThreshold = configurations[i].streamingThreshold;
+        this->prepareSubspaces();
+
+#pragma omp parallel
+        {
+          size_t start;
+          size_t end;
+          PartitioningTool::getOpenMPPartitionSegment(0, sampleSize, &start, &end,
+                                                      this->getAlignment());
+          this->multImpl(alpha, result, start, end);
+        }
+      });
+
+  this->parallelDataPoints = configurations[bestConfiguration].parallelDataPoints;
+  this->streamingThreshold = configurations[bestConfiguration].streamingThreshold;
 }
 
 void OperationMultipleEvalSubspaceCombined::setCoefficients(DataVector& surplusVector) {
@@ -220,11 +305,11 @@ size_t OperationMultipleEvalSubspaceCombined::getPaddedDatasetSize() {
   return this->paddedDataset->getNrows();
 }
 
-size_t OperationMultipleEvalSubspaceCombined::getAlignment() {
-  return X86COMBINED_PARALLEL_DATA_POINTS;
-}
+size_t OperationMultipleEvalSubspaceCombined::getAlignment() { return this->parallelDataPoints; }
 
 std::string OperationMultipleEvalSubspaceCombined::getImplementationName() { return "COMBINED"; }
 
 }  // namespace datadriven
 }  // namespace sgpp
+
+#include <sgpp/datadriven/operation/hash/KernelTargetEnd.hpp>
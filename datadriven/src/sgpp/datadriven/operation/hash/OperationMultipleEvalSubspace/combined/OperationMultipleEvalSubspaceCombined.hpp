@@ -3,7 +3,9 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#ifdef __AVX__
+// with USE_KERNEL_DISPATCH, the operation is compiled for AVX independently of ARCH
+// and only created by the factory if the CPU supports AVX
+#if defined(__AVX__) || defined(USE_KERNEL_DISPATCH)
 
 #pragma once
 
@@ -20,6 +22,9 @@
 
 #include <sgpp/globaldef.hpp>
 
+// the inline functions use AVX, see KernelTargetBegin.hpp
+#include <sgpp/datadriven/operation/hash/KernelTargetBegin.hpp>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -47,6 +52,13 @@ class OperationMultipleEvalSubspaceCombined : public AbstractOperationMultipleEv
   // sgpp::base::GridStorage* storage = nullptr;
   uint32_t totalRegularGridPoints = -1;
 
+  /// Number of data points processed in parallel, divisor of X86COMBINED_PARALLEL_DATA_POINTS
+  size_t parallelDataPoints;
+  /// Subspaces with fewer grid points are stored as lists (if they are sparse enough)
+  uint32_t streamingThreshold;
+  /// Streaming threshold the subspaces have been created with, 0 if they have to be recreated
+  uint32_t preparedStreamingThreshold;
+
 #ifdef X86COMBINED_WRITE_STATS
   size_t refinementStep = 0;
   ofstream statsFile;
@@ -58,6 +70,18 @@ class OperationMultipleEvalSubspaceCombined : public AbstractOperationMultipleEv
    */
   void prepareSubspaceIterator();
 
+  /**
+   * Recreates the data structure used by the operation if it has not been created with the
+   * current streaming threshold.
+   */
+  void prepareSubspaces();
+
+  /**
+   * Chooses the number of data points processed in parallel and the streaming threshold
+   * with the KernelAutotuner.
+   */
+  void autotune();
+
   void listMultInner(size_t dim, const double* const datasetPtr, sgpp::base::DataVector& alpha,
                      size_t dataIndexBase, size_t end_index_data, SubspaceNodeCombined& subspace,
                      double* levelArrayContinuous, size_t validIndicesCount, size_t* validIndices,
@@ -423,4 +447,6 @@ class OperationMultipleEvalSubspaceCombined : public AbstractOperationMultipleEv
 }
 }
 
+#include <sgpp/datadriven/operation/hash/KernelTargetEnd.hpp>
+
 #endif
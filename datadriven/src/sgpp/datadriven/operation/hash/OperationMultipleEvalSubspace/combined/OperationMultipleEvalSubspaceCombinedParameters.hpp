@@ -10,9 +10,9 @@
  *
  */
 
-// number of data elements processed in parallel
+// (maximum) number of data elements processed in parallel
 // should be divisible by vector size
-// corresponds to data chunk size
+// corresponds to data chunk size, the autotuner may choose a smaller divisor
 #ifndef X86COMBINED_PARALLEL_DATA_POINTS
 //#define X86COMBINED_PARALLEL_DATA_POINTS 4
 #define X86COMBINED_PARALLEL_DATA_POINTS 256
@@ -44,6 +44,11 @@
 #define X86COMBINED_LIST_RATIO 0.2
 #endif
 
+// number of grid points times data points times dimension of an autotuning benchmark run
+#ifndef X86COMBINED_AUTOTUNE_WORK
+#define X86COMBINED_AUTOTUNE_WORK (1 << 24)
+#endif
+
 #ifndef X86COMBINED_ENABLE_PARTIAL_RESULT_REUSAGE
 #define X86COMBINED_ENABLE_PARTIAL_RESULT_REUSAGE 1
 #endif
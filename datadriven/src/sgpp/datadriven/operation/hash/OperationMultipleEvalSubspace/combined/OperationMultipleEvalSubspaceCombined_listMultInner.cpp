@@ -7,6 +7,9 @@
 
 #include <sgpp/globaldef.hpp>
 
+// with USE_KERNEL_DISPATCH, the operation is compiled for AVX, see KernelTargetBegin.hpp
+#include <sgpp/datadriven/operation/hash/KernelTargetBegin.hpp>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -109,7 +112,7 @@ void OperationMultipleEvalSubspaceCombined::listMultInner(
         double partialSurplus = 0.0;
 
         if (dataIndexBase + parallelIndex < end_index_data &&
-            parallelIndex < X86COMBINED_PARALLEL_DATA_POINTS) {
+            parallelIndex < this->parallelDataPoints) {
           partialSurplus = phiEval[innerIndex] * alpha[dataIndexBase + parallelIndex];
 
           size_t localIndexFlat = indexFlat[innerIndex];
@@ -143,7 +146,7 @@ void OperationMultipleEvalSubspaceCombined::listMultInner(
         double partialSurplus = 0.0;
 
         if (dataIndexBase + parallelIndex < end_index_data &&
-            parallelIndex < X86COMBINED_PARALLEL_DATA_POINTS) {
+            parallelIndex < this->parallelDataPoints) {
           partialSurplus = phiEval2[innerIndex] * alpha[dataIndexBase + parallelIndex];
 
           size_t localIndexFlat = indexFlat2[innerIndex];
@@ -172,3 +175,5 @@ void OperationMultipleEvalSubspaceCombined::listMultInner(
 }
 }
 }
+
+#include <sgpp/datadriven/operation/hash/KernelTargetEnd.hpp>
@@ -11,6 +11,9 @@
 
 #include <sgpp/globaldef.hpp>
 
+// with USE_KERNEL_DISPATCH, the operation is compiled for AVX, see KernelTargetBegin.hpp
+#include <sgpp/datadriven/operation/hash/KernelTargetBegin.hpp>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -70,7 +73,7 @@ void OperationMultipleEvalSubspaceCombined::multImpl(sgpp::base::DataVector& sou
 
   // process the next chunk of data tuples in parallel
   for (size_t dataIndexBase = start_index_data; dataIndexBase < end_index_data;
-       dataIndexBase += X86COMBINED_PARALLEL_DATA_POINTS) {
+       dataIndexBase += this->parallelDataPoints) {
     for (size_t i = 0; i < totalThreadNumber; i++) {
       levelIndices[i] = 0.0;
       componentResults[i] = 0.0;
@@ -97,8 +100,7 @@ void OperationMultipleEvalSubspaceCombined::multImpl(sgpp::base::DataVector& sou
 
       validIndicesCount = 0;
 
-      for (size_t parallelIndex = 0; parallelIndex < X86COMBINED_PARALLEL_DATA_POINTS;
-           parallelIndex++) {
+      for (size_t parallelIndex = 0; parallelIndex < this->parallelDataPoints; parallelIndex++) {
         size_t parallelLevelIndex = levelIndices[parallelIndex];
 
         if (parallelLevelIndex == subspaceIndex) {
@@ -107,11 +109,11 @@ void OperationMultipleEvalSubspaceCombined::multImpl(sgpp::base::DataVector& sou
         }
       }
 
-      size_t paddingSize = std::min(static_cast<int>(validIndicesCount + X86COMBINED_VEC_PADDING),
-                                    X86COMBINED_PARALLEL_DATA_POINTS + X86COMBINED_VEC_PADDING);
+      size_t paddingSize = std::min(validIndicesCount + X86COMBINED_VEC_PADDING,
+                                    this->parallelDataPoints + X86COMBINED_VEC_PADDING);
 
       for (size_t i = validIndicesCount; i < paddingSize; i++) {
-        size_t threadId = X86COMBINED_PARALLEL_DATA_POINTS + (i - validIndicesCount);
+        size_t threadId = this->parallelDataPoints + (i - validIndicesCount);
         validIndices[i] = threadId;
         componentResults[threadId] = 0.0;
         levelIndices[threadId] = 0;
@@ -139,8 +141,7 @@ void OperationMultipleEvalSubspaceCombined::multImpl(sgpp::base::DataVector& sou
       }
     }  // end iterate grid
 
-    for (size_t parallelIndex = 0; parallelIndex < X86COMBINED_PARALLEL_DATA_POINTS;
-         parallelIndex++) {
+    for (size_t parallelIndex = 0; parallelIndex < this->parallelDataPoints; parallelIndex++) {
       size_t dataIndex = dataIndexBase + parallelIndex;
       result.set(dataIndex, componentResults[parallelIndex]);
     }
@@ -152,3 +153,5 @@ void OperationMultipleEvalSubspaceCombined::multImpl(sgpp::base::DataVector& sou
 }
 }  // namespace datadriven
 }  // namespace sgpp
+
+#include <sgpp/datadriven/operation/hash/KernelTargetEnd.hpp>
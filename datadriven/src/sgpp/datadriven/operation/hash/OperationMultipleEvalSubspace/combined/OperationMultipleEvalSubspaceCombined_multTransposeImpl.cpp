@@ -7,6 +7,9 @@
 
 #include <sgpp/globaldef.hpp>
 
+// with USE_KERNEL_DISPATCH, the operation is compiled for AVX, see KernelTargetBegin.hpp
+#include <sgpp/datadriven/operation/hash/KernelTargetBegin.hpp>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -70,7 +73,7 @@ void OperationMultipleEvalSubspaceCombined::multTransposeImpl(sgpp::base::DataVe
   vector<uint64_t> dimRecalc(dim, 0);*/
 
   for (size_t dataIndexBase = start_index_data; dataIndexBase < end_index_data;
-       dataIndexBase += X86COMBINED_PARALLEL_DATA_POINTS) {
+       dataIndexBase += this->parallelDataPoints) {
     for (size_t i = 0; i < totalThreadNumber; i++) {
       levelIndices[i] = 0.0;
       // nextIterationToRecalcReferences[i] = 0;
@@ -90,8 +93,7 @@ void OperationMultipleEvalSubspaceCombined::multTransposeImpl(sgpp::base::DataVe
 
       validIndicesCount = 0;
 
-      for (size_t parallelIndex = 0; parallelIndex < X86COMBINED_PARALLEL_DATA_POINTS;
-           parallelIndex++) {
+      for (size_t parallelIndex = 0; parallelIndex < this->parallelDataPoints; parallelIndex++) {
         size_t parallelLevelIndex = levelIndices[parallelIndex];
 
         if (parallelLevelIndex == subspaceIndex) {
@@ -102,11 +104,11 @@ void OperationMultipleEvalSubspaceCombined::multTransposeImpl(sgpp::base::DataVe
 
       // padding for up to vector size, no padding required if all data tuples participate as
       // the number of data points is a multiple of the vector width
-      size_t paddingSize = std::min((int)(validIndicesCount + X86COMBINED_VEC_PADDING),
-                                    X86COMBINED_PARALLEL_DATA_POINTS + X86COMBINED_VEC_PADDING);
+      size_t paddingSize = std::min(validIndicesCount + X86COMBINED_VEC_PADDING,
+                                    this->parallelDataPoints + X86COMBINED_VEC_PADDING);
 
       for (size_t i = validIndicesCount; i < paddingSize; i++) {
-        size_t threadId = X86COMBINED_PARALLEL_DATA_POINTS + (i - validIndicesCount);
+        size_t threadId = this->parallelDataPoints + (i - validIndicesCount);
         validIndices[i] = threadId;
         levelIndices[threadId] = 0;
         // nextIterationToRecalcReferences[threadId] = 0;
@@ -209,3 +211,5 @@ evaluations" << endl;
 }
 }
 }
+
+#include <sgpp/datadriven/operation/hash/KernelTargetEnd.hpp>
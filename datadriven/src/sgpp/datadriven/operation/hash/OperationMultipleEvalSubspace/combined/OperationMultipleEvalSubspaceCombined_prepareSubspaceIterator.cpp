@@ -15,6 +15,9 @@ using sgpp::base::DataVector;
 #include <map>
 #include <algorithm>
 
+// with USE_KERNEL_DISPATCH, the operation is compiled for AVX, see KernelTargetBegin.hpp
+#include <sgpp/datadriven/operation/hash/KernelTargetBegin.hpp>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -125,7 +128,7 @@ void OperationMultipleEvalSubspaceCombined::prepareSubspaceIterator() {
   for (size_t subspaceIndex = 0; subspaceIndex < this->subspaceCount; subspaceIndex++) {
     SubspaceNodeCombined& subspace = this->allSubspaceNodes[subspaceIndex];
     // select representation
-    subspace.unpack();
+    subspace.unpack(this->streamingThreshold);
 
     this->allLevelsIndexMap.insert(std::make_pair(subspace.flatLevel, subspaceIndex));
 
@@ -252,3 +255,5 @@ void OperationMultipleEvalSubspaceCombined::prepareSubspaceIterator() {
 }
 }  // namespace datadriven
 }  // namespace sgpp
+
+#include <sgpp/datadriven/operation/hash/KernelTargetEnd.hpp>
@@ -7,6 +7,9 @@
 
 #include <sgpp/globaldef.hpp>
 
+// with USE_KERNEL_DISPATCH, the operation is compiled for AVX, see KernelTargetBegin.hpp
+#include <sgpp/datadriven/operation/hash/KernelTargetBegin.hpp>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -173,3 +176,5 @@ void OperationMultipleEvalSubspaceCombined::uncachedMultTransposeInner(
 }
 }
 }
+
+#include <sgpp/datadriven/operation/hash/KernelTargetEnd.hpp>
@@ -89,11 +89,11 @@ void SubspaceNodeCombined::printLevel() {
 // unpack has to be called when the subspace is set up (except for surplus valus)
 // this method will decide how to best represent the subspace (list or array type)
 // and prepare the subspace for its representation
-void SubspaceNodeCombined::unpack() {
+void SubspaceNodeCombined::unpack(uint32_t streamingThreshold) {
   double usageRatio = (double)this->existingGridPointsOnLevel / (double)this->gridPointsOnLevel;
 
   if (usageRatio < X86COMBINED_LIST_RATIO &&
-      this->existingGridPointsOnLevel < X86COMBINED_STREAMING_THRESHOLD) {
+      this->existingGridPointsOnLevel < streamingThreshold) {
     this->type = LIST;
   } else {
     this->type = ARRAY;
@@ -52,7 +52,8 @@ class SubspaceNodeCombined {
   // unpack has to be called when the subspace is set up (except for surplus valus)
   // this method will decide how to best represent the subspace (list or array type)
   // and prepare the subspace for its representation
-  void unpack();
+  // subspaces with fewer grid points than streamingThreshold may become list type subspaces
+  void unpack(uint32_t streamingThreshold);
 
   // the first call initializes the array for ARRAY type subspaces
   //
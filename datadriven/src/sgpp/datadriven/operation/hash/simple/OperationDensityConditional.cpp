@@ -16,6 +16,13 @@ namespace datadriven {
 void OperationDensityConditional::doConditional(base::DataVector& alpha, base::Grid*& mg,
                                                 base::DataVector& malpha, unsigned int mdim,
                                                 double xbar) {
+  mg = createConditionalGrid(mdim);
+  doConditional(alpha, *mg, malpha, mdim, xbar);
+}
+
+void OperationDensityConditional::doConditional(base::DataVector& alpha, base::Grid& mg,
+                                                base::DataVector& malpha, unsigned int mdim,
+                                                double xbar) {
   /**
    * Assume: mdim = 1
    * Compute vector with values
@@ -54,6 +61,38 @@ void OperationDensityConditional::doConditional(base::DataVector& alpha, base::G
 
   // std::cout << theta << std::endl;
 
+  /**
+   * Compute coefficients malpha for grid mg
+   */
+  base::GridStorage* mgs = &mg.getStorage();
+  sgpp::base::GridPoint mgp(mgs->getDimension());
+  malpha.resize(mgs->getSize());
+  malpha.setAll(0.0);
+  size_t mseqNr;
+
+  for (size_t seqNr = 0; seqNr < gs->getSize(); seqNr++) {
+    sgpp::base::GridPoint& gp = gs->getPoint(seqNr);
+
+    for (unsigned int d = 0; d < gs->getDimension(); d++) {
+      if (d < mdim)
+        mgp.set(d, gp.getLevel(d), gp.getIndex(d));
+      else if (d > mdim)
+        mgp.set(d - 1, gp.getLevel(d), gp.getIndex(d));
+    }
+
+    if (!mgs->isContaining(mgp))
+      throw sgpp::base::operation_exception(
+          "Key not found! This should not happen! There is something seriously wrong!");
+
+    // get index in alpha vector for current basis function
+    mseqNr = mgs->getSequenceNumber(mgp);
+    // update corresponding coefficient
+    malpha[mseqNr] += alpha[seqNr] * zeta[seqNr];
+  }
+  if (theta != 0) malpha.mult(1. / theta);
+}
+
+base::Grid* OperationDensityConditional::createConditionalGrid(unsigned int mdim) {
   /**
    * Generate d - 1 dimensional grid, as in marginalize
    */
@@ -63,11 +102,13 @@ void OperationDensityConditional::doConditional(base::DataVector& alpha, base::G
    * to the new grid mg
    */
   // create grid of dimensions d - 1 of the same type
+  sgpp::base::GridStorage* gs = &this->grid->getStorage();
+
   if (gs->getDimension() < 2)
     throw sgpp::base::operation_exception(
         "OperationDensityConditional is not possible for less than 2 dimensions");
 
-  mg = this->grid->createGridOfEquivalentType(gs->getDimension() - 1);
+  base::Grid* mg = this->grid->createGridOfEquivalentType(gs->getDimension() - 1);
   base::GridStorage* mgs = &mg->getStorage();
 
   // run through grid g and add points to mg
@@ -93,34 +134,7 @@ void OperationDensityConditional::doConditional(base::DataVector& alpha, base::G
   }
 
   mgs->recalcLeafProperty();
-
-  /**
-   * Compute coefficients malpha for grid mg
-   */
-  malpha.resize(mgs->getSize());
-  malpha.setAll(0.0);
-  size_t mseqNr;
-
-  for (size_t seqNr = 0; seqNr < gs->getSize(); seqNr++) {
-    sgpp::base::GridPoint& gp = gs->getPoint(seqNr);
-
-    for (unsigned int d = 0; d < gs->getDimension(); d++) {
-      if (d < mdim)
-        mgp.set(d, gp.getLevel(d), gp.getIndex(d));
-      else if (d > mdim)
-        mgp.set(d - 1, gp.getLevel(d), gp.getIndex(d));
-    }
-
-    if (!mgs->isContaining(mgp))
-      throw sgpp::base::operation_exception(
-          "Key not found! This should not happen! There is something seriously wrong!");
-
-    // get index in alpha vector for current basis function
-    mseqNr = mgs->getSequenceNumber(mgp);
-    // update corresponding coefficient
-    malpha[mseqNr] += alpha[seqNr] * zeta[seqNr];
-  }
-  if (theta != 0) malpha.mult(1. / theta);
+  return mg;
 }
 }  // namespace datadriven
 }  // namespace sgpp
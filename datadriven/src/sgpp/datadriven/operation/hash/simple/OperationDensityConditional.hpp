@@ -35,6 +35,29 @@ class OperationDensityConditional {
   virtual void doConditional(base::DataVector& alpha, base::Grid*& mg, base::DataVector& malpha,
                              unsigned int mdim, double xbar);
 
+  /**
+   * Conditional (Density) Functions on an existing grid, only the coefficients are computed.
+   * This allows to condition the same density on many values without creating a new grid
+   * every time.
+   *
+   * @param alpha Coefficient vector for current grid
+   * @param mg Grid created by createConditionalGrid for the same dimension mdim
+   * @param malpha Coefficient vector for mg. Will be resized.
+   * @param mdim Marginalize in dimension mdim
+   * @param xbar Point at which to conditionalize
+   */
+  virtual void doConditional(base::DataVector& alpha, base::Grid& mg, base::DataVector& malpha,
+                             unsigned int mdim, double xbar);
+
+  /**
+   * Creates the d - 1 dimensional grid that contains the points of the grid without
+   * dimension mdim.
+   *
+   * @param mdim Marginalize in dimension mdim
+   * @return new grid
+   */
+  base::Grid* createConditionalGrid(unsigned int mdim);
+
  protected:
   base::Grid* grid;
 };
@@ -13,7 +13,7 @@
 namespace sgpp {
 namespace datadriven {
 
-void OperationDensityConditionalLinear::doConditional(base::DataVector& alpha, base::Grid*& mg,
+void OperationDensityConditionalLinear::doConditional(base::DataVector& alpha, base::Grid& mg,
                                                       base::DataVector& malpha, unsigned int mdim,
                                                       double xbar) {
   /**
@@ -52,49 +52,11 @@ void OperationDensityConditionalLinear::doConditional(base::DataVector& alpha, b
 
   // std::cout << theta << std::endl;
 
-  /**
-   * Generate d - 1 dimensional grid, as in marginalize
-   */
-  /**
-   * Note: Because of adaptively refined sparse grids, we cannot simply
-   * generate a regular grid. Thus, we need to add point after point
-   * to the new grid mg
-   */
-  // create grid of dimensions d - 1 of the same type
-  if (gs->getDimension() < 2)
-    throw sgpp::base::operation_exception(
-        "OperationDensityConditional is not possible for less than 2 dimensions");
-
-  mg = base::Grid::createLinearGrid(gs->getDimension() - 1);
-  base::GridStorage* mgs = &mg->getStorage();
-
-  // run through grid g and add points to mg
-  sgpp::base::GridPoint mgp(mgs->getDimension());
-
-  for (size_t seqNr = 0; seqNr < gs->getSize(); seqNr++) {
-    sgpp::base::GridPoint& gp = gs->getPoint(seqNr);
-
-    for (unsigned int d = 0; d < gs->getDimension(); d++) {
-      // skip direction in which we marginalize
-      if (d == mdim) {
-        continue;
-      } else {
-        if (d < mdim) {
-          mgp.set(d, gp.getLevel(d), gp.getIndex(d));
-        } else {
-          mgp.set(d - 1, gp.getLevel(d), gp.getIndex(d));
-        }
-      }
-    }
-
-    if (!mgs->isContaining(mgp)) mgs->insert(mgp);
-  }
-
-  mgs->recalcLeafProperty();
-
   /**
    * Compute coefficients malpha for grid mg
    */
+  base::GridStorage* mgs = &mg.getStorage();
+  sgpp::base::GridPoint mgp(mgs->getDimension());
   malpha.resize(mgs->getSize());
   malpha.setAll(0.0);
   size_t mseqNr;
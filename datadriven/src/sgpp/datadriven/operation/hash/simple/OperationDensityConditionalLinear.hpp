@@ -25,16 +25,18 @@ class OperationDensityConditionalLinear : public OperationDensityConditional {
       : OperationDensityConditional(grid) {}
   ~OperationDensityConditionalLinear() override {}
 
+  using OperationDensityConditional::doConditional;
+
   /**
-   * Marginalizes (Density) Functions
+   * Conditional (Density) Functions on an existing grid, only the coefficients are computed.
    *
    * @param alpha Coefficient vector for current grid
-   * @param mg Referenz of grid pointer
-   * @param malpha Coefficient vector for new grid (mg). Will be resized.
+   * @param mg Grid created by createConditionalGrid for the same dimension mdim
+   * @param malpha Coefficient vector for mg. Will be resized.
    * @param mdim Marginalize in dimension mdim
    * @param xbar Point at which to conditionalize
    */
-  void doConditional(base::DataVector& alpha, base::Grid*& mg, base::DataVector& malpha,
+  void doConditional(base::DataVector& alpha, base::Grid& mg, base::DataVector& malpha,
                      unsigned int mdim, double xbar) override;
 };
 }  // namespace datadriven
@@ -55,6 +55,61 @@ void OperationDensityMargTo1D::margToDimX(base::DataVector* alpha, base::Grid*&
   return;
 }
 
+void OperationDensityMargTo1D::margToDimX(base::DataVector& alpha, base::Grid& grid_x,
+                                          base::DataVector& alpha_x, size_t dim_x) {
+  base::GridStorage& gs = this->grid->getStorage();
+  base::GridStorage& gs_x = grid_x.getStorage();
+  const size_t numDims = gs.getDimension();
+
+  if (dim_x >= numDims) {
+    throw base::operation_exception("Error: dimension out of range. Operation aborted!");
+  }
+
+  alpha_x.resize(gs_x.getSize());
+  alpha_x.setAll(0.0);
+  auto& basis = grid->getBasis();
+  base::GridPoint gp_x(1);
+
+  for (size_t seqNr = 0; seqNr < gs.getSize(); seqNr++) {
+    base::GridPoint& gp = gs.getPoint(seqNr);
+    double weight = alpha[seqNr];
+
+    for (size_t d = 0; d < numDims; d++) {
+      if (d != dim_x) weight *= basis.getIntegral(gp.getLevel(d), gp.getIndex(d));
+    }
+
+    gp_x.set(0, gp.getLevel(dim_x), gp.getIndex(dim_x));
+
+    if (!gs_x.isContaining(gp_x))
+      throw base::operation_exception(
+          "Key not found! This should not happen! There is something seriously wrong!");
+
+    alpha_x[gs_x.getSequenceNumber(gp_x)] += weight;
+  }
+}
+
+base::Grid* OperationDensityMargTo1D::create1DGrid(size_t dim_x) {
+  base::GridStorage& gs = this->grid->getStorage();
+
+  if (dim_x >= gs.getDimension()) {
+    throw base::operation_exception("Error: dimension out of range. Operation aborted!");
+  }
+
+  base::Grid* grid_x = this->grid->createGridOfEquivalentType(1);
+  base::GridStorage& gs_x = grid_x->getStorage();
+  base::GridPoint gp_x(1);
+
+  for (size_t seqNr = 0; seqNr < gs.getSize(); seqNr++) {
+    base::GridPoint& gp = gs.getPoint(seqNr);
+    gp_x.set(0, gp.getLevel(dim_x), gp.getIndex(dim_x));
+
+    if (!gs_x.isContaining(gp_x)) gs_x.insert(gp_x);
+  }
+
+  gs_x.recalcLeafProperty();
+  return grid_x;
+}
+
 void OperationDensityMargTo1D::margToDimXs(base::DataVector* alpha, base::Grid*& grid_x,
                                            base::DataVector*& alpha_x, std::vector<size_t>& dim_x) {
   size_t numDims = this->grid->getDimension();
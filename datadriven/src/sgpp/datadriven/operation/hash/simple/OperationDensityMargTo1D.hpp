@@ -35,6 +35,27 @@ class OperationDensityMargTo1D {
   virtual void margToDimX(base::DataVector* alpha, base::Grid*& grid_x, base::DataVector*& alpha_x,
                           size_t dim_x);
 
+  /**
+   * Marginalizes the (Density) Function to dimension dim_x on an existing 1D grid, only the
+   * coefficients are computed. Each coefficient is weighted with the integrals of its basis
+   * functions in all other dimensions.
+   *
+   * @param alpha Coefficient vector for current grid
+   * @param grid_x 1D grid created by create1DGrid for the same dimension dim_x
+   * @param alpha_x Coefficient vector for grid_x. Will be resized.
+   * @param dim_x Target dimension, all other dimensions will be marginalized
+   */
+  virtual void margToDimX(base::DataVector& alpha, base::Grid& grid_x, base::DataVector& alpha_x,
+                          size_t dim_x);
+
+  /**
+   * Creates the 1D grid that contains the points of the grid projected to dimension dim_x.
+   *
+   * @param dim_x Target dimension
+   * @return new 1D grid
+   */
+  base::Grid* create1DGrid(size_t dim_x);
+
   /**
    * Keep applying marginalizes to (Density) Functions, until it's reduced to d dimensions (dim_x)
    *
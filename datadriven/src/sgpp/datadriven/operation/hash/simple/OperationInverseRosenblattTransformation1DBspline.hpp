@@ -12,7 +12,6 @@
 #include <sgpp/globaldef.hpp>
 
 #include <functional>
-#include <map>
 #include <vector>
 
 namespace sgpp {
@@ -28,9 +27,14 @@ class OperationInverseRosenblattTransformation1DBspline : public OperationTransf
   std::vector<bool> is_negative_patch;
   std::vector<double> ordered_grid_points;
   std::vector<std::function<double(double)>> patch_functions;
-  std::multimap<double, double> coord_cdf;
+  /// values of the CDF at the ordered grid points
+  std::vector<double> cdf_values;
+  /// number of negative patches left of the ordered grid points
+  std::vector<size_t> negative_patches;
   double sum;
   size_t quadOrder;
+  /// evaluation point of the density
+  base::DataVector coord;
 
   /**
    * this function computes the CDF (i.e. the patch areas)
@@ -47,6 +51,14 @@ class OperationInverseRosenblattTransformation1DBspline : public OperationTransf
    */
   double sample(base::DataVector* alpha1d, double coord1d);
 
+  /**
+   * inverts the CDF after it has been computed
+   * @param alpha1d coefficient vector in the current direction
+   * @param coord1d value of the CDF
+   * @return the point where the CDF takes the value coord1d
+   */
+  double invert(base::DataVector* alpha1d, double coord1d);
+
  protected:
   base::Grid* grid;
 
@@ -61,6 +73,15 @@ class OperationInverseRosenblattTransformation1DBspline : public OperationTransf
    * @return
    */
   double doTransformation1D(base::DataVector* alpha1d, double coord1d);
+
+  /**
+   * Inverse Rosenblatt Transformation 1D of several coordinates, the CDF is computed only once
+   * @param alpha1d
+   * @param coords1d
+   * @param result
+   */
+  void doTransformation1D(base::DataVector* alpha1d, const base::DataVector& coords1d,
+                          base::DataVector& result);
 };
 
 }  // namespace datadriven
@@ -10,8 +10,6 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
-#include <utility>
-#include <map>
 #include <vector>
 #include <algorithm>
 
@@ -30,88 +28,18 @@ OperationInverseRosenblattTransformation1DLinear::
 
 double OperationInverseRosenblattTransformation1DLinear::doTransformation1D(
     base::DataVector* alpha1d, double coord1d) {
-  /***************** STEP 1. Compute CDF  ********************/
-  // compute PDF, sort by coordinates
-  std::multimap<double, double> coord_pdf, coord_cdf;
-  std::multimap<double, double>::iterator it1, it2;
-
-  base::GridStorage* gs = &grid->getStorage();
-  std::unique_ptr<base::OperationEval> opEval(op_factory::createOperationEval(*grid));
-  base::DataVector coord(1);
-
-  for (unsigned int i = 0; i < gs->getSize(); i++) {
-    coord[0] = gs->getPoint(i).getStandardCoordinate(0);
-    coord_pdf.insert(std::pair<double, double>(coord[0], opEval->eval(*alpha1d, coord)));
-    coord_cdf.insert(std::pair<double, double>(coord[0], i));
-  }
-
-  // include values at the boundary [0,1]
-  coord_pdf.insert(std::pair<double, double>(0.0, 0.0));
-  coord_pdf.insert(std::pair<double, double>(1.0, 0.0));
-  coord_cdf.insert(std::pair<double, double>(0.0, 0.0));
-  coord_cdf.insert(std::pair<double, double>(1.0, 1.0));
-
-  // Composite rule: trapezoidal (b-a)/2 * (f(a)+f(b))
-  it1 = coord_pdf.begin();
-  it2 = coord_pdf.begin();
-  std::vector<double> tmp;
-  tmp.push_back(0.0);
-  double sum = 0.0, area;
-
-  for (++it2; it2 != coord_pdf.end(); ++it2) {
-    // (*it).first : the coordinate
-    // (*it).second : the function value
-    area = ((*it2).first - (*it1).first) / 2 * (it1->second + it2->second);
-
-    // make sure that the cdf is monotonically increasing
-    // WARNING: THIS IS A HACK THAT OVERCOMES THE PROBLEM
-    // OF NON POSITIVE DENSITY
-    if (area < 0) {
-      std::cerr << "warning: negative area encountered (inverse) " << it1->second << ", "
-                << it2->second << std::endl;
-      area = 0;
-    }
-
-    tmp.push_back(area);
-    sum += area;
-    ++it1;
-  }
-
-  // compute CDF
-  double tmp_sum;
-  unsigned int i = 0;
-
-  for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    tmp_sum = 0.0;
-
-    for (unsigned int j = 0; j <= i; ++j) tmp_sum += tmp[j];
-
-    ++i;
-    (*it1).second = tmp_sum / sum;
-  }
-
-  tmp.clear();
-  coord_pdf.clear();
-  /***************** STEP 1. Done  ********************/
+  PiecewiseLinearCDF::reportNegativeAreas(cdf.init(*grid, *alpha1d, false), true);
+  return cdf.evalInverse(coord1d);
+}
 
-  /***************** STEP 2. Sampling  ********************/
-  double y, x1, x2, y1, y2;
+void OperationInverseRosenblattTransformation1DLinear::doTransformation1D(
+    base::DataVector* alpha1d, const base::DataVector& coords1d, base::DataVector& result) {
+  PiecewiseLinearCDF::reportNegativeAreas(cdf.init(*grid, *alpha1d, false), true);
+  result.resize(coords1d.getSize());
 
-  // find cdf interval
-  for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    if ((*it1).second >= coord1d) break;
+  for (size_t i = 0; i < coords1d.getSize(); i++) {
+    result[i] = cdf.evalInverse(coords1d[i]);
   }
-
-  x2 = (*it1).first;
-  y2 = (*it1).second;
-  --it1;
-  x1 = (*it1).first;
-  y1 = (*it1).second;
-  // find x (linear interpolation): (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
-  y = (x2 - x1) / (y2 - y1) * (coord1d - y1) + x1;
-
-  /***************** STEP 2. Done  ********************/
-  return y;
 }
 
 }  // namespace datadriven
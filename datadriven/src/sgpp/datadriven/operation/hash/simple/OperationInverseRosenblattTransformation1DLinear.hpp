@@ -8,6 +8,7 @@
 
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationTransformation1D.hpp>
+#include <sgpp/datadriven/operation/hash/simple/PiecewiseLinearCDF.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -17,6 +18,7 @@ namespace datadriven {
 class OperationInverseRosenblattTransformation1DLinear : public OperationTransformation1D {
  protected:
   base::Grid* grid;
+  PiecewiseLinearCDF cdf;
 
  public:
   explicit OperationInverseRosenblattTransformation1DLinear(base::Grid* grid);
@@ -29,6 +31,15 @@ class OperationInverseRosenblattTransformation1DLinear : public OperationTransfo
    * @return
    */
   double doTransformation1D(base::DataVector* alpha1d, double coord1d);
+
+  /**
+   * Inverse Rosenblatt Transformation 1D of several coordinates, the CDF is computed only once
+   * @param alpha1d
+   * @param coords1d
+   * @param result
+   */
+  void doTransformation1D(base::DataVector* alpha1d, const base::DataVector& coords1d,
+                          base::DataVector& result);
 };
 
 }  // namespace datadriven
@@ -34,7 +34,7 @@ namespace datadriven {
  */
 OperationInverseRosenblattTransformation1DPoly::OperationInverseRosenblattTransformation1DPoly(
     base::Grid* grid)
-    : sum(0.0), quadOrder(0), grid(grid) {}
+    : sum(0.0), quadOrder(0), coord(1), grid(grid) {}
 
 OperationInverseRosenblattTransformation1DPoly::~OperationInverseRosenblattTransformation1DPoly() {}
 
@@ -43,12 +43,9 @@ void OperationInverseRosenblattTransformation1DPoly::init(base::DataVector* alph
   is_negative_patch.clear();
   ordered_grid_points.clear();
   patch_functions.clear();
-  coord_cdf.clear();
   sum = 0;
   opEval = std::unique_ptr<base::OperationEval>(op_factory::createOperationEval(*grid));
 
-  base::DataVector coord(1);
-  std::multimap<double, double>::iterator it1;
   base::GridStorage* gs = &this->grid->getStorage();
   double area = 0.0;
   double right_coord = 0.0, right_function_value = 0.0;
@@ -61,14 +58,10 @@ void OperationInverseRosenblattTransformation1DPoly::init(base::DataVector* alph
   for (size_t i = 0; i < gs->getSize(); i++) {
     coord[0] = gs->getPoint(i).getStandardCoordinate(0);
     ordered_grid_points.push_back(coord[0]);
-    // inserting dummy points into coord_cdf to make it have the right size
-    coord_cdf.insert(std::pair<double, double>(coord[0], 0.0));
   }
   ordered_grid_points.push_back(0.0);
   ordered_grid_points.push_back(1.0);
 
-  coord_cdf.insert(std::pair<double, double>(0.0, 0.0));
-  coord_cdf.insert(std::pair<double, double>(1.0, 1.0));
   std::sort(ordered_grid_points.begin(), ordered_grid_points.end());
 
   double left_coord = 0.0;
@@ -199,15 +192,20 @@ void OperationInverseRosenblattTransformation1DPoly::init(base::DataVector* alph
     }
   }
 
-  // compute CDF
-  double tmp_sum;
-  unsigned int i = 0;
+  // compute CDF at the grid points and count the negative patches left of them
+  cdf_values.resize(ordered_grid_points.size());
+  negative_patches.resize(ordered_grid_points.size());
+  double tmp_sum = 0.0;
+  size_t negative_patch_counter = 0;
 
-  for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    tmp_sum = 0.0;
-    for (unsigned int j = 0; j < i; ++j) tmp_sum += patch_areas[j];
-    ++i;
-    it1->second = tmp_sum / sum;
+  for (size_t i = 0; i < ordered_grid_points.size(); i++) {
+    cdf_values[i] = tmp_sum / sum;
+    negative_patches[i] = negative_patch_counter;
+
+    if (i < patch_areas.size()) {
+      tmp_sum += patch_areas[i];
+      negative_patch_counter += is_negative_patch[i] ? 1 : 0;
+    }
   }
 }
 
@@ -215,35 +213,28 @@ double OperationInverseRosenblattTransformation1DPoly::sample(base::DataVector*
                                                               double coord1d) {
   if (coord1d == 0.0) return 0.0;
   if (sum == 0) return 0;
-  base::DataVector coord(1);
-  std::multimap<double, double>::iterator it1;
-  size_t patch_nr = 0;
-  int negative_patch_counter = 0;
-  for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    if (it1->first == coord1d)
-      return it1->second;
-    else if (it1->first >= coord1d)
-      break;
-    if (is_negative_patch[patch_nr]) {
-      // std::cout << "patch " << patch_nr << "is negative" << std::endl;
-      ++negative_patch_counter;
-    }
-    ++patch_nr;
+
+  // find cdf interval
+  const size_t numPoints = ordered_grid_points.size();
+  size_t patch_nr =
+      std::lower_bound(ordered_grid_points.begin(), ordered_grid_points.end(), coord1d) -
+      ordered_grid_points.begin();
+
+  if ((patch_nr < numPoints) && (ordered_grid_points[patch_nr] == coord1d)) {
+    return cdf_values[patch_nr];
   }
-  --patch_nr;
-  --negative_patch_counter;
-  // std::cout << "negative_patch_counter: " << negative_patch_counter << std::endl;
-  // std::cout << "patch_nr: " << patch_nr << std::endl;
-  // std::cout << "PAs size: " << patch_areas.size() << std::endl;
-  // std::cout << "PFs size : " << patch_functions.size() << std::endl;
-  --it1;
+
+  patch_nr = std::min(std::max(patch_nr, static_cast<size_t>(1)), numPoints - 1) - 1;
+
   double gaussQuadSum = 0.;
-  double left = it1->first;
+  double left = ordered_grid_points[patch_nr];
   double scaling = coord1d - left;
   if (is_negative_patch[patch_nr]) {
+    const std::function<double(double)>& patch_function =
+        patch_functions[negative_patches[patch_nr]];
     for (size_t c = 0; c < quadOrder; c++) {
       coord[0] = left + scaling * gauss_coordinates[c];
-      gaussQuadSum += weights[c] * patch_functions[negative_patch_counter](coord[0]);
+      gaussQuadSum += weights[c] * patch_function(coord[0]);
     }
   } else {
     for (size_t c = 0; c < quadOrder; c++) {
@@ -251,13 +242,27 @@ double OperationInverseRosenblattTransformation1DPoly::sample(base::DataVector*
       gaussQuadSum += weights[c] * opEval->eval(*alpha1d, coord);
     }
   }
-  return it1->second + (gaussQuadSum * scaling) / sum;
+  return cdf_values[patch_nr] + (gaussQuadSum * scaling) / sum;
 }
 
 double OperationInverseRosenblattTransformation1DPoly::doTransformation1D(base::DataVector* alpha1d,
                                                                           double coord1d) {
   init(alpha1d);
-  // std::cout << "PFs size after exit: " << patch_functions.size() << std::endl;
+  return invert(alpha1d, coord1d);
+}
+
+void OperationInverseRosenblattTransformation1DPoly::doTransformation1D(
+    base::DataVector* alpha1d, const base::DataVector& coords1d, base::DataVector& result) {
+  init(alpha1d);
+  result.resize(coords1d.getSize());
+
+  for (size_t i = 0; i < coords1d.getSize(); i++) {
+    result[i] = invert(alpha1d, coords1d[i]);
+  }
+}
+
+double OperationInverseRosenblattTransformation1DPoly::invert(base::DataVector* alpha1d,
+                                                              double coord1d) {
   std::function<double(const base::DataVector&)> optFunc = [this, coord1d, alpha1d](
       const base::DataVector& x) -> double {
     double F_x = sample(alpha1d, x[0]);
@@ -13,7 +13,6 @@
 #include <sgpp/base/tools/Printer.hpp>
 
 #include <functional>
-#include <map>
 #include <vector>
 
 namespace sgpp {
@@ -29,9 +28,14 @@ class OperationInverseRosenblattTransformation1DPoly : public OperationTransform
   std::vector<bool> is_negative_patch;
   std::vector<double> ordered_grid_points;
   std::vector<std::function<double(double)>> patch_functions;
-  std::multimap<double, double> coord_cdf;
+  /// values of the CDF at the ordered grid points
+  std::vector<double> cdf_values;
+  /// number of negative patches left of the ordered grid points
+  std::vector<size_t> negative_patches;
   double sum;
   size_t quadOrder;
+  /// evaluation point of the density
+  base::DataVector coord;
 
   /**
    * this function computes the CDF (i.e. the patch areas)
@@ -48,6 +52,14 @@ class OperationInverseRosenblattTransformation1DPoly : public OperationTransform
    */
   double sample(base::DataVector* alpha1d, double coord1d);
 
+  /**
+   * inverts the CDF after it has been computed
+   * @param alpha1d coefficient vector in the current direction
+   * @param coord1d value of the CDF
+   * @return the point where the CDF takes the value coord1d
+   */
+  double invert(base::DataVector* alpha1d, double coord1d);
+
  protected:
   base::Grid* grid;
 
@@ -62,6 +74,15 @@ class OperationInverseRosenblattTransformation1DPoly : public OperationTransform
    * @return
    */
   double doTransformation1D(base::DataVector* alpha1d, double coord1d);
+
+  /**
+   * Inverse Rosenblatt Transformation 1D of several coordinates, the CDF is computed only once
+   * @param alpha1d
+   * @param coords1d
+   * @param result
+   */
+  void doTransformation1D(base::DataVector* alpha1d, const base::DataVector& coords1d,
+                          base::DataVector& result);
 };
 
 }  // namespace datadriven
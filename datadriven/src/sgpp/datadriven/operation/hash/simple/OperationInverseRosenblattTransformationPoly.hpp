@@ -46,12 +46,17 @@ class OperationInverseRosenblattTransformationPoly
 
  protected:
   base::Grid* grid;
-  void doTransformation_start_dimX(base::Grid* g_in, base::DataVector* a_in, size_t dim_start,
-                                   base::DataVector* cdfs1d, base::DataVector* coords1d);
-  void doTransformation_in_next_dim(base::Grid* g_in, base::DataVector* a_in, size_t op_dim,
-                                    base::DataVector* cdfs1d, base::DataVector* coords1d,
-                                    size_t& curr_dim);
-  double doTransformation1D(base::Grid* grid1d, base::DataVector* alpha1d, double coord1d);
+
+  /**
+   * Transforms several coordinates with the same 1D density
+   *
+   * @param grid1d 1D grid
+   * @param alpha1d coefficient vector of the 1D density
+   * @param coords1d coordinates to be transformed
+   * @param result transformed coordinates
+   */
+  virtual void doTransformation1D(base::Grid* grid1d, base::DataVector* alpha1d,
+                                  const base::DataVector& coords1d, base::DataVector& result);
 };
 }  // namespace datadriven
 }  // namespace sgpp
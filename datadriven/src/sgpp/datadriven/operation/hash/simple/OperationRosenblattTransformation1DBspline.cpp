@@ -30,52 +30,53 @@ namespace datadriven {
  */
 OperationRosenblattTransformation1DBspline::OperationRosenblattTransformation1DBspline(
     base::Grid* grid)
-    : grid(grid) {}
+    : sum(0.0), quadOrder(0), coord(1), grid(grid) {}
 
 OperationRosenblattTransformation1DBspline::~OperationRosenblattTransformation1DBspline() {}
 
 double OperationRosenblattTransformation1DBspline::doTransformation1D(base::DataVector* alpha1d,
-                                                                     double coord1d) {
-  if (coord1d == 0.0)
-    return 0.0;
-  /***************** STEP 1. Compute CDF  ********************/
+                                                                      double coord1d) {
+  if (coord1d == 0.0) return 0.0;
+  init(alpha1d);
+  return sample(alpha1d, coord1d);
+}
+
+void OperationRosenblattTransformation1DBspline::doTransformation1D(
+    base::DataVector* alpha1d, const base::DataVector& coords1d, base::DataVector& result) {
+  init(alpha1d);
+  result.resize(coords1d.getSize());
+
+  for (size_t i = 0; i < coords1d.getSize(); i++) {
+    result[i] = sample(alpha1d, coords1d[i]);
+  }
+}
 
-  // compute PDF, sort by coordinates
-  std::multimap<double, double> coord_cdf;
-  std::vector<double> ordered_grid_points;
-  std::vector<bool> is_negative_patch;
-  std::multimap<double, double>::iterator it1;
+void OperationRosenblattTransformation1DBspline::init(base::DataVector* alpha1d) {
+  /***************** STEP 1. Compute CDF  ********************/
+  patch_areas.clear();
+  is_negative_patch.clear();
+  ordered_grid_points.clear();
+  patch_functions.clear();
+  sum = 0.0;
+  opEval = std::unique_ptr<base::OperationEval>(op_factory::createOperationEvalNaive(*grid));
 
   base::GridStorage* gs = &this->grid->getStorage();
-  std::unique_ptr<base::OperationEval> opEval(op_factory::createOperationEvalNaive(*grid));
-  base::DataVector coord(1);
-  base::DataVector gauss_coordinates;
-  base::DataVector weights;
-  base::GaussLegendreQuadRule1D gauss;
-  std::vector<double> patch_areas;
   size_t p = dynamic_cast<sgpp::base::BsplineGrid*>(grid)->getDegree();
-  const size_t quadOrder =  (p + 1) / 2;
+  quadOrder = (p + 1) / 2;
   gauss.getLevelPointsAndWeightsNormalized(quadOrder, gauss_coordinates, weights);
 
   double right_coord = 0.0, right_function_value = 0.0;
-  // std::cout << "size:" << gs->getSize() << std::endl;
-  double sum = 0.0 , area = 0.0;
+  double area = 0.0;
 
   // need an ordered list of the grid points
   for (size_t i = 0; i < gs->getSize(); i++) {
     coord[0] = gs->getPoint(i).getStandardCoordinate(0);
     ordered_grid_points.push_back(coord[0]);
-    // inserting dummy points into coord_cdf to make it have the right size
-    coord_cdf.insert(std::pair<double, double>(coord[0], 0.0));
   }
   ordered_grid_points.push_back(0.0);
   ordered_grid_points.push_back(1.0);
   std::sort(ordered_grid_points.begin(), ordered_grid_points.end());
 
-  coord_cdf.insert(std::pair<double, double>(0.0, 0.0));
-  coord_cdf.insert(std::pair<double, double>(1.0, 1.0));
-
-  std::vector<std::function<double(double)>> patch_functions;
   double left_coord = 0.0;
   coord[0] = 0.0;
   double left_function_value = opEval->eval(*alpha1d, coord);
@@ -220,65 +221,54 @@ double OperationRosenblattTransformation1DBspline::doTransformation1D(base::Data
       is_negative_patch.push_back(false);
     }
   }
-  if (sum == 0) return 0;
 
-  // compute CDF
-  double tmp_sum;
-  unsigned int i = 0;
+  // compute CDF at the grid points and count the negative patches left of them
+  cdf_values.resize(ordered_grid_points.size());
+  negative_patches.resize(ordered_grid_points.size());
+  double tmp_sum = 0.0;
+  size_t negative_patch_counter = 0;
 
-  for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    tmp_sum = 0.0;
-    for (unsigned int j = 0; j < i; ++j) tmp_sum += patch_areas[j];
-    ++i;
-    it1->second = tmp_sum / sum;
-  }
+  for (size_t i = 0; i < ordered_grid_points.size(); i++) {
+    cdf_values[i] = tmp_sum / sum;
+    negative_patches[i] = negative_patch_counter;
 
+    if (i < patch_areas.size()) {
+      tmp_sum += patch_areas[i];
+      negative_patch_counter += is_negative_patch[i] ? 1 : 0;
+    }
+  }
   /***************** STEP 1. Done  ********************/
+}
 
+double OperationRosenblattTransformation1DBspline::sample(base::DataVector* alpha1d,
+                                                          double coord1d) {
   /***************** STEP 2. Sampling  ********************/
-
-  // std::cout << "Areas: " << std::endl;
-  // for (size_t i = 0; i < patch_areas.size(); i++) {
-    // std::cout << patch_areas[i] << std::endl;
-  // }
-  // std::cout << "Size areas: " << patch_areas.size() << std::endl;
-  // std::cout << "Size cdf: " << coord_cdf.size() << std::endl;
-  // std::cout << "coord cdf: " << std::endl;
-  // for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    // std::cout << it1->first << ":" << it1->second << std::endl;
-  // }
+  if (coord1d == 0.0) return 0.0;
+  if (sum == 0) return 0;
 
   // find cdf interval
-  size_t patch_nr = 0;
-  int negative_patch_counter = 0;
-  for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    if (it1->first == coord1d)
-      return it1->second;
-    else if (it1->first >= coord1d)
-      break;
-    if (is_negative_patch[patch_nr]) {
-      // std::cout << "patch " << patch_nr << "is negative" << std::endl;
-      ++negative_patch_counter;
-    }
-    ++patch_nr;
+  const size_t numPoints = ordered_grid_points.size();
+  size_t patch_nr =
+      std::lower_bound(ordered_grid_points.begin(), ordered_grid_points.end(), coord1d) -
+      ordered_grid_points.begin();
+
+  if ((patch_nr < numPoints) && (ordered_grid_points[patch_nr] == coord1d)) {
+    return cdf_values[patch_nr];
   }
-  --patch_nr;
-  --negative_patch_counter;
 
-  // std::cout << "patch_nr: " << patch_nr << std::endl;
-  // std::cout << "patch_func size: " << patch_functions.size() << std::endl;
-  --it1;
+  patch_nr = std::min(std::max(patch_nr, static_cast<size_t>(1)), numPoints - 1) - 1;
+
   double gaussQuadSum = 0.;
-  double left = it1->first;
+  double left = ordered_grid_points[patch_nr];
   double scaling = coord1d - left;
   if (is_negative_patch[patch_nr]) {
-    // std::cout << "is negative" << std::endl;
+    const std::function<double(double)>& patch_function =
+        patch_functions[negative_patches[patch_nr]];
     for (size_t c = 0; c < quadOrder; c++) {
       coord[0] = left + scaling * gauss_coordinates[c];
-      gaussQuadSum += weights[c] * patch_functions[negative_patch_counter](coord[0]);
+      gaussQuadSum += weights[c] * patch_function(coord[0]);
     }
   } else {
-    // std::cout << "is not negative" << std::endl;
     for (size_t c = 0; c < quadOrder; c++) {
       coord[0] = left + scaling * gauss_coordinates[c];
       gaussQuadSum += weights[c] * opEval->eval(*alpha1d, coord);
@@ -286,7 +276,7 @@ double OperationRosenblattTransformation1DBspline::doTransformation1D(base::Data
   }
 
   /***************** STEP 2. Done  ********************/
-  return it1->second + (gaussQuadSum * scaling) / sum;
-}  // end of compute_1D_cdf()
+  return cdf_values[patch_nr] + (gaussQuadSum * scaling) / sum;
+}
 }  // namespace datadriven
 }  // namespace sgpp
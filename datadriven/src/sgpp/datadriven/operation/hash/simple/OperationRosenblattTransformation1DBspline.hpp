@@ -7,13 +7,52 @@
 #define OPERATIONROSENBLATTTRANSFORMATION1DBSPLINE_HPP
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationTransformation1D.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 namespace sgpp {
 namespace datadriven {
 class OperationRosenblattTransformation1DBspline : public OperationTransformation1D {
+ private:
+  base::GaussLegendreQuadRule1D gauss;
+  base::DataVector weights;
+  base::DataVector gauss_coordinates;
+  std::unique_ptr<base::OperationEval> opEval;
+  std::vector<double> patch_areas;
+  std::vector<bool> is_negative_patch;
+  std::vector<double> ordered_grid_points;
+  std::vector<std::function<double(double)>> patch_functions;
+  /// values of the CDF at the ordered grid points
+  std::vector<double> cdf_values;
+  /// number of negative patches left of the ordered grid points
+  std::vector<size_t> negative_patches;
+  double sum;
+  size_t quadOrder;
+  /// evaluation point of the density
+  base::DataVector coord;
+
+  /**
+   * this function computes the CDF (i.e. the patch areas)
+   * and saves it into the vectors of this object
+   * @param alpha1d coefficient vector in the current direction
+   */
+  void init(base::DataVector* alpha1d);
+
+  /**
+   * evaluates the CDF after it has been computed by init
+   * @param alpha1d coefficient vector in the current direction
+   * @param coord1d point where to evaluate the CDF
+   * @return the value of the CDF
+   */
+  double sample(base::DataVector* alpha1d, double coord1d);
+
  protected:
   base::Grid* grid;
 
@@ -28,6 +67,15 @@ class OperationRosenblattTransformation1DBspline : public OperationTransformatio
    * @return
    */
   double doTransformation1D(base::DataVector* alpha1d, double coord1d);
+
+  /**
+   * Rosenblatt Transformation 1D of several coordinates, the CDF is computed only once
+   * @param alpha1d
+   * @param coords1d
+   * @param result
+   */
+  void doTransformation1D(base::DataVector* alpha1d, const base::DataVector& coords1d,
+                          base::DataVector& result);
 };
 }  // namespace datadriven
 }  // namespace sgpp
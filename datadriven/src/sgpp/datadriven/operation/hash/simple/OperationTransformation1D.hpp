@@ -6,6 +6,7 @@
 #ifndef OPERATIONTRANSFORMATION1D_HPP
 #define OPERATIONTRANSFORMATION1D_HPP
 
+#include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -30,6 +31,24 @@ class OperationTransformation1D {
    * @return
    */
   virtual double doTransformation1D(base::DataVector* alpha1d, double coord1d) = 0;
+
+  /**
+   * Transform several coordinates with the same 1d density. Implementations compute the
+   * cumulative distribution function only once for all coordinates, the default
+   * implementation transforms each coordinate separately.
+   *
+   * @param alpha1d
+   * @param coords1d coordinates to be transformed
+   * @param result transformed coordinates, resized to the size of coords1d
+   */
+  virtual void doTransformation1D(base::DataVector* alpha1d, const base::DataVector& coords1d,
+                                  base::DataVector& result) {
+    result.resize(coords1d.getSize());
+
+    for (size_t i = 0; i < coords1d.getSize(); i++) {
+      result[i] = doTransformation1D(alpha1d, coords1d[i]);
+    }
+  }
 };
 
 }  // namespace datadriven
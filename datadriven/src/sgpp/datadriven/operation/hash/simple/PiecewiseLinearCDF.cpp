@@ -0,0 +1,143 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/PiecewiseLinearCDF.hpp>
+
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+size_t PiecewiseLinearCDF::init(base::Grid& grid1d, base::DataVector& alpha1d,
+                                bool fixNegativeValues) {
+  base::GridStorage& gs = grid1d.getStorage();
+  std::unique_ptr<base::OperationEval> opEval(op_factory::createOperationEval(grid1d));
+  base::DataVector coord(1);
+  const size_t numPoints = gs.getSize() + 2;
+
+  // compute PDF, the values at the boundary [0,1] are appended
+  coords.resize(numPoints);
+  pdfs.resize(numPoints);
+
+  for (size_t i = 0; i < gs.getSize(); i++) {
+    coord[0] = gs.getPoint(i).getStandardCoordinate(0);
+    coords[i] = coord[0];
+    pdfs[i] = opEval->eval(alpha1d, coord);
+  }
+
+  coords[numPoints - 2] = 0.0;
+  pdfs[numPoints - 2] = 0.0;
+  coords[numPoints - 1] = 1.0;
+  pdfs[numPoints - 1] = 0.0;
+
+  // sort by coordinates, equal coordinates keep their order
+  permutation.resize(numPoints);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    permutation[i] = i;
+  }
+
+  std::stable_sort(permutation.begin(), permutation.end(),
+                   [this](size_t i, size_t j) { return coords[i] < coords[j]; });
+
+  // cdfs is used as temporary storage for the sorted values
+  cdfs.resize(numPoints);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    cdfs[i] = coords[permutation[i]];
+  }
+
+  coords.swap(cdfs);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    cdfs[i] = pdfs[permutation[i]];
+  }
+
+  pdfs.swap(cdfs);
+
+  if (fixNegativeValues) {
+    // make sure that all the pdf values are positive
+    // if not, interpolate between the closest positive neighbors
+    pdfs[0] = std::max(pdfs[0], 0.0);
+
+    for (size_t i = 1; i < numPoints; i++) {
+      if (pdfs[i] < 0.0) {
+        // search for next right neighbor that has a positive function value
+        size_t j = i;
+
+        while (j < numPoints && pdfs[j] <= 0.0) {
+          j++;
+        }
+
+        pdfs[i] = (pdfs[i - 1] + ((j < numPoints) ? pdfs[j] : 0.0)) / 2.0;
+      }
+    }
+  }
+
+  // Composite rule: trapezoidal (b-a)/2 * (f(a)+f(b)), the areas are accumulated in cdfs
+  double sum = 0.0;
+  size_t numNegativeAreas = 0;
+  cdfs[0] = 0.0;
+
+  for (size_t i = 1; i < numPoints; i++) {
+    double area = (coords[i] - coords[i - 1]) / 2 * (pdfs[i - 1] + pdfs[i]);
+
+    // make sure that the cdf is monotonically increasing
+    // WARNING: THIS IS A HACK THAT OVERCOMES THE PROBLEM
+    // OF NON POSITIVE DENSITY
+    if (area < 0) {
+      ++numNegativeAreas;
+      area = 0;
+    }
+
+    sum += area;
+    cdfs[i] = sum;
+  }
+
+  // compute CDF
+  for (size_t i = 0; i < numPoints; i++) {
+    cdfs[i] /= sum;
+  }
+
+  return numNegativeAreas;
+}
+
+void PiecewiseLinearCDF::reportNegativeAreas(size_t numNegativeAreas, bool inverse) {
+  if (numNegativeAreas > 0) {
+    std::cerr << "warning: negative area encountered " << (inverse ? "(inverse) " : "")
+              << numNegativeAreas << " times" << std::endl;
+  }
+}
+
+double PiecewiseLinearCDF::eval(double coord1d) const {
+  // find cdf interval
+  size_t pos = std::lower_bound(coords.begin(), coords.end(), coord1d) - coords.begin();
+  return interpolate(coords, cdfs, pos, coord1d);
+}
+
+double PiecewiseLinearCDF::evalInverse(double cdf1d) const {
+  // find cdf interval
+  size_t pos = std::lower_bound(cdfs.begin(), cdfs.end(), cdf1d) - cdfs.begin();
+  return interpolate(cdfs, coords, pos, cdf1d);
+}
+
+double PiecewiseLinearCDF::interpolate(const std::vector<double>& xs,
+                                       const std::vector<double>& ys, size_t pos,
+                                       double x) const {
+  pos = std::min(std::max(pos, static_cast<size_t>(1)), xs.size() - 1);
+  double x1 = xs[pos - 1], x2 = xs[pos];
+  double y1 = ys[pos - 1], y2 = ys[pos];
+  // linear interpolation: (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
+  return (y2 - y1) / (x2 - x1) * (x - x1) + y1;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,77 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PIECEWISELINEARCDF_HPP
+#define PIECEWISELINEARCDF_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Cumulative distribution function of a 1D sparse grid density that is integrated with the
+ * trapezoidal rule between the grid points and interpolated linearly in between. The table is
+ * computed once by init() and can then be evaluated for many coordinates.
+ */
+class PiecewiseLinearCDF {
+ public:
+  PiecewiseLinearCDF() {}
+
+  /**
+   * Tabulates the cumulative distribution function of the density (grid1d, alpha1d).
+   *
+   * @param grid1d 1D grid
+   * @param alpha1d coefficient vector of the density
+   * @param fixNegativeValues replace negative density values at the grid points by the mean
+   * of the left neighbor and the next positive value to the right
+   * @return number of intervals with a negative area, which are set to zero
+   */
+  size_t init(base::Grid& grid1d, base::DataVector& alpha1d, bool fixNegativeValues);
+
+  /**
+   * Prints a single warning if negative areas were encountered.
+   *
+   * @param numNegativeAreas number of negative areas returned by init()
+   * @param inverse whether the tables were used for the inverse transformation
+   */
+  static void reportNegativeAreas(size_t numNegativeAreas, bool inverse);
+
+  /**
+   * @param coord1d coordinate in [0, 1]
+   * @return value of the cumulative distribution function at coord1d
+   */
+  double eval(double coord1d) const;
+
+  /**
+   * @param cdf1d value of the cumulative distribution function in [0, 1]
+   * @return coordinate where the cumulative distribution function equals cdf1d
+   */
+  double evalInverse(double cdf1d) const;
+
+ protected:
+  /// coordinates of the grid points and the boundaries, ascending
+  std::vector<double> coords;
+  /// values of the cumulative distribution function at coords
+  std::vector<double> cdfs;
+  /// density values at coords
+  std::vector<double> pdfs;
+  /// positions of the grid points in the order of the coordinates
+  std::vector<size_t> permutation;
+
+  /// evaluates the linear interpolant of (xs, ys) on the interval that ends at position pos
+  double interpolate(const std::vector<double>& xs, const std::vector<double>& ys, size_t pos,
+                     double x) const;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* PIECEWISELINEARCDF_HPP */
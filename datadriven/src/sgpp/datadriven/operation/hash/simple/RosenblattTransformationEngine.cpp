@@ -0,0 +1,284 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/RosenblattTransformationEngine.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
+namespace sgpp {
+namespace datadriven {
+
+RosenblattTransformationEngine::RosenblattTransformationEngine(base::Grid& grid,
+                                                               base::DataVector& alpha,
+                                                               bool inverse,
+                                                               Transformation1D transformation1D)
+    : grid(grid), alpha(alpha), inverse(inverse), transformation1D(transformation1D) {}
+
+void RosenblattTransformationEngine::getMixedStartDimensions(size_t numSamples, size_t numDims,
+                                                             std::vector<size_t>& startDims) {
+  startDims.resize(numSamples);
+  size_t dim_start = 0;
+  size_t bucket_size = numSamples / numDims + 1;
+
+  for (size_t i = 0; i < numSamples; i++) {
+    if (((i + 1) % bucket_size) == 0 && (i + 1) < numSamples) {
+      ++dim_start;
+    }
+
+    startDims[i] = dim_start;
+  }
+}
+
+void RosenblattTransformationEngine::doTransformation(base::DataMatrix& points,
+                                                      base::DataMatrix& result,
+                                                      const std::vector<size_t>& startDims) {
+  const size_t numDims = grid.getDimension();
+  const size_t numSamples = points.getNrows();
+
+  if (numDims == 1) {
+    throw base::operation_exception("Error: # of dimensions = 1. No operation needed!");
+  }
+
+  for (size_t i = 0; i < numSamples; i++) {
+    if (startDims[i] >= numDims) {
+      throw base::operation_exception("Error: dimension out of range. Operation aborted!");
+    }
+  }
+
+  // 1. sort the samples by their start dimension and their conditioning values,
+  // samples with the same conditioning values share the same conditioned densities
+  std::vector<size_t> samples(numSamples);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    samples[i] = i;
+  }
+
+  std::stable_sort(samples.begin(), samples.end(), [&](size_t i, size_t j) {
+    if (startDims[i] != startDims[j]) {
+      return startDims[i] < startDims[j];
+    }
+
+    // the transformed coordinates of the inverse transformation only depend on the
+    // previous input coordinates, so the input coordinates are used in both cases
+    for (size_t k = 0; k < numDims - 1; k++) {
+      const size_t dim = (startDims[i] + k) % numDims;
+
+      if (points.get(i, dim) != points.get(j, dim)) {
+        return points.get(i, dim) < points.get(j, dim);
+      }
+    }
+
+    return false;
+  });
+
+  // 2. marginalize to all occurring start dimensions and create the grids of the
+  // conditioned densities
+  std::vector<std::unique_ptr<base::Grid>> grids1d(numDims);
+  std::vector<std::unique_ptr<base::DataVector>> alphas1d(numDims);
+  std::vector<std::vector<ConditionalLevel>> levels(numDims);
+  std::unique_ptr<OperationDensityMargTo1D> marg1d(
+      op_factory::createOperationDensityMargTo1D(grid));
+  // ranges of the sorted samples with the same start dimension
+  std::vector<std::pair<size_t, size_t>> startRanges(numDims, std::make_pair(0, 0));
+
+  for (size_t begin = 0; begin < numSamples;) {
+    const size_t idim = startDims[samples[begin]];
+    size_t end = begin + 1;
+
+    while ((end < numSamples) && (startDims[samples[end]] == idim)) {
+      ++end;
+    }
+
+    base::Grid* g1d = nullptr;
+    base::DataVector* a1d = nullptr;
+    marg1d->margToDimX(&alpha, g1d, a1d, idim);
+    grids1d[idim].reset(g1d);
+    alphas1d[idim].reset(a1d);
+    createConditionalLevels(idim, levels[idim]);
+    startRanges[idim] = std::make_pair(begin, end);
+    begin = end;
+  }
+
+  // 3. 1D transformation in the start dimensions, every thread transforms a chunk of the
+  // samples of each start dimension
+  size_t numChunks = 1;
+#ifdef _OPENMP
+  numChunks = static_cast<size_t>(omp_get_max_threads());
+#endif /* _OPENMP */
+  // start dimension and range of the sorted samples
+  std::vector<std::pair<size_t, std::pair<size_t, size_t>>> tasks;
+
+  for (size_t idim = 0; idim < numDims; idim++) {
+    const size_t begin = startRanges[idim].first;
+    const size_t end = startRanges[idim].second;
+    const size_t chunkSize = (end - begin + numChunks - 1) / numChunks;
+
+    for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += chunkSize) {
+      tasks.push_back(
+          std::make_pair(idim, std::make_pair(chunkBegin, std::min(chunkBegin + chunkSize, end))));
+    }
+  }
+
+  // ranges of the sorted samples with the same start dimension and the same
+  // conditioning value in the start dimension
+  std::vector<std::pair<size_t, size_t>> groups;
+  std::exception_ptr exception = nullptr;
+
+#pragma omp parallel
+  {
+    Workspace workspace;
+    workspace.conditionalAlphas.resize(numDims - 1);
+    workspace.alphas1d.resize(numDims - 1);
+
+#pragma omp for schedule(dynamic)
+    for (size_t t = 0; t < tasks.size(); t++) {
+      try {
+        const size_t idim = tasks[t].first;
+        const size_t begin = tasks[t].second.first;
+        const size_t end = tasks[t].second.second;
+        transform1D(grids1d[idim].get(), alphas1d[idim].get(), &samples[begin], end - begin, idim,
+                    points, result, workspace);
+      } catch (...) {
+#pragma omp critical
+        { exception = std::current_exception(); }
+      }
+    }
+
+#pragma omp single
+    {
+      for (size_t begin = 0; begin < numSamples;) {
+        const size_t idim = startDims[samples[begin]];
+        const double value = getConditioningValue(points, result, samples[begin], idim);
+        size_t end = begin + 1;
+
+        while ((end < numSamples) && (startDims[samples[end]] == idim) &&
+               (getConditioningValue(points, result, samples[end], idim) == value)) {
+          ++end;
+        }
+
+        groups.push_back(std::make_pair(begin, end));
+        begin = end;
+      }
+    }
+
+    // 4. for every group of samples do the remaining dimensions
+#pragma omp for schedule(dynamic)
+    for (size_t g = 0; g < groups.size(); g++) {
+      try {
+        const size_t begin = groups[g].first;
+        const size_t idim = startDims[samples[begin]];
+        doTransformation_in_next_dim(levels[idim], 0, idim, &samples[begin],
+                                     groups[g].second - begin, points, result, workspace);
+      } catch (...) {
+#pragma omp critical
+        { exception = std::current_exception(); }
+      }
+    }
+  }
+
+  if (exception != nullptr) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void RosenblattTransformationEngine::transform1D(base::Grid* grid1d, base::DataVector* alpha1d,
+                                                 const size_t* samples, size_t numSamples,
+                                                 size_t dim, base::DataMatrix& points,
+                                                 base::DataMatrix& result,
+                                                 Workspace& workspace) {
+  workspace.coords1d.resize(numSamples);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    workspace.coords1d[i] = points.get(samples[i], dim);
+  }
+
+  transformation1D(grid1d, alpha1d, workspace.coords1d, workspace.result1d);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    result.set(samples[i], dim, workspace.result1d[i]);
+  }
+}
+
+void RosenblattTransformationEngine::createConditionalLevels(
+    size_t startDim, std::vector<ConditionalLevel>& levels) {
+  const size_t dims = grid.getDimension();  // total dimensions
+  base::Grid* g_in = &grid;
+  size_t op_dim = startDim;
+  levels.resize(dims - 1);
+
+  for (ConditionalLevel& level : levels) {
+    level.conditional.reset(op_factory::createOperationDensityConditional(*g_in));
+    level.conditionalDim = static_cast<unsigned int>(op_dim);
+    level.conditionalGrid.reset(level.conditional->createConditionalGrid(level.conditionalDim));
+    op_dim = (op_dim + 1) % level.conditionalGrid->getDimension();
+    level.margDim = op_dim;
+
+    if (level.conditionalGrid->getDimension() > 1) {
+      level.marg1d.reset(op_factory::createOperationDensityMargTo1D(*level.conditionalGrid));
+      level.grid1d.reset(level.marg1d->create1DGrid(level.margDim));
+    }
+
+    g_in = level.conditionalGrid.get();
+  }
+}
+
+void RosenblattTransformationEngine::doTransformation_in_next_dim(
+    const std::vector<ConditionalLevel>& levels, size_t level, size_t curr_dim,
+    const size_t* samples, size_t numSamples, base::DataMatrix& points, base::DataMatrix& result,
+    Workspace& workspace) {
+  const size_t dims = grid.getDimension();  // total dimensions
+  const ConditionalLevel& cl = levels[level];
+  base::DataVector& a_in = (level == 0) ? alpha : workspace.conditionalAlphas[level - 1];
+  base::DataVector& a_out = workspace.conditionalAlphas[level];
+
+  /* Step 1: do conditional in current dim */
+  cl.conditional->doConditional(a_in, *cl.conditionalGrid, a_out, cl.conditionalDim,
+                                getConditioningValue(points, result, samples[0], curr_dim));
+
+  // move on to next dim
+  curr_dim = (curr_dim + 1) % dims;
+
+  /* Step 2: transform all samples in next dim */
+  if (cl.grid1d != nullptr) {
+    // Marginalize to next dimension
+    base::DataVector& a1d = workspace.alphas1d[level];
+    cl.marg1d->margToDimX(a_out, *cl.grid1d, a1d, cl.margDim);
+    transform1D(cl.grid1d.get(), &a1d, samples, numSamples, curr_dim, points, result, workspace);
+  } else {
+    // skip Marginalize, directly transform in next dimension
+    transform1D(cl.conditionalGrid.get(), &a_out, samples, numSamples, curr_dim, points, result,
+                workspace);
+    return;
+  }
+
+  /* Step 3: continue with the samples that share the next conditioning value */
+  for (size_t begin = 0; begin < numSamples;) {
+    const double value = getConditioningValue(points, result, samples[begin], curr_dim);
+    size_t end = begin + 1;
+
+    while ((end < numSamples) &&
+           (getConditioningValue(points, result, samples[end], curr_dim) == value)) {
+      ++end;
+    }
+
+    doTransformation_in_next_dim(levels, level + 1, curr_dim, samples + begin, end - begin,
+                                 points, result, workspace);
+    begin = end;
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
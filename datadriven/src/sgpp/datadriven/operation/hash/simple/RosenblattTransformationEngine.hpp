@@ -0,0 +1,150 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ROSENBLATTTRANSFORMATIONENGINE_HPP
+#define ROSENBLATTTRANSFORMATIONENGINE_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationDensityConditional.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationDensityMargTo1D.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Batched (inverse) Rosenblatt transformation of a sparse grid density.
+ *
+ * Every sample is transformed dimension by dimension, starting in its start dimension: the
+ * density is conditioned on the coordinate of the previous dimension and marginalized to the
+ * next one, where the 1D transformation is applied. The samples are sorted by their start
+ * dimension and their conditioning values, such that the marginalized start densities are
+ * shared by all samples with the same start dimension and the conditioned densities are shared
+ * by all samples with the same conditioning values. Every 1D density is transformed for all
+ * samples sharing it at once, i.e., its cumulative distribution function is computed only
+ * once. The grids of the conditioned and marginalized densities only depend on the start
+ * dimension, so they are created once and shared by all threads, only their coefficients are
+ * computed per group of samples in the workspace of the thread.
+ */
+class RosenblattTransformationEngine {
+ public:
+  /**
+   * Function that transforms several coordinates with the same 1D density,
+   * arguments are the 1D grid, its coefficients, the coordinates and the result vector.
+   */
+  typedef std::function<void(base::Grid* grid1d, base::DataVector* alpha1d,
+                             const base::DataVector& coords1d, base::DataVector& result)>
+      Transformation1D;
+
+  /**
+   * Constructor
+   *
+   * @param grid grid of the density
+   * @param alpha coefficient vector of the density
+   * @param inverse true for the inverse Rosenblatt transformation, i.e., the density is
+   * conditioned on the transformed coordinates instead of the input coordinates
+   * @param transformation1D 1D transformation
+   */
+  RosenblattTransformationEngine(base::Grid& grid, base::DataVector& alpha, bool inverse,
+                                 Transformation1D transformation1D);
+
+  /**
+   * Transforms the samples.
+   *
+   * @param points input samples, one per row
+   * @param result transformed samples, must have the same size as points
+   * @param startDims start dimension of each sample
+   */
+  void doTransformation(base::DataMatrix& points, base::DataMatrix& result,
+                        const std::vector<size_t>& startDims);
+
+  /**
+   * Computes the start dimensions for mixed starting dimensions: the start dimension changes
+   * every numSamples / numDims + 1 samples. This distributes the error in the projection
+   * uniformly to all dimensions and makes it therefore stable.
+   *
+   * @param numSamples number of samples
+   * @param numDims number of dimensions
+   * @param startDims start dimension of each sample
+   */
+  static void getMixedStartDimensions(size_t numSamples, size_t numDims,
+                                      std::vector<size_t>& startDims);
+
+ protected:
+  /// conditioning step of the transformation, shared by all samples with the same start dimension
+  struct ConditionalLevel {
+    /// conditional operation on the grid of the previous level (or the density)
+    std::unique_ptr<OperationDensityConditional> conditional;
+    /// dimension of the previous grid the density is conditioned in
+    unsigned int conditionalDim;
+    /// grid of the conditioned density
+    std::unique_ptr<base::Grid> conditionalGrid;
+    /// marginalization of the conditioned density, null if conditionalGrid is 1D
+    std::unique_ptr<OperationDensityMargTo1D> marg1d;
+    /// dimension of conditionalGrid the density is marginalized to
+    size_t margDim;
+    /// 1D grid of the marginalized density, null if conditionalGrid is 1D
+    std::unique_ptr<base::Grid> grid1d;
+  };
+
+  /// per thread workspace
+  struct Workspace {
+    /// coordinates that are transformed with the same 1D density
+    base::DataVector coords1d;
+    /// transformed coordinates
+    base::DataVector result1d;
+    /// coefficients of the conditioned density of each level
+    std::vector<base::DataVector> conditionalAlphas;
+    /// coefficients of the marginalized density of each level
+    std::vector<base::DataVector> alphas1d;
+  };
+
+  base::Grid& grid;
+  base::DataVector& alpha;
+  bool inverse;
+  Transformation1D transformation1D;
+
+  /**
+   * Applies the 1D transformation to all given samples in dimension dim.
+   */
+  void transform1D(base::Grid* grid1d, base::DataVector* alpha1d, const size_t* samples,
+                   size_t numSamples, size_t dim, base::DataMatrix& points,
+                   base::DataMatrix& result, Workspace& workspace);
+
+  /**
+   * Creates the grids and operations of all conditioning steps for the start dimension.
+   */
+  void createConditionalLevels(size_t startDim, std::vector<ConditionalLevel>& levels);
+
+  /**
+   * Conditions the density of the given level on the common conditioning value of the given
+   * samples in dimension curr_dim, transforms the samples in the next dimension and
+   * recurses into the following dimensions.
+   */
+  void doTransformation_in_next_dim(const std::vector<ConditionalLevel>& levels, size_t level,
+                                    size_t curr_dim, const size_t* samples, size_t numSamples,
+                                    base::DataMatrix& points, base::DataMatrix& result,
+                                    Workspace& workspace);
+
+  /**
+   * @return the value the density is conditioned on for the sample in dimension dim
+   */
+  double getConditioningValue(base::DataMatrix& points, base::DataMatrix& result,
+                              size_t sample, size_t dim) const {
+    return inverse ? result.get(sample, dim) : points.get(sample, dim);
+  }
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* ROSENBLATTTRANSFORMATIONENGINE_HPP */
@@ -0,0 +1,419 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/BlockDecompressor.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef ZLIB
+#include <zlib.h>
+#endif /* ZLIB */
+
+#ifdef ZSTD
+#include <zstd.h>
+#endif /* ZSTD */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// number of compressed bytes that are read from the file at a time
+const size_t inputSize = 1 << 18;
+
+/// maximal size of a zstd frame header (ZSTD_FRAMEHEADERSIZE_MAX is not part of the stable API)
+const size_t zstdFrameHeaderSize = 18;
+
+#ifdef ZLIB
+/// releases the zlib stream state, also if decompressing fails
+struct InflateGuard {
+  z_stream* stream;
+  ~InflateGuard() { inflateEnd(stream); }
+};
+#endif /* ZLIB */
+
+#if defined(ZLIB) || defined(ZSTD)
+/// appends up to inputSize bytes of the file to input, returns the number of bytes read
+size_t readInput(std::ifstream& file, std::vector<char>& input) {
+  const size_t oldSize = input.size();
+  input.resize(oldSize + inputSize);
+  file.read(input.data() + oldSize, static_cast<std::streamsize>(inputSize));
+  const size_t bytesRead = static_cast<size_t>(file.gcount());
+  input.resize(oldSize + bytesRead);
+  return bytesRead;
+}
+#endif /* defined(ZLIB) || defined(ZSTD) */
+
+}  // namespace
+
+BlockDecompressor::Compression BlockDecompressor::detectCompression(const std::string& filename) {
+  std::ifstream file(filename, std::ios::in | std::ios::binary);
+  unsigned char magic[4] = {0, 0, 0, 0};
+
+  if (!file.is_open() || !file.read(reinterpret_cast<char*>(magic), 4)) {
+    return Compression::NONE;
+  }
+
+  if ((magic[0] == 0x1f) && (magic[1] == 0x8b)) {
+    return Compression::GZIP;
+  } else if ((magic[0] == 0x28) && (magic[1] == 0xb5) && (magic[2] == 0x2f) &&
+             (magic[3] == 0xfd)) {
+    return Compression::ZSTANDARD;
+  } else if (((magic[0] & 0xf0) == 0x50) && (magic[1] == 0x2a) && (magic[2] == 0x4d) &&
+             (magic[3] == 0x18)) {
+    // skippable frame, e.g., the size information pzstd writes in front of each frame
+    return Compression::ZSTANDARD;
+  }
+
+  return Compression::NONE;
+}
+
+std::string BlockDecompressor::getCompressionName(Compression compression) {
+  switch (compression) {
+    case Compression::GZIP:
+      return "gzip";
+    case Compression::ZSTANDARD:
+      return "zstd";
+    default:
+      return "none";
+  }
+}
+
+BlockDecompressor::BlockDecompressor(const std::string& filename, size_t blockSize, size_t depth)
+    : filename(filename),
+      compression(detectCompression(filename)),
+      blockSize(std::max(blockSize, static_cast<size_t>(1))),
+      depth(std::max(depth, static_cast<size_t>(1))),
+      stopRequested(false),
+      finished(false),
+      exception(nullptr) {
+  if (compression == Compression::NONE) {
+    throw sgpp::base::file_exception(
+        "BlockDecompressor: cannot open file or unknown compression format");
+  }
+#ifndef ZLIB
+  if (compression == Compression::GZIP) {
+    throw sgpp::base::file_exception(
+        "BlockDecompressor: sgpp has been built without zlib support, cannot read gzip files");
+  }
+#endif /* ZLIB */
+#ifndef ZSTD
+  if (compression == Compression::ZSTANDARD) {
+    throw sgpp::base::file_exception(
+        "BlockDecompressor: sgpp has been built without zstd support, cannot read zstd files");
+  }
+#endif /* ZSTD */
+
+  worker = std::thread(&BlockDecompressor::run, this);
+}
+
+BlockDecompressor::~BlockDecompressor() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopRequested = true;
+  }
+  slotAvailable.notify_all();
+
+  if (worker.joinable()) {
+    worker.join();
+  }
+}
+
+bool BlockDecompressor::readBlock(std::vector<char>& output) {
+  std::unique_lock<std::mutex> lock(mutex);
+  blockAvailable.wait(lock, [this] { return !queue.empty() || finished; });
+
+  if (!queue.empty()) {
+    if (output.empty()) {
+      output.swap(queue.front());
+    } else {
+      output.insert(output.end(), queue.front().begin(), queue.front().end());
+    }
+
+    queue.pop_front();
+    slotAvailable.notify_one();
+    return true;
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+
+  return false;
+}
+
+bool BlockDecompressor::pushBlock(std::vector<char>& block) {
+  std::unique_lock<std::mutex> lock(mutex);
+  slotAvailable.wait(lock, [this] { return stopRequested || (queue.size() < depth); });
+
+  if (stopRequested) {
+    return false;
+  }
+
+  if (!block.empty()) {
+    queue.push_back(std::move(block));
+    block = std::vector<char>();
+    lock.unlock();
+    blockAvailable.notify_one();
+  }
+
+  return true;
+}
+
+void BlockDecompressor::run() {
+  std::exception_ptr failure;
+
+  try {
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+
+    if (!file.is_open()) {
+      throw sgpp::base::file_exception("BlockDecompressor: cannot open file");
+    }
+
+    if (compression == Compression::GZIP) {
+      decompressGzip(file);
+    } else {
+      decompressZstd(file);
+    }
+  } catch (...) {
+    failure = std::current_exception();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    exception = failure;
+    finished = true;
+  }
+  blockAvailable.notify_one();
+}
+
+void BlockDecompressor::decompressGzip(std::ifstream& file) {
+#ifdef ZLIB
+  z_stream stream;
+  std::memset(&stream, 0, sizeof(stream));
+
+  // 15 + 32: maximal window size, gzip and zlib headers are detected automatically
+  if (inflateInit2(&stream, 15 + 32) != Z_OK) {
+    throw sgpp::base::file_exception("BlockDecompressor: cannot initialize zlib");
+  }
+
+  InflateGuard guard{&stream};
+  std::vector<char> input;
+  std::vector<char> block(blockSize);
+  size_t blockUsed = 0;
+  bool streamEnd = false;
+
+  while (true) {
+    input.clear();
+
+    if (readInput(file, input) == 0) {
+      break;
+    }
+
+    stream.next_in = reinterpret_cast<Bytef*>(input.data());
+    stream.avail_in = static_cast<uInt>(input.size());
+
+    while (stream.avail_in > 0) {
+      if (streamEnd) {
+        // concatenated gzip files consist of several members
+        inflateReset(&stream);
+        streamEnd = false;
+      }
+
+      stream.next_out = reinterpret_cast<Bytef*>(block.data() + blockUsed);
+      stream.avail_out = static_cast<uInt>(block.size() - blockUsed);
+      const int status = inflate(&stream, Z_NO_FLUSH);
+      blockUsed = block.size() - stream.avail_out;
+
+      if (status == Z_STREAM_END) {
+        streamEnd = true;
+      } else if ((status != Z_OK) && (status != Z_BUF_ERROR)) {
+        throw sgpp::base::file_exception("BlockDecompressor: corrupt gzip data");
+      }
+
+      if (blockUsed == block.size()) {
+        if (!pushBlock(block)) {
+          return;
+        }
+
+        block.resize(blockSize);
+        blockUsed = 0;
+      }
+    }
+  }
+
+  if (!streamEnd) {
+    throw sgpp::base::file_exception("BlockDecompressor: truncated gzip data");
+  }
+
+  block.resize(blockUsed);
+  pushBlock(block);
+#else
+  (void)file;
+#endif /* ZLIB */
+}
+
+void BlockDecompressor::decompressZstd(std::ifstream& file) {
+#ifdef ZSTD
+  std::unique_ptr<ZSTD_DCtx, size_t (*)(ZSTD_DCtx*)> context(ZSTD_createDCtx(), ZSTD_freeDCtx);
+
+  if (context == nullptr) {
+    throw sgpp::base::file_exception("BlockDecompressor: cannot initialize zstd");
+  }
+
+  // frames of known size up to this size are decompressed in parallel
+  const size_t maxParallelFrameSize = 4 * blockSize;
+  size_t numberOfThreads = 1;
+#ifdef _OPENMP
+  numberOfThreads = static_cast<size_t>(omp_get_max_threads());
+#endif /* _OPENMP */
+
+  // compressed input that has not been decompressed yet, starting at inputBegin
+  std::vector<char> input;
+  size_t inputBegin = 0;
+  // complete frames and their decompressed sizes
+  std::vector<std::pair<std::vector<char>, size_t>> frames;
+
+  auto readMoreInput = [&]() {
+    input.erase(input.begin(), input.begin() + static_cast<std::ptrdiff_t>(inputBegin));
+    inputBegin = 0;
+    return readInput(file, input) > 0;
+  };
+
+  auto decompressFrames = [&]() {
+    std::vector<std::vector<char>> outputs(frames.size());
+    bool failed = false;
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < frames.size(); i++) {
+      outputs[i].resize(frames[i].second);
+      const size_t result = ZSTD_decompress(outputs[i].data(), outputs[i].size(),
+                                            frames[i].first.data(), frames[i].first.size());
+
+      if (ZSTD_isError(result) || (result != frames[i].second)) {
+#pragma omp atomic write
+        failed = true;
+      }
+    }
+
+    frames.clear();
+
+    if (failed) {
+      throw sgpp::base::file_exception("BlockDecompressor: corrupt zstd data");
+    }
+
+    for (std::vector<char>& output : outputs) {
+      if (!pushBlock(output)) {
+        return false;
+      }
+    }
+
+    return true;
+  };
+
+  while (true) {
+    // the header of the next frame determines its decompressed size
+    while ((input.size() - inputBegin < zstdFrameHeaderSize) && readMoreInput()) {
+    }
+
+    if (input.size() == inputBegin) {
+      break;
+    }
+
+    const unsigned long long contentSize =
+        ZSTD_getFrameContentSize(input.data() + inputBegin, input.size() - inputBegin);
+
+    if (contentSize == ZSTD_CONTENTSIZE_ERROR) {
+      throw sgpp::base::file_exception("BlockDecompressor: corrupt zstd data");
+    }
+
+    if ((contentSize != ZSTD_CONTENTSIZE_UNKNOWN) && (contentSize <= maxParallelFrameSize)) {
+      // buffer the whole frame, it is decompressed with the next frames in parallel
+      size_t frameSize;
+
+      while (ZSTD_isError(frameSize = ZSTD_findFrameCompressedSize(input.data() + inputBegin,
+                                                                   input.size() - inputBegin))) {
+        if (!readMoreInput()) {
+          throw sgpp::base::file_exception("BlockDecompressor: truncated zstd data");
+        }
+      }
+
+      const char* frameBegin = input.data() + inputBegin;
+      frames.emplace_back(std::vector<char>(frameBegin, frameBegin + frameSize),
+                          static_cast<size_t>(contentSize));
+      inputBegin += frameSize;
+
+      if ((frames.size() >= numberOfThreads) && !decompressFrames()) {
+        return;
+      }
+
+      continue;
+    }
+
+    // large frames and frames of unknown size are decompressed as a stream
+    if (!decompressFrames()) {
+      return;
+    }
+
+    ZSTD_DCtx_reset(context.get(), ZSTD_reset_session_only);
+    std::vector<char> block(blockSize);
+    size_t blockUsed = 0;
+
+    while (true) {
+      ZSTD_inBuffer in = {input.data() + inputBegin, input.size() - inputBegin, 0};
+      ZSTD_outBuffer out = {block.data() + blockUsed, block.size() - blockUsed, 0};
+      const size_t status = ZSTD_decompressStream(context.get(), &out, &in);
+
+      if (ZSTD_isError(status)) {
+        throw sgpp::base::file_exception("BlockDecompressor: corrupt zstd data");
+      }
+
+      inputBegin += in.pos;
+      blockUsed += out.pos;
+
+      if (blockUsed == block.size()) {
+        if (!pushBlock(block)) {
+          return;
+        }
+
+        block.resize(blockSize);
+        blockUsed = 0;
+      }
+
+      if (status == 0) {
+        // end of the frame
+        break;
+      }
+
+      if ((in.pos == in.size) && (out.pos < out.size) && !readMoreInput()) {
+        throw sgpp::base::file_exception("BlockDecompressor: truncated zstd data");
+      }
+    }
+
+    block.resize(blockUsed);
+
+    if (!pushBlock(block)) {
+      return;
+    }
+  }
+
+  decompressFrames();
+#else
+  (void)file;
+#endif /* ZSTD */
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
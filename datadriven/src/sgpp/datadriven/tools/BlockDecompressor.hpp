@@ -0,0 +1,117 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BLOCKDECOMPRESSOR_HPP
+#define BLOCKDECOMPRESSOR_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Decompresses a gzip (requires ZLIB) or zstd (requires ZSTD) compressed file block by block.
+ *
+ * The file is decompressed on a background thread while the caller processes the previous
+ * blocks, at most depth blocks are decompressed ahead, so the memory consumption does not depend
+ * on the size of the file. Files consisting of several zstd frames whose decompressed size is
+ * known (e.g., written by pzstd) are decompressed frame-parallel by the OpenMP threads; gzip
+ * files and all other zstd frames are decompressed sequentially.
+ */
+class BlockDecompressor {
+ public:
+  /**
+   * Supported compression formats
+   */
+  enum class Compression { NONE, GZIP, ZSTANDARD };
+
+  /**
+   * Determines the compression format of a file from its first bytes.
+   *
+   * @param filename name of the file
+   * @return compression format, NONE if the file is not compressed or cannot be opened
+   */
+  static Compression detectCompression(const std::string& filename);
+
+  /**
+   * Name of a compression format for messages.
+   *
+   * @param compression compression format
+   * @return "gzip", "zstd" or "none"
+   */
+  static std::string getCompressionName(Compression compression);
+
+  /**
+   * Constructor, opens the file and starts decompressing it.
+   *
+   * @param filename name of a gzip or zstd compressed file
+   * @param blockSize approximate number of decompressed bytes per block
+   * @param depth maximal number of blocks that are decompressed ahead
+   */
+  explicit BlockDecompressor(const std::string& filename, size_t blockSize = 1 << 22,
+                             size_t depth = 2);
+
+  /**
+   * Destructor, stops the background thread.
+   */
+  ~BlockDecompressor();
+
+  BlockDecompressor(const BlockDecompressor&) = delete;
+  BlockDecompressor& operator=(const BlockDecompressor&) = delete;
+
+  /**
+   * Appends the next decompressed block to output, waiting for the background thread if
+   * necessary. Errors of the decompression (e.g., corrupt data) are rethrown here.
+   *
+   * @param output buffer the block is appended to
+   * @return false if the end of the file has been reached (output is left unchanged)
+   */
+  bool readBlock(std::vector<char>& output);
+
+ private:
+  /// name of the file
+  std::string filename;
+  /// compression format of the file
+  Compression compression;
+  /// approximate number of decompressed bytes per block
+  size_t blockSize;
+  /// maximal number of blocks that are decompressed ahead
+  size_t depth;
+
+  /// blocks that have been decompressed ahead
+  std::deque<std::vector<char>> queue;
+  /// protects all members that are shared with the background thread
+  std::mutex mutex;
+  /// signals the caller that a block has been decompressed or the background thread finished
+  std::condition_variable blockAvailable;
+  /// signals the background thread that a block has been taken or it has to stop
+  std::condition_variable slotAvailable;
+  /// whether the background thread has to stop
+  bool stopRequested;
+  /// whether the background thread finished, i.e., reached the end of the file or failed
+  bool finished;
+  /// exception thrown on the background thread
+  std::exception_ptr exception;
+  /// background thread
+  std::thread worker;
+
+  void run();
+  bool pushBlock(std::vector<char>& block);
+  void decompressGzip(std::ifstream& file);
+  void decompressZstd(std::ifstream& file);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* BLOCKDECOMPRESSOR_HPP */
@@ -0,0 +1,735 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/BlockDecompressor.hpp>
+#include <sgpp/datadriven/tools/StreamingDataParser.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+inline const char* findLineEnd(const char* begin, const char* end) {
+  const void* newline = std::memchr(begin, '\n', static_cast<size_t>(end - begin));
+  return (newline != nullptr) ? static_cast<const char*>(newline) : end;
+}
+
+inline bool isBlank(char c) { return (c == ' ') || (c == '\t') || (c == '\r'); }
+
+/// class labels are compared with this tolerance (the same as in ARFFTools and CSVTools)
+const double targetTolerance = 0.001;
+
+/// fields shorter than this are parsed without allocating memory
+const size_t maxFieldBufferLength = 64;
+
+}  // namespace
+
+StreamingDataParser::StreamingDataParser(Format format, bool hasTargets, size_t instanceCutoff,
+                                         std::vector<size_t> selectedCols,
+                                         std::vector<double> selectedTargets)
+    : format(format),
+      hasTargets(hasTargets),
+      instanceCutoff(instanceCutoff),
+      selectedCols(selectedCols),
+      selectedTargets(hasTargets ? selectedTargets : std::vector<double>()),
+      chunkSize(1 << 22),
+      data(nullptr),
+      dataSize(0),
+      input(nullptr),
+      dataStart(0),
+      numberOfFields(0),
+      numberInstances(0),
+      isCounted(false),
+      compressedFile(),
+      decompressedSize(0),
+      decompressor(nullptr),
+      window(),
+      windowOffset(0) {}
+
+StreamingDataParser::StreamingDataParser(const StreamingDataParser& other)
+    : format(other.format),
+      hasTargets(other.hasTargets),
+      instanceCutoff(other.instanceCutoff),
+      selectedCols(other.selectedCols),
+      selectedTargets(other.selectedTargets),
+      chunkSize(other.chunkSize),
+      data(other.data),
+      dataSize(other.dataSize),
+      input(other.input),
+      dataStart(other.dataStart),
+      numberOfFields(other.numberOfFields),
+      numberInstances(other.numberInstances),
+      isCounted(other.isCounted),
+      compressedFile(other.compressedFile),
+      decompressedSize(other.decompressedSize),
+      decompressor(nullptr),
+      window(),
+      windowOffset(0) {}
+
+StreamingDataParser::~StreamingDataParser() { unmap(); }
+
+void StreamingDataParser::unmap() {
+  // the memory is released by the last parser using it
+  input.reset();
+  data = nullptr;
+  dataSize = 0;
+
+  // also close a compressed input
+  compressedFile.clear();
+  decompressedSize = 0;
+  decompressor.reset();
+  std::vector<char>().swap(window);
+  windowOffset = 0;
+}
+
+void StreamingDataParser::readFile(const std::string& filename) {
+  unmap();
+
+#ifndef _WIN32
+  const int fd = open(filename.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    throw sgpp::base::file_exception("StreamingDataParser: cannot open file");
+  }
+
+  struct stat fileStatus;
+
+  if (fstat(fd, &fileStatus) != 0) {
+    close(fd);
+    throw sgpp::base::file_exception("StreamingDataParser: cannot determine file size");
+  }
+
+  const size_t fileSize = static_cast<size_t>(fileStatus.st_size);
+
+  if (fileSize > 0) {
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (mapping != MAP_FAILED) {
+      // the file is read front to back
+      madvise(mapping, fileSize, MADV_SEQUENTIAL);
+      input.reset(static_cast<const char*>(mapping),
+                  [fileSize](const char* mapped) { munmap(const_cast<char*>(mapped), fileSize); });
+      data = input.get();
+      dataSize = fileSize;
+    }
+  }
+
+  close(fd);
+#endif
+
+  if (input == nullptr) {
+    // fallback if memory mapping is not available
+    std::ifstream stream(filename, std::ios::in | std::ios::binary);
+
+    if (!stream.is_open()) {
+      throw sgpp::base::file_exception("StreamingDataParser: cannot open file");
+    }
+
+    setBuffer(std::make_shared<std::vector<char>>(std::istreambuf_iterator<char>(stream),
+                                                  std::istreambuf_iterator<char>()));
+  }
+
+  initialize();
+}
+
+void StreamingDataParser::readString(const std::string& content) {
+  unmap();
+  setBuffer(std::make_shared<std::vector<char>>(content.begin(), content.end()));
+  initialize();
+}
+
+void StreamingDataParser::setBuffer(std::shared_ptr<std::vector<char>> buffer) {
+  // the buffer lives as long as a parser refers to its contents
+  input = std::shared_ptr<const char>(buffer, buffer->data());
+  data = buffer->data();
+  dataSize = buffer->size();
+}
+
+void StreamingDataParser::initialize() {
+  const char* end = data + dataSize;
+
+  dataStart = 0;
+  numberOfFields = 0;
+  numberInstances = 0;
+  isCounted = false;
+
+  if (format == Format::CSV) {
+    // the first line contains the column titles
+    const char* firstLineEnd = findLineEnd(data, end);
+    dataStart = (firstLineEnd == end) ? dataSize : static_cast<size_t>(firstLineEnd - data) + 1;
+  }
+
+  // the first sample determines the number of columns
+  for (const char* lineBegin = data + dataStart; lineBegin < end;) {
+    const char* lineEnd = findLineEnd(lineBegin, end);
+
+    if (isSample(lineBegin, lineEnd)) {
+      numberOfFields = std::count(lineBegin, lineEnd, ',') + 1;
+      break;
+    }
+
+    lineBegin = lineEnd + 1;
+  }
+
+  checkColumnSelection();
+}
+
+void StreamingDataParser::readCompressedFile(const std::string& filename) {
+  if (BlockDecompressor::detectCompression(filename) == BlockDecompressor::Compression::NONE) {
+    readFile(filename);
+    return;
+  }
+
+  unmap();
+
+  BlockDecompressor decompressedInput(filename, chunkSize);
+  std::vector<char> text;
+  size_t textOffset = 0;
+  bool isHeaderSkipped = (format != Format::CSV);
+  bool hasMoreInput = true;
+  size_t count = 0;
+
+  compressedFile = filename;
+  dataStart = 0;
+  numberOfFields = 0;
+
+  // the file is decompressed once to determine the number of columns and samples
+  while (hasMoreInput) {
+    hasMoreInput = decompressedInput.readBlock(text);
+
+    if (!hasMoreInput && !text.empty() && (text.back() != '\n')) {
+      // terminate the last line, so that it is found like the other lines
+      text.push_back('\n');
+    }
+
+    // complete lines are processed, the rest is kept until the next block has been read
+    const auto lastLineBreak = std::find(text.rbegin(), text.rend(), '\n');
+
+    if (lastLineBreak == text.rend()) {
+      continue;
+    }
+
+    const char* begin = text.data();
+    const char* end = text.data() + (text.rend() - lastLineBreak);
+
+    if (!isHeaderSkipped) {
+      // the first line contains the column titles
+      begin = findLineEnd(begin, end) + 1;
+      dataStart = textOffset + static_cast<size_t>(begin - text.data());
+      isHeaderSkipped = true;
+    }
+
+    // the first sample determines the number of columns
+    for (const char* lineBegin = begin; (numberOfFields == 0) && (lineBegin < end);) {
+      const char* lineEnd = findLineEnd(lineBegin, end);
+
+      if (isSample(lineBegin, lineEnd)) {
+        numberOfFields = std::count(lineBegin, lineEnd, ',') + 1;
+      }
+
+      lineBegin = lineEnd + 1;
+    }
+
+    if (numberOfFields > 0) {
+      count += countSamples(begin, end);
+    }
+
+    const size_t processed = static_cast<size_t>(end - text.data());
+    text.erase(text.begin(), text.begin() + processed);
+    textOffset += processed;
+  }
+
+  decompressedSize = textOffset;
+  numberInstances = std::min(count, instanceCutoff);
+  isCounted = true;
+  checkColumnSelection();
+}
+
+void StreamingDataParser::checkColumnSelection() const {
+  if ((numberOfFields > 0) && (selectedCols.size() > 0) &&
+      (*std::max_element(selectedCols.begin(), selectedCols.end()) >=
+       numberOfFields - (hasTargets ? 1 : 0))) {
+    throw sgpp::base::data_exception("StreamingDataParser: invalid column selection");
+  }
+}
+
+size_t StreamingDataParser::getDimension() const {
+  if (numberOfFields == 0) {
+    return 0;
+  } else if (selectedCols.size() > 0) {
+    return selectedCols.size();
+  } else {
+    return numberOfFields - (hasTargets ? 1 : 0);
+  }
+}
+
+void StreamingDataParser::setChunkSize(size_t chunkSize) {
+  this->chunkSize = std::max(chunkSize, static_cast<size_t>(1));
+}
+
+StreamingDataParser::Cursor StreamingDataParser::begin() const {
+  Cursor cursor;
+  cursor.offset = dataStart;
+  cursor.numberRead = 0;
+  return cursor;
+}
+
+StreamingDataParser::Cursor StreamingDataParser::end() const {
+  Cursor cursor;
+  cursor.offset = compressedFile.empty() ? dataSize : decompressedSize;
+  cursor.numberRead = getNumberInstances();
+  return cursor;
+}
+
+bool StreamingDataParser::isSample(const char* lineBegin, const char* lineEnd) const {
+  const char* firstNonBlank = std::find_if_not(lineBegin, lineEnd, isBlank);
+
+  if (firstNonBlank == lineEnd) {
+    return false;
+  }
+
+  if ((format == Format::ARFF) &&
+      ((std::memchr(lineBegin, '%', lineEnd - lineBegin) != nullptr) ||
+       (std::memchr(lineBegin, '@', lineEnd - lineBegin) != nullptr))) {
+    return false;
+  }
+
+  if (selectedTargets.size() > 0) {
+    // the target is the last column
+    const char* targetBegin = lineEnd;
+
+    while ((targetBegin > lineBegin) && (*(targetBegin - 1) != ',')) {
+      targetBegin--;
+    }
+
+    const double target = parseValue(targetBegin, lineEnd);
+
+    for (double selectedTarget : selectedTargets) {
+      if (std::fabs(target - selectedTarget) < targetTolerance) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  return true;
+}
+
+size_t StreamingDataParser::collectChunk(size_t chunkBegin, size_t chunkEnd, size_t maxLines,
+                                         std::vector<const char*>& lines) const {
+  // collects the samples whose lines start in [chunkBegin, chunkEnd)
+  const char* end = data + dataSize;
+  const char* lineBegin = data + chunkBegin;
+  size_t numberOfLines = 0;
+
+  while ((lineBegin < data + chunkEnd) && (numberOfLines < maxLines)) {
+    const char* lineEnd = findLineEnd(lineBegin, end);
+
+    if (isSample(lineBegin, lineEnd)) {
+      lines.push_back(lineBegin);
+      numberOfLines++;
+    }
+
+    lineBegin = lineEnd + 1;
+  }
+
+  return std::min(static_cast<size_t>(lineBegin - data), dataSize);
+}
+
+void StreamingDataParser::getChunks(std::vector<size_t>& chunkBegins) const {
+  const char* end = data + dataSize;
+  const size_t numberOfChunks =
+      std::max((dataSize - dataStart) / chunkSize, static_cast<size_t>(1));
+
+  chunkBegins.clear();
+  chunkBegins.push_back(dataStart);
+
+  for (size_t c = 1; c < numberOfChunks; c++) {
+    // move the boundary to the beginning of the next line
+    const size_t boundary = std::max(dataStart + c * chunkSize, chunkBegins.back());
+
+    if (boundary >= dataSize) {
+      break;
+    }
+
+    const char* lineEnd = findLineEnd(data + boundary - 1, end);
+    const size_t chunkBegin = std::min(static_cast<size_t>(lineEnd - data) + 1, dataSize);
+
+    if (chunkBegin > chunkBegins.back()) {
+      chunkBegins.push_back(chunkBegin);
+    }
+  }
+
+  chunkBegins.push_back(dataSize);
+}
+
+size_t StreamingDataParser::getNumberInstances() const {
+  if (isCounted) {
+    return numberInstances;
+  }
+
+  if (numberOfFields == 0) {
+    numberInstances = 0;
+    isCounted = true;
+    return numberInstances;
+  }
+
+  numberInstances = std::min(countSamples(data + dataStart, data + dataSize), instanceCutoff);
+  isCounted = true;
+  return numberInstances;
+}
+
+size_t StreamingDataParser::countSamples(const char* begin, const char* end) const {
+  // split the input into chunks at line boundaries which are counted in parallel
+  std::vector<const char*> chunkBegins(1, begin);
+
+  while (static_cast<size_t>(end - chunkBegins.back()) > chunkSize) {
+    const char* lineEnd = findLineEnd(chunkBegins.back() + chunkSize - 1, end);
+
+    if (lineEnd == end) {
+      break;
+    }
+
+    chunkBegins.push_back(lineEnd + 1);
+  }
+
+  chunkBegins.push_back(end);
+
+  const size_t numberOfChunks = chunkBegins.size() - 1;
+  size_t count = 0;
+
+#pragma omp parallel for schedule(dynamic) reduction(+ : count)
+  for (size_t c = 0; c < numberOfChunks; c++) {
+    const char* lineBegin = chunkBegins[c];
+
+    while (lineBegin < chunkBegins[c + 1]) {
+      const char* lineEnd = findLineEnd(lineBegin, end);
+
+      if (isSample(lineBegin, lineEnd)) {
+        count++;
+      }
+
+      lineBegin = lineEnd + 1;
+    }
+  }
+
+  return count;
+}
+
+size_t StreamingDataParser::collectDecompressed(size_t offset, size_t maxLines, size_t maxBytes,
+                                                std::vector<const char*>& lines) const {
+  // collects the samples from offset on, the decompressed lines are appended to window
+  if ((decompressor == nullptr) || (offset < windowOffset)) {
+    decompressor.reset(new BlockDecompressor(compressedFile, chunkSize));
+    window.clear();
+    windowOffset = 0;
+  }
+
+  // skip the decompressed input before offset
+  while (windowOffset + window.size() < offset) {
+    windowOffset += window.size();
+    window.clear();
+
+    if (!decompressor->readBlock(window)) {
+      break;
+    }
+  }
+
+  const size_t start = std::min(offset - windowOffset, window.size());
+  std::vector<size_t> lineOffsets;
+  size_t position = start;
+
+  while ((lineOffsets.size() < maxLines) && (position - start < maxBytes)) {
+    const void* lineBreak =
+        (position < window.size())
+            ? std::memchr(window.data() + position, '\n', window.size() - position)
+            : nullptr;
+
+    if (lineBreak == nullptr) {
+      if (decompressor->readBlock(window)) {
+        continue;
+      } else if (position == window.size()) {
+        break;
+      }
+
+      // terminate the last line, so that it is found like the other lines
+      window.push_back('\n');
+      continue;
+    }
+
+    const char* lineBegin = window.data() + position;
+    const char* lineEnd = static_cast<const char*>(lineBreak);
+
+    if (isSample(lineBegin, lineEnd)) {
+      lineOffsets.push_back(position);
+    }
+
+    position = static_cast<size_t>(lineEnd - window.data()) + 1;
+  }
+
+  // window does not change anymore, so the lines can be referenced
+  for (size_t lineOffset : lineOffsets) {
+    lines.push_back(window.data() + lineOffset);
+  }
+
+  return windowOffset + position;
+}
+
+void StreamingDataParser::discardDecompressed(size_t offset) const {
+  // the input that has been read is removed once it makes up half of the window, so that moving
+  // the remaining input costs amortized constant time per byte
+  const size_t processed = offset - windowOffset;
+
+  if (2 * processed >= window.size()) {
+    window.erase(window.begin(), window.begin() + processed);
+    windowOffset = offset;
+  }
+}
+
+double StreamingDataParser::parseValue(const char* begin, const char* end) const {
+  // neither the mapped file nor the decompressed window is null-terminated, hence strtod only
+  // gets a null-terminated copy of the field and cannot read past the input
+  begin = std::find_if_not(begin, end, isBlank);
+  const size_t length = static_cast<size_t>(end - begin);
+
+  if (length < maxFieldBufferLength) {
+    char field[maxFieldBufferLength];
+    std::memcpy(field, begin, length);
+    field[length] = '\0';
+    return std::strtod(field, nullptr);
+  } else {
+    return std::strtod(std::string(begin, end).c_str(), nullptr);
+  }
+}
+
+void StreamingDataParser::parseLine(const char* lineBegin, const char* inputEnd,
+                                    std::vector<double>& fields) const {
+  const char* lineEnd = findLineEnd(lineBegin, inputEnd);
+  const char* fieldBegin = lineBegin;
+  size_t numberOfValues = 0;
+
+  while (true) {
+    const void* separator = std::memchr(fieldBegin, ',', lineEnd - fieldBegin);
+    const char* fieldEnd = (separator != nullptr) ? static_cast<const char*>(separator) : lineEnd;
+
+    if (numberOfValues == numberOfFields) {
+      throw sgpp::base::data_exception("StreamingDataParser: too many columns in line");
+    }
+
+    fields[numberOfValues++] = parseValue(fieldBegin, fieldEnd);
+
+    if (fieldEnd == lineEnd) {
+      break;
+    }
+
+    fieldBegin = fieldEnd + 1;
+  }
+
+  if (numberOfValues != numberOfFields) {
+    throw sgpp::base::data_exception("StreamingDataParser: columns missing in line");
+  }
+}
+
+void StreamingDataParser::parseLines(const std::vector<const char*>& lines, const char* inputEnd,
+                                     size_t firstLine, size_t numberOfLines, Dataset& dataset,
+                                     size_t firstRow) const {
+  const size_t dimension = dataset.getDimension();
+  std::vector<double> fields(numberOfFields);
+  double* rows = dataset.getData().getPointer();
+  double* targets = dataset.getTargets().getPointer();
+
+  for (size_t k = 0; k < numberOfLines; k++) {
+    const size_t row = firstRow + k;
+    double* rowValues = rows + row * dimension;
+
+    parseLine(lines[firstLine + k], inputEnd, fields);
+
+    if (selectedCols.size() == 0) {
+      std::copy(fields.begin(), fields.begin() + dimension, rowValues);
+    } else {
+      for (size_t i = 0; i < dimension; i++) {
+        rowValues[i] = fields[selectedCols[i]];
+      }
+    }
+
+    if (hasTargets) {
+      targets[row] = fields[numberOfFields - 1];
+    }
+  }
+}
+
+Dataset* StreamingDataParser::readNext(Cursor& cursor, size_t howMany) const {
+  const size_t dimension = getDimension();
+  const size_t remaining =
+      (cursor.numberRead < instanceCutoff) ? instanceCutoff - cursor.numberRead : 0;
+  std::vector<const char*> lines;
+
+  const char* inputEnd = data + dataSize;
+
+  howMany = std::min(howMany, remaining);
+
+  if ((dimension > 0) && (howMany > 0)) {
+    // find the lines of the batch, then parse them in parallel
+    if (compressedFile.empty()) {
+      cursor.offset = collectChunk(cursor.offset, dataSize, howMany, lines);
+    } else {
+      cursor.offset =
+          collectDecompressed(cursor.offset, howMany, std::numeric_limits<size_t>::max(), lines);
+      inputEnd = window.data() + window.size();
+    }
+  }
+
+  std::unique_ptr<Dataset> dataset(new Dataset(lines.size(), dimension));
+  parseBatch(lines, inputEnd, *dataset, 0);
+
+  if (!compressedFile.empty() && !lines.empty()) {
+    discardDecompressed(cursor.offset);
+  }
+
+  cursor.numberRead += lines.size();
+  return dataset.release();
+}
+
+void StreamingDataParser::parseBatch(const std::vector<const char*>& lines, const char* inputEnd,
+                                     Dataset& dataset, size_t firstRow) const {
+  const size_t numberOfLines = lines.size();
+  // in blocks of lines to keep the scheduling overhead low
+  const size_t blockSize = 256;
+  const size_t numberOfBlocks = (numberOfLines + blockSize - 1) / blockSize;
+  bool failed = false;
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t block = 0; block < numberOfBlocks; block++) {
+    const size_t firstLine = block * blockSize;
+
+    try {
+      parseLines(lines, inputEnd, firstLine, std::min(blockSize, numberOfLines - firstLine),
+                 dataset, firstRow + firstLine);
+    } catch (...) {
+#pragma omp atomic write
+      failed = true;
+    }
+  }
+
+  if (failed) {
+    throw sgpp::base::data_exception("StreamingDataParser: malformed line in input");
+  }
+}
+
+Dataset* StreamingDataParser::readAll() const {
+  const size_t dimension = getDimension();
+
+  if (dimension == 0) {
+    return new Dataset(0, 0);
+  }
+
+  if (!compressedFile.empty()) {
+    // the decompressed input is parsed in pieces of about chunkSize bytes per thread
+    std::unique_ptr<Dataset> dataset(new Dataset(getNumberInstances(), dimension));
+    size_t maxBytes = chunkSize;
+#ifdef _OPENMP
+    maxBytes *= static_cast<size_t>(omp_get_max_threads());
+#endif /* _OPENMP */
+    size_t offset = dataStart;
+    size_t row = 0;
+
+    while (row < dataset->getNumberInstances()) {
+      std::vector<const char*> lines;
+      const size_t nextOffset =
+          collectDecompressed(offset, dataset->getNumberInstances() - row, maxBytes, lines);
+
+      if (nextOffset == offset) {
+        // end of the input
+        break;
+      }
+
+      parseBatch(lines, window.data() + window.size(), *dataset, row);
+      discardDecompressed(nextOffset);
+      offset = nextOffset;
+      row += lines.size();
+    }
+
+    return dataset.release();
+  }
+
+  std::vector<size_t> chunkBegins;
+  getChunks(chunkBegins);
+
+  const size_t numberOfChunks = chunkBegins.size() - 1;
+  std::vector<std::vector<const char*>> chunkLines(numberOfChunks);
+  std::vector<size_t> chunkRows(numberOfChunks + 1, 0);
+  Dataset* dataset = nullptr;
+  bool failed = false;
+
+#pragma omp parallel
+  {
+    // first pass: find the samples of each chunk
+#pragma omp for schedule(dynamic)
+    for (size_t c = 0; c < numberOfChunks; c++) {
+      collectChunk(chunkBegins[c], chunkBegins[c + 1], instanceCutoff, chunkLines[c]);
+    }
+
+#pragma omp single
+    {
+      // the row of the first sample of each chunk, all rows are allocated at once
+      for (size_t c = 0; c < numberOfChunks; c++) {
+        chunkRows[c + 1] = std::min(chunkRows[c] + chunkLines[c].size(), instanceCutoff);
+      }
+
+      dataset = new Dataset(chunkRows[numberOfChunks], dimension);
+    }
+
+    // second pass: parse the samples of each chunk into their rows
+#pragma omp for schedule(dynamic)
+    for (size_t c = 0; c < numberOfChunks; c++) {
+      try {
+        parseLines(chunkLines[c], data + dataSize, 0, chunkRows[c + 1] - chunkRows[c], *dataset,
+                   chunkRows[c]);
+      } catch (...) {
+#pragma omp atomic write
+        failed = true;
+      }
+
+      std::vector<const char*>().swap(chunkLines[c]);
+    }
+  }
+
+  if (failed) {
+    delete dataset;
+    throw sgpp::base::data_exception("StreamingDataParser: malformed line in input");
+  }
+
+  numberInstances = dataset->getNumberInstances();
+  isCounted = true;
+  return dataset;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
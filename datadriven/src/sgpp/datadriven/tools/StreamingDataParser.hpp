@@ -0,0 +1,223 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef STREAMINGDATAPARSER_HPP
+#define STREAMINGDATAPARSER_HPP
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+class BlockDecompressor;
+
+/**
+ * Parser for CSV and ARFF data that reads the samples in batches without materializing the
+ * whole file.
+ *
+ * The input file is mapped read-only into memory (on POSIX systems, otherwise it is read into a
+ * buffer). Values are converted directly from the mapped bytes and written in place into the
+ * rows of the resulting #sgpp::datadriven::Dataset, the lines of a batch are parsed in parallel
+ * by the OpenMP threads. Reading the whole file (readAll) and counting the samples split the file
+ * into chunks at line boundaries which are processed in parallel.
+ *
+ * Files compressed with gzip or zstd are decompressed block by block (see
+ * #sgpp::datadriven::BlockDecompressor) while they are read, only a few decompressed blocks and
+ * the lines of the current batch are kept in memory. Such input can only be read front to back
+ * efficiently: reading from a cursor before the current position restarts the decompression.
+ *
+ * The accepted format is the one of CSVTools and ARFFTools: one sample per line, values separated
+ * by commas, the target (if any) in the last column. For CSV, the first line (column titles) is
+ * skipped; for ARFF, all lines containing '%' or '@' are skipped. Empty lines are ignored.
+ */
+class StreamingDataParser {
+ public:
+  /**
+   * Supported formats
+   */
+  enum class Format { CSV, ARFF };
+
+  /**
+   * Position of a reader in the input, see begin, end and readNext.
+   */
+  struct Cursor {
+    /// byte offset of the next line to read
+    size_t offset;
+    /// number of samples read so far
+    size_t numberRead;
+  };
+
+  /**
+   * Constructor
+   *
+   * @param format format of the input
+   * @param hasTargets whether the last column contains the targets (supervised learning)
+   * @param instanceCutoff maximal number of samples to read, -1 for all samples
+   * @param selectedCols columns that are used as dimensions (in this order), empty for all
+   * @param selectedTargets only samples with one of these targets are read, empty for all
+   *        (ignored if hasTargets is false)
+   */
+  StreamingDataParser(Format format, bool hasTargets, size_t instanceCutoff = -1,
+                      std::vector<size_t> selectedCols = std::vector<size_t>(),
+                      std::vector<double> selectedTargets = std::vector<double>());
+
+  /**
+   * Copy constructor, creates a parser that reads the same input independently of the other one.
+   * The input (mapped file or buffer) is shared, the decompression state is not, so the parsers
+   * can be used by different threads.
+   *
+   * @param other parser to copy
+   */
+  StreamingDataParser(const StreamingDataParser& other);
+
+  /**
+   * Destructor, unmaps the file if no copy of the parser uses it anymore.
+   */
+  ~StreamingDataParser();
+
+  StreamingDataParser& operator=(const StreamingDataParser&) = delete;
+
+  /**
+   * Maps a file into memory. The file is not parsed apart from its first sample, which
+   * determines the number of columns.
+   *
+   * @param filename name of the file
+   */
+  void readFile(const std::string& filename);
+
+  /**
+   * Uses a gzip or zstd compressed file as input. The file is decompressed once to count the
+   * samples and again block by block while the samples are read. Files that are not compressed
+   * are read like with readFile.
+   *
+   * @param filename name of the file
+   */
+  void readCompressedFile(const std::string& filename);
+
+  /**
+   * Uses a copy of a string as input.
+   *
+   * @param content data in the format of the parser
+   */
+  void readString(const std::string& content);
+
+  /**
+   * @return dimension of the samples (number of selected columns), 0 if the input has no samples
+   */
+  size_t getDimension() const;
+
+  /**
+   * Counts the samples of the input (with respect to selectedTargets and instanceCutoff).
+   * The count is computed in parallel on the first call and cached.
+   *
+   * @return number of samples
+   */
+  size_t getNumberInstances() const;
+
+  /**
+   * @return cursor pointing to the first sample
+   */
+  Cursor begin() const;
+
+  /**
+   * @return cursor pointing behind the last sample
+   */
+  Cursor end() const;
+
+  /**
+   * Reads the next samples and advances the cursor.
+   *
+   * @param cursor position in the input
+   * @param howMany maximal number of samples to read
+   * @return new dataset with the next min(howMany, number of remaining samples) samples,
+   *         caller owns the object
+   */
+  Dataset* readNext(Cursor& cursor, size_t howMany) const;
+
+  /**
+   * Reads all samples.
+   *
+   * @return new dataset with all samples, caller owns the object
+   */
+  Dataset* readAll() const;
+
+  /**
+   * @param chunkSize approximate number of bytes that are processed by a thread at a time when
+   *        the whole input is counted or read, also the size of the decompressed blocks of
+   *        compressed input (set it before readCompressedFile)
+   */
+  void setChunkSize(size_t chunkSize);
+
+ private:
+  /// format of the input
+  Format format;
+  /// whether the last column contains the targets
+  bool hasTargets;
+  /// maximal number of samples to read
+  size_t instanceCutoff;
+  /// columns that are used as dimensions, empty for all
+  std::vector<size_t> selectedCols;
+  /// targets of the samples that are read, empty for all
+  std::vector<double> selectedTargets;
+  /// approximate number of bytes per chunk
+  size_t chunkSize;
+
+  /// pointer to the beginning of the input
+  const char* data;
+  /// size of the input in bytes
+  size_t dataSize;
+  /// owner of the memory data points to (memory mapping or buffer), shared by copies
+  std::shared_ptr<const char> input;
+  /// byte offset of the first line that may contain a sample
+  size_t dataStart;
+  /// number of columns of a line (including the target)
+  size_t numberOfFields;
+  /// number of samples, computed by getNumberInstances
+  mutable size_t numberInstances;
+  /// whether numberInstances has been computed
+  mutable bool isCounted;
+
+  /// name of the file if it is compressed, empty otherwise
+  std::string compressedFile;
+  /// size of the decompressed input in bytes
+  size_t decompressedSize;
+  /// decompresses the input that is read next (compressed files only)
+  mutable std::unique_ptr<BlockDecompressor> decompressor;
+  /// decompressed input around the current position (compressed files only)
+  mutable std::vector<char> window;
+  /// byte offset of the beginning of window in the decompressed input
+  mutable size_t windowOffset;
+
+  void unmap();
+  void setBuffer(std::shared_ptr<std::vector<char>> buffer);
+  void initialize();
+  void checkColumnSelection() const;
+  size_t countSamples(const char* begin, const char* end) const;
+  size_t collectDecompressed(size_t offset, size_t maxLines, size_t maxBytes,
+                             std::vector<const char*>& lines) const;
+  void discardDecompressed(size_t offset) const;
+  bool isSample(const char* lineBegin, const char* lineEnd) const;
+  size_t collectChunk(size_t chunkBegin, size_t chunkEnd, size_t maxLines,
+                      std::vector<const char*>& lines) const;
+  void getChunks(std::vector<size_t>& chunkBegins) const;
+  void parseLine(const char* lineBegin, const char* inputEnd, std::vector<double>& fields) const;
+  void parseLines(const std::vector<const char*>& lines, const char* inputEnd, size_t firstLine,
+                  size_t numberOfLines, Dataset& dataset, size_t firstRow) const;
+  void parseBatch(const std::vector<const char*>& lines, const char* inputEnd, Dataset& dataset,
+                  size_t firstRow) const;
+  double parseValue(const char* begin, const char* end) const;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* STREAMINGDATAPARSER_HPP */
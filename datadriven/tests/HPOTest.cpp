@@ -18,6 +18,11 @@
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationLeastSquares.hpp>
 
 
+#include <atomic>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -77,6 +82,31 @@ class FitterFactoryTester : public sgpp::datadriven::FitterFactory {
   }
 };
 
+class ModelFittingCounter : public ModelFittingTester {
+ public:
+  ModelFittingCounter(double x, int y, int z) : ModelFittingTester(x, y, z), trained(false) {}
+
+  void update(Dataset &dataset) override {
+    if (!trained) {
+      trained = true;
+      trainedModels++;
+    }
+  }
+
+  static std::atomic<size_t> trainedModels;
+  bool trained;
+};
+
+std::atomic<size_t> ModelFittingCounter::trainedModels(0);
+
+class FitterFactoryCounter : public FitterFactoryTester {
+ public:
+  sgpp::datadriven::ModelFittingBase *buildFitter() override {
+    return new ModelFittingCounter(conpar["x"].getValue(), dispar["y"].getValue(),
+                                   catpar["c"].getValue());
+  }
+};
+
 class FitterFactoryTesterHarm : public sgpp::datadriven::FitterFactory {
  public:
   FitterFactoryTesterHarm() {
@@ -131,6 +161,101 @@ BOOST_AUTO_TEST_CASE(upperLevelTest) {
   BOOST_CHECK_LE(res2, 0.3);
 }
 
+BOOST_AUTO_TEST_CASE(parallelTrials) {
+  // same as upperLevelTest, but three configurations are evaluated at once
+  std::string path("datadriven/tests/hpo_parallel_testconfig.json");
+  sgpp::datadriven::DataMiningConfigParser parser(path);
+  sgpp::datadriven::LeastSquaresRegressionMinerFactory minfac{};
+  std::vector<sgpp::datadriven::SparseGridMiner *> bominers;
+  std::vector<sgpp::datadriven::SparseGridMiner *> harmminers;
+  for (size_t i = 0; i < 3; i++) {
+    bominers.push_back(minfac.buildMiner(path));
+    harmminers.push_back(minfac.buildMiner(path));
+  }
+  sgpp::datadriven::BoHyperparameterOptimizer
+      bohpo(bominers, new FitterFactoryTester(), parser);
+  sgpp::datadriven::HarmonicaHyperparameterOptimizer
+      harmhpo(harmminers, new FitterFactoryTester(), parser);
+  double res1 = bohpo.run(false);
+  double res2 = harmhpo.run(false);
+  BOOST_CHECK_LE(res1, 0.3);
+  BOOST_CHECK_LE(res2, 0.3);
+}
+
+std::string bayesianResultsFile(time_t time) {
+  tm tmobj{};
+  tm *ltm = localtime_r(&time, &tmobj);
+  std::stringstream fn;
+  fn << "Bayesian_" << (ltm->tm_year + 1900) << "_" << (ltm->tm_mon + 1) << "_" << ltm->tm_mday
+     << "_" << ltm->tm_hour << "_" << ltm->tm_min;
+  return fn.str();
+}
+
+BOOST_AUTO_TEST_CASE(resumeParallelTrials) {
+  // a run with three concurrent trials is interrupted after the random phase and two batches,
+  // resuming it must only train the missing samples and reproduce the result exactly
+  std::string path("datadriven/tests/hpo_parallel_testconfig.json");
+  sgpp::datadriven::LeastSquaresRegressionMinerFactory minfac{};
+  const size_t numberOfSamples = 30;
+  const size_t numberOfResumedSamples = 16;
+
+  std::vector<sgpp::datadriven::SparseGridMiner *> miners;
+  for (size_t i = 0; i < 3; i++) {
+    miners.push_back(minfac.buildMiner(path));
+  }
+  sgpp::datadriven::DataMiningConfigParser parser(path);
+  sgpp::datadriven::BoHyperparameterOptimizer bohpo(miners, new FitterFactoryCounter(), parser);
+
+  ModelFittingCounter::trainedModels = 0;
+  const time_t start = time(nullptr);
+  double res = bohpo.run(true);
+  BOOST_CHECK_EQUAL(ModelFittingCounter::trainedModels, numberOfSamples);
+
+  std::string resultsFile = bayesianResultsFile(time(nullptr));
+  std::ifstream results(resultsFile);
+  if (!results.is_open()) {
+    resultsFile = bayesianResultsFile(start);
+    results.open(resultsFile);
+  }
+  BOOST_REQUIRE(results.is_open());
+
+  // keep the headline and the first samples
+  const std::string resumeFile = "HPOTest_resume.tmp";
+  std::ofstream resume(resumeFile);
+  std::string line;
+  for (size_t i = 0; (i <= numberOfResumedSamples) && std::getline(results, line); i++) {
+    resume << line << std::endl;
+  }
+  resume.close();
+  results.close();
+  std::remove(resultsFile.c_str());
+
+  std::ifstream configFile(path);
+  std::stringstream config;
+  config << configFile.rdbuf();
+  std::string resumeConfig = config.str();
+  resumeConfig.replace(resumeConfig.find("\"hpo\": {"), 8,
+                       "\"hpo\": {\n    \"resumeFile\": \"" + resumeFile + "\",");
+  const std::string resumeConfigFile = "HPOTest_resume_config.tmp";
+  std::ofstream(resumeConfigFile) << resumeConfig;
+
+  std::vector<sgpp::datadriven::SparseGridMiner *> resumedMiners;
+  for (size_t i = 0; i < 3; i++) {
+    resumedMiners.push_back(minfac.buildMiner(path));
+  }
+  sgpp::datadriven::DataMiningConfigParser resumeParser(resumeConfigFile);
+  sgpp::datadriven::BoHyperparameterOptimizer resumed(resumedMiners, new FitterFactoryCounter(),
+                                                      resumeParser);
+
+  ModelFittingCounter::trainedModels = 0;
+  double resumedRes = resumed.run(false);
+  BOOST_CHECK_EQUAL(ModelFittingCounter::trainedModels, numberOfSamples - numberOfResumedSamples);
+  BOOST_CHECK_EQUAL(resumedRes, res);
+
+  std::remove(resumeFile.c_str());
+  std::remove(resumeConfigFile.c_str());
+}
+
 BOOST_AUTO_TEST_CASE(harmonicaConfigs) {
   // tests the bit management, especially setParameters and addConstraint by comparing
   // to a vector of all possible bit configurations
@@ -413,6 +538,37 @@ BOOST_AUTO_TEST_CASE(fitScalesGP) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(batchProposals) {
+  // proposing several sample points at once has to give distinct points
+  std::vector<BOConfig> initialConfigs{};
+  std::mt19937 generator(42);
+
+  std::vector<int> discOptions = {};
+  std::vector<int> catOptions = {};
+  size_t nCont = 2;
+  BOConfig prototype{&discOptions, &catOptions, nCont};
+
+  std::vector<double> scores = {0.3, 0.7, 0.1, 0.9, 0.5};
+  initialConfigs.reserve(scores.size());
+
+  for (size_t i = 0; i < scores.size(); i++) {
+    initialConfigs.emplace_back(prototype);
+    initialConfigs[i].randomize(generator);
+    initialConfigs[i].setScore(scores[i]);
+  }
+
+  sgpp::datadriven::BayesianOptimization bo(initialConfigs);
+  std::vector<BOConfig> batch = bo.proposeBatch(prototype, 4);
+
+  BOOST_CHECK_EQUAL(batch.size(), 4);
+  DataVector scales(prototype.getNPar() + 1, 1);
+  for (size_t i = 0; i < batch.size(); i++) {
+    for (size_t k = 0; k < i; k++) {
+      BOOST_CHECK_GT(batch[i].getScaledDistance(batch[k], scales), 1e-6);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(validAcquisitionFunction) {
   // testing acquisition function for monotonicity with respect to mean and variance
   // not every acquisition function fullfills this but expected improvement does
@@ -12,13 +12,16 @@
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 #include <sgpp/datadriven/datamining/builder/ClassificationMinerFactory.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationClassification.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationDensityEstimation.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingClassification.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <string>
 
@@ -85,6 +88,68 @@ BOOST_AUTO_TEST_CASE(testGeo) {
   BOOST_CHECK(accuracy >= 0);
 }
 
+BOOST_AUTO_TEST_CASE(testFusedEvaluation) {
+  // the prediction for many samples at once evaluates the sparse grids of all classes, it has to
+  // agree with the prediction for single samples
+  ClassificationMinerFactory factory;
+  std::unique_ptr<SparseGridMiner> miner(factory.buildMiner("datadriven/tests/gmm_cg.json"));
+  miner->learn(false);
+  ModelFittingBase *model = miner->getModel();
+
+  CSVFileSampleProvider csv;
+  csv.readFile("datadriven/datasets/gmm/gmm_test.csv", true);
+  std::unique_ptr<sgpp::datadriven::Dataset> testDataset(csv.getAllSamples());
+  sgpp::base::DataMatrix &samples = testDataset->getData();
+  DataVector predictions(samples.getNrows());
+  model->evaluate(samples, predictions);
+
+  DataVector sample(samples.getNcols());
+  for (size_t idx = 0; idx < samples.getNrows(); idx++) {
+    samples.getRow(idx, sample);
+    BOOST_CHECK_EQUAL(predictions[idx], model->evaluate(sample));
+  }
+
+  // many samples are evaluated in several tiles
+  const size_t numSamples = samples.getNrows();
+  const size_t numRepetitions = 20000 / numSamples + 1;
+  sgpp::base::DataMatrix manySamples(numSamples * numRepetitions, samples.getNcols());
+  for (size_t idx = 0; idx < manySamples.getNrows(); idx++) {
+    samples.getRow(idx % numSamples, sample);
+    manySamples.setRow(idx, sample);
+  }
+  DataVector manyPredictions(manySamples.getNrows());
+  model->evaluate(manySamples, manyPredictions);
+
+  for (size_t idx = 0; idx < manySamples.getNrows(); idx++) {
+    BOOST_CHECK_EQUAL(manyPredictions[idx], predictions[idx % numSamples]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testFusedEvaluationSharedGrid) {
+  // without refinement, all classes share the same grid points and only the surpluses differ
+  sgpp::datadriven::FitterConfigurationClassification config;
+  config.setupDefaults();
+  config.getGridConfig().level_ = 5;
+  config.getDensityEstimationConfig().type_ = sgpp::datadriven::DensityEstimationType::CG;
+  config.getRegularizationConfig().lambda_ = 1e-1;
+  sgpp::datadriven::ModelFittingClassification model(config);
+
+  CSVFileSampleProvider csv;
+  csv.readFile("datadriven/datasets/gmm/gmm_train.csv", true);
+  std::unique_ptr<sgpp::datadriven::Dataset> trainDataset(csv.getAllSamples());
+  model.fit(*trainDataset);
+
+  sgpp::base::DataMatrix &samples = trainDataset->getData();
+  DataVector predictions(samples.getNrows());
+  model.evaluate(samples, predictions);
+
+  DataVector sample(samples.getNcols());
+  for (size_t idx = 0; idx < samples.getNrows(); idx++) {
+    samples.getRow(idx, sample);
+    BOOST_CHECK_EQUAL(predictions[idx], model.evaluate(sample));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(visualization) {
   std::string configFile = "datadriven/tests/visualizationConfig.json";
   BOOST_CHECK(testVisualization(configFile));
@@ -249,6 +249,62 @@ BOOST_AUTO_TEST_CASE(testReadWriteLU) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testStoreMappedCholesky) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 3;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.1;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+
+  sgpp::datadriven::GridFactory gridFactory;
+  std::unique_ptr<sgpp::base::Grid> grid = std::unique_ptr<sgpp::base::Grid>{
+      gridFactory.createGrid(gridConfig, std::set<std::set<size_t>>())};
+
+  auto offline = std::unique_ptr<sgpp::datadriven::DBMatOffline>{
+      sgpp::datadriven::DBMatOfflineFactory::buildOfflineObject(
+          gridConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig)};
+  offline->buildMatrix(grid.get(), regularizationConfig);
+  offline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
+
+  // store an object which still serves its matrices from the mapping of a file
+  std::string filename = "test_mapped.dbmat";
+  std::string mappedFilename = "test_mapped_copy.dbmat";
+  offline->store(filename);
+  auto mappedOffline = std::unique_ptr<sgpp::datadriven::DBMatOffline>{
+      sgpp::datadriven::DBMatOfflineFactory::buildFromFile(filename)};
+  mappedOffline->store(mappedFilename);
+  auto newOffline = std::unique_ptr<sgpp::datadriven::DBMatOffline>{
+      sgpp::datadriven::DBMatOfflineFactory::buildFromFile(mappedFilename)};
+
+  /**
+   * Check matrices, the views read the mappings without copying
+   */
+  auto& oldMatrix = offline->getDecomposedMatrix();
+  auto mappedView = mappedOffline->getDecomposedMatrixView();
+  auto newView = newOffline->getDecomposedMatrixView();
+
+  BOOST_CHECK_EQUAL(oldMatrix.getNrows(), mappedView.nrows);
+  BOOST_CHECK_EQUAL(oldMatrix.getNcols(), mappedView.ncols);
+  BOOST_CHECK_EQUAL(oldMatrix.getNrows(), newView.nrows);
+  BOOST_CHECK_EQUAL(oldMatrix.getNcols(), newView.ncols);
+
+  for (size_t i = 0; i < oldMatrix.getSize(); i++) {
+    BOOST_CHECK_CLOSE(mappedView.data[i], oldMatrix[i], 1e-4);
+    BOOST_CHECK_CLOSE(newView.data[i], oldMatrix[i], 1e-4);
+  }
+
+  std::remove(filename.c_str());
+  std::remove(mappedFilename.c_str());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif /* USE_GSL */
@@ -6,9 +6,12 @@
 #include <boost/test/unit_test_suite.hpp>
 #include <boost/test/test_tools.hpp>
 #include <sgpp/datadriven/algorithm/DBMatDatabase.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <iostream>
 #include <cstdio>
+#include <set>
 #include <string>
+#include <vector>
 
 using sgpp::base::GeneralGridConfiguration;
 using sgpp::base::AdaptivityConfiguration;
@@ -144,4 +147,40 @@ BOOST_AUTO_TEST_CASE(TestOverwriteMatrix) {
   removeDatabase(filepath);
 }
 
+BOOST_AUTO_TEST_CASE(TestPutMatrixFromFile) {
+  // Test to put a matrix file that describes its own configuration
+  std::string filepath = createEmptyDatabase();
+  DBMatDatabase database(filepath);
+  sgpp::base::RegularGridConfiguration gridConfig;
+  AdaptivityConfiguration adaptivityConfig;
+  RegularizationConfiguration regularizationConfig;
+  DensityEstimationConfiguration densityEstimationConfig;
+
+  initializeStandardConfiguration(gridConfig, adaptivityConfig, regularizationConfig,
+      densityEstimationConfig);
+  std::string description = DBMatDatabase::describeDataMatrix(gridConfig, adaptivityConfig,
+      regularizationConfig, densityEstimationConfig);
+
+  std::string path = "testfilepathFromFile";
+  sgpp::base::DataMatrix matrix(3, 3, 1.0);
+  sgpp::datadriven::DBMatOfflineFile::write(path, densityEstimationConfig.decomposition_,
+      std::set<std::set<size_t>>(), {&matrix, &matrix, &matrix}, std::vector<size_t>(),
+      description);
+  database.putDataMatrixFromFile(path);
+
+  // Assert that the database holds the file for the configuration
+  BOOST_CHECK(database.hasDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+      densityEstimationConfig));
+  std::string& pathFromDatabase = database.getDataMatrix(gridConfig, adaptivityConfig,
+      regularizationConfig, densityEstimationConfig);
+  BOOST_CHECK(path.compare(pathFromDatabase) == 0);
+
+  // Modify the configuration and assert the database does not hold the string
+  regularizationConfig.lambda_ *= 2.0;
+  BOOST_CHECK(!database.hasDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+      densityEstimationConfig));
+  removeDatabase(path);
+  removeDatabase(filepath);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
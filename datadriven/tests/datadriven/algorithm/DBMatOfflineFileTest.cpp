@@ -0,0 +1,162 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::datadriven::DBMatOffline;
+using sgpp::datadriven::DBMatOfflineFactory::buildFromFile;
+using sgpp::datadriven::DBMatOfflineFile;
+using sgpp::datadriven::DBMatOfflineOrthoAdapt;
+using sgpp::datadriven::MatrixDecompositionType;
+
+BOOST_AUTO_TEST_SUITE(DBMatOfflineFileTest)
+
+DataMatrix createMatrix(size_t nrows, size_t ncols, double offset) {
+  DataMatrix matrix(nrows, ncols);
+
+  for (size_t i = 0; i < nrows; i++) {
+    for (size_t j = 0; j < ncols; j++) {
+      matrix.set(i, j, offset + static_cast<double>(i * ncols + j) / 7.0);
+    }
+  }
+
+  return matrix;
+}
+
+BOOST_AUTO_TEST_CASE(TestWriteRead) {
+  std::string filepath = "tmpdbmatofflinefile";
+  DataMatrix first = createMatrix(5, 5, 1.0);
+  DataMatrix second = createMatrix(3, 7, -2.0);
+  std::set<std::set<size_t>> interactions = {{0}, {1}, {0, 1}};
+  std::vector<size_t> permutation = {4, 2, 0, 1, 3};
+
+  DBMatOfflineFile::write(filepath, MatrixDecompositionType::LU, interactions, {&first, &second},
+                          permutation, "description");
+  BOOST_CHECK(DBMatOfflineFile::isBinaryFile(filepath));
+
+  {
+    DBMatOfflineFile file(filepath);
+    BOOST_CHECK(file.verifyChecksum());
+    BOOST_CHECK(file.getDecompositionType() == MatrixDecompositionType::LU);
+    BOOST_CHECK(file.getInteractions() == interactions);
+    BOOST_CHECK_EQUAL(file.getDescription(), "description");
+    BOOST_CHECK_EQUAL(file.getNumberOfMatrices(), 2);
+    BOOST_CHECK_EQUAL(file.getNrows(1), 3);
+    BOOST_CHECK_EQUAL(file.getNcols(1), 7);
+    // the matrices are aligned in the file
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(file.getMatrixData(1)) % 64, 0);
+
+    DataMatrix matrix;
+    file.getMatrix(0, matrix);
+    BOOST_CHECK(matrix == first);
+    file.getMatrix(1, matrix);
+    BOOST_CHECK(matrix == second);
+
+    std::vector<size_t> readPermutation;
+    file.getPermutation(readPermutation);
+    BOOST_CHECK(readPermutation == permutation);
+  }
+
+  std::remove(filepath.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(TestChecksum) {
+  std::string filepath = "tmpdbmatofflinefile";
+  DataMatrix matrix = createMatrix(40, 40, 0.5);
+  DBMatOfflineFile::write(filepath, MatrixDecompositionType::Chol, {}, {&matrix});
+
+  {
+    // modify the last entry of the matrix
+    std::fstream stream(filepath, std::ios::in | std::ios::out | std::ios::binary);
+    stream.seekp(-static_cast<std::streamoff>(sizeof(double)), std::ios::end);
+    double value = 42.0;
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(double));
+  }
+
+  {
+    DBMatOfflineFile file(filepath);
+    BOOST_CHECK(!file.verifyChecksum());
+  }
+
+  BOOST_CHECK_THROW(std::unique_ptr<DBMatOffline>(buildFromFile(filepath)),
+                    sgpp::base::data_exception);
+  std::remove(filepath.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(TestBuildFromFile) {
+  // Cholesky factors can be read without GSL
+  std::string filepath = "tmpdbmatofflinefile";
+  DataMatrix matrix = createMatrix(9, 9, 3.0);
+  std::set<std::set<size_t>> interactions = {{0}, {0, 1}};
+  DBMatOfflineFile::write(filepath, MatrixDecompositionType::Chol, interactions, {&matrix});
+
+  std::unique_ptr<DBMatOffline> offline(buildFromFile(filepath));
+  BOOST_CHECK(offline->getDecompositionType() == MatrixDecompositionType::Chol);
+  BOOST_CHECK(offline->interactions == interactions);
+  BOOST_CHECK_EQUAL(offline->getGridSize(), 9);
+
+  // copies share the mapping of the file until the matrix is accessed
+  std::unique_ptr<DBMatOffline> copy(offline->clone());
+  BOOST_CHECK(offline->getDecomposedMatrix() == matrix);
+  BOOST_CHECK(copy->getDecomposedMatrix() == matrix);
+
+  // storing it again yields the same contents
+  std::string secondFilepath = "tmpdbmatofflinefile2";
+  offline->setDescription("stored again");
+  offline->store(secondFilepath);
+  DBMatOfflineFile file(secondFilepath);
+  BOOST_CHECK(file.verifyChecksum());
+  BOOST_CHECK_EQUAL(file.getDescription(), "stored again");
+  DataMatrix storedMatrix;
+  file.getMatrix(0, storedMatrix);
+  BOOST_CHECK(storedMatrix == matrix);
+
+  std::remove(filepath.c_str());
+  std::remove(secondFilepath.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(TestBuildFromFileOrthoAdapt) {
+  std::string filepath = "tmpdbmatofflinefile";
+  DataMatrix lhs = createMatrix(6, 6, 1.0);
+  DataMatrix q = createMatrix(6, 6, -1.0);
+  DataMatrix tInv = createMatrix(6, 6, 2.0);
+  DBMatOfflineFile::write(filepath, MatrixDecompositionType::OrthoAdapt, {}, {&lhs, &q, &tInv},
+                          std::vector<size_t>(), "description");
+
+  std::unique_ptr<DBMatOffline> offline(buildFromFile(filepath));
+  BOOST_CHECK_EQUAL(offline->getDescription(), "description");
+  BOOST_CHECK_EQUAL(offline->getGridSize(), 6);
+
+  // the file has been mapped once, the mapping stays valid after the file is removed
+  std::remove(filepath.c_str());
+  auto orthoAdapt = dynamic_cast<DBMatOfflineOrthoAdapt*>(offline.get());
+  BOOST_REQUIRE(orthoAdapt != nullptr);
+  BOOST_CHECK(orthoAdapt->getQ() == q);
+  BOOST_CHECK(orthoAdapt->getTinv() == tInv);
+  BOOST_CHECK(orthoAdapt->getDecomposedMatrix() == lhs);
+
+  // a file without Q and T^-1 is rejected
+  DBMatOfflineFile::write(filepath, MatrixDecompositionType::OrthoAdapt, {}, {&lhs});
+  BOOST_CHECK_THROW(std::unique_ptr<DBMatOffline>(buildFromFile(filepath)),
+                    sgpp::base::data_exception);
+  std::remove(filepath.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
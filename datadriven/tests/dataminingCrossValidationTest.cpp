@@ -0,0 +1,117 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/datadriven/configuration/CrossvalidationConfiguration.hpp>
+#include <sgpp/datadriven/datamining/base/SparseGridMinerCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/builder/DataSourceBuilder.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationLeastSquares.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingLeastSquares.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/MSE.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/Scorer.hpp>
+#include <sgpp/datadriven/datamining/modules/visualization/VisualizerDummy.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <memory>
+#include <vector>
+
+using sgpp::datadriven::CrossvalidationConfiguration;
+using sgpp::datadriven::DataSourceBuilder;
+using sgpp::datadriven::DataSourceConfig;
+using sgpp::datadriven::DataSourceCrossValidation;
+using sgpp::datadriven::Dataset;
+
+namespace {
+
+DataSourceCrossValidation* createDataSource(size_t numBatches, size_t batchSize,
+                                            size_t foldThreads) {
+  DataSourceConfig config;
+  config.filePath = "datadriven/datasets/ripley/ripleyGarcke.train.arff";
+  config.fileType = sgpp::datadriven::DataSourceFileType::ARFF;
+  config.shuffling = sgpp::datadriven::DataSourceShufflingType::random;
+  config.randomSeed = 42;
+  config.numBatches = numBatches;
+  config.batchSize = batchSize;
+
+  CrossvalidationConfiguration crossValidationConfig;
+  crossValidationConfig.kfold_ = 4;
+  crossValidationConfig.foldThreads_ = foldThreads;
+
+  DataSourceBuilder builder;
+  return builder.crossValidationFromConfig(config, crossValidationConfig);
+}
+
+void checkEqualDatasets(Dataset& expected, Dataset& actual) {
+  BOOST_REQUIRE_EQUAL(expected.getNumberInstances(), actual.getNumberInstances());
+  BOOST_REQUIRE_EQUAL(expected.getDimension(), actual.getDimension());
+
+  for (size_t i = 0; i < expected.getNumberInstances(); i++) {
+    BOOST_CHECK_EQUAL(expected.getTargets()[i], actual.getTargets()[i]);
+
+    for (size_t t = 0; t < expected.getDimension(); t++) {
+      BOOST_CHECK_EQUAL(expected.getData().get(i, t), actual.getData().get(i, t));
+    }
+  }
+}
+
+double crossValidate(size_t foldThreads) {
+  sgpp::datadriven::FitterConfigurationLeastSquares fitterConfig;
+  fitterConfig.setupDefaults();
+  fitterConfig.getRefinementConfig().numRefinements_ = 1;
+
+  // ModelFittingLeastSquares can only be trained on a single batch per fold
+  sgpp::datadriven::SparseGridMinerCrossValidation miner(
+      createDataSource(1, 0, foldThreads),
+      new sgpp::datadriven::ModelFittingLeastSquares(fitterConfig),
+      new sgpp::datadriven::Scorer(new sgpp::datadriven::MSE()),
+      new sgpp::datadriven::VisualizerDummy());
+  return miner.learn(false);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testDataminingCrossValidation)
+
+BOOST_AUTO_TEST_CASE(testFoldViews) {
+  std::unique_ptr<DataSourceCrossValidation> dataSource(createDataSource(3, 100, 0));
+  const size_t kfold = dataSource->getCrossValidationConfig().kfold_;
+
+  std::vector<std::unique_ptr<DataSourceCrossValidation>> foldViews;
+
+  for (size_t fold = 0; fold < kfold; fold++) {
+    foldViews.emplace_back(dataSource->createFoldView(fold));
+  }
+
+  // the views must provide the same batches as the data source itself
+  for (size_t fold = 0; fold < kfold; fold++) {
+    dataSource->setFold(fold);
+    dataSource->reset();
+    foldViews[fold]->reset();
+    checkEqualDatasets(*dataSource->getValidationData(), *foldViews[fold]->getValidationData());
+
+    while (true) {
+      std::unique_ptr<Dataset> expected(dataSource->getNextSamples());
+      std::unique_ptr<Dataset> actual(foldViews[fold]->getNextSamples());
+      checkEqualDatasets(*expected, *actual);
+
+      if (expected->getNumberInstances() == 0) {
+        break;
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testConcurrentFolds) {
+  // training the folds concurrently must not change the result
+  const double sequentialScore = crossValidate(1);
+  BOOST_CHECK_CLOSE(crossValidate(4), sequentialScore, 1e-8);
+  BOOST_CHECK_CLOSE(crossValidate(0), sequentialScore, 1e-8);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
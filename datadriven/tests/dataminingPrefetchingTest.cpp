@@ -0,0 +1,122 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/datadriven/datamining/builder/DataSourceBuilder.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/BatchPrefetcher.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceSplitting.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <memory>
+#include <vector>
+
+using sgpp::datadriven::BatchPrefetcher;
+using sgpp::datadriven::DataSourceBuilder;
+using sgpp::datadriven::DataSourceConfig;
+using sgpp::datadriven::DataSourceSplitting;
+using sgpp::datadriven::Dataset;
+
+namespace {
+
+DataSourceSplitting* createDataSource(size_t prefetchDepth) {
+  DataSourceConfig config;
+  config.filePath = "datadriven/datasets/ripley/ripleyGarcke.train.arff";
+  config.fileType = sgpp::datadriven::DataSourceFileType::ARFF;
+  config.shuffling = sgpp::datadriven::DataSourceShufflingType::random;
+  config.randomSeed = 42;
+  config.numBatches = 4;
+  config.batchSize = 40;
+  config.prefetchDepth = prefetchDepth;
+
+  DataSourceBuilder builder;
+  return builder.splittingFromConfig(config);
+}
+
+void checkEqualDatasets(Dataset& expected, Dataset& actual) {
+  BOOST_REQUIRE_EQUAL(expected.getNumberInstances(), actual.getNumberInstances());
+  BOOST_REQUIRE_EQUAL(expected.getDimension(), actual.getDimension());
+
+  for (size_t i = 0; i < expected.getNumberInstances(); i++) {
+    BOOST_CHECK_EQUAL(expected.getTargets()[i], actual.getTargets()[i]);
+
+    for (size_t t = 0; t < expected.getDimension(); t++) {
+      BOOST_CHECK_EQUAL(expected.getData().get(i, t), actual.getData().get(i, t));
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testDataminingPrefetching)
+
+BOOST_AUTO_TEST_CASE(testPrefetchedBatches) {
+  // prefetching must not change the batches, also across epochs
+  std::unique_ptr<DataSourceSplitting> expectedSource(createDataSource(0));
+  std::unique_ptr<DataSourceSplitting> prefetchingSource(createDataSource(2));
+
+  for (size_t epoch = 0; epoch < 2; epoch++) {
+    expectedSource->reset();
+    prefetchingSource->reset();
+    checkEqualDatasets(*expectedSource->getValidationData(),
+                       *prefetchingSource->getValidationData());
+
+    // stop in the middle of the second epoch
+    const size_t numBatches = (epoch == 0) ? 10 : 2;
+    for (size_t batch = 0; batch < numBatches; batch++) {
+      std::unique_ptr<Dataset> expected(expectedSource->getNextSamples());
+      std::unique_ptr<Dataset> actual(prefetchingSource->getNextSamples());
+      checkEqualDatasets(*expected, *actual);
+    }
+  }
+
+  BOOST_CHECK_EQUAL(expectedSource->getCurrentIteration(),
+                    prefetchingSource->getCurrentIteration());
+  BOOST_CHECK_GE(prefetchingSource->getPrefetchStallTime(), 0.0);
+  BOOST_CHECK_EQUAL(expectedSource->getPrefetchStallTime(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(testAllSamplesNotPrefetched) {
+  // a single batch with all samples is read on request, even if prefetching is configured
+  DataSourceConfig config;
+  config.filePath = "datadriven/datasets/ripley/ripleyGarcke.train.arff";
+  config.fileType = sgpp::datadriven::DataSourceFileType::ARFF;
+  config.numBatches = 1;
+  config.batchSize = 0;
+  config.prefetchDepth = 2;
+
+  DataSourceBuilder builder;
+  std::unique_ptr<DataSourceSplitting> dataSource(builder.splittingFromConfig(config));
+  std::unique_ptr<Dataset> allSamples(dataSource->getNextSamples());
+
+  BOOST_CHECK_GT(allSamples->getNumberInstances(), 0);
+  BOOST_CHECK_EQUAL(dataSource->getCurrentIteration(), 1);
+  BOOST_CHECK_EQUAL(dataSource->getPrefetchStallTime(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(testPrefetcherException) {
+  // exceptions of the background thread are passed to the consumer in order
+  size_t counter = 0;
+  BatchPrefetcher prefetcher(
+      [&counter]() -> Dataset* {
+        if (counter == 2) {
+          throw sgpp::base::data_exception("failed to read the batch");
+        }
+        counter++;
+        return new Dataset(1, 1);
+      },
+      4);
+
+  std::unique_ptr<Dataset> first(prefetcher.getNextSamples());
+  std::unique_ptr<Dataset> second(prefetcher.getNextSamples());
+  BOOST_CHECK_EQUAL(first->getNumberInstances(), 1);
+  BOOST_CHECK_EQUAL(second->getNumberInstances(), 1);
+  BOOST_CHECK_THROW(prefetcher.getNextSamples(), sgpp::base::data_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
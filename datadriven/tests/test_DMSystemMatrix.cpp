@@ -0,0 +1,213 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/DMSystemMatrix.hpp>
+
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::HashGridPoint;
+using sgpp::base::OperationMatrix;
+using sgpp::datadriven::DMSystemMatrix;
+
+namespace {
+
+const double lambda = 1e-3;
+const double tolerance = 1e-10;
+
+DataMatrix randomPoints(size_t numberOfPoints, size_t dim) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  DataMatrix points(numberOfPoints, dim);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      points.set(i, t, distribution(generator));
+    }
+  }
+
+  return points;
+}
+
+DataVector randomVector(size_t size) {
+  std::mt19937 generator(17);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  DataVector vector(size);
+
+  for (size_t i = 0; i < size; i++) {
+    vector[i] = distribution(generator);
+  }
+
+  return vector;
+}
+
+void checkEqualVectors(const DataVector& expected, const DataVector& actual) {
+  BOOST_REQUIRE_EQUAL(expected.getSize(), actual.getSize());
+
+  for (size_t i = 0; i < expected.getSize(); i++) {
+    BOOST_CHECK_SMALL(expected[i] - actual[i], tolerance);
+  }
+}
+
+/**
+ * Checks that the system matrix yields the same results with and without the cached data
+ * matrix and returns whether the data matrix has been cached.
+ */
+bool checkCachedSystemMatrix(Grid& grid, DataMatrix& data, size_t memoryBudget) {
+  std::shared_ptr<OperationMatrix> C(sgpp::op_factory::createOperationIdentity(grid));
+  DMSystemMatrix expectedMatrix(grid, data, C, lambda);
+  DMSystemMatrix cachedMatrix(grid, data, C, lambda);
+  cachedMatrix.setBasisMatrixCache(memoryBudget);
+
+  const size_t n = grid.getSize();
+  DataVector alpha = randomVector(n);
+  DataVector expected(n);
+  DataVector actual(n);
+  expectedMatrix.mult(alpha, expected);
+  cachedMatrix.mult(alpha, actual);
+  checkEqualVectors(expected, actual);
+
+  DataVector classes = randomVector(data.getNrows());
+  expectedMatrix.generateb(classes, expected);
+  cachedMatrix.generateb(classes, actual);
+  checkEqualVectors(expected, actual);
+
+  DataMatrix alphaBatch(n, 2);
+  alphaBatch.setColumn(0, alpha);
+  alphaBatch.setColumn(1, DataVector(n, 1.0));
+  DataMatrix expectedBatch;
+  DataMatrix actualBatch;
+  expectedMatrix.multBatch(alphaBatch, expectedBatch);
+  cachedMatrix.multBatch(alphaBatch, actualBatch);
+
+  for (size_t j = 0; j < 2; j++) {
+    DataVector expectedColumn(n);
+    DataVector actualColumn(n);
+    expectedBatch.getColumn(j, expectedColumn);
+    actualBatch.getColumn(j, actualColumn);
+    checkEqualVectors(expectedColumn, actualColumn);
+  }
+
+  return cachedMatrix.isBasisMatrixCached();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testDMSystemMatrix)
+
+BOOST_AUTO_TEST_CASE(testCachedBasisMatrix) {
+  const size_t dim = 2;
+  DataMatrix data = randomPoints(300, dim);
+  std::unique_ptr<Grid> grids[] = {
+      std::unique_ptr<Grid>(Grid::createLinearGrid(dim)),
+      std::unique_ptr<Grid>(Grid::createLinearBoundaryGrid(dim)),
+      std::unique_ptr<Grid>(Grid::createModLinearGrid(dim)),
+      std::unique_ptr<Grid>(Grid::createPolyGrid(dim, 3)),
+      std::unique_ptr<Grid>(Grid::createModPolyGrid(dim, 3)),
+      std::unique_ptr<Grid>(Grid::createBsplineGrid(dim, 3)),
+      std::unique_ptr<Grid>(Grid::createModBsplineGrid(dim, 3))};
+
+  for (std::unique_ptr<Grid>& grid : grids) {
+    BOOST_TEST_MESSAGE(grid->getTypeAsString());
+    grid->getGenerator().regular(4);
+    BOOST_CHECK(checkCachedSystemMatrix(*grid, data, 1 << 24));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testBasisMatrixBudget) {
+  // the on-the-fly evaluation is used if the data matrix does not fit into the budget
+  const size_t dim = 2;
+  DataMatrix data = randomPoints(300, dim);
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+
+  BOOST_CHECK(!checkCachedSystemMatrix(*grid, data, 4096));
+  BOOST_CHECK(!checkCachedSystemMatrix(*grid, data, 0));
+}
+
+BOOST_AUTO_TEST_CASE(testBasisMatrixGridChange) {
+  // the data matrix is rebuilt if grid points are added
+  const size_t dim = 2;
+  DataMatrix data = randomPoints(100, dim);
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(2);
+
+  std::shared_ptr<OperationMatrix> C(sgpp::op_factory::createOperationIdentity(*grid));
+  DMSystemMatrix cachedMatrix(*grid, data, C, lambda);
+  cachedMatrix.setBasisMatrixCache(1 << 24);
+  DataVector alpha(grid->getSize(), 1.0);
+  DataVector result(grid->getSize());
+  cachedMatrix.mult(alpha, result);
+  BOOST_CHECK(cachedMatrix.isBasisMatrixCached());
+
+  grid->getStorage().clear();
+  grid->getGenerator().regular(3);
+  BOOST_CHECK(checkCachedSystemMatrix(*grid, data, 1 << 24));
+
+  std::shared_ptr<OperationMatrix> newC(sgpp::op_factory::createOperationIdentity(*grid));
+  DMSystemMatrix expectedMatrix(*grid, data, newC, lambda);
+  alpha = randomVector(grid->getSize());
+  DataVector expected(grid->getSize());
+  DataVector actual(grid->getSize());
+  expectedMatrix.mult(alpha, expected);
+  cachedMatrix.mult(alpha, actual);
+  BOOST_CHECK(cachedMatrix.isBasisMatrixCached());
+  checkEqualVectors(expected, actual);
+}
+
+BOOST_AUTO_TEST_CASE(testBasisMatrixGridChangeSameSize) {
+  // the data matrix is rebuilt if the grid points change, but not their number
+  const size_t dim = 2;
+  DataMatrix data = randomPoints(100, dim);
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(2);
+  const size_t gridSize = grid->getSize();
+
+  std::shared_ptr<OperationMatrix> C(sgpp::op_factory::createOperationIdentity(*grid));
+  DMSystemMatrix cachedMatrix(*grid, data, C, lambda);
+  cachedMatrix.setBasisMatrixCache(1 << 24);
+  DataVector alpha(gridSize, 1.0);
+  DataVector result(gridSize);
+  cachedMatrix.mult(alpha, result);
+  BOOST_CHECK(cachedMatrix.isBasisMatrixCached());
+
+  // replace the grid by one that is refined up to level 3 in the first dimension only
+  grid->getStorage().clear();
+  HashGridPoint point(dim);
+
+  for (HashGridPoint::level_type l = 1; l <= 3; l++) {
+    for (HashGridPoint::index_type i = 1; i < (1u << l); i += 2) {
+      if ((l < 3) || (i < 4)) {
+        point.set(0, l, i);
+        point.set(1, 1, 1);
+        grid->getStorage().insert(point);
+      }
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(grid->getSize(), gridSize);
+
+  std::shared_ptr<OperationMatrix> newC(sgpp::op_factory::createOperationIdentity(*grid));
+  DMSystemMatrix expectedMatrix(*grid, data, newC, lambda);
+  alpha = randomVector(gridSize);
+  DataVector expected(gridSize);
+  DataVector actual(gridSize);
+  expectedMatrix.mult(alpha, expected);
+  cachedMatrix.mult(alpha, actual);
+  BOOST_CHECK(cachedMatrix.isBasisMatrixCached());
+  checkEqualVectors(expected, actual);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,129 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/operation/hash/OperationDensityClustering/OperationClustering.hpp>
+#include <sgpp/datadriven/operation/hash/OperationDensityClustering/OperationCreateGraph.hpp>
+#include <sgpp/datadriven/operation/hash/OperationDensityClustering/OperationPruneGraph.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::datadriven::DensityClustering::OperationClustering;
+using sgpp::datadriven::DensityClustering::OperationCreateGraph;
+using sgpp::datadriven::DensityClustering::OperationPruneGraph;
+
+namespace {
+
+const std::string dataPath = "datadriven/datasets/clustering_test_data/";
+const size_t k = 8;
+
+/// reads all values of a whitespace separated result file of the OpenCL tests
+template <typename T>
+std::vector<T> readValues(const std::string& fileName) {
+  std::ifstream in(dataPath + fileName);
+
+  if (!in) {
+    BOOST_THROW_EXCEPTION(std::runtime_error("Result file " + fileName + " is missing!"));
+  }
+
+  std::vector<T> values;
+  T value;
+
+  while (in >> value) {
+    values.push_back(value);
+  }
+
+  return values;
+}
+
+DataMatrix readDataset() {
+  return sgpp::datadriven::ARFFTools::readARFFFromFile(
+             dataPath + "clustering_testdataset_dim2.arff", false)
+      .getData();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestDensityClustering)
+
+BOOST_AUTO_TEST_CASE(testCreateGraph) {
+  // the neighbors equal the ones found by the OpenCL kernel, but are sorted by distance
+  DataMatrix dataset = readDataset();
+  std::vector<int> expected = readValues<int>("graph_erg_dim2_depth11.txt");
+  BOOST_REQUIRE_EQUAL(expected.size(), dataset.getNrows() * k);
+
+  OperationCreateGraph operation(dataset, k);
+  std::vector<int> graph(dataset.getNrows() * k);
+  operation.create_graph(graph);
+
+  for (size_t i = 0; i < dataset.getNrows(); i++) {
+    std::vector<int> neighbors(graph.begin() + i * k, graph.begin() + (i + 1) * k);
+    std::vector<int> expectedNeighbors(expected.begin() + i * k, expected.begin() + (i + 1) * k);
+    std::sort(neighbors.begin(), neighbors.end());
+    std::sort(expectedNeighbors.begin(), expectedNeighbors.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(neighbors.begin(), neighbors.end(), expectedNeighbors.begin(),
+                                  expectedNeighbors.end());
+  }
+
+  // a chunk of the graph equals the corresponding part of the whole graph
+  const size_t startid = 1234;
+  const size_t chunksize = 567;
+  std::vector<int> chunk(chunksize * k);
+  operation.create_graph(chunk, startid, chunksize);
+  BOOST_CHECK_EQUAL_COLLECTIONS(chunk.begin(), chunk.end(), graph.begin() + startid * k,
+                                graph.begin() + (startid + chunksize) * k);
+}
+
+BOOST_AUTO_TEST_CASE(testPruneGraph) {
+  DataMatrix dataset = readDataset();
+  std::vector<int> graph = readValues<int>("graph_erg_dim2_depth11.txt");
+  std::vector<int> expected = readValues<int>("graph_pruned_erg_dim2_depth11.txt");
+  std::vector<double> alphaValues = readValues<double>("alpha_erg_dim2_depth11.txt");
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(11);
+  BOOST_REQUIRE_EQUAL(alphaValues.size(), grid->getSize());
+  DataVector alpha(alphaValues);
+
+  OperationPruneGraph operation(*grid, alpha, dataset, 0.2, k);
+  operation.prune_graph(graph);
+  BOOST_CHECK_EQUAL_COLLECTIONS(graph.begin(), graph.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(testFindClusters) {
+  std::vector<int> graph = readValues<int>("graph_pruned_erg_dim2_depth11.txt");
+  std::vector<size_t> expected = readValues<size_t>("cluster_erg.txt");
+
+  std::vector<size_t> clusters = OperationClustering::find_clusters(graph, k);
+  BOOST_CHECK_EQUAL_COLLECTIONS(clusters.begin(), clusters.end(), expected.begin(),
+                                expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(testFindClustersNoise) {
+  // node 2 is removed, all edges of node 4 are removed, node 5 is connected to node 0
+  // only by an incoming edge
+  std::vector<int> graph = {1, -2, 0, 2, -1, -1, -2, 6, -2, -2, 0, -2, 3, -2};
+  std::vector<size_t> expected = {1, 1, 0, 2, 0, 1, 2};
+
+  std::vector<size_t> clusters = OperationClustering::find_clusters(graph, 2);
+  BOOST_CHECK_EQUAL_COLLECTIONS(clusters.begin(), clusters.end(), expected.begin(),
+                                expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,343 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/KernelAutotuner.hpp>
+#include <sgpp/datadriven/operation/hash/KernelDispatch.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::OperationMultipleEval;
+using sgpp::datadriven::KernelAutotuner;
+using sgpp::datadriven::KernelDispatch;
+using sgpp::datadriven::KernelISA;
+
+namespace {
+
+const size_t dim = 4;
+const size_t numDataPoints = 1001;
+
+void createData(DataMatrix& dataset, DataVector& alpha, DataVector& source) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  dataset.resize(numDataPoints, dim);
+
+  for (size_t i = 0; i < numDataPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, distribution(generator));
+    }
+  }
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = distribution(generator) - 0.5;
+  }
+
+  source.resize(numDataPoints);
+
+  for (size_t i = 0; i < numDataPoints; i++) {
+    source[i] = distribution(generator) - 0.5;
+  }
+}
+
+void checkClose(const DataVector& expected, const DataVector& actual) {
+  BOOST_REQUIRE_EQUAL(expected.getSize(), actual.getSize());
+
+  for (size_t i = 0; i < expected.getSize(); i++) {
+    BOOST_CHECK_SMALL(expected[i] - actual[i], 1e-10 * std::max(1.0, std::abs(expected[i])));
+  }
+}
+
+// compares the given operation with the generic implementation of the base module
+// for all available instruction sets, with and without autotuning
+template <class Operation>
+void checkAllISAs(Grid& grid, sgpp::datadriven::OperationMultipleEvalType type,
+                  sgpp::datadriven::OperationMultipleEvalSubType subType) {
+  DataMatrix dataset;
+  DataVector alpha(grid.getSize());
+  DataVector source;
+  createData(dataset, alpha, source);
+
+  std::unique_ptr<OperationMultipleEval> reference(
+      sgpp::op_factory::createOperationMultipleEval(grid, dataset));
+  DataVector expectedResult(numDataPoints);
+  DataVector expectedResultTranspose(grid.getSize());
+  reference->mult(alpha, expectedResult);
+  reference->multTranspose(source, expectedResultTranspose);
+
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(type, subType);
+  const bool wasEnabled = KernelAutotuner::isEnabled();
+
+  for (bool autotune : {false, true}) {
+    KernelAutotuner::setEnabled(autotune);
+
+    for (KernelISA isa : KernelDispatch::getAvailableISAs()) {
+      BOOST_TEST_MESSAGE("instruction set: " << KernelDispatch::toString(isa)
+                                             << ", autotuning: " << autotune);
+      std::unique_ptr<OperationMultipleEval> op(
+          sgpp::op_factory::createOperationMultipleEval(grid, dataset, configuration));
+      Operation& kernelOp = dynamic_cast<Operation&>(*op);
+      kernelOp.setKernelISA(isa);
+      BOOST_CHECK(kernelOp.getKernelISA() == isa);
+
+      DataVector result(numDataPoints);
+      DataVector resultTranspose(grid.getSize());
+      op->mult(alpha, result);
+      op->multTranspose(source, resultTranspose);
+
+      checkClose(expectedResult, result);
+      checkClose(expectedResultTranspose, resultTranspose);
+    }
+  }
+
+  KernelAutotuner::setEnabled(wasEnabled);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestKernelDispatch)
+
+BOOST_AUTO_TEST_CASE(testInstructionSets) {
+  for (KernelISA isa : {KernelISA::Scalar, KernelISA::SSE3, KernelISA::AVX, KernelISA::AVX2,
+                        KernelISA::AVX512}) {
+    BOOST_CHECK(KernelDispatch::fromString(KernelDispatch::toString(isa)) == isa);
+  }
+
+  BOOST_CHECK(KernelDispatch::fromString("AVX2") == KernelISA::AVX2);
+  BOOST_CHECK_THROW(KernelDispatch::fromString("neon"), sgpp::base::application_exception);
+
+  // the instruction set SG++ is compiled for must always be available
+  BOOST_CHECK(KernelDispatch::isCompiled(KernelDispatch::getCompiledISA()));
+  BOOST_CHECK(KernelDispatch::isSupported(KernelDispatch::getCompiledISA()));
+
+  std::vector<KernelISA> isas = KernelDispatch::getAvailableISAs();
+  BOOST_REQUIRE(!isas.empty());
+  BOOST_CHECK(KernelDispatch::getBestISA() == isas.front());
+
+  for (size_t i = 0; i < isas.size(); i++) {
+    BOOST_CHECK(KernelDispatch::isAvailable(isas[i]));
+
+    if (i > 0) {
+      BOOST_CHECK(isas[i] < isas[i - 1]);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testAutotunerCache) {
+  const bool wasEnabled = KernelAutotuner::isEnabled();
+  KernelAutotuner::setEnabled(true);
+  KernelAutotuner::clearCache();
+
+  size_t numBenchmarks = 0;
+  auto benchmark = [&numBenchmarks](size_t candidate) { numBenchmarks++; };
+
+  size_t best = KernelAutotuner::tune("test", KernelISA::Scalar, 1000, 5, 3000, 4, 0, benchmark);
+  BOOST_CHECK_LT(best, 4);
+  BOOST_CHECK_GE(numBenchmarks, 4);
+  BOOST_CHECK_EQUAL(KernelAutotuner::getCacheSize(), 1);
+
+  // similar shapes reuse the tuned configuration
+  size_t numBenchmarksTuned = numBenchmarks;
+  BOOST_CHECK_EQUAL(
+      KernelAutotuner::tune("test", KernelISA::Scalar, 1020, 5, 2900, 4, 0, benchmark), best);
+  BOOST_CHECK_EQUAL(numBenchmarks, numBenchmarksTuned);
+
+  // other shapes and instruction sets are tuned separately
+  KernelAutotuner::tune("test", KernelISA::Scalar, 1000, 6, 3000, 4, 0, benchmark);
+  KernelAutotuner::tune("test", KernelISA::SSE3, 1000, 5, 3000, 4, 0, benchmark);
+  BOOST_CHECK_GT(numBenchmarks, numBenchmarksTuned);
+  BOOST_CHECK_EQUAL(KernelAutotuner::getCacheSize(), 3);
+
+  // other candidate sets (e.g., with a fixed instruction set) are tuned separately
+  numBenchmarksTuned = numBenchmarks;
+  BOOST_CHECK_LT(KernelAutotuner::tune("test", KernelISA::Scalar, 1000, 5, 3000, 2, 0, benchmark),
+                 2);
+  KernelAutotuner::tune("test", KernelISA::Scalar, 1000, 5, 3000, 4, 0, benchmark, 42);
+  BOOST_CHECK_GE(numBenchmarks, numBenchmarksTuned + 6);
+  BOOST_CHECK_EQUAL(KernelAutotuner::getCacheSize(), 5);
+
+  BOOST_CHECK_THROW(
+      KernelAutotuner::tune("test", KernelISA::Scalar, 1000, 5, 3000, 4, 4, benchmark),
+      sgpp::base::operation_exception);
+
+  // without autotuning, the default candidate is used without benchmarking
+  KernelAutotuner::setEnabled(false);
+  numBenchmarksTuned = numBenchmarks;
+  BOOST_CHECK_EQUAL(
+      KernelAutotuner::tune("test", KernelISA::Scalar, 50, 2, 50, 4, 2, benchmark), 2);
+  BOOST_CHECK_EQUAL(numBenchmarks, numBenchmarksTuned);
+
+  KernelAutotuner::clearCache();
+  BOOST_CHECK_EQUAL(KernelAutotuner::getCacheSize(), 0);
+  KernelAutotuner::setEnabled(wasEnabled);
+}
+
+BOOST_AUTO_TEST_CASE(testAutotunerStreamingConfigurations) {
+  const bool wasEnabled = KernelAutotuner::isEnabled();
+  KernelAutotuner::setEnabled(true);
+  KernelAutotuner::clearCache();
+
+  const KernelISA isa = KernelDispatch::getBestISA();
+  std::vector<KernelAutotuner::StreamingConfiguration> fixedConfigurations =
+      KernelAutotuner::getStreamingConfigurations(isa, true, 96);
+  std::vector<KernelAutotuner::StreamingConfiguration> configurations =
+      KernelAutotuner::getStreamingConfigurations(isa, false, 96);
+  BOOST_REQUIRE(!fixedConfigurations.empty());
+  BOOST_CHECK_GE(configurations.size(), fixedConfigurations.size());
+
+  // the default configuration comes first, a fixed instruction set is not changed
+  BOOST_CHECK(configurations.front().isa == isa);
+  BOOST_CHECK_EQUAL(configurations.front().chunkDataPoints,
+                    KernelAutotuner::getDefaultStreamingChunkDataPoints(isa, 96));
+
+  for (const KernelAutotuner::StreamingConfiguration& configuration : fixedConfigurations) {
+    BOOST_CHECK(configuration.isa == isa);
+    BOOST_CHECK_EQUAL(KernelAutotuner::getStreamingDataPadding(96) %
+                          configuration.chunkDataPoints, 0);
+  }
+
+  // the choice for one candidate set is never used for another one (both sets are equal if
+  // there is no second instruction set to compare with)
+  auto benchmark = [](const KernelAutotuner::StreamingConfiguration& configuration) {};
+  KernelAutotuner::tuneStreaming("test", configurations, 1000, 5, 3000, benchmark);
+  KernelAutotuner::StreamingConfiguration best =
+      KernelAutotuner::tuneStreaming("test", fixedConfigurations, 1000, 5, 3000, benchmark);
+  BOOST_CHECK(best.isa == isa);
+  BOOST_CHECK_EQUAL(KernelAutotuner::getCacheSize(),
+                    (fixedConfigurations.size() > 1 ? 1 : 0) +
+                        (configurations.size() > fixedConfigurations.size() ? 1 : 0));
+
+  BOOST_CHECK_EQUAL(KernelAutotuner::getBenchmarkSize(1 << 10, 10, 2, 1000, 24), 72);
+  BOOST_CHECK_EQUAL(KernelAutotuner::getBenchmarkSize(1 << 30, 10, 2, 960, 24), 960);
+  BOOST_CHECK_EQUAL(KernelAutotuner::getBenchmarkSize(1, 10, 2, 960, 24), 24);
+
+  KernelAutotuner::clearCache();
+  KernelAutotuner::setEnabled(wasEnabled);
+}
+
+BOOST_AUTO_TEST_CASE(testStreaming) {
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+
+  checkAllISAs<sgpp::datadriven::OperationMultiEvalStreaming>(
+      *grid, sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+}
+
+BOOST_AUTO_TEST_CASE(testStreamingMultipleVectors) {
+  // all coefficient vectors are evaluated at once, the padding points must not be returned
+  const size_t numberOfVectors = 3;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+
+  DataMatrix dataset;
+  DataVector alphaColumn(grid->getSize());
+  DataVector source;
+  DataMatrix alpha(grid->getSize(), numberOfVectors);
+  createData(dataset, alphaColumn, source);
+
+  for (size_t k = 0; k < numberOfVectors; k++) {
+    alpha.setColumn(k, alphaColumn);
+    alphaColumn.mult(-2.0);
+  }
+
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+  std::unique_ptr<OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration));
+  std::unique_ptr<OperationMultipleEval> reference(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+  DataMatrix result;
+  op->mult(alpha, result);
+  BOOST_REQUIRE_EQUAL(result.getNrows(), numDataPoints);
+  BOOST_REQUIRE_EQUAL(result.getNcols(), numberOfVectors);
+
+  DataVector expectedResult(numDataPoints);
+  DataVector resultColumn(numDataPoints);
+
+  for (size_t k = 0; k < numberOfVectors; k++) {
+    alpha.getColumn(k, alphaColumn);
+    reference->mult(alphaColumn, expectedResult);
+    result.getColumn(k, resultColumn);
+    checkClose(expectedResult, resultColumn);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testModMaskStreaming) {
+  std::unique_ptr<Grid> grid(Grid::createModLinearGrid(dim));
+  grid->getGenerator().regular(4);
+
+  checkAllISAs<sgpp::datadriven::OperationMultiEvalModMaskStreaming>(
+      *grid, sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+}
+
+#if defined(__AVX__) || defined(USE_KERNEL_DISPATCH)
+BOOST_AUTO_TEST_CASE(testSubspaceCombined) {
+  if (!KernelDispatch::isSupported(KernelISA::AVX)) {
+    BOOST_TEST_MESSAGE("skipping test, the CPU doesn't support AVX");
+    return;
+  }
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+
+  DataMatrix dataset;
+  DataVector alpha(grid->getSize());
+  DataVector source;
+  createData(dataset, alpha, source);
+
+  std::unique_ptr<OperationMultipleEval> reference(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+  DataVector expectedResult(numDataPoints);
+  DataVector expectedResultTranspose(grid->getSize());
+  reference->mult(alpha, expectedResult);
+  reference->multTranspose(source, expectedResultTranspose);
+
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::SUBSPACELINEAR,
+      sgpp::datadriven::OperationMultipleEvalSubType::COMBINED);
+  const bool wasEnabled = KernelAutotuner::isEnabled();
+
+  for (bool autotune : {false, true}) {
+    KernelAutotuner::setEnabled(autotune);
+    std::unique_ptr<OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration));
+
+    DataVector result(numDataPoints);
+    DataVector resultTranspose(grid->getSize());
+    op->mult(alpha, result);
+    op->multTranspose(source, resultTranspose);
+
+    checkClose(expectedResult, result);
+    checkClose(expectedResultTranspose, resultTranspose);
+  }
+
+  KernelAutotuner::setEnabled(wasEnabled);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
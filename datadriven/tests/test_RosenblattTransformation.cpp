@@ -15,12 +15,15 @@
 #include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
 #include <sgpp/datadriven/application/KernelDensityEstimator.hpp>
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationDensityConditional.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationDensityMargTo1D.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/optimization/operation/OptimizationOpFactory.hpp>
 
 #include <vector>
 #include <random>
 #include <iostream>
+#include <memory>
 
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
@@ -216,6 +219,124 @@ void testEqualityRosenblattInverseRosenblattKDE(
   }
 }
 
+void testEqualityBatchedSingleSample(Grid& grid, DataVector& alpha, size_t numSamples = 40,
+                                     double tolerance = 1e-14,
+                                     std::uint64_t seedValue = std::mt19937_64::default_seed) {
+  size_t numDims = grid.getStorage().getDimension();
+  DataMatrix u_vars(numSamples, numDims);
+  randu(u_vars, seedValue);
+
+  // every other sample shares its conditioning values with the previous one,
+  // such that the transformation reuses the conditioned densities
+  DataVector u_sample(numDims);
+  for (size_t isample = 1; isample < numSamples; isample += 2) {
+    u_vars.getRow(isample - 1, u_sample);
+    u_sample[numDims - 1] = 0.5 * u_sample[numDims - 1];
+    u_vars.setRow(isample, u_sample);
+  }
+
+  std::unique_ptr<sgpp::datadriven::OperationInverseRosenblattTransformation> opInvRos(
+      sgpp::op_factory::createOperationInverseRosenblattTransformation(grid));
+  std::unique_ptr<sgpp::datadriven::OperationRosenblattTransformation> opRos(
+      sgpp::op_factory::createOperationRosenblattTransformation(grid));
+
+  DataMatrix x_vars(numSamples, numDims);
+  DataMatrix u_vars_transformed(numSamples, numDims);
+  DataMatrix u_single(1, numDims);
+  DataMatrix x_single(1, numDims);
+  DataVector x_sample(numDims);
+
+  for (size_t dim_start = 0; dim_start < numDims; dim_start++) {
+    // transform all samples at once
+    opInvRos->doTransformation(&alpha, &u_vars, &x_vars, dim_start);
+    opRos->doTransformation(&alpha, &x_vars, &u_vars_transformed, dim_start);
+
+    for (size_t isample = 0; isample < numSamples; isample++) {
+      // transform every sample on its own
+      u_vars.getRow(isample, u_sample);
+      u_single.setRow(0, u_sample);
+      opInvRos->doTransformation(&alpha, &u_single, &x_single, dim_start);
+      x_vars.getRow(isample, x_sample);
+      x_single.getRow(0, u_sample);
+
+      for (size_t idim = 0; idim < numDims; idim++) {
+        BOOST_CHECK_SMALL(x_sample[idim] - u_sample[idim], tolerance);
+      }
+
+      x_single.setRow(0, x_sample);
+      opRos->doTransformation(&alpha, &x_single, &u_single, dim_start);
+      u_vars_transformed.getRow(isample, x_sample);
+      u_single.getRow(0, u_sample);
+
+      for (size_t idim = 0; idim < numDims; idim++) {
+        BOOST_CHECK_SMALL(x_sample[idim] - u_sample[idim], tolerance);
+      }
+    }
+  }
+}
+
+void testEqualityConditionalOnExistingGrid(Grid& grid, DataVector& alpha,
+                                           double tolerance = 1e-12) {
+  size_t numDims = grid.getStorage().getDimension();
+  std::unique_ptr<sgpp::datadriven::OperationDensityConditional> opCond(
+      sgpp::op_factory::createOperationDensityConditional(grid));
+  DataMatrix x_vars(20, numDims - 1);
+  randu(x_vars);
+  DataVector x_sample(numDims - 1);
+  DataVector coord1d(1);
+
+  for (unsigned int mdim = 0; mdim < numDims; mdim++) {
+    std::unique_ptr<Grid> conditionalGrid(opCond->createConditionalGrid(mdim));
+    std::unique_ptr<sgpp::datadriven::OperationDensityMargTo1D> opMarg(
+        sgpp::op_factory::createOperationDensityMargTo1D(*conditionalGrid));
+    std::unique_ptr<Grid> grid1d(opMarg->create1DGrid(0));
+
+    for (double xbar : {0.1, 0.3, 0.75}) {
+      // reference: conditioned and marginalized densities on newly created grids
+      Grid* refGrid = nullptr;
+      DataVector refAlpha(1);
+      opCond->doConditional(alpha, refGrid, refAlpha, mdim, xbar);
+      std::unique_ptr<Grid> refGridPtr(refGrid);
+      Grid* refGrid1d = nullptr;
+      DataVector* refAlpha1d = nullptr;
+      std::unique_ptr<sgpp::datadriven::OperationDensityMargTo1D> refMarg(
+          sgpp::op_factory::createOperationDensityMargTo1D(*refGrid));
+      refMarg->margToDimX(&refAlpha, refGrid1d, refAlpha1d, 0);
+      std::unique_ptr<Grid> refGrid1dPtr(refGrid1d);
+      std::unique_ptr<DataVector> refAlpha1dPtr(refAlpha1d);
+
+      // only the coefficients are computed on the existing grids
+      DataVector condAlpha;
+      opCond->doConditional(alpha, *conditionalGrid, condAlpha, mdim, xbar);
+      DataVector alpha1d;
+      opMarg->margToDimX(condAlpha, *grid1d, alpha1d, 0);
+
+      std::unique_ptr<sgpp::base::OperationEval> opEvalRef(
+          sgpp::op_factory::createOperationEvalNaive(*refGrid));
+      std::unique_ptr<sgpp::base::OperationEval> opEval(
+          sgpp::op_factory::createOperationEvalNaive(*conditionalGrid));
+
+      for (size_t isample = 0; isample < x_vars.getNrows(); isample++) {
+        x_vars.getRow(isample, x_sample);
+        BOOST_CHECK_SMALL(opEvalRef->eval(refAlpha, x_sample) - opEval->eval(condAlpha, x_sample),
+                          tolerance);
+      }
+
+      std::unique_ptr<sgpp::base::OperationEval> opEval1dRef(
+          sgpp::op_factory::createOperationEvalNaive(*refGrid1d));
+      std::unique_ptr<sgpp::base::OperationEval> opEval1d(
+          sgpp::op_factory::createOperationEvalNaive(*grid1d));
+
+      for (size_t isample = 0; isample < x_vars.getNrows(); isample++) {
+        coord1d[0] = x_vars.get(isample, 0);
+        BOOST_CHECK_SMALL(
+            opEval1dRef->eval(*refAlpha1d, coord1d) - opEval1d->eval(alpha1d, coord1d),
+            tolerance);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE(testRosenblattTransformation)
 
 BOOST_AUTO_TEST_CASE(testRosenblattLinear1D) {
@@ -542,4 +663,36 @@ BOOST_AUTO_TEST_CASE(testRosenblattKDEDD) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testRosenblattBatchedLinear) {
+  Grid* grid = Grid::createLinearGrid(3);
+  DataVector alpha;
+  hierarchize(grid, 3, alpha, &parabola);
+  testEqualityBatchedSingleSample(*grid, alpha);
+  delete grid;
+}
+
+BOOST_AUTO_TEST_CASE(testRosenblattBatchedPoly) {
+  Grid* grid = Grid::createPolyGrid(2, 3);
+  DataVector alpha;
+  hierarchize(grid, 3, alpha, &parabola);
+  testEqualityBatchedSingleSample(*grid, alpha, 10);
+  delete grid;
+}
+
+BOOST_AUTO_TEST_CASE(testConditionalOnExistingGridLinear) {
+  Grid* grid = Grid::createLinearGrid(3);
+  DataVector alpha;
+  hierarchize(grid, 3, alpha, &parabola);
+  testEqualityConditionalOnExistingGrid(*grid, alpha);
+  delete grid;
+}
+
+BOOST_AUTO_TEST_CASE(testConditionalOnExistingGridPoly) {
+  Grid* grid = Grid::createPolyGrid(3, 3);
+  DataVector alpha;
+  hierarchize(grid, 3, alpha, &parabola);
+  testEqualityConditionalOnExistingGrid(*grid, alpha);
+  delete grid;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -8,20 +8,93 @@
 #include <boost/test/unit_test.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
 
+#include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/StreamingDataParser.hpp>
 
+#include <cstdio>
+#include <fstream>
 #include <string>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
+using sgpp::datadriven::CSVFileSampleProvider;
 using sgpp::datadriven::Dataset;
 using sgpp::datadriven::CSVTools;
+using sgpp::datadriven::StreamingDataParser;
 
 
+#if defined(ZLIB) || defined(ZSTD)
+namespace {
+
+void checkCompressedRead(const std::string& fileName, const std::string& compressedFileName,
+                         size_t chunkSize) {
+  // the samples of the compressed file must equal those of the uncompressed one
+  double eps = 1e-10;
+  StreamingDataParser control(StreamingDataParser::Format::ARFF, true);
+  control.readFile(fileName);
+  std::unique_ptr<Dataset> expected(control.readAll());
+
+  StreamingDataParser parser(StreamingDataParser::Format::ARFF, true);
+  parser.setChunkSize(chunkSize);
+  parser.readCompressedFile(compressedFileName);
+  BOOST_CHECK_EQUAL(parser.getDimension(), control.getDimension());
+  BOOST_REQUIRE_EQUAL(parser.getNumberInstances(), expected->getNumberInstances());
+
+  // batches across the decompressed blocks, then again from the beginning
+  for (size_t pass = 0; pass < 2; pass++) {
+    StreamingDataParser::Cursor cursor = parser.begin();
+    size_t row = 0;
+    while (true) {
+      std::unique_ptr<Dataset> d(parser.readNext(cursor, 17));
+      if (d->getNumberInstances() == 0) {
+        break;
+      }
+      for (size_t i = 0; i < d->getNumberInstances(); i++, row++) {
+        BOOST_CHECK_EQUAL(d->getTargets()[i], expected->getTargets()[row]);
+        for (size_t j = 0; j < d->getDimension(); j++) {
+          BOOST_CHECK_SMALL(d->getData().get(i, j) - expected->getData().get(row, j), eps);
+        }
+      }
+    }
+    BOOST_CHECK_EQUAL(row, expected->getNumberInstances());
+    BOOST_CHECK_EQUAL(cursor.offset, parser.end().offset);
+  }
+
+  std::unique_ptr<Dataset> d(parser.readAll());
+  BOOST_REQUIRE_EQUAL(d->getNumberInstances(), expected->getNumberInstances());
+  DataMatrix difference(d->getData());
+  difference.sub(expected->getData()); difference.abs();
+  BOOST_CHECK_SMALL(difference.max(), eps);
+
+  // a copy decompresses on its own, so reading alternately from both does not disturb either
+  StreamingDataParser copy(parser);
+  StreamingDataParser::Cursor cursor = parser.begin();
+  StreamingDataParser::Cursor copyCursor = copy.begin();
+  std::unique_ptr<Dataset> skipped(parser.readNext(cursor, 50));
+  size_t row = 0;
+  while (true) {
+    std::unique_ptr<Dataset> fromCopy(copy.readNext(copyCursor, 13));
+    std::unique_ptr<Dataset> fromParser(parser.readNext(cursor, 7));
+    if (fromCopy->getNumberInstances() == 0) {
+      break;
+    }
+    for (size_t i = 0; i < fromCopy->getNumberInstances(); i++, row++) {
+      BOOST_CHECK_EQUAL(fromCopy->getTargets()[i], expected->getTargets()[row]);
+    }
+  }
+  BOOST_CHECK_EQUAL(row, expected->getNumberInstances());
+}
+
+}  // namespace
+#endif
+
 BOOST_AUTO_TEST_SUITE(test_dataread_csv)
 
 BOOST_AUTO_TEST_CASE(test_fullread_hastargets) {
@@ -175,4 +248,177 @@ BOOST_AUTO_TEST_CASE(test_read_csv_old) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_streaming_batches) {
+  std::string fileName = "datadriven/datasets/dataread/simple.csv";
+  double eps = 1e-06;
+  std::vector<double> cls;
+  cls.push_back(7.0); cls.push_back(42.42);
+  std::vector<size_t> cols;
+  cols.push_back(4); cols.push_back(2); cols.push_back(0);
+  Dataset control = CSVTools::readCSVFromFile(fileName, true, true, 3, cols, cls);
+
+  StreamingDataParser parser(StreamingDataParser::Format::CSV, true, 3, cols, cls);
+  parser.readFile(fileName);
+  BOOST_CHECK_EQUAL(parser.getDimension(), 3);
+  BOOST_CHECK_EQUAL(parser.getNumberInstances(), 3);
+
+  // read in batches of two samples, the last batch is smaller
+  StreamingDataParser::Cursor cursor = parser.begin();
+  size_t row = 0;
+  for (size_t batch = 0; batch < 3; batch++) {
+    std::unique_ptr<Dataset> d(parser.readNext(cursor, 2));
+    BOOST_CHECK_EQUAL(d->getNumberInstances(), (batch == 0) ? 2 : ((batch == 1) ? 1 : 0));
+    for (size_t i = 0; i < d->getNumberInstances(); i++, row++) {
+      BOOST_CHECK_CLOSE(d->getTargets()[i], control.getTargets()[row], eps);
+      for (size_t j = 0; j < 3; j++) {
+        BOOST_CHECK_SMALL(d->getData().get(i, j) - control.getData().get(row, j), eps);
+      }
+    }
+  }
+  BOOST_CHECK_EQUAL(row, 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_streaming_readall_chunks) {
+  std::string fileName = "datadriven/datasets/dataread/simple.csv";
+  double eps = 1e-06;
+  Dataset control = CSVTools::readCSVFromFile(fileName, true, false);
+
+  // tiny chunks such that every line is in its own chunk
+  StreamingDataParser parser(StreamingDataParser::Format::CSV, false);
+  parser.readFile(fileName);
+  parser.setChunkSize(3);
+  std::unique_ptr<Dataset> d(parser.readAll());
+  BOOST_CHECK_EQUAL(d->getNumberInstances(), control.getNumberInstances());
+  BOOST_CHECK_EQUAL(d->getDimension(), control.getDimension());
+  DataMatrix difference(d->getData());
+  difference.sub(control.getData()); difference.abs();
+  BOOST_CHECK_SMALL(difference.max(), eps);
+  BOOST_CHECK_EQUAL(parser.getNumberInstances(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_streaming_string) {
+  // no newline at the end, blank fields are zero, too few columns are an error
+  StreamingDataParser parser(StreamingDataParser::Format::CSV, true);
+  parser.readString("x,y,class\r\n1.5,-2,1\r\n, 3e2,-1");
+  std::unique_ptr<Dataset> d(parser.readAll());
+  BOOST_CHECK_EQUAL(d->getNumberInstances(), 2);
+  BOOST_CHECK_EQUAL(d->getData().get(0, 0), 1.5);
+  BOOST_CHECK_EQUAL(d->getData().get(0, 1), -2.0);
+  BOOST_CHECK_EQUAL(d->getData().get(1, 0), 0.0);
+  BOOST_CHECK_EQUAL(d->getData().get(1, 1), 300.0);
+  BOOST_CHECK_EQUAL(d->getTargets()[1], -1.0);
+
+  parser.readString("x,y,class\n1,2,3\n4,5\n");
+  StreamingDataParser::Cursor cursor = parser.begin();
+  BOOST_CHECK_THROW(parser.readNext(cursor, 10), sgpp::base::data_exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_streaming_file_end) {
+  // the mapped file fills exactly one page and its last line is not terminated, the target of
+  // the last line ends at the end of the mapping, the first field of the last line is long
+  std::string fileName = "test_readCSV_file_end.tmp";
+  std::string longField = "0.5" + std::string(67, '0');
+  {
+    std::ofstream file(fileName, std::ios::binary);
+    file << "x,class\n";
+    for (size_t i = 0; i < 1004; i++) {
+      file << "1,1\n";
+    }
+    file << longField << ",2";
+  }
+
+  StreamingDataParser parser(StreamingDataParser::Format::CSV, true);
+  parser.readFile(fileName);
+  std::unique_ptr<Dataset> d(parser.readAll());
+  BOOST_REQUIRE_EQUAL(d->getNumberInstances(), 1005);
+  BOOST_CHECK_EQUAL(d->getData().get(1004, 0), 0.5);
+  BOOST_CHECK_EQUAL(d->getTargets()[1004], 2.0);
+
+  StreamingDataParser filter(StreamingDataParser::Format::CSV, true, -1, std::vector<size_t>(),
+                             std::vector<double>{2.0});
+  filter.readFile(fileName);
+  BOOST_CHECK_EQUAL(filter.getNumberInstances(), 1);
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_streaming_copy) {
+  // the copy shares the mapped file, which must stay valid after the original is destroyed
+  std::string fileName = "datadriven/datasets/ripley/ripleyGarcke.test.arff";
+  StreamingDataParser control(StreamingDataParser::Format::ARFF, true);
+  control.readFile(fileName);
+  std::unique_ptr<Dataset> expected(control.readAll());
+
+  std::unique_ptr<StreamingDataParser> parser(
+      new StreamingDataParser(StreamingDataParser::Format::ARFF, true));
+  parser->readFile(fileName);
+  StreamingDataParser copy(*parser);
+  parser.reset();
+
+  BOOST_CHECK_EQUAL(copy.getDimension(), control.getDimension());
+  StreamingDataParser::Cursor cursor = copy.begin();
+  std::unique_ptr<Dataset> d(copy.readNext(cursor, expected->getNumberInstances()));
+  BOOST_REQUIRE_EQUAL(d->getNumberInstances(), expected->getNumberInstances());
+  DataMatrix difference(d->getData());
+  difference.sub(expected->getData()); difference.abs();
+  BOOST_CHECK_SMALL(difference.max(), 1e-10);
+}
+
+#ifdef ZLIB
+BOOST_AUTO_TEST_CASE(test_streaming_gzip) {
+  checkCompressedRead("datadriven/datasets/ripley/ripleyGarcke.test.arff",
+                      "datadriven/datasets/ripley/ripleyGarcke.test.arff.gz", 100);
+
+  // the column titles of the CSV file span several blocks
+  std::string fileName = "datadriven/datasets/dataread/simple.csv";
+  double eps = 1e-06;
+  std::vector<double> cls;
+  cls.push_back(7.0); cls.push_back(42.42);
+  std::vector<size_t> cols;
+  cols.push_back(4); cols.push_back(2); cols.push_back(0);
+  Dataset control = CSVTools::readCSVFromFile(fileName, true, true, 3, cols, cls);
+
+  StreamingDataParser parser(StreamingDataParser::Format::CSV, true, 3, cols, cls);
+  parser.setChunkSize(5);
+  parser.readCompressedFile(fileName + ".gz");
+  BOOST_CHECK_EQUAL(parser.getDimension(), 3);
+  BOOST_CHECK_EQUAL(parser.getNumberInstances(), 3);
+  std::unique_ptr<Dataset> d(parser.readAll());
+  BOOST_REQUIRE_EQUAL(d->getNumberInstances(), 3);
+  DataMatrix difference(d->getData());
+  difference.sub(control.getData()); difference.abs();
+  BOOST_CHECK_SMALL(difference.max(), eps);
+
+  // uncompressed files are read as they are
+  parser.readCompressedFile(fileName);
+  BOOST_CHECK_EQUAL(parser.getNumberInstances(), 3);
+}
+#endif
+
+#ifdef ZSTD
+BOOST_AUTO_TEST_CASE(test_streaming_zstd) {
+  // the file consists of four frames which are decompressed in parallel for the larger chunk
+  // size and as a stream for the smaller one
+  checkCompressedRead("datadriven/datasets/ripley/ripleyGarcke.test.arff",
+                      "datadriven/datasets/ripley/ripleyGarcke.test.arff.zst", 4096);
+  checkCompressedRead("datadriven/datasets/ripley/ripleyGarcke.test.arff",
+                      "datadriven/datasets/ripley/ripleyGarcke.test.arff.zst", 100);
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(test_compressed_error_message) {
+  // the message names the file and its compression format
+  std::string fileName = "datadriven/datasets/dataread/doesNotExist.csv.gz";
+  CSVFileSampleProvider provider;
+
+  try {
+    provider.readCompressedFile(fileName, true);
+    BOOST_FAIL("reading a missing file must throw");
+  } catch (const sgpp::base::data_exception& e) {
+    std::string message(e.what());
+    BOOST_CHECK_NE(message.find(fileName), std::string::npos);
+    BOOST_CHECK_NE(message.find("compression: none"), std::string::npos);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
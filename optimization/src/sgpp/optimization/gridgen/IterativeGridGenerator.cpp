@@ -3,10 +3,6 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/optimization/gridgen/IterativeGridGenerator.hpp>
@@ -54,36 +50,29 @@ void IterativeGridGenerator::evalFunction(size_t oldGridSize) {
   const size_t d = f.getNumberOfParameters();
   base::GridStorage& gridStorage = grid.getStorage();
   const size_t curGridSize = gridStorage.getSize();
-  base::DataVector& fX = functionValues;
-
-#pragma omp parallel shared(fX, oldGridSize, gridStorage)
-  {
-    base::DataVector x(d);
-    base::ScalarFunction* curFPtr = &f;
-#ifdef _OPENMP
-    std::unique_ptr<base::ScalarFunction> curF;
-
-    if (omp_get_max_threads() > 1) {
-      f.clone(curF);
-      curFPtr = curF.get();
-    }
 
-#endif /* _OPENMP */
-
-#pragma omp for
+  if (curGridSize <= oldGridSize) {
+    return;
+  }
 
-    for (size_t i = oldGridSize; i < curGridSize; i++) {
-      // convert grid point to coordinate vector
-      const base::GridPoint& gp = gridStorage[i];
+  // coordinates of the new grid points (row-wise)
+  base::DataMatrix x(curGridSize - oldGridSize, d);
+  base::DataVector fx(curGridSize - oldGridSize);
 
-      for (size_t t = 0; t < d; t++) {
-        x[t] = gridStorage.getCoordinate(gp, t);
-      }
+  for (size_t i = oldGridSize; i < curGridSize; i++) {
+    const base::GridPoint& gp = gridStorage[i];
 
-      const double fx = curFPtr->eval(x);
-      fX[i] = fx;
+    for (size_t t = 0; t < d; t++) {
+      x(i - oldGridSize, t) = gridStorage.getCoordinate(gp, t);
     }
   }
+
+  // batched evaluation (in parallel, see base::ScalarFunction::eval)
+  f.eval(x, fx);
+
+  for (size_t i = oldGridSize; i < curGridSize; i++) {
+    functionValues[i] = fx[i - oldGridSize];
+  }
 }
 }  // namespace optimization
 }  // namespace sgpp
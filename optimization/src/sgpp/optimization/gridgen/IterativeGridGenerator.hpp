@@ -80,6 +80,8 @@ class IterativeGridGenerator {
    * Evaluates the objective function at grid points with indices
    * [oldGridSize, oldGridSize + 1, ..., grid.getSize() - 1]
    * and saves values in functionValues.
+   * The points are evaluated at once with the batched (parallel) evaluation
+   * of base::ScalarFunction.
    *
    * @param oldGridSize   number of grid points already evaluated
    */
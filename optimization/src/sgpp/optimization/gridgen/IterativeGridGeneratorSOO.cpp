@@ -73,10 +73,7 @@ bool IterativeGridGeneratorSOO::generate() {
   base::DataVector& fX = functionValues;
   fX.resize(N);
 
-  {
-    base::DataVector x(gridStorage.getCoordinates(gridStorage[0]));
-    fX[0] = f.eval(x);
-  }
+  evalFunction();
 
   base::DataVector refinementAlpha(1, 0.0);
 
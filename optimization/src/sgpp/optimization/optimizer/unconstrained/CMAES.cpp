@@ -77,7 +77,7 @@ void CMAES::optimize() {
   base::DataVector m(x0);
   double sigma = 0.3;
 
-  base::DataMatrix X(d, lambda), Y(d, lambda);
+  base::DataMatrix X(d, lambda), Y(d, lambda), XTransposed(lambda, d);
   base::DataVector x(d), y(d), tmp(d);
   base::DataVector fX(lambda);
   std::vector<size_t> fXOrder(lambda);
@@ -118,22 +118,13 @@ void CMAES::optimize() {
       x.mult(sigma);
       x.add(m);
       X.setColumn(j, x);
-
-      {
-        bool inDomain = true;
-
-        for (size_t t = 0; t < d; t++) {
-          if ((x[t] < 0.0) || (x[t] > 1.0)) {
-            inDomain = false;
-            break;
-          }
-        }
-
-        fX[j] = (inDomain ? f->eval(x) : std::numeric_limits<double>::infinity());
-        fXOrder[j] = j;
-      }
+      XTransposed.setRow(j, x);
+      fXOrder[j] = j;
     }
 
+    // evaluate all samples at once
+    f->evalInDomain(XTransposed, fX);
+
     numberOfFcnEvals += lambda;
 
     std::sort(fXOrder.begin(), fXOrder.end(),
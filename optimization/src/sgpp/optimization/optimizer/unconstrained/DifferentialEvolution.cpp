@@ -66,15 +66,21 @@ void DifferentialEvolution::optimize() {
   // (no need to swap those)
   base::DataVector fx(populationSize);
 
+  // points to be evaluated (row-wise, evaluated in batches)
+  base::DataMatrix y(populationSize, d);
+  // function values at these points
+  base::DataVector fy(populationSize);
+
   // initial pseudorandom points
   for (size_t i = 0; i < populationSize; i++) {
     for (size_t t = 0; t < d; t++) {
       (*xOld)[i][t] = base::RandomNumberGenerator::getInstance().getUniformRN();
+      y(i, t) = (*xOld)[i][t];
     }
-
-    fx[i] = f->eval((*xOld)[i]);
   }
 
+  f->evalInDomain(y, fx);
+
   // smallest function value in the population
   double fCurrentOpt = std::numeric_limits<double>::infinity();
   // index of the point with value fOpt
@@ -129,72 +135,43 @@ void DifferentialEvolution::optimize() {
     const std::vector<size_t>& j_k = j[k];
     const std::vector<base::DataVector>& prob_k = prob[k];
 
-#pragma omp parallel shared(k, a_k, b_k, c_k, j_k, prob_k, xOld, fx, fCurrentOpt, xOptIndex, xNew)
-    {  // NOLINT(whitespace/braces)
-      base::DataVector y(d);
-      base::ScalarFunction* curFPtr = f.get();
-#ifdef _OPENMP
-      std::unique_ptr<base::ScalarFunction> curF;
-
-      if (omp_get_max_threads() > 1) {
-        f->clone(curF);
-        curFPtr = curF.get();
-      }
-
-#endif /* _OPENMP */
-
-// for each point in the population
-#pragma omp for schedule(dynamic)
+    // mutate every point of the population
+    for (size_t i = 0; i < populationSize; i++) {
+      const size_t &cur_a = a_k[i], &cur_b = b_k[i], &cur_c = c_k[i];
+      const size_t& cur_j = j_k[i];
+      const base::DataVector& prob_ki = prob_k[i];
 
-      for (size_t i = 0; i < populationSize; i++) {
-        const size_t &cur_a = a_k[i], &cur_b = b_k[i], &cur_c = c_k[i];
-        const size_t& cur_j = j_k[i];
-        const base::DataVector& prob_ki = prob_k[i];
-        bool inDomain = true;
+      // for each dimension
+      for (size_t t = 0; t < d; t++) {
+        const double& curProb = prob_ki[t];
 
-        // for each dimension
-        for (size_t t = 0; t < d; t++) {
-          const double& curProb = prob_ki[t];
-
-          if ((t == cur_j) || (curProb < crossoverProbability)) {
-            // mutate point in this dimension
-            y[t] = (*xOld)[cur_a][t] + scalingFactor * ((*xOld)[cur_b][t] - (*xOld)[cur_c][t]);
-          } else {
-            // don't mutate point in this dimension
-            y[t] = (*xOld)[i][t];
-          }
-
-          // mutated point is out of bounds ==> discard
-          if ((y[t] < 0.0) || (y[t] > 1.0)) {
-            inDomain = false;
-            break;
-          }
+        if ((t == cur_j) || (curProb < crossoverProbability)) {
+          // mutate point in this dimension
+          y(i, t) = (*xOld)[cur_a][t] + scalingFactor * ((*xOld)[cur_b][t] - (*xOld)[cur_c][t]);
+        } else {
+          // don't mutate point in this dimension
+          y(i, t) = (*xOld)[i][t];
         }
+      }
+    }
 
-        // evaluate mutated point (if not out of bounds)
-        const double fy = (inDomain ? curFPtr->eval(y) : std::numeric_limits<double>::infinity());
-
-        if (fy < fx[i]) {
-// function_value is better ==> replace point with mutated one
-#pragma omp critical
-          {
-            fx[i] = fy;
+    // evaluate mutated points (in parallel, points out of bounds are discarded)
+    f->evalInDomain(y, fy);
 
-            if (fy < fCurrentOpt) {
-              xOptIndex = i;
-              fCurrentOpt = fy;
-            }
-          }
+    for (size_t i = 0; i < populationSize; i++) {
+      if (fy[i] < fx[i]) {
+        // function_value is better ==> replace point with mutated one
+        fx[i] = fy[i];
 
-          for (size_t t = 0; t < d; t++) {
-            (*xNew)[i][t] = y[t];
-          }
-        } else {
-          // function value not better ==> keep old point
-          for (size_t t = 0; t < d; t++) {
-            (*xNew)[i][t] = (*xOld)[i][t];
-          }
+        if (fy[i] < fCurrentOpt) {
+          xOptIndex = i;
+          fCurrentOpt = fy[i];
         }
+
+        y.getRow(i, (*xNew)[i]);
+      } else {
+        // function value not better ==> keep old point
+        (*xNew)[i] = (*xOld)[i];
       }
     }
 
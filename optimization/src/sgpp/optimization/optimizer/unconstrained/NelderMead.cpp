@@ -48,13 +48,19 @@ void NelderMead::optimize() {
   base::DataVector fPoints(d + 1);
   base::DataVector fPointsNew(d + 1);
 
+  // vertices of the starting simplex (row-wise, evaluated at once)
+  base::DataMatrix pointsToEvaluate(d + 1, d);
+
   // construct starting simplex
   for (size_t t = 0; t < d; t++) {
     points[t + 1][t] = std::min(points[t + 1][t] + STARTING_SIMPLEX_EDGE_LENGTH, 1.0);
-    fPoints[t + 1] = f->eval(points[t + 1]);
   }
 
-  fPoints[0] = f->eval(points[0]);
+  for (size_t i = 0; i < d + 1; i++) {
+    pointsToEvaluate.setRow(i, points[i]);
+  }
+
+  f->evalInDomain(pointsToEvaluate, fPoints);
 
   std::vector<size_t> index(d + 1, 0);
   base::DataVector pointO(d);
@@ -177,18 +183,21 @@ void NelderMead::optimize() {
 
     if (shrink) {
       // shrink all points but the first
-      for (size_t i = 1; i < d + 1; i++) {
-        bool in_domain = true;
+      base::DataMatrix pointsShrunk(d, d);
 
+      for (size_t i = 1; i < d + 1; i++) {
         for (size_t t = 0; t < d; t++) {
           points[i][t] = points[0][t] + delta * (points[i][t] - points[0][t]);
-
-          if ((points[i][t] < 0.0) || (points[i][t] > 1.0)) {
-            in_domain = false;
-          }
         }
 
-        fPoints[i] = (in_domain ? f->eval(points[i]) : std::numeric_limits<double>::infinity());
+        pointsShrunk.setRow(i - 1, points[i]);
+      }
+
+      base::DataVector fPointsShrunk(d);
+      f->evalInDomain(pointsShrunk, fPointsShrunk);
+
+      for (size_t i = 1; i < d + 1; i++) {
+        fPoints[i] = fPointsShrunk[i - 1];
       }
 
       numberOfFcnEvals += d;
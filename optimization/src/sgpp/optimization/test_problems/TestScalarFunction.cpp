@@ -24,6 +24,8 @@ double TestScalarFunction::eval(const base::DataVector& x) {
   return evalUndisplaced(xTmp);
 }
 
+bool TestScalarFunction::supportsParallelEval() const { return true; }
+
 const base::DataVector& TestScalarFunction::getDisplacement() const { return displacement; }
 
 void TestScalarFunction::setDisplacement(const base::DataVector& displacement) {
@@ -62,6 +62,11 @@ class TestScalarFunction : public base::ScalarFunction {
    */
   virtual double evalUndisplaced(const base::DataVector& x) = 0;
 
+  /**
+   * @return true, the clones of the test functions do not share state
+   */
+  bool supportsParallelEval() const override;
+
   /**
    * @return                currently used displacement
    */
@@ -9,6 +9,7 @@
 #include <sgpp/base/function/scalar/ComponentScalarFunction.hpp>
 #include <sgpp/base/function/scalar/ComponentScalarFunctionGradient.hpp>
 #include <sgpp/base/function/scalar/ComponentScalarFunctionHessian.hpp>
+#include <sgpp/base/function/scalar/InterpolantScalarFunction.hpp>
 #include <sgpp/base/function/scalar/WrapperScalarFunction.hpp>
 #include <sgpp/base/function/scalar/WrapperScalarFunctionGradient.hpp>
 #include <sgpp/base/function/scalar/WrapperScalarFunctionHessian.hpp>
@@ -18,7 +19,9 @@
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/RandomNumberGenerator.hpp>
 
+#include <atomic>
 #include <limits>
+#include <memory>
 #include <vector>
 
 #include "CheckEqualFunction.hpp"
@@ -28,6 +31,7 @@ using sgpp::base::ComponentScalarFunctionGradient;
 using sgpp::base::ComponentScalarFunctionHessian;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
+using sgpp::base::InterpolantScalarFunction;
 using sgpp::base::RandomNumberGenerator;
 using sgpp::base::ScalarFunction;
 using sgpp::base::ScalarFunctionGradient;
@@ -55,6 +59,25 @@ class ScalarTestFunction : public ScalarFunction {
   }
 };
 
+class ClonedScalarTestFunction : public ScalarTestFunction {
+ public:
+  ClonedScalarTestFunction(size_t d, bool parallel)
+      : ScalarTestFunction(d), parallel(parallel), numberOfClones(new std::atomic<size_t>(0)) {}
+
+  void clone(std::unique_ptr<ScalarFunction>& clone) const override {
+    (*numberOfClones)++;
+    clone = std::unique_ptr<ScalarFunction>(new ClonedScalarTestFunction(*this));
+  }
+
+  bool supportsParallelEval() const override { return parallel; }
+
+  size_t getNumberOfClones() const { return *numberOfClones; }
+
+ protected:
+  bool parallel;
+  std::shared_ptr<std::atomic<size_t>> numberOfClones;
+};
+
 class ScalarTestGradient : public ScalarFunctionGradient {
  public:
   explicit ScalarTestGradient(size_t d) : ScalarFunctionGradient(d) {}
@@ -412,3 +435,96 @@ BOOST_AUTO_TEST_CASE(TestWrapperVectorFunctionHessian) {
   f2.clone(f2Clone);
   checkEqualFunction(f1, *f2Clone);
 }
+
+BOOST_AUTO_TEST_CASE(TestBatchedScalarFunction) {
+  // Test batched evaluation of sgpp::base::ScalarFunction and
+  // sgpp::base::InterpolantScalarFunction.
+  const size_t d = 3;
+  const size_t N = 200;
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  DataMatrix X(N, d);
+
+  for (size_t k = 0; k < N; k++) {
+    for (size_t t = 0; t < d; t++) {
+      X(k, t) = RandomNumberGenerator::getInstance().getUniformRN();
+    }
+  }
+
+  // some points outside of the domain
+  X(3, 0) = -0.1;
+  X(42, 2) = 1.5;
+
+  for (bool parallel : {false, true}) {
+    // standard implementation (parallel with clones only if the function supports it)
+    ClonedScalarTestFunction f(d, parallel);
+    DataVector fX;
+    DataVector x(d);
+    static_cast<ScalarFunction&>(f).eval(X, fX);
+    BOOST_REQUIRE_EQUAL(fX.getSize(), N);
+
+    for (size_t k = 0; k < N; k++) {
+      X.getRow(k, x);
+      BOOST_CHECK_EQUAL(fX[k], f.eval(x));
+    }
+
+    if (!parallel) {
+      BOOST_CHECK_EQUAL(f.getNumberOfClones(), 0);
+    }
+
+    // points outside of the domain are not evaluated
+    f.evalInDomain(X, fX);
+    BOOST_REQUIRE_EQUAL(fX.getSize(), N);
+
+    for (size_t k = 0; k < N; k++) {
+      X.getRow(k, x);
+
+      if ((k == 3) || (k == 42)) {
+        BOOST_CHECK_EQUAL(fX[k], std::numeric_limits<double>::infinity());
+      } else {
+        BOOST_CHECK_EQUAL(fX[k], f.eval(x));
+      }
+    }
+  }
+
+  // grids with and without OperationMultipleEval implementation
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(d)));
+  grids.push_back(
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearBoundaryGrid(d)));
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineGrid(d, 3)));
+  grids.push_back(
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModBsplineGrid(d, 3)));
+  grids.push_back(
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createFundamentalSplineGrid(d, 3)));
+
+  for (auto& grid : grids) {
+    grid->getGenerator().regular(4);
+    DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = RandomNumberGenerator::getInstance().getUniformRN(-1.0, 1.0);
+    }
+
+    InterpolantScalarFunction f(*grid, alpha);
+    DataVector fX;
+    DataVector x(d);
+
+    // evaluate twice (the second time, the fallback is known for unsupported grids)
+    for (size_t i = 0; i < 2; i++) {
+      f.eval(X, fX);
+      BOOST_REQUIRE_EQUAL(fX.getSize(), N);
+
+      for (size_t k = 0; k < N; k++) {
+        X.getRow(k, x);
+        const double fx = f.eval(x);
+
+        if (fx == std::numeric_limits<double>::infinity()) {
+          BOOST_CHECK_EQUAL(fX[k], fx);
+        } else {
+          BOOST_CHECK_SMALL(fX[k] - fx, 1e-10);
+        }
+      }
+    }
+  }
+}
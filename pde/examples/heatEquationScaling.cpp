@@ -0,0 +1,142 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/**
+ * \page example_heatEquationScaling_cpp Scaling of the Up/Down operators for the heat equation
+ *
+ * This example measures the strong scaling of the task-parallel Up/Down scheme
+ * (sgpp::pde::UpDownOneOpDim and sgpp::pde::StdUpDown) on a six-dimensional heat equation,
+ * from one thread up to the maximum number of OpenMP threads. For every number of threads,
+ * it reports the time of one application of the Laplace operator and of the mass matrix
+ * (L2 dot product) and the time of a few implicit Euler time steps with CG.
+ *
+ * Usage: heatEquationScaling [level] [number of time steps] [task cutoff]
+ */
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystem.hpp>
+#include <sgpp/pde/algorithm/StdUpDown.hpp>
+#include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/solver/ode/Euler.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::OperationMatrix;
+using sgpp::base::SGppStopwatch;
+
+int main(int argc, char* argv[]) {
+  /**
+   * We create a regular grid with boundary points (as the heat equation solver does)
+   * and interpolate a smooth initial heat distribution.
+   */
+  const size_t dim = 6;
+  const int level = (argc > 1) ? std::atoi(argv[1]) : 3;
+  const size_t numTimesteps = (argc > 2) ? std::atoi(argv[2]) : 3;
+  const double timestepSize = 0.001;
+  const double heatCoefficient = 1.0;
+
+  std::unique_ptr<Grid> grid(Grid::createLinearBoundaryGrid(dim));
+  grid->getGenerator().regular(level);
+  sgpp::base::GridStorage& storage = grid->getStorage();
+
+  DataVector alpha0(grid->getSize());
+
+  for (size_t i = 0; i < grid->getSize(); i++) {
+    double value = 1.0;
+
+    for (size_t t = 0; t < dim; t++) {
+      value *= std::sin(M_PI * storage.getCoordinate(storage.getPoint(i), t));
+    }
+
+    alpha0[i] = value;
+  }
+
+  std::unique_ptr<sgpp::base::OperationHierarchisation>(
+      sgpp::op_factory::createOperationHierarchisation(*grid))
+      ->doHierarchisation(alpha0);
+
+  std::unique_ptr<OperationMatrix> opLaplace(sgpp::op_factory::createOperationLaplace(*grid));
+  std::unique_ptr<OperationMatrix> opMass(sgpp::op_factory::createOperationLTwoDotProduct(*grid));
+
+  if (argc > 3) {
+    const size_t taskCutoff = std::atoi(argv[3]);
+    dynamic_cast<sgpp::pde::UpDownOneOpDim&>(*opLaplace).setTaskCutoff(taskCutoff);
+    dynamic_cast<sgpp::pde::StdUpDown&>(*opMass).setTaskCutoff(taskCutoff);
+  }
+
+  std::cout << "dimension: " << dim << ", level: " << level << ", grid points: " << grid->getSize()
+            << ", time steps: " << numTimesteps << std::endl;
+
+  /**
+   * We apply the operators and solve the heat equation with an increasing number of threads.
+   * The speedup of the time stepping is relative to the run with one thread.
+   */
+  int maxThreads = 1;
+#ifdef _OPENMP
+  maxThreads = omp_get_max_threads();
+#endif
+
+  SGppStopwatch stopwatch;
+  double timeOneThread = 0.0;
+  DataVector result(grid->getSize());
+
+  std::cout << std::setw(8) << "threads" << std::setw(14) << "laplace [s]" << std::setw(14)
+            << "mass [s]" << std::setw(14) << "heat eq. [s]" << std::setw(10) << "speedup"
+            << std::setw(18) << "checksum" << std::endl;
+
+  for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+#ifdef _OPENMP
+    omp_set_num_threads(numThreads);
+#endif
+    stopwatch.start();
+    opLaplace->mult(alpha0, result);
+    const double timeLaplace = stopwatch.stop();
+
+    stopwatch.start();
+    opMass->mult(alpha0, result);
+    const double timeMass = stopwatch.stop();
+
+    DataVector alpha(alpha0);
+    sgpp::pde::HeatEquationParabolicPDESolverSystem system(*grid, alpha, heatCoefficient,
+                                                           timestepSize, "ImEul");
+    sgpp::solver::Euler euler("ImEul", numTimesteps, timestepSize);
+    sgpp::solver::ConjugateGradients cg(1000, 1e-8);
+
+    stopwatch.start();
+    euler.solve(cg, system, false);
+    const double timeHeat = stopwatch.stop();
+
+    if (numThreads == 1) {
+      timeOneThread = timeHeat;
+    }
+
+    std::cout << std::setw(8) << numThreads << std::setw(14) << timeLaplace << std::setw(14)
+              << timeMass << std::setw(14) << timeHeat << std::setw(10) << timeOneThread / timeHeat
+              << std::setw(18) << alpha.sum() << std::endl;
+
+    // also measure the maximum number of threads if it is not a power of two
+    if ((numThreads < maxThreads) && (2 * numThreads > maxThreads)) {
+      numThreads = maxThreads / 2;
+    }
+  }
+
+  return 0;
+}
@@ -7,6 +7,10 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace sgpp {
 namespace pde {
 
@@ -18,9 +22,18 @@ StdUpDown::StdUpDown(sgpp::base::GridStorage* storage)
 StdUpDown::~StdUpDown() {}
 
 void StdUpDown::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
+#ifdef _OPENMP
+  // called from a parallel region (e.g. by a task of a PDE solver system), the tasks
+  // of the recursion are executed by the enclosing team
+  if (omp_in_parallel()) {
+    multParallelBuildingBlock(alpha, result);
+    return;
+  }
+#endif
+
   sgpp::base::DataVector beta(result.getSize());
   result.setAll(0.0);
-#pragma omp parallel
+#pragma omp parallel if (isTaskParallel(this->numAlgoDims_ - 1))
   {
 #pragma omp single nowait
     { this->updown(alpha, beta, this->numAlgoDims_ - 1); }
@@ -38,9 +51,12 @@ void StdUpDown::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
   result.add(beta);
 }
 
+bool StdUpDown::isTaskParallel(size_t dim) const {
+  return UpDownTaskCutoff::isTaskParallel(dim, this->numAlgoDims_, this->storage->getSize());
+}
+
 void StdUpDown::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) {
-  size_t curNumAlgoDims = this->numAlgoDims_;
-  size_t curMaxParallelDims = this->maxParallelDims_;
+  bool parallel = isTaskParallel(dim);
 
   // Unidirectional scheme
   if (dim > 0) {
@@ -49,14 +65,13 @@ void StdUpDown::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& re
     sgpp::base::DataVector result_temp(alpha.getSize());
     sgpp::base::DataVector temp_two(alpha.getSize());
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
+#pragma omp task if (parallel) shared(alpha, temp, result)
     {
       up(alpha, temp, this->algoDims[dim]);
       updown(temp, result, dim - 1);
     }
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
-                                                                        result_temp)
+#pragma omp task if (parallel) shared(alpha, temp_two, result_temp)
     {  // NOLINT(whitespace/braces)
       updown(alpha, temp_two, dim - 1);
       down(temp_two, result_temp, this->algoDims[dim]);
@@ -69,10 +84,10 @@ void StdUpDown::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& re
     // Terminates dimension recursion
     sgpp::base::DataVector temp(alpha.getSize());
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
+#pragma omp task if (parallel) shared(alpha, result)
     up(alpha, result, this->algoDims[dim]);
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
+#pragma omp task if (parallel) shared(alpha, temp)
     down(alpha, temp, this->algoDims[dim]);
 
 #pragma omp taskwait
@@ -9,6 +9,7 @@
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/pde/algorithm/UpDownTaskCutoff.hpp>
 
 #ifndef TASKS_PARALLEL_UPDOWN
 #define TASKS_PARALLEL_UPDOWN 4
@@ -25,7 +26,7 @@ namespace pde {
  * Implements a standard Up/Down Schema without any operation dim.
  *
  */
-class StdUpDown : public sgpp::base::OperationMatrix {
+class StdUpDown : public sgpp::base::OperationMatrix, public UpDownTaskCutoff {
  public:
   /**
    * Constructor
@@ -69,6 +70,12 @@ class StdUpDown : public sgpp::base::OperationMatrix {
   /// max number of parallel stages (dimension recursive calls)
   static const size_t maxParallelDims_ = TASKS_PARALLEL_UPDOWN;
 
+  /**
+   * @param dim the current dimension of the recursion
+   * @return whether the branches of the recursion step are executed as OpenMP tasks
+   */
+  bool isTaskParallel(size_t dim) const;
+
   /**
    * Recursive procedure for updown
    *
@@ -7,6 +7,12 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <vector>
+
 namespace sgpp {
 namespace pde {
 
@@ -25,36 +31,57 @@ UpDownOneOpDim::UpDownOneOpDim(sgpp::base::GridStorage* storage)
 UpDownOneOpDim::~UpDownOneOpDim() {}
 
 void UpDownOneOpDim::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
+  // one result per operation dimension, summed up in a fixed order afterwards so that
+  // the result does not depend on the order in which the tasks finish
+  std::vector<sgpp::base::DataVector> betas(this->numAlgoDims_,
+                                            sgpp::base::DataVector(result.getSize()));
+  bool parallel = isTaskParallel(this->numAlgoDims_ - 1);
+
+#ifdef _OPENMP
+  // called from a parallel region (e.g. by a task of a PDE solver system), the tasks
+  // are executed by the enclosing team
+  bool inParallel = omp_in_parallel();
+#else
+  bool inParallel = false;
+#endif
+
+  if (inParallel) {
+    updownAllDims(alpha, betas);
+  } else {
+#pragma omp parallel if (parallel)
+    {
+#pragma omp single nowait
+      updownAllDims(alpha, betas);
+    }
+  }
+
   result.setAll(0.0);
 
-#pragma omp parallel
-  {
-#pragma omp single nowait
-    {
-      for (size_t i = 0; i < this->numAlgoDims_; i++) {
-#pragma omp task firstprivate(i) shared(alpha, result)
-        {
-          sgpp::base::DataVector beta(result.getSize());
-
-          if (this->coefs != nullptr) {
-            if (this->coefs->get(i) != 0.0) {
-              this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
-
-#pragma omp critical
-              { result.axpy(this->coefs->get(i), beta); }
-            }
-          } else {
-            this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
-
-#pragma omp critical
-            { result.add(beta); }
-          }
-        }
+  for (size_t i = 0; i < this->numAlgoDims_; i++) {
+    if (this->coefs != nullptr) {
+      if (this->coefs->get(i) != 0.0) {
+        result.axpy(this->coefs->get(i), betas[i]);
       }
+    } else {
+      result.add(betas[i]);
+    }
+  }
+}
 
-#pragma omp taskwait
+void UpDownOneOpDim::updownAllDims(sgpp::base::DataVector& alpha,
+                                   std::vector<sgpp::base::DataVector>& betas) {
+  bool parallel = isTaskParallel(this->numAlgoDims_ - 1);
+
+  for (size_t i = 0; i < this->numAlgoDims_; i++) {
+    if ((this->coefs != nullptr) && (this->coefs->get(i) == 0.0)) {
+      continue;
     }
+
+#pragma omp task if (parallel) firstprivate(i) shared(alpha, betas)
+    this->updown(alpha, betas[i], this->numAlgoDims_ - 1, i);
   }
+
+#pragma omp taskwait
 }
 
 void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
@@ -77,10 +104,13 @@ void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
   }
 }
 
+bool UpDownOneOpDim::isTaskParallel(size_t dim) const {
+  return UpDownTaskCutoff::isTaskParallel(dim, this->numAlgoDims_, this->storage->getSize());
+}
+
 void UpDownOneOpDim::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                             size_t dim, size_t op_dim) {
-  size_t curNumAlgoDims = this->numAlgoDims_;
-  size_t curMaxParallelDims = this->maxParallelDims_;
+  bool parallel = isTaskParallel(dim);
 
   if (dim == op_dim) {
     specialOP(alpha, result, dim, op_dim);
@@ -92,15 +122,14 @@ void UpDownOneOpDim::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVecto
       sgpp::base::DataVector result_temp(alpha.getSize());
       sgpp::base::DataVector temp_two(alpha.getSize());
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
+#pragma omp task if (parallel) shared(alpha, temp, result)
       {
         up(alpha, temp, this->algoDims[dim]);
         updown(temp, result, dim - 1, op_dim);
       }
 
 // Same from the other direction:
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
-                                                                        result_temp)
+#pragma omp task if (parallel) shared(alpha, temp_two, result_temp)
       {  // NOLINT(whitespace/braces)
         updown(alpha, temp_two, dim - 1, op_dim);
         down(temp_two, result_temp, this->algoDims[dim]);
@@ -113,10 +142,10 @@ void UpDownOneOpDim::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVecto
       // Terminates dimension recursion
       sgpp::base::DataVector temp(alpha.getSize());
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
+#pragma omp task if (parallel) shared(alpha, result)
       up(alpha, result, this->algoDims[dim]);
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
+#pragma omp task if (parallel) shared(alpha, temp)
       down(alpha, temp, this->algoDims[dim]);
 
 #pragma omp taskwait
@@ -128,8 +157,7 @@ void UpDownOneOpDim::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVecto
 
 void UpDownOneOpDim::specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                                size_t dim, size_t op_dim) {
-  size_t curNumAlgoDims = this->numAlgoDims_;
-  size_t curMaxParallelDims = this->maxParallelDims_;
+  bool parallel = isTaskParallel(dim);
 
   // Unidirectional scheme
   if (dim > 0) {
@@ -138,15 +166,14 @@ void UpDownOneOpDim::specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVe
     sgpp::base::DataVector result_temp(alpha.getSize());
     sgpp::base::DataVector temp_two(alpha.getSize());
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
+#pragma omp task if (parallel) shared(alpha, temp, result)
     {
       upOpDim(alpha, temp, this->algoDims[dim]);
       updown(temp, result, dim - 1, op_dim);
     }
 
 // Same from the other direction:
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
-                                                                        result_temp)
+#pragma omp task if (parallel) shared(alpha, temp_two, result_temp)
     {  // NOLINT(whitespace/braces)
       updown(alpha, temp_two, dim - 1, op_dim);
       downOpDim(temp_two, result_temp, this->algoDims[dim]);
@@ -159,10 +186,10 @@ void UpDownOneOpDim::specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVe
     // Terminates dimension recursion
     sgpp::base::DataVector temp(alpha.getSize());
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
+#pragma omp task if (parallel) shared(alpha, result)
     upOpDim(alpha, result, this->algoDims[dim]);
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
+#pragma omp task if (parallel) shared(alpha, temp)
     downOpDim(alpha, temp, this->algoDims[dim]);
 
 #pragma omp taskwait
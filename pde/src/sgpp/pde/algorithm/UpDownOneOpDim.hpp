@@ -9,6 +9,7 @@
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/pde/algorithm/UpDownTaskCutoff.hpp>
 
 #ifndef TASKS_PARALLEL_UPDOWN
 #define TASKS_PARALLEL_UPDOWN 4
@@ -27,7 +28,7 @@ namespace pde {
  * Parallelization with OpenMP 2 / 3 is supported!
  *
  */
-class UpDownOneOpDim : public sgpp::base::OperationMatrix {
+class UpDownOneOpDim : public sgpp::base::OperationMatrix, public UpDownTaskCutoff {
  public:
   /**
    * Constructor
@@ -88,6 +89,21 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
   /// max number of parallel stages (dimension recursive calls)
   static const size_t maxParallelDims_ = TASKS_PARALLEL_UPDOWN;
 
+  /**
+   * @param dim the current dimension of the recursion
+   * @return whether the branches of the recursion step are executed as OpenMP tasks
+   */
+  bool isTaskParallel(size_t dim) const;
+
+  /**
+   * Computes the up/down for every operation dimension (with nonzero coefficient) in a
+   * separate task and waits for the tasks.
+   *
+   * @param alpha vector of coefficients
+   * @param betas one vector per algorithmic dimension to store the results in
+   */
+  void updownAllDims(sgpp::base::DataVector& alpha, std::vector<sgpp::base::DataVector>& betas);
+
   /**
    * Recursive procedure for updown(), parallel version using OpenMP 3
    *
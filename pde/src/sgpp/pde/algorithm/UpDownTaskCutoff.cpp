@@ -0,0 +1,35 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/algorithm/UpDownTaskCutoff.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace pde {
+
+UpDownTaskCutoff::UpDownTaskCutoff() : taskCutoff(TASKS_PARALLEL_UPDOWN_CUTOFF) {}
+
+UpDownTaskCutoff::~UpDownTaskCutoff() {}
+
+void UpDownTaskCutoff::setTaskCutoff(size_t taskCutoff) { this->taskCutoff = taskCutoff; }
+
+size_t UpDownTaskCutoff::getTaskCutoff() const { return this->taskCutoff; }
+
+bool UpDownTaskCutoff::isTaskParallel(size_t dim, size_t numAlgoDims, size_t gridSize) const {
+  if (numAlgoDims - dim > TASKS_PARALLEL_UPDOWN) {
+    return false;
+  }
+
+  // each branch performs 2^dim sweeps over the grid
+  if (dim >= 8 * sizeof(size_t) - 1) {
+    return true;
+  }
+
+  return gridSize >= (this->taskCutoff >> dim);
+}
+
+}  // namespace pde
+}  // namespace sgpp
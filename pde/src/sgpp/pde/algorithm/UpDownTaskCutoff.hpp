@@ -0,0 +1,73 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef UPDOWNTASKCUTOFF_HPP
+#define UPDOWNTASKCUTOFF_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+#ifndef TASKS_PARALLEL_UPDOWN
+#define TASKS_PARALLEL_UPDOWN 4
+#endif
+
+#ifndef TASKS_PARALLEL_UPDOWN_CUTOFF
+#define TASKS_PARALLEL_UPDOWN_CUTOFF 16384
+#endif
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Size-based cutoff for the OpenMP tasks of the dimension recursion of Up/Down operators.
+ *
+ * The two branches of a recursion step are only executed as separate tasks if they
+ * perform at least taskCutoff 1D point updates (number of grid points times number of
+ * 1D sweeps in the branch), smaller subproblems are computed sequentially by the task
+ * that reaches them. Only the first TASKS_PARALLEL_UPDOWN recursion steps create tasks.
+ */
+class UpDownTaskCutoff {
+ public:
+  /**
+   * Constructor, the cutoff defaults to TASKS_PARALLEL_UPDOWN_CUTOFF.
+   */
+  UpDownTaskCutoff();
+
+  /**
+   * Destructor
+   */
+  virtual ~UpDownTaskCutoff();
+
+  /**
+   * @param taskCutoff minimal number of point updates of a task
+   */
+  void setTaskCutoff(size_t taskCutoff);
+
+  /**
+   * @return minimal number of point updates of a task
+   */
+  size_t getTaskCutoff() const;
+
+ protected:
+  /// minimal number of point updates of a task
+  size_t taskCutoff;
+
+  /**
+   * Decides whether the branches of the recursion step in dimension dim are executed as
+   * separate OpenMP tasks.
+   *
+   * @param dim the current dimension of the recursion
+   * @param numAlgoDims number of algorithmic dimensions (the recursion starts at numAlgoDims - 1)
+   * @param gridSize number of grid points
+   * @return whether tasks should be created
+   */
+  bool isTaskParallel(size_t dim, size_t numAlgoDims, size_t gridSize) const;
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* UPDOWNTASKCUTOFF_HPP */
@@ -10,7 +10,12 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <algorithm>
+#include <vector>
 
 namespace sgpp {
 namespace pde {
@@ -42,11 +47,25 @@ void OperationMatrixLTwoDotModLinear::mult(sgpp::base::DataVector& alpha,
   size_t gridSize = storage.getSize();
   size_t gridDim = storage.getDimension();
 
-  for (size_t i = 0; i < gridSize; i++) {
-    result[i] = 0;
-  }
+  // every thread accumulates the contributions of its rows (and, by symmetry, columns) in a
+  // vector of its own, the vectors are summed up in the order of the threads afterwards;
+  // the static schedule assigns the rows to the threads independently of the timing, hence the
+  // result only depends on the number of threads
+  int numThreads = 1;
+#ifdef _OPENMP
+  numThreads = omp_get_max_threads();
+#endif
+  std::vector<sgpp::base::DataVector> partialResults(numThreads,
+                                                     sgpp::base::DataVector(gridSize, 0.0));
 
+#pragma omp parallel for schedule(static, 16)
   for (size_t i = 0; i < gridSize; i++) {
+#ifdef _OPENMP
+    sgpp::base::DataVector& localResult = partialResults[omp_get_thread_num()];
+#else
+    sgpp::base::DataVector& localResult = partialResults[0];
+#endif
+
     for (size_t j = i; j < gridSize; j++) {
       double temp_ij = 1;
 
@@ -133,11 +152,17 @@ void OperationMatrixLTwoDotModLinear::mult(sgpp::base::DataVector& alpha,
         }
         temp_ij *= temp_res;
       }
-      result[i] += temp_ij * alpha[j];
+      localResult[i] += temp_ij * alpha[j];
       if (i != j)
-        result[j] += temp_ij * alpha[i];
+        localResult[j] += temp_ij * alpha[i];
     }
   }
+
+  result.setAll(0.0);
+
+  for (sgpp::base::DataVector& localResult : partialResults) {
+    result.add(localResult);
+  }
 }
 }  // namespace pde
 }  // namespace sgpp
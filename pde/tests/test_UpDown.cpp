@@ -0,0 +1,132 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp_base.hpp>
+#include <sgpp_pde.hpp>
+#include <sgpp/pde/algorithm/StdUpDown.hpp>
+#include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+
+namespace {
+
+sgpp::base::DataVector createAlpha(size_t size) {
+  sgpp::base::DataVector alpha(size);
+
+  for (size_t i = 0; i < size; i++) {
+    alpha[i] = std::sin(static_cast<double>(i + 1));
+  }
+
+  return alpha;
+}
+
+/**
+ * Applies an Up/Down operator sequentially (no tasks), with a task for every recursion step
+ * and from within a parallel region, and checks that the results are identical.
+ */
+template <class UpDown>
+void checkTaskParallelUpDown(sgpp::base::OperationMatrix* op, size_t gridSize) {
+  UpDown& upDown = dynamic_cast<UpDown&>(*op);
+  sgpp::base::DataVector alpha = createAlpha(gridSize);
+  sgpp::base::DataVector resultSequential(gridSize);
+  sgpp::base::DataVector resultTasks(gridSize);
+  sgpp::base::DataVector resultNested(gridSize);
+
+  upDown.setTaskCutoff(std::numeric_limits<size_t>::max());
+  upDown.mult(alpha, resultSequential);
+
+  upDown.setTaskCutoff(0);
+  upDown.mult(alpha, resultTasks);
+
+#pragma omp parallel
+  {
+#pragma omp single
+    upDown.mult(alpha, resultNested);
+  }
+
+  for (size_t i = 0; i < gridSize; i++) {
+    BOOST_CHECK_EQUAL(resultSequential[i], resultTasks[i]);
+    BOOST_CHECK_EQUAL(resultSequential[i], resultNested[i]);
+  }
+}
+
+void checkOperators(sgpp::base::Grid& grid) {
+  std::unique_ptr<sgpp::base::OperationMatrix> opLaplace(
+      sgpp::op_factory::createOperationLaplace(grid));
+  checkTaskParallelUpDown<sgpp::pde::UpDownOneOpDim>(opLaplace.get(), grid.getSize());
+
+  sgpp::base::DataVector coef(grid.getDimension());
+
+  for (size_t t = 0; t < grid.getDimension(); t++) {
+    coef[t] = (t % 2 == 0) ? 0.0 : static_cast<double>(t);
+  }
+
+  if (grid.getType() != sgpp::base::GridType::ModLinear) {
+    std::unique_ptr<sgpp::base::OperationMatrix> opLaplaceCoef(
+        sgpp::op_factory::createOperationLaplace(grid, coef));
+    checkTaskParallelUpDown<sgpp::pde::UpDownOneOpDim>(opLaplaceCoef.get(), grid.getSize());
+
+    std::unique_ptr<sgpp::base::OperationMatrix> opMass(
+        sgpp::op_factory::createOperationLTwoDotProduct(grid));
+    checkTaskParallelUpDown<sgpp::pde::StdUpDown>(opMass.get(), grid.getSize());
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testUpDown)
+
+BOOST_AUTO_TEST_CASE(testTaskParallelUpDownLinear) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(5));
+  grid->getGenerator().regular(4);
+  checkOperators(*grid);
+}
+
+BOOST_AUTO_TEST_CASE(testTaskParallelUpDownLinearBoundary) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearBoundaryGrid(4));
+  grid->getGenerator().regular(3);
+  checkOperators(*grid);
+}
+
+BOOST_AUTO_TEST_CASE(testTaskParallelUpDownModLinear) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createModLinearGrid(5));
+  grid->getGenerator().regular(4);
+  checkOperators(*grid);
+}
+
+BOOST_AUTO_TEST_CASE(testParallelLTwoDotModLinear) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createModLinearGrid(3));
+  grid->getGenerator().regular(4);
+  const size_t gridSize = grid->getSize();
+
+  sgpp::base::DataMatrix m(gridSize, gridSize);
+  std::unique_ptr<sgpp::base::OperationMatrix> opExplicit(
+      sgpp::op_factory::createOperationLTwoDotExplicit(&m, *grid));
+  std::unique_ptr<sgpp::base::OperationMatrix> opImplicit(
+      sgpp::op_factory::createOperationLTwoDotProduct(*grid));
+
+  sgpp::base::DataVector alpha = createAlpha(gridSize);
+  sgpp::base::DataVector resultExplicit(gridSize);
+  sgpp::base::DataVector resultImplicit(gridSize);
+  sgpp::base::DataVector resultRepeated(gridSize);
+
+  opExplicit->mult(alpha, resultExplicit);
+  opImplicit->mult(alpha, resultImplicit);
+  opImplicit->mult(alpha, resultRepeated);
+
+  for (size_t i = 0; i < gridSize; i++) {
+    BOOST_CHECK_SMALL(resultImplicit[i] - resultExplicit[i], 1e-12);
+    BOOST_CHECK_EQUAL(resultImplicit[i], resultRepeated[i]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
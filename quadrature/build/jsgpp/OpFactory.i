@@ -7,3 +7,6 @@
 
 %newobject sgpp::op_factory::createOperationQuadratureMCAdvanced(
     base::Grid& grid, size_t numberOfSamples, std::uint64_t seed);
+%newobject sgpp::op_factory::createOperationQuadratureQMC(
+    base::Grid& grid, size_t maxSamples, double tolerance, size_t numberOfRandomizations,
+    std::uint64_t seed);
@@ -10,6 +10,7 @@
 %include "quadrature/src/sgpp/quadrature/sampling/LatinHypercubeSampleGenerator.hpp"
 %include "quadrature/src/sgpp/quadrature/sampling/StratifiedSampleGenerator.hpp"
 %include "quadrature/src/sgpp/quadrature/sampling/HaltonSampleGenerator.hpp"
+%include "quadrature/src/sgpp/quadrature/sampling/SobolSampleGenerator.hpp"
 
 %include "OpFactory.i"
 
@@ -15,5 +15,14 @@ quadrature::OperationQuadratureMCAdvanced* createOperationQuadratureMCAdvanced(
   return new quadrature::OperationQuadratureMCAdvanced(grid, numberOfSamples, seed);
 }
 
+quadrature::OperationQuadratureQMC* createOperationQuadratureQMC(base::Grid& grid,
+                                                                size_t maxSamples,
+                                                                double tolerance,
+                                                                size_t numberOfRandomizations,
+                                                                std::uint64_t seed) {
+  return new quadrature::OperationQuadratureQMC(grid, maxSamples, tolerance,
+                                                numberOfRandomizations, seed);
+}
+
 }  // namespace op_factory
 }  // namespace sgpp
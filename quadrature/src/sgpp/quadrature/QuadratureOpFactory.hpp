@@ -11,6 +11,7 @@
  */
 
 #include <sgpp/quadrature/operation/hash/OperationQuadratureMCAdvanced.hpp>
+#include <sgpp/quadrature/operation/hash/OperationQuadratureQMC.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <random>
@@ -28,6 +29,19 @@ namespace op_factory {
 quadrature::OperationQuadratureMCAdvanced* createOperationQuadratureMCAdvanced(
     base::Grid& grid, size_t numberOfSamples, std::uint64_t seed = std::mt19937_64::default_seed);
 
+/**
+ * Creates an OperationQuadratureQMC.
+ *
+ * @param grid Reference to the grid object
+ * @param maxSamples Maximal number of samples of all randomizations together
+ * @param tolerance Requested tolerance of the error estimate, zero to use all samples
+ * @param numberOfRandomizations Number of independently scrambled Sobol sequences, at least 2
+ * @param seed Custom seed (defaults to default seed of mt19937_64)
+ */
+quadrature::OperationQuadratureQMC* createOperationQuadratureQMC(
+    base::Grid& grid, size_t maxSamples, double tolerance = 0.0,
+    size_t numberOfRandomizations = 16, std::uint64_t seed = std::mt19937_64::default_seed);
+
 }  // namespace op_factory
 }  // namespace sgpp
 
@@ -12,6 +12,7 @@
 #include <sgpp/quadrature/sampling/HaltonSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/LatinHypercubeSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/NaiveSampleGenerator.hpp>
+#include <sgpp/quadrature/sampling/SobolSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/StratifiedSampleGenerator.hpp>
 
 #include <cmath>
@@ -76,6 +77,22 @@ void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithHaltonSequences() {
   myGenerator = new sgpp::quadrature::HaltonSampleGenerator(dimensions);
 }
 
+void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithSobolSequences() {
+  if (myGenerator != nullptr) {
+    delete myGenerator;
+  }
+
+  myGenerator = new sgpp::quadrature::SobolSampleGenerator(dimensions);
+}
+
+void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithScrambledSobolSequences() {
+  if (myGenerator != nullptr) {
+    delete myGenerator;
+  }
+
+  myGenerator = new sgpp::quadrature::SobolSampleGenerator(dimensions, true, seed);
+}
+
 double OperationQuadratureMCAdvanced::doQuadrature(sgpp::base::DataVector& alpha) {
   sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
 
@@ -111,24 +128,20 @@ double OperationQuadratureMCAdvanced::doQuadratureL2Error(FUNC func, void* clien
   sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
   myGenerator->getSamples(dm);
 
-  double x;
-  double* p = new double[dimensions];
+  // evaluate the sparse grid function at all samples at once
+  sgpp::base::DataVector gridValues(numberOfSamples);
+  std::unique_ptr<sgpp::base::OperationMultipleEval>(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dm))
+      ->mult(alpha, gridValues);
 
-  sgpp::base::DataVector point(dimensions);
-  std::unique_ptr<sgpp::base::OperationEval> opEval(sgpp::op_factory::createOperationEval(*grid));
   double res = 0;
 
   for (size_t i = 0; i < numberOfSamples; i++) {
-    for (size_t d = 0; d < dimensions; d++) {
-      x = dm.get(i, d);
-      p[d] = x;
-      point[d] = x;
-    }
-    res += pow(
-        func(static_cast<int>(dimensions), p, clientdata) - opEval->eval(alpha, point), 2);
+    res += pow(func(static_cast<int>(dimensions), dm.getPointer() + i * dimensions, clientdata) -
+                   gridValues[i],
+               2);
   }
 
-  delete[] p;
   return sqrt(res / static_cast<double>(numberOfSamples));
 }
 
@@ -0,0 +1,150 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/quadrature/operation/hash/OperationQuadratureQMC.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/quadrature/sampling/SobolSampleGenerator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace quadrature {
+
+OperationQuadratureQMC::OperationQuadratureQMC(sgpp::base::Grid& grid, size_t maxSamples,
+                                               double tolerance, size_t numberOfRandomizations,
+                                               std::uint64_t seed)
+    : grid(&grid),
+      maxSamples(maxSamples),
+      tolerance(tolerance),
+      numberOfRandomizations(numberOfRandomizations),
+      seed(seed),
+      blockSize(1024),
+      errorEstimate(std::numeric_limits<double>::infinity()),
+      numberOfSamples(0) {
+  if (numberOfRandomizations < 2) {
+    throw sgpp::base::data_exception(
+        "OperationQuadratureQMC: at least two randomizations are required for the error estimate");
+  }
+}
+
+OperationQuadratureQMC::~OperationQuadratureQMC() {}
+
+double OperationQuadratureQMC::doQuadrature(sgpp::base::DataVector& alpha) {
+  return integrate([this, &alpha](sgpp::base::DataMatrix& points, sgpp::base::DataVector& values) {
+    std::unique_ptr<sgpp::base::OperationMultipleEval> opEval(
+        sgpp::op_factory::createOperationMultipleEval(*grid, points));
+    opEval->mult(alpha, values);
+  });
+}
+
+double OperationQuadratureQMC::doQuadratureFunc(FUNC func, void* clientdata) {
+  return integrate([func, clientdata](sgpp::base::DataMatrix& points,
+                                      sgpp::base::DataVector& values) {
+    const size_t dim = points.getNcols();
+
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      values[i] = func(static_cast<int>(dim), points.getPointer() + i * dim, clientdata);
+    }
+  });
+}
+
+double OperationQuadratureQMC::integrate(
+    const std::function<void(sgpp::base::DataMatrix&, sgpp::base::DataVector&)>& evaluate) {
+  const size_t dim = grid->getDimension();
+  const size_t numRand = numberOfRandomizations;
+  sgpp::base::BoundingBox& boundingBox = grid->getBoundingBox();
+
+  std::vector<std::unique_ptr<SobolSampleGenerator>> generators;
+
+  for (size_t r = 0; r < numRand; r++) {
+    generators.emplace_back(new SobolSampleGenerator(dim, true, seed + r));
+  }
+
+  // multiply with determinant of "unit cube -> BoundingBox" transformation
+  double determinant = 1.0;
+
+  for (size_t d = 0; d < dim; d++) {
+    determinant *= boundingBox.getIntervalWidth(d);
+  }
+
+  const size_t maxSamplesPerRandomization = std::max(maxSamples / numRand, size_t(1));
+  std::vector<double> sums(numRand, 0.0);
+  size_t samplesPerRandomization = 0;
+  double mean = 0.0;
+  errorEstimate = std::numeric_limits<double>::infinity();
+
+  while (samplesPerRandomization < maxSamplesPerRandomization) {
+    const size_t currentBlockSize =
+        std::min(blockSize, maxSamplesPerRandomization - samplesPerRandomization);
+
+    // the blocks of all randomizations are evaluated at once, the generators sample in parallel
+    sgpp::base::DataMatrix points(numRand * currentBlockSize, dim);
+    sgpp::base::DataMatrix block(currentBlockSize, dim);
+
+    for (size_t r = 0; r < numRand; r++) {
+      generators[r]->getSamples(block);
+      std::copy(block.getPointer(), block.getPointer() + block.getSize(),
+                points.getPointer() + r * block.getSize());
+    }
+
+    boundingBox.transformPointsToBoundingBox(points);
+
+    sgpp::base::DataVector values(points.getNrows());
+    evaluate(points, values);
+    samplesPerRandomization += currentBlockSize;
+
+    // the estimates of the randomizations are independent, so their standard error of the mean
+    // estimates the error of the mean
+    mean = 0.0;
+
+    for (size_t r = 0; r < numRand; r++) {
+      for (size_t i = 0; i < currentBlockSize; i++) {
+        sums[r] += values[r * currentBlockSize + i];
+      }
+
+      mean += sums[r];
+    }
+
+    mean /= static_cast<double>(numRand * samplesPerRandomization);
+    double variance = 0.0;
+
+    for (size_t r = 0; r < numRand; r++) {
+      const double diff = sums[r] / static_cast<double>(samplesPerRandomization) - mean;
+      variance += diff * diff;
+    }
+
+    variance /= static_cast<double>(numRand - 1);
+    errorEstimate = determinant * std::sqrt(variance / static_cast<double>(numRand));
+
+    if (errorEstimate <= tolerance) {
+      break;
+    }
+  }
+
+  numberOfSamples = numRand * samplesPerRandomization;
+  return mean * determinant;
+}
+
+void OperationQuadratureQMC::setBlockSize(size_t blockSize) {
+  if (blockSize == 0) {
+    throw sgpp::base::data_exception("OperationQuadratureQMC: the block size has to be positive");
+  }
+
+  this->blockSize = blockSize;
+}
+
+double OperationQuadratureQMC::getErrorEstimate() { return errorEstimate; }
+
+size_t OperationQuadratureQMC::getNumberOfSamples() { return numberOfSamples; }
+
+}  // namespace quadrature
+}  // namespace sgpp
@@ -0,0 +1,118 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONQUADRATUREQMC_HPP
+#define OPERATIONQUADRATUREQMC_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationQuadrature.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/quadrature/operation/hash/OperationQuadratureMCAdvanced.hpp>
+
+#include <functional>
+#include <random>
+
+namespace sgpp {
+namespace quadrature {
+
+/**
+ * Quadrature on any sparse grid (that has OperationMultipleEval implemented) using randomized
+ * quasi-Monte Carlo with scrambled Sobol sequences.
+ *
+ * Several independently scrambled Sobol sequences (randomizations) are sampled in blocks. The
+ * points of a block of all randomizations are evaluated at once with OperationMultipleEval. After
+ * each block, the error is estimated by the standard error of the mean of the independent
+ * estimates of the randomizations, and the integration stops as soon as the estimate is below the
+ * requested tolerance or the maximal number of samples is reached.
+ */
+class OperationQuadratureQMC : public sgpp::base::OperationQuadrature {
+ public:
+  /**
+   * @brief Constructor of OperationQuadratureQMC, specifying a grid object, the maximal number of
+   * samples and the requested tolerance.
+   *
+   * @param grid Reference to the grid object
+   * @param maxSamples Maximal number of samples of all randomizations together
+   * @param tolerance Requested tolerance of the error estimate, zero to use all samples
+   * @param numberOfRandomizations Number of independently scrambled sequences, at least 2
+   * @param seed Custom seed, randomization r uses seed + r (defaults to default seed of
+   * mt19937_64)
+   */
+  OperationQuadratureQMC(sgpp::base::Grid& grid, size_t maxSamples, double tolerance = 0.0,
+                         size_t numberOfRandomizations = 16,
+                         std::uint64_t seed = std::mt19937_64::default_seed);
+
+  /**
+   * Descructor
+   */
+  virtual ~OperationQuadratureQMC();
+
+  /**
+   * @brief Quadrature using randomized QMC in the bounding box of the grid.
+   *
+   * @param alpha Coefficient vector for current grid
+   */
+  virtual double doQuadrature(sgpp::base::DataVector& alpha);
+
+  /**
+   * @brief Quadrature of an arbitrary function using randomized QMC in the bounding box of the
+   * grid. The function is called sequentially, since it might not be thread-safe.
+   *
+   * @param func The function to integrate
+   * @param clientdata Optional data to pass to FUNC
+   */
+  double doQuadratureFunc(FUNC func, void* clientdata);
+
+  /**
+   * @param blockSize Number of samples per randomization and block (default 1024), powers of two
+   * retain the net property of the Sobol points
+   */
+  void setBlockSize(size_t blockSize);
+
+  /**
+   * @return Error estimate (standard error) of the last quadrature
+   */
+  double getErrorEstimate();
+
+  /**
+   * @return Number of samples of all randomizations used in the last quadrature
+   */
+  size_t getNumberOfSamples();
+
+ protected:
+  /**
+   * Samples the integrand until the error estimate is below the tolerance.
+   *
+   * @param evaluate Evaluates the integrand at all points (rows) of the given matrix
+   * @return Estimate of the integral
+   */
+  double integrate(
+      const std::function<void(sgpp::base::DataMatrix&, sgpp::base::DataVector&)>& evaluate);
+
+  // Pointer to the grid object
+  sgpp::base::Grid* grid;
+  // Maximal number of samples
+  size_t maxSamples;
+  // Requested tolerance of the error estimate
+  double tolerance;
+  // Number of independent randomizations
+  size_t numberOfRandomizations;
+  // seed of the first randomization
+  std::uint64_t seed;
+  // Number of samples per randomization and block
+  size_t blockSize;
+
+  // Error estimate of the last quadrature
+  double errorEstimate;
+  // Number of samples of the last quadrature
+  size_t numberOfSamples;
+};
+
+}  // namespace quadrature
+}  // namespace sgpp
+
+#endif /* OPERATIONQUADRATUREQMC_HPP */
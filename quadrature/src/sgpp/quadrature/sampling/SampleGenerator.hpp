@@ -54,7 +54,7 @@ class SampleGenerator {
    * @param samples provide a DataMatrix to hold the generated samples
    */
 
-  void getSamples(sgpp::base::DataMatrix& samples);
+  virtual void getSamples(sgpp::base::DataMatrix& samples);
 
   /**
    *
@@ -0,0 +1,121 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SOBOLSAMPLEGENERATOR_HPP
+#define SOBOLSAMPLEGENERATOR_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/quadrature/sampling/SampleGenerator.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace quadrature {
+
+/**
+ * Quasi-Monte Carlo sample generator for the Sobol sequence with the direction numbers of
+ * Joe and Kuo (new-joe-kuo-6.21201). The points are generated in Gray code order starting with
+ * the origin, hence the first 2^m points form a (t,m,s)-net in base 2. The sequence is limited
+ * to 2^32 points.
+ *
+ * Optionally, the sequence is randomized by a random linear matrix scrambling of the direction
+ * numbers followed by a random digital shift (Matousek). The scrambled points are uniformly
+ * distributed in the unit cube, keep the net property, and sequences with different seeds are
+ * independent randomizations, which allows for error estimates of QMC quadrature.
+ */
+class SobolSampleGenerator : public SampleGenerator {
+ public:
+  /// maximal number of dimensions with tabulated direction numbers
+  static const size_t maxDimensions = 128;
+
+  /**
+   * Standard constructor
+   *
+   * @param dimensions number of dimensions used for sample generation (at most maxDimensions)
+   * @param scrambled randomize the sequence by linear matrix scrambling and a digital shift
+   * @param seed custom seed for the scrambling (defaults to default seed of mt19937_64)
+   */
+  explicit SobolSampleGenerator(size_t dimensions, bool scrambled = false,
+                                std::uint64_t seed = std::mt19937_64::default_seed);
+
+  /**
+   * Destructor
+   */
+  ~SobolSampleGenerator();
+
+  /**
+   * This method generates the next point of the sequence.
+   * Implementation of the abstract Method getSample from SampleGenerator.
+   *
+   * @param sample DataVector storing the new generated sample vector.
+   */
+  virtual void getSample(sgpp::base::DataVector& sample);
+
+  /**
+   * Generates the next points of the sequence in parallel, each thread computes the first point
+   * of its block of rows directly and the following ones by the Gray code recursion.
+   * The result equals the one of repeated calls of getSample.
+   *
+   * @param samples provide a DataMatrix to hold the generated samples
+   */
+  virtual void getSamples(sgpp::base::DataMatrix& samples);
+
+  /**
+   * @return index of the point that is generated next
+   */
+  size_t getIndex();
+
+  /**
+   * Continues the sequence at the given index, e.g., to skip the origin of an unscrambled
+   * sequence.
+   *
+   * @param index index of the point that is generated next
+   */
+  void setIndex(size_t index);
+
+ private:
+  /// number of bits of the integer representation of the points
+  static const size_t numBits = 32;
+
+  /**
+   * Computes the integer representation of the point with the given index.
+   *
+   * @param index index of the point
+   * @param point array of size dimensions for the result
+   */
+  void computePoint(size_t index, std::uint32_t* point) const;
+
+  /**
+   * Writes the given point (shifted if the sequence is scrambled) as doubles in [0,1).
+   *
+   * @param point integer representation of the point
+   * @param sample array of size dimensions for the result
+   */
+  void toDouble(const std::uint32_t* point, double* sample) const;
+
+  /**
+   * Throws if points beyond the end of the sequence would be generated.
+   *
+   * @param end index after the last point to generate
+   */
+  void checkIndex(size_t end) const;
+
+  bool scrambled;
+  size_t index;
+  // direction numbers, the ones of dimension d are stored at [d * numBits, (d + 1) * numBits)
+  std::vector<std::uint32_t> directions;
+  // digital shift of the scrambling
+  std::vector<std::uint32_t> shift;
+  // integer representation of the point with the current index
+  std::vector<std::uint32_t> current;
+};
+
+}  // namespace quadrature
+}  // namespace sgpp
+
+#endif /* SOBOLSAMPLEGENERATOR_HPP */
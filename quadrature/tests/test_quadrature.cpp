@@ -32,14 +32,18 @@ std::string normalize_test_case_name(const_string name) {
 #include <sgpp/quadrature/QuadratureOpFactory.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <memory>
 #include <vector>
 
+using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::quadrature::HaltonSampleGenerator;
 using sgpp::quadrature::LatinHypercubeSampleGenerator;
 using sgpp::quadrature::NaiveSampleGenerator;
 using sgpp::quadrature::SampleGenerator;
+using sgpp::quadrature::SobolSampleGenerator;
 using sgpp::quadrature::StratifiedSampleGenerator;
 
 double f(DataVector x) {
@@ -82,11 +86,79 @@ BOOST_AUTO_TEST_CASE(testSamplers) {
   }
 
   StratifiedSampleGenerator pSSampler(blockSize);
+  SobolSampleGenerator pSobolSampler(dim);
+  SobolSampleGenerator pScrambledSobolSampler(dim, true, seed);
 
   testSampler(pNSampler, dim, numSamples, analyticResult, 5e-2);
   testSampler(pHSampler, dim, numSamples, analyticResult, 1e-3);
   testSampler(pLHSampler, dim, numSamples, analyticResult, 1e-3);
   testSampler(pSSampler, dim, numSamples, analyticResult, 1e-3);
+  testSampler(pSobolSampler, dim, numSamples, analyticResult, 1e-3);
+  testSampler(pScrambledSobolSampler, dim, numSamples, analyticResult, 1e-3);
+}
+
+BOOST_AUTO_TEST_CASE(testSobolSampleGenerator) {
+  // first points of the Sobol sequence with the direction numbers of Joe and Kuo
+  std::vector<std::vector<double>> expected = {
+      {0.0, 0.0, 0.0},       {0.5, 0.5, 0.5},       {0.75, 0.25, 0.25},   {0.25, 0.75, 0.75},
+      {0.375, 0.375, 0.625}, {0.875, 0.875, 0.125}, {0.625, 0.125, 0.875}, {0.125, 0.625, 0.375}};
+  SobolSampleGenerator sobol(3);
+  DataVector sample(3);
+
+  for (size_t i = 0; i < expected.size(); i++) {
+    sobol.getSample(sample);
+
+    for (size_t d = 0; d < 3; d++) {
+      BOOST_CHECK_EQUAL(sample[d], expected[i][d]);
+    }
+  }
+
+  size_t dim = 20;
+  size_t numSamples = 1024;
+  DataVector point(dim);
+
+  for (bool scrambled : {false, true}) {
+    // the blocks generated in parallel equal the sequence of single samples
+    SobolSampleGenerator sequential(dim, scrambled, 42);
+    SobolSampleGenerator blocked(dim, scrambled, 42);
+    DataMatrix samples(numSamples, dim);
+    blocked.getSample(point);
+    blocked.getSamples(samples);
+    sequential.getSample(point);
+    BOOST_CHECK_EQUAL(blocked.getIndex(), numSamples + 1);
+
+    for (size_t i = 0; i < numSamples; i++) {
+      sequential.getSample(point);
+
+      for (size_t d = 0; d < dim; d++) {
+        BOOST_CHECK_EQUAL(samples.get(i, d), point[d]);
+      }
+    }
+
+    // every interval of length 1 / numSamples contains one of the first numSamples points in
+    // each dimension, the scrambling retains this property
+    SobolSampleGenerator net(dim, scrambled, 42);
+    net.getSamples(samples);
+
+    for (size_t d = 0; d < dim; d++) {
+      std::vector<size_t> counts(numSamples, 0);
+
+      for (size_t i = 0; i < numSamples; i++) {
+        BOOST_CHECK(samples.get(i, d) >= 0.0 && samples.get(i, d) < 1.0);
+        counts[static_cast<size_t>(samples.get(i, d) * static_cast<double>(numSamples))]++;
+      }
+
+      BOOST_CHECK(std::all_of(counts.begin(), counts.end(), [](size_t c) { return c == 1; }));
+    }
+  }
+
+  // different seeds give different randomizations
+  SobolSampleGenerator first(dim, true, 1);
+  SobolSampleGenerator second(dim, true, 2);
+  DataVector otherPoint(dim);
+  first.getSample(point);
+  second.getSample(otherPoint);
+  BOOST_CHECK(point[0] != otherPoint[0]);
 }
 
 void testOperationQuadratureMCAdvanced(Grid& grid, DataVector& alpha,
@@ -112,6 +184,14 @@ void testOperationQuadratureMCAdvanced(Grid& grid, DataVector& alpha,
     case sgpp::quadrature::SamplerTypes::Halton:
       opQuad->useQuasiMonteCarloWithHaltonSequences();
       break;
+
+    case sgpp::quadrature::SamplerTypes::Sobol:
+      opQuad->useQuasiMonteCarloWithSobolSequences();
+      break;
+
+    case sgpp::quadrature::SamplerTypes::ScrambledSobol:
+      opQuad->useQuasiMonteCarloWithScrambledSobolSequences();
+      break;
   }
 
   double resMC = opQuad->doQuadrature(alpha);
@@ -151,4 +231,52 @@ BOOST_AUTO_TEST_CASE(testOperationMCAdvanced) {
                                     dim, numSamples, blockSize, analyticResult, 1e-3, seed);
   testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::Halton, dim,
                                     numSamples, blockSize, analyticResult, 1e-3, seed);
+  testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::Sobol, dim,
+                                    numSamples, blockSize, analyticResult, 1e-3, seed);
+  testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::ScrambledSobol,
+                                    dim, numSamples, blockSize, analyticResult, 1e-3, seed);
+}
+
+BOOST_AUTO_TEST_CASE(testOperationQuadratureQMC) {
+  size_t dim = 3;
+  size_t maxSamples = 1 << 22;
+  double analyticResult = std::pow(2. / 3., dim);
+  double tolerance = 1e-5;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createPolyGrid(dim, 2));
+  grid->getGenerator().regular(1);
+
+  DataVector alpha(1);
+  alpha[0] = 1.0;
+
+  std::unique_ptr<sgpp::quadrature::OperationQuadratureQMC> opQuad(
+      sgpp::op_factory::createOperationQuadratureQMC(*grid, maxSamples, tolerance, 8, 1234567));
+  double resQMC = opQuad->doQuadrature(alpha);
+
+  // the integration stops as soon as the error estimate is below the tolerance
+  BOOST_CHECK(opQuad->getErrorEstimate() <= tolerance);
+  BOOST_CHECK(opQuad->getNumberOfSamples() < maxSamples);
+  BOOST_CHECK_SMALL(resQMC - analyticResult, 10 * tolerance);
+
+  // the grid function equals f
+  double resFunc = opQuad->doQuadratureFunc(
+      [](int dim, double* x, void*) {
+        double res = 1.0;
+
+        for (int i = 0; i < dim; i++) {
+          res *= 4 * (1 - x[i]) * x[i];
+        }
+
+        return res;
+      },
+      nullptr);
+  BOOST_CHECK_CLOSE(resFunc, resQMC, 1e-10);
+
+  // without a tolerance, all samples are used
+  std::unique_ptr<sgpp::quadrature::OperationQuadratureQMC> opQuadFixed(
+      sgpp::op_factory::createOperationQuadratureQMC(*grid, 1000, 0.0, 4));
+  opQuadFixed->setBlockSize(64);
+  double resFixed = opQuadFixed->doQuadrature(alpha);
+  BOOST_CHECK_EQUAL(opQuadFixed->getNumberOfSamples(), static_cast<size_t>(1000));
+  BOOST_CHECK_SMALL(resFixed - analyticResult, 1e-2);
 }
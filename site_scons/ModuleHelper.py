@@ -24,6 +24,8 @@ class Module(object):
     self.cpps = []
     self.hpps = []
     self.objs = []
+    # objects of kernels compiled for more capable instruction sets than ARCH
+    self.kernelISAObjs = []
 
     # inject those variables in the module namespace
     # which were imported in the SConscript files, including env;
@@ -92,6 +94,23 @@ class Module(object):
       headerSourceList.append(hpp)
       headerDestList.append(hpp)
 
+  def compileForKernelISAs(self, cpps, isaNames=None):
+    """Compile the given kernel sources additionally for the instruction sets in
+    KERNEL_DISPATCH_ISAS (see USE_KERNEL_DISPATCH and sgpp::datadriven::KernelDispatch).
+    isaNames restricts the instruction sets, e.g., to ["avx"].
+    """
+    for isaName, isaLevel in env.get("KERNEL_DISPATCH_ISAS", []):
+      if (isaNames is not None) and (isaName not in isaNames): continue
+      # the sources are compiled with the flags of ARCH, only their kernels are compiled for
+      # the instruction set (between KernelTargetBegin.hpp and KernelTargetEnd.hpp), such that
+      # the inline functions of shared headers are not compiled for it
+      envClone = env.Clone()
+      envClone["CPPDEFINES"]["SGPP_KERNEL_TARGET_ISA_LEVEL"] = str(isaLevel)
+
+      for cpp in cpps:
+        target = os.path.splitext(cpp)[0] + "_" + isaName
+        self.kernelISAObjs.append(envClone.SharedObject(target=target, source=cpp))
+
   def buildLibrary(self):
     """Build the module.
     """
@@ -99,6 +118,8 @@ class Module(object):
     # name of the library to build
     self.libname = "sgpp" + moduleName
 
+    objs = self.objs + self.kernelISAObjs
+
     # change library names if we're linking statically
     if env["BUILD_STATICLIB"]:
       self.libname += "static"
@@ -115,13 +136,13 @@ class Module(object):
       libsuffix = env["LIBSUFFIX"]
       envClone = env.Clone()
       envClone.AppendUnique(LIBS=self.moduleDependencies + self.additionalDependencies)
-      self.lib = envClone.StaticLibrary(target=self.libname, source=self.objs)
+      self.lib = envClone.StaticLibrary(target=self.libname, source=objs)
     else:
       # build shared library
       libsuffix = env["SHLIBSUFFIX"]
       envClone = env.Clone()
       envClone.AppendUnique(LIBS=self.moduleDependencies + self.additionalDependencies)
-      self.lib = envClone.SharedLibrary(target=self.libname, source=self.objs)
+      self.lib = envClone.SharedLibrary(target=self.libname, source=objs)
 
     # set module dependencies
     for module in self.moduleDependencies:
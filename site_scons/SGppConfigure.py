@@ -62,6 +62,8 @@ def doConfigure(env, moduleFolders, languageWrapperFolders):
                              "Available configurations are:",
                              "gnu, clang, intel, openmpi, mpich, intel.mpi")
 
+  configureKernelDispatch(config)
+
   if config.env["COMPILER"] in ("openmpi", "mpich", "intel.mpi"):
     config.env["CPPDEFINES"]["USE_MPI"] = "1"
     config.env["USE_MPI"] = True # tells scons to build MPI related examples and operations
@@ -119,6 +121,7 @@ def doConfigure(env, moduleFolders, languageWrapperFolders):
   checkOpenCL(config)
   detectGSL(config)
   detectZlib(config)
+  detectZstd(config)
   detectScaLAPACK(config)
   checkDAKOTA(config)
   checkCGAL(config)
@@ -585,6 +588,29 @@ def configureClangCompiler(config):
     Helper.printErrorAndExit("You must specify a valid ARCH value for clang.",
                              "Available configurations are: sse3, sse4.2, avx, fma4, avx2, avx512")
 
+def configureKernelDispatch(config):
+  # instruction sets the vectorized MultiEval kernels are additionally compiled for,
+  # list of (name, level of sgpp::datadriven::KernelISA); the level is passed as
+  # SGPP_KERNEL_TARGET_ISA_LEVEL, such that only the kernels are compiled for the
+  # instruction set (see KernelTargetBegin.hpp)
+  config.env["KERNEL_DISPATCH_ISAS"] = []
+
+  if not config.env["USE_KERNEL_DISPATCH"]:
+    return
+
+  # the kernels are switched to the instruction set with #pragma GCC target
+  if config.env["COMPILER"] not in ("gnu", "openmpi", "mpich"):
+    Helper.printWarning("USE_KERNEL_DISPATCH is only supported for COMPILER=gnu, "
+                        "the kernels are only compiled for ARCH.")
+    config.env["USE_KERNEL_DISPATCH"] = False
+    return
+
+  archLevels = {"sse3" : 1, "sse42" : 1, "avx" : 2, "fma4" : 2, "avx2" : 3, "avx512" : 4}
+  kernelISAs = [("avx", 2), ("avx2", 3), ("avx512", 4)]
+  config.env["KERNEL_DISPATCH_ISAS"] = [(name, level) for name, level in kernelISAs
+                                        if level > archLevels[config.env["ARCH"]]]
+  config.env["CPPDEFINES"]["USE_KERNEL_DISPATCH"] = "1"
+
 def configureIntelCompiler(config):
   config.env.AppendUnique(CPPFLAGS=["-Wall", "-ansi", "-Wno-deprecated", "-wd1125",
                                     "-fno-strict-aliasing",
@@ -665,6 +691,16 @@ def detectZlib(config):
   else:
     Helper.printInfo("ZLIB support could not be enabled.")
 
+def detectZstd(config):
+  if config.CheckLib("zstd", language="c++", autoadd=0) and config.CheckCXXHeader("zstd.h"):
+    Helper.printInfo("zstd is installed, enabling ZSTD support.")
+    config.env["USE_ZSTD"] = True
+    config.env["CPPDEFINES"]["ZSTD"] = "1"
+  elif config.env["USE_ZSTD"]:
+    Helper.printErrorAndExit("USE_ZSTD is set but either libzstd or zstd.h is missing!")
+  else:
+    Helper.printInfo("ZSTD support could not be enabled.")
+
 def detectScaLAPACK(config):
   if "SCALAPACK_LIBRARY_PATH" in config.env:
     config.env.AppendUnique(LIBPATH=[config.env["SCALAPACK_LIBRARY_PATH"]])
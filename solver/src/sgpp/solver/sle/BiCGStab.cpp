@@ -6,7 +6,9 @@
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace sgpp {
 namespace solver {
@@ -119,5 +121,164 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
   }
 }
 
+void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+                     sgpp::base::DataMatrix& b, bool reuse, bool verbose, double max_threshold) {
+  this->nIterations = 1;
+  double epsilonSqd = this->myEpsilon * this->myEpsilon;
+
+  const size_t n = b.getNrows();
+  const size_t numRhs = b.getNcols();
+
+  if (reuse == false) {
+    // Choose x0
+    alpha.resizeZero(n, numRhs);
+    alpha.setAll(0.0);
+  }
+
+  // Calculate r0 for all right-hand sides with one batched multiplication
+  sgpp::base::DataMatrix batch(n, numRhs);
+  sgpp::base::DataMatrix batchResult(n, numRhs);
+  batch.copyFrom(alpha);
+  SystemMatrix.multBatch(batch, batchResult);
+
+  // temporal vectors, one per right-hand side
+  std::vector<sgpp::base::DataVector> x(numRhs, sgpp::base::DataVector(n));
+  std::vector<sgpp::base::DataVector> r(numRhs, sgpp::base::DataVector(n));
+  std::vector<sgpp::base::DataVector> rZero(numRhs, sgpp::base::DataVector(n));
+  std::vector<sgpp::base::DataVector> p(numRhs, sgpp::base::DataVector(n));
+  std::vector<sgpp::base::DataVector> s(numRhs, sgpp::base::DataVector(n));
+  std::vector<sgpp::base::DataVector> w(numRhs, sgpp::base::DataVector(n));
+  sgpp::base::DataVector column(n);
+
+  std::vector<double> delta_0(numRhs, 0.0);
+  std::vector<double> rho(numRhs, 0.0);
+  std::vector<double> a(numRhs, 0.0);
+  std::vector<double> delta(numRhs, 0.0);
+  std::vector<bool> active(numRhs, true);
+
+  for (size_t j = 0; j < numRhs; j++) {
+    alpha.getColumn(j, x[j]);
+    batchResult.getColumn(j, r[j]);
+    b.getColumn(j, column);
+    r[j].sub(column);
+
+    delta_0[j] = r[j].dotProduct(r[j]) * epsilonSqd;
+
+    // Choose r0 as r, set p as r0
+    rZero[j].copyFrom(r[j]);
+    p[j].copyFrom(r[j]);
+    rho[j] = rZero[j].dotProduct(r[j]);
+  }
+
+  if (verbose == true) {
+    std::cout << "max. delta_0 " << *std::max_element(delta_0.begin(), delta_0.end())
+              << std::endl;
+  }
+
+  // indices of the right-hand sides that have not converged yet
+  std::vector<size_t> activeRhs;
+
+  for (size_t j = 0; j < numRhs; j++) {
+    activeRhs.push_back(j);
+  }
+
+  this->residuum = 0.0;
+
+  while (this->nIterations < this->nMaxIterations && !activeRhs.empty()) {
+    // s = Ap
+    batch.resizeZero(n, activeRhs.size());
+    batchResult.resizeZero(n, activeRhs.size());
+
+    for (size_t k = 0; k < activeRhs.size(); k++) {
+      batch.setColumn(k, p[activeRhs[k]]);
+    }
+
+    SystemMatrix.multBatch(batch, batchResult);
+
+    for (size_t k = 0; k < activeRhs.size(); k++) {
+      const size_t j = activeRhs[k];
+      batchResult.getColumn(k, s[j]);
+
+      double sigma = s[j].dotProduct(rZero[j]);
+
+      if (fabs(sigma) == 0.0) {
+        active[j] = false;
+        continue;
+      }
+
+      a[j] = rho[j] / sigma;
+
+      // w = r - a*s
+      w[j].copyFrom(r[j]);
+      w[j].axpy((-1.0) * a[j], s[j]);
+    }
+
+    // v = Aw (columns of right-hand sides that stopped above are not used)
+    for (size_t k = 0; k < activeRhs.size(); k++) {
+      batch.setColumn(k, w[activeRhs[k]]);
+    }
+
+    SystemMatrix.multBatch(batch, batchResult);
+
+    for (size_t k = 0; k < activeRhs.size(); k++) {
+      const size_t j = activeRhs[k];
+
+      if (!active[j]) {
+        continue;
+      }
+
+      // column = v
+      batchResult.getColumn(k, column);
+
+      double omega = (column.dotProduct(w[j])) / (column.dotProduct(column));
+
+      // x = x - a*p - omega*w
+      x[j].axpy((-1.0) * a[j], p[j]);
+      x[j].axpy((-1.0) * omega, w[j]);
+
+      // r = r - a*s - omega*v
+      r[j].axpy((-1.0) * a[j], s[j]);
+      r[j].axpy((-1.0) * omega, column);
+
+      double rho_new = r[j].dotProduct(rZero[j]);
+      delta[j] = r[j].dotProduct(r[j]);
+
+      // Stop in case of better accuracy
+      if (delta[j] < delta_0[j] || delta[j] < max_threshold) {
+        active[j] = false;
+        continue;
+      }
+
+      double beta = (rho_new / rho[j]) * (a[j] / omega);
+      rho[j] = rho_new;
+
+      // p = r + beta*(p - omega*s)
+      p[j].axpy((-1.0) * omega, s[j]);
+      p[j].mult(beta);
+      p[j].add(r[j]);
+    }
+
+    this->residuum = *std::max_element(delta.begin(), delta.end());
+
+    if (verbose == true) {
+      std::cout << "max. delta: " << this->residuum << std::endl;
+    }
+
+    activeRhs.erase(std::remove_if(activeRhs.begin(), activeRhs.end(),
+                                   [&active](size_t j) { return !active[j]; }),
+                    activeRhs.end());
+
+    if (activeRhs.empty()) {
+      break;
+    }
+
+    this->nIterations++;
+  }
+
+  for (size_t j = 0; j < numRhs; j++) {
+    alpha.setColumn(j, x[j]);
+  }
+}
+
 }  // namespace solver
 }  // namespace sgpp
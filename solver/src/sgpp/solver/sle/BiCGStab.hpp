@@ -8,6 +8,7 @@
 
 #include <sgpp/solver/SLESolver.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -40,6 +41,26 @@ class BiCGStab : public SLESolver {
   virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
                      sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
                      double max_threshold = -1.0);
+
+  /**
+   * Solves the system for several right-hand sides at once (block solver). The BiCGStab
+   * recurrences of the right-hand sides are independent, but both matrix-vector products of an
+   * iteration are computed for all right-hand sides that have not converged yet in one
+   * base::OperationMatrix::multBatch call each.
+   *
+   * Afterwards, getNumberIterations returns the maximal number of iterations over all
+   * right-hand sides and getResiduum the maximal squared residual norm.
+   *
+   * @param SystemMatrix the system matrix
+   * @param alpha matrix whose columns are the solutions (and the start vectors if reuse is true)
+   * @param b matrix whose columns are the right-hand sides
+   * @param reuse use the columns of alpha as start vectors
+   * @param verbose print information
+   * @param max_threshold threshold for the squared residual norms of the right-hand sides
+   */
+  virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+                     sgpp::base::DataMatrix& b, bool reuse = false, bool verbose = false,
+                     double max_threshold = -1.0);
 };
 
 }  // namespace solver
@@ -10,7 +10,9 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <cstdio>
+#include <vector>
 
 namespace sgpp {
 namespace solver {
@@ -150,6 +152,193 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
   }
 }
 
+void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                               sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& b,
+                               bool reuse, bool verbose, double max_threshold) {
+  this->starting();
+
+  if (verbose == true) {
+    std::cout << "Starting block Conjugated Gradients" << std::endl;
+  }
+
+  const size_t n = b.getNrows();
+  const size_t numRhs = b.getNcols();
+
+  // needed for residuum calculation
+  double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  // number off current iterations
+  this->nIterations = 0;
+
+  if (reuse == false) {
+    alpha.resizeZero(n, numRhs);
+    alpha.setAll(0.0);
+  }
+
+  // define temporal vectors, one per right-hand side
+  std::vector<sgpp::base::DataVector> x(numRhs, sgpp::base::DataVector(n));
+  std::vector<sgpp::base::DataVector> r(numRhs, sgpp::base::DataVector(n));
+  std::vector<sgpp::base::DataVector> d(numRhs, sgpp::base::DataVector(n));
+  std::vector<sgpp::base::DataVector> rhs(numRhs, sgpp::base::DataVector(n));
+  sgpp::base::DataVector column(n);
+
+  std::vector<double> delta_0(numRhs, 0.0);
+  std::vector<double> delta_old(numRhs, 0.0);
+  std::vector<double> delta_new(numRhs, 0.0);
+  std::vector<double> a(numRhs, 0.0);
+  std::vector<bool> active(numRhs, true);
+
+  for (size_t j = 0; j < numRhs; j++) {
+    alpha.getColumn(j, x[j]);
+    b.getColumn(j, rhs[j]);
+
+    if (reuse == true) {
+      delta_0[j] = rhs[j].dotProduct(rhs[j]) * epsilonSquared;
+    }
+  }
+
+  // calculate the starting residua with one batched multiplication
+  sgpp::base::DataMatrix batch(n, numRhs);
+  sgpp::base::DataMatrix batchResult(n, numRhs);
+  batch.copyFrom(alpha);
+  SystemMatrix.multBatch(batch, batchResult);
+
+  for (size_t j = 0; j < numRhs; j++) {
+    batchResult.getColumn(j, column);
+    r[j].copyFrom(rhs[j]);
+    r[j].sub(column);
+    d[j].copyFrom(r[j]);
+    delta_new[j] = r[j].dotProduct(r[j]);
+
+    if (reuse == false) {
+      delta_0[j] = delta_new[j] * epsilonSquared;
+    }
+  }
+
+  // indices of the right-hand sides that have not converged yet
+  std::vector<size_t> activeRhs;
+
+  auto updateActive = [&]() {
+    activeRhs.clear();
+    this->residuum = 0.0;
+
+    for (size_t j = 0; j < numRhs; j++) {
+      active[j] = active[j] && (delta_new[j] > delta_0[j]) && (delta_new[j] > max_threshold);
+      this->residuum = std::max(this->residuum, delta_new[j]);
+
+      if (active[j]) {
+        activeRhs.push_back(j);
+      }
+    }
+  };
+
+  updateActive();
+  this->residuum = 0.0;
+
+  for (size_t j = 0; j < numRhs; j++) {
+    this->residuum = std::max(this->residuum, delta_0[j] / epsilonSquared);
+  }
+
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Number of right-hand sides: " << numRhs << std::endl;
+    std::cout << "Maximal starting norm of residuum: " << this->residuum << std::endl;
+  }
+
+  while ((this->nIterations < this->nMaxIterations) && !activeRhs.empty()) {
+    // q = A*d for all active right-hand sides at once
+    batch.resizeZero(n, activeRhs.size());
+    batchResult.resizeZero(n, activeRhs.size());
+
+    for (size_t k = 0; k < activeRhs.size(); k++) {
+      batch.setColumn(k, d[activeRhs[k]]);
+    }
+
+    SystemMatrix.multBatch(batch, batchResult);
+
+    bool recompute = (this->nIterations % 50) == 0 && this->nIterations > 0;
+
+    for (size_t k = 0; k < activeRhs.size(); k++) {
+      const size_t j = activeRhs[k];
+      batchResult.getColumn(k, column);
+
+      double dq = d[j].dotProduct(column);
+
+      if (dq == 0.0) {
+        active[j] = false;
+        continue;
+      }
+
+      // a = d_new / d.q
+      a[j] = delta_new[j] / dq;
+
+      // x = x + a*d
+      x[j].axpy(a[j], d[j]);
+
+      // r = r - a*q
+      r[j].axpy(-a[j], column);
+    }
+
+    if (recompute) {
+      // r = b - A*x, batched over the active right-hand sides
+      for (size_t k = 0; k < activeRhs.size(); k++) {
+        batch.setColumn(k, x[activeRhs[k]]);
+      }
+
+      SystemMatrix.multBatch(batch, batchResult);
+
+      for (size_t k = 0; k < activeRhs.size(); k++) {
+        const size_t j = activeRhs[k];
+
+        if (active[j]) {
+          batchResult.getColumn(k, column);
+          r[j].copyFrom(rhs[j]);
+          r[j].sub(column);
+        }
+      }
+    }
+
+    // calculate new deltas and determine beta
+    for (size_t j : activeRhs) {
+      if (!active[j]) {
+        continue;
+      }
+
+      delta_old[j] = delta_new[j];
+      delta_new[j] = r[j].dotProduct(r[j]);
+
+      d[j].mult(delta_new[j] / delta_old[j]);
+      d[j].add(r[j]);
+    }
+
+#ifdef X86_MIC_SYMMETRIC
+    MPI_Bcast(delta_new.data(), static_cast<int>(numRhs), MPI_DOUBLE, 0, MPI_COMM_WORLD);
+#endif
+
+    updateActive();
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "max. delta: " << this->residuum << ", active right-hand sides: "
+                << activeRhs.size() << std::endl;
+    }
+
+    this->nIterations++;
+  }
+
+  for (size_t j = 0; j < numRhs; j++) {
+    alpha.setColumn(j, x[j]);
+  }
+
+  this->complete();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Maximal final norm of residuum: " << this->residuum << std::endl;
+  }
+}
+
 void ConjugateGradients::starting() {}
 
 void ConjugateGradients::calcStarting() {}
@@ -7,6 +7,7 @@
 #define CONJUGATEGRADIENTS_HPP
 
 #include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -32,6 +33,27 @@ class ConjugateGradients : public SLESolver {
                      sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
                      double max_threshold = -1.0);
 
+  /**
+   * Solves the system for several right-hand sides at once (block solver). The CG recurrences
+   * of the right-hand sides are independent, but all search directions are multiplied with the
+   * system matrix in one base::OperationMatrix::multBatch call per iteration, so operators that
+   * implement multBatch traverse the grid only once for all right-hand sides. Right-hand sides
+   * that have converged are removed from the batch.
+   *
+   * Afterwards, getNumberIterations returns the maximal number of iterations and getResiduum the
+   * maximal squared residual norm over all right-hand sides.
+   *
+   * @param SystemMatrix the system matrix
+   * @param alpha matrix whose columns are the solutions (and the start vectors if reuse is true)
+   * @param b matrix whose columns are the right-hand sides
+   * @param reuse use the columns of alpha as start vectors
+   * @param verbose print information
+   * @param max_threshold threshold for the squared residual norms of the right-hand sides
+   */
+  virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+                     sgpp::base::DataMatrix& b, bool reuse = false, bool verbose = false,
+                     double max_threshold = -1.0);
+
   // Define functions for observer pattern in python
 
   /**
@@ -0,0 +1,155 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/BiCGStab.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+namespace {
+
+/**
+ * Dense test matrix that counts the (batched) multiplications.
+ */
+class DenseTestMatrix : public sgpp::base::OperationMatrix {
+ public:
+  explicit DenseTestMatrix(const DataMatrix& A) : A(A), numMult(0), numMultBatch(0) {}
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    numMult++;
+    A.mult(alpha, result);
+  }
+
+  void multBatch(DataMatrix& alpha, DataMatrix& result) override {
+    numMultBatch++;
+    result.resizeZero(A.getNrows(), alpha.getNcols());
+
+    for (size_t i = 0; i < A.getNrows(); i++) {
+      for (size_t j = 0; j < alpha.getNcols(); j++) {
+        double sum = 0.0;
+
+        for (size_t k = 0; k < A.getNcols(); k++) {
+          sum += A.get(i, k) * alpha.get(k, j);
+        }
+
+        result.set(i, j, sum);
+      }
+    }
+  }
+
+  DataMatrix A;
+  size_t numMult;
+  size_t numMultBatch;
+};
+
+DataMatrix createTestMatrix(size_t n, bool symmetric) {
+  DataMatrix A(n, n, 0.0);
+
+  for (size_t i = 0; i < n; i++) {
+    A.set(i, i, 4.0 + static_cast<double>(i % 3));
+
+    if (i + 1 < n) {
+      A.set(i, i + 1, -1.0);
+      A.set(i + 1, i, symmetric ? -1.0 : -0.5);
+    }
+  }
+
+  return A;
+}
+
+DataMatrix createRightHandSides(size_t n, size_t numRhs) {
+  DataMatrix B(n, numRhs);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < numRhs; j++) {
+      // the last right-hand side is zero and converges immediately
+      B.set(i, j, (j + 1 < numRhs) ? std::sin(static_cast<double>((i + 1) * (j + 1))) : 0.0);
+    }
+  }
+
+  return B;
+}
+
+template <class Solver>
+void checkBlockSolver(bool symmetric) {
+  const size_t n = 40;
+  const size_t numRhs = 5;
+  DenseTestMatrix op(createTestMatrix(n, symmetric));
+  DataMatrix B = createRightHandSides(n, numRhs);
+
+  Solver blockSolver(200, 1e-10);
+  DataMatrix X(n, numRhs);
+  blockSolver.solve(op, X, B);
+  BOOST_CHECK_EQUAL(op.numMult, 0);
+  BOOST_CHECK_GT(op.numMultBatch, 0);
+
+  size_t maxIterations = 0;
+
+  for (size_t j = 0; j < numRhs; j++) {
+    DataVector b(n);
+    DataVector x(n);
+    DataVector xBlock(n);
+    DataVector residual(n);
+    B.getColumn(j, b);
+    X.getColumn(j, xBlock);
+
+    Solver solver(200, 1e-10);
+    solver.solve(op, x, b);
+    maxIterations = std::max(maxIterations, solver.getNumberIterations());
+
+    op.A.mult(xBlock, residual);
+    residual.sub(b);
+    BOOST_CHECK_SMALL(residual.l2Norm(), 1e-8);
+
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_SMALL(x[i] - xBlock[i], 1e-12);
+    }
+  }
+
+  BOOST_CHECK_EQUAL(blockSolver.getNumberIterations(), maxIterations);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestBlockSolvers)
+
+BOOST_AUTO_TEST_CASE(testDefaultMultBatch) {
+  const size_t n = 10;
+  DataMatrix A = createTestMatrix(n, false);
+  DenseTestMatrix op(A);
+  DataMatrix X = createRightHandSides(n, 3);
+  DataMatrix expected(n, 3);
+  DataMatrix result(n, 3);
+
+  op.multBatch(X, expected);
+  op.sgpp::base::OperationMatrix::multBatch(X, result);
+  BOOST_CHECK_EQUAL(op.numMult, 3);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      BOOST_CHECK_SMALL(result.get(i, j) - expected.get(i, j), 1e-14);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testBlockConjugateGradients) {
+  checkBlockSolver<sgpp::solver::ConjugateGradients>(true);
+}
+
+BOOST_AUTO_TEST_CASE(testBlockBiCGStab) { checkBlockSolver<sgpp::solver::BiCGStab>(false); }
+
+BOOST_AUTO_TEST_SUITE_END()